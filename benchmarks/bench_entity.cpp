@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include "scenario.h"
+
+namespace symaware {
+
+/** Read the state of all the entities of the environment */
+void BM_EntityState(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i) scenario.addEntity();
+  scenario.initialise();
+  for (auto _ : state) {
+    for (const auto& entity : scenario.entities()) benchmark::DoNotOptimize(entity->state());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Read the state of all the entities of the environment, iterating over the registry of the environment */
+void BM_EnvironmentEntityState(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i) scenario.addEntity();
+  scenario.initialise();
+  for (auto _ : state) {
+    for (const auto& [name, entity] : scenario.environment().entities()) benchmark::DoNotOptimize(entity->state());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Add the entities to the environment one at a time */
+void BM_EnvironmentAddEntity(benchmark::State& state) {
+  std::vector<std::unique_ptr<Entity>> entities;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Environment environment;
+    entities.clear();
+    for (int64_t i = 0; i < state.range(0); ++i)
+      entities.push_back(std::make_unique<Entity>(i % 2 == 0 ? ObjectType::Audi_A8_Sedan : ObjectType::Cone));
+    state.ResumeTiming();
+    for (const auto& entity : entities) environment.addEntity(*entity);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Add the entities to the environment all at once */
+void BM_EnvironmentAddEntities(benchmark::State& state) {
+  std::vector<std::unique_ptr<Entity>> entities;
+  std::vector<Entity*> pointers;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Environment environment;
+    entities.clear();
+    pointers.clear();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      entities.push_back(std::make_unique<Entity>(i % 2 == 0 ? ObjectType::Audi_A8_Sedan : ObjectType::Cone));
+      pointers.push_back(entities.back().get());
+    }
+    state.ResumeTiming();
+    environment.addEntities(pointers);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Remove and add back all the entities of the environment, as done when resetting an episode */
+void BM_EnvironmentResetEntities(benchmark::State& state) {
+  Environment environment;
+  environment.setPooling(state.range(1) != 0);
+  std::vector<std::unique_ptr<Entity>> entities;
+  std::vector<Entity*> pointers;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    entities.push_back(std::make_unique<Entity>(i % 2 == 0 ? ObjectType::Audi_A8_Sedan : ObjectType::Cone));
+    pointers.push_back(entities.back().get());
+  }
+  environment.addEntities(pointers);
+  for (auto _ : state) {
+    for (Entity* const entity : pointers) environment.removeEntity(*entity);
+    environment.addEntities(pointers);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_EntityState)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_EnvironmentEntityState)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_EnvironmentAddEntity)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(BM_EnvironmentAddEntities)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(BM_EnvironmentResetEntities)->ArgsProduct({{10, 100, 1000}, {0, 1}});
+
+}  // namespace symaware
@@ -0,0 +1,24 @@
+#include <benchmark/benchmark.h>
+
+#include "scenario.h"
+
+namespace symaware {
+
+/** Update the state of the simulation from the input of each model of type @p T */
+template <class T>
+void BM_EntityModelUpdateState(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i) scenario.addEntity(makeModel<T>());
+  scenario.initialise();
+  for (auto _ : state) {
+    for (const auto& model : scenario.models()) model->step(&scenario.simulation());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_EntityModelUpdateState<CustomDynamicalModel>)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_EntityModelUpdateState<AmesimDynamicalModel>)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_EntityModelUpdateState<TrackModel>)->RangeMultiplier(10)->Range(1, 10000);
+
+}  // namespace symaware
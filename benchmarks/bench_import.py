@@ -0,0 +1,61 @@
+"""
+Measure the time it takes to import the Python bindings in a fresh interpreter,
+as short-lived worker processes do.
+
+Each case is run in a new process, so that nothing is cached between repetitions.
+- import: only import the package. The entity classes are created when first accessed;
+- import + 1 entity: import the package and access a single entity class;
+- import + all entities: import the package and access every entity class,
+  which is what importing the package used to do.
+
+Usage: python benchmarks/bench_import.py [--repeat N]
+"""
+
+import argparse
+import statistics
+import subprocess
+import sys
+
+CASES = {
+    "import": "import symaware.simulators.prescan",
+    "import + 1 entity": "from symaware.simulators.prescan import AudiA8SedanEntity",
+    "import + all entities": (
+        "import symaware.simulators.prescan as p\n"
+        "for name in p.entity_object_types():\n"
+        "    getattr(p, name)"
+    ),
+}
+
+TIMER = """
+import time
+start = time.perf_counter()
+{code}
+print(time.perf_counter() - start)
+"""
+
+
+def run(code: str, repeat: int) -> "list[float]":
+    times = []
+    for _ in range(repeat):
+        out = subprocess.run(
+            [sys.executable, "-c", TIMER.format(code=code)], check=True, capture_output=True, text=True
+        ).stdout
+        times.append(float(out.strip().splitlines()[-1]))
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--repeat", type=int, default=10, help="number of processes started for each case")
+    args = parser.parse_args()
+
+    # Warm up the bytecode cache, so that the first repetition does not pay for the compilation
+    run(CASES["import"], 1)
+    print(f"{'case':<24}{'min [ms]':>12}{'median [ms]':>14}")
+    for name, code in CASES.items():
+        times = run(code, args.repeat)
+        print(f"{name:<24}{min(times) * 1e3:>12.2f}{statistics.median(times) * 1e3:>14.2f}")
+
+
+if __name__ == "__main__":
+    main()
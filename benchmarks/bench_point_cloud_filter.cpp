@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "symaware/prescan/point_cloud_filter.h"
+#include "symaware/util/constants.h"
+
+namespace symaware {
+
+namespace {
+
+const Pose sensor_pose{12.5, -3.2, 1.8, 0, 0, 0.7};
+
+/**
+ * Scan of a spinning sensor 1.8 m above flat ground, with 32 rings and @p size points in total.
+ * The rays pointing down hit the ground, the others a wall 20 m away.
+ */
+struct Scan {
+  explicit Scan(const std::size_t size) : x(size), y(size), z(size) {
+    const std::size_t rings = 32, per_ring = size / rings;
+    for (std::size_t i = 0; i < size; ++i) {
+      const double azimuth = 2 * pi * static_cast<double>(i % per_ring) / per_ring;
+      const double elevation = -0.4 + 0.5 * static_cast<double>(i / per_ring) / rings;
+      const double range = elevation < -0.09 ? -1.8 / std::sin(elevation) : 20 / std::cos(elevation);
+      x[i] = range * std::cos(elevation) * std::cos(azimuth);
+      y[i] = range * std::cos(elevation) * std::sin(azimuth);
+      z[i] = range * std::sin(elevation);
+    }
+  }
+  std::vector<double> x, y, z;
+};
+
+}  // namespace
+
+/**
+ * Process a scan with the default setup.
+ * The argument is the number of points in the scan.
+ */
+void BM_PointCloudFilter(benchmark::State& state) {
+  const Scan scan{static_cast<std::size_t>(state.range(0))};
+  PointCloudFilter filter{};
+  for (auto _ : state) {
+    filter.process(sensor_pose, scan.x.data(), scan.y.data(), scan.z.data(), scan.x.size());
+    benchmark::DoNotOptimize(filter.points().data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  state.counters["kept"] = static_cast<double>(filter.size());
+  state.counters["ground"] = static_cast<double>(filter.groundSize());
+}
+
+/**
+ * Only downsample the scan, without looking for the ground.
+ * The first argument is the number of points in the scan, the second the side of the voxels in cm.
+ */
+void BM_PointCloudFilterDownsample(benchmark::State& state) {
+  const Scan scan{static_cast<std::size_t>(state.range(0))};
+  PointCloudFilter filter{PointCloudFilter::Setup{static_cast<double>(state.range(1)) / 100, 0}};
+  for (auto _ : state) {
+    filter.process(sensor_pose, scan.x.data(), scan.y.data(), scan.z.data(), scan.x.size());
+    benchmark::DoNotOptimize(filter.points().data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  state.counters["kept"] = static_cast<double>(filter.size());
+}
+
+BENCHMARK(BM_PointCloudFilter)->Arg(4096)->Arg(32768)->Arg(131072);
+BENCHMARK(BM_PointCloudFilterDownsample)->ArgsProduct({{4096, 32768, 131072}, {10, 20, 50}});
+
+}  // namespace symaware
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "symaware/prescan.h"
+
+namespace symaware {
+
+namespace {
+
+/**
+ * @brief JSON description of @p num_roads roads laid out on a grid.
+ *
+ * Each road has four sections, four lanes, a speed limit and a parking space.
+ * @param num_roads number of roads
+ * @return JSON description
+ */
+std::string makeDescription(const std::int64_t num_roads) {
+  std::string description = R"({"roads": [)";
+  for (std::int64_t i = 0; i < num_roads; ++i) {
+    description += fmt::format(
+        R"({{"position": [{}, {}, 0], "sections": [{{"type": "straight", "length": 100}},)"
+        R"({{"type": "spiral", "length": 20, "start_curvature": 0, "end_curvature": 0.01}},)"
+        R"({{"type": "arc", "length": 50, "curvature": 0.01}},)"
+        R"({{"type": "spiral", "length": 20, "start_curvature": 0.01, "end_curvature": 0}}],)"
+        R"("lanes": [{{"side": "left", "width": 3.5}}, {{"side": "left", "width": 3.5}},)"
+        R"({{"side": "right", "width": 3.5}}, {{"side": "right", "width": 3.5}}],)"
+        R"("speed_limits": [{{"value": 13.9}}],)"
+        R"("parking_spaces": [{{"length": 5, "width": 2.5, "offset": 10}}]}}{})",
+        200 * (i % 100), 200 * (i / 100), i + 1 < num_roads ? "," : "");
+  }
+  return description + "]}";
+}
+
+}  // namespace
+
+/** Build the roads by chaining the methods of each road, as done from Python */
+void BM_RoadBuilderChained(benchmark::State& state) {
+  using prescan::api::roads::types::RoadSideType;
+  for (auto _ : state) {
+    Environment environment;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      environment.addRoad(Position{200.0 * static_cast<double>(i % 100), 200.0 * static_cast<double>(i / 100), 0})
+          .addStraightSection(100)
+          .addSpiralSection(20, 0, 0.01)
+          .addCurveSection(50, 0.01)
+          .addSpiralSection(20, 0.01, 0)
+          .addLane(RoadSideType::RoadSideTypeLeft, 3.5)
+          .addLane(RoadSideType::RoadSideTypeLeft, 3.5)
+          .addLane(RoadSideType::RoadSideTypeRight, 3.5)
+          .addLane(RoadSideType::RoadSideTypeRight, 3.5)
+          .setSpeedLimitProfile(13.9)
+          .addParkingSpace(5, 2.5, 0, RoadSideType::RoadSideTypeLeft, 0, 10);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Build the roads from their JSON description */
+void BM_RoadBuilderJson(benchmark::State& state) {
+  const std::string description = makeDescription(state.range(0));
+  for (auto _ : state) {
+    Environment environment;
+    RoadBuilder builder{environment};
+    std::istringstream is{description};
+    benchmark::DoNotOptimize(builder.buildJson(is));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(description.size()));
+}
+
+/** Build the roads from their binary description */
+void BM_RoadBuilderBinary(benchmark::State& state) {
+  std::istringstream json{makeDescription(state.range(0))};
+  std::ostringstream os;
+  RoadBuilder::jsonToBinary(json, os);
+  const std::string description = os.str();
+  for (auto _ : state) {
+    Environment environment;
+    RoadBuilder builder{environment};
+    std::istringstream is{description};
+    benchmark::DoNotOptimize(builder.buildBinary(is));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(description.size()));
+}
+
+BENCHMARK(BM_RoadBuilderChained)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RoadBuilderJson)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RoadBuilderBinary)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+
+}  // namespace symaware
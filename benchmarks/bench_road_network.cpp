@@ -0,0 +1,226 @@
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/frenet_transform.h"
+#include "symaware/map/road_network.h"
+#include "symaware/map/router.h"
+
+namespace symaware {
+
+namespace {
+
+/**
+ * @brief OpenDRIVE document with @p num_roads parallel roads 30 m apart.
+ *
+ * Each road is 1 km long, made of a straight line, a spiral, an arc and another spiral,
+ * with two 3.5 m lanes on each side of the reference line.
+ * @param num_roads number of roads
+ * @return OpenDRIVE document
+ */
+std::string makeDocument(const std::int64_t num_roads) {
+  constexpr const char* lane = R"(<lane id="{}" type="driving"><width sOffset="0" a="3.5" b="0" c="0" d="0"/></lane>)";
+  std::string document = "<OpenDRIVE>";
+  for (std::int64_t i = 0; i < num_roads; ++i) {
+    // Chain the geometries of the road, reading the start of each one from the previous
+    ReferenceLine line;
+    line.addGeometry(ReferenceLine::Geometry::line(0, 0, 30.0 * static_cast<double>(i), 0, 400));
+    const auto next = [&line](const double length, const auto make) {
+      const ReferenceLine::Point point = line.point(line.end());
+      line.addGeometry(make(line.end(), point.x, point.y, point.heading, length));
+    };
+    next(200, [](double s, double x, double y, double h, double l) {
+      return ReferenceLine::Geometry::spiral(s, x, y, h, l, 0, 0.002);
+    });
+    next(200, [](double s, double x, double y, double h, double l) {
+      return ReferenceLine::Geometry::arc(s, x, y, h, l, 0.002);
+    });
+    next(200, [](double s, double x, double y, double h, double l) {
+      return ReferenceLine::Geometry::spiral(s, x, y, h, l, 0.002, 0);
+    });
+    document += fmt::format(R"(<road id="{}" length="{}" junction="-1"><planView>)", i, line.end());
+    for (const ReferenceLine::Geometry& geometry : line.geometries()) {
+      document += fmt::format(R"(<geometry s="{}" x="{}" y="{}" hdg="{}" length="{}">)", geometry.s, geometry.x,
+                              geometry.y, geometry.heading, geometry.length);
+      switch (geometry.type) {
+        case ReferenceLine::GeometryType::Line:
+          document += "<line/>";
+          break;
+        case ReferenceLine::GeometryType::Arc:
+          document += fmt::format(R"(<arc curvature="{}"/>)", geometry.parameters[0]);
+          break;
+        default:
+          document += fmt::format(R"(<spiral curvStart="{}" curvEnd="{}"/>)", geometry.parameters[0],
+                                  geometry.parameters[1]);
+      }
+      document += "</geometry>";
+    }
+    document += R"(</planView><lanes><laneSection s="0"><left>)";
+    document += fmt::format(lane, 2) + fmt::format(lane, 1);
+    document += "</left><right>" + fmt::format(lane, -1) + fmt::format(lane, -2);
+    document += "</right></laneSection></lanes></road>";
+  }
+  return document + "</OpenDRIVE>";
+}
+
+/** Points close to the reference lines of the roads of the network */
+std::vector<std::pair<double, double>> makePoints(const RoadNetwork& network, const std::size_t num_points) {
+  std::mt19937 generator{0};
+  std::uniform_int_distribution<std::size_t> road(0, network.roads().size() - 1);
+  std::uniform_real_distribution<double> s(0, 1000), t(-7, 7);
+  std::vector<std::pair<double, double>> points;
+  points.reserve(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const ReferenceLine::Point point = network.roads()[road(generator)].reference_line.point(s(generator));
+    const double offset = t(generator);
+    points.emplace_back(point.x - offset * std::sin(point.heading), point.y + offset * std::cos(point.heading));
+  }
+  return points;
+}
+
+/**
+ * @brief OpenDRIVE document with a chain of @p num_roads straight roads, each 100 m long and linked to the next one.
+ *
+ * Each road has two 3.5 m driving lanes on each side of the reference line.
+ * @param num_roads number of roads
+ * @return OpenDRIVE document
+ */
+std::string makeChain(const std::int64_t num_roads) {
+  constexpr const char* lane =
+      R"(<lane id="{0}" type="driving"><link><predecessor id="{0}"/><successor id="{0}"/></link>)"
+      R"(<width sOffset="0" a="3.5" b="0" c="0" d="0"/></lane>)";
+  std::string document = "<OpenDRIVE>";
+  for (std::int64_t i = 0; i < num_roads; ++i) {
+    document += fmt::format(R"(<road id="{}" length="100" junction="-1"><link>)", i);
+    if (i > 0) document += fmt::format(R"(<predecessor elementType="road" elementId="{}" contactPoint="end"/>)", i - 1);
+    if (i + 1 < num_roads)
+      document += fmt::format(R"(<successor elementType="road" elementId="{}" contactPoint="start"/>)", i + 1);
+    document += fmt::format(R"(</link><planView><geometry s="0" x="{}" y="0" hdg="0" length="100"><line/></geometry>)",
+                            100 * i);
+    document += R"(</planView><lanes><laneSection s="0"><left>)";
+    document += fmt::format(lane, 2) + fmt::format(lane, 1);
+    document += "</left><right>" + fmt::format(lane, -1) + fmt::format(lane, -2);
+    document += "</right></laneSection></lanes></road>";
+  }
+  return document + "</OpenDRIVE>";
+}
+
+}  // namespace
+
+/** Parse an OpenDRIVE document and build the lane graph and the spatial index */
+void BM_RoadNetworkImport(benchmark::State& state) {
+  const std::string document = makeDocument(state.range(0));
+  for (auto _ : state) {
+    RoadNetwork network;
+    network.importOpenDrive(document);
+    benchmark::DoNotOptimize(network.lanes().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(document.size()));
+}
+
+/** Locate points on the lanes of the network */
+void BM_RoadNetworkLocate(benchmark::State& state) {
+  RoadNetwork network;
+  network.importOpenDrive(makeDocument(state.range(0)));
+  const std::vector<std::pair<double, double>> points = makePoints(network, 1024);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto& [x, y] = points[i++ % points.size()];
+    benchmark::DoNotOptimize(network.locate(x, y));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** Route along a chain of roads, from the outer lane of the first one to the inner lane of the last one */
+void BM_RouterRoute(benchmark::State& state) {
+  RoadNetwork network;
+  network.importOpenDrive(makeChain(state.range(0)));
+  // Without a cache, every route is searched from scratch
+  Router router{network, 20, 20, 2, static_cast<std::size_t>(state.range(1))};
+  const double end = 100.0 * static_cast<double>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(router.route(5, -5.25, end - 5, -1.75));
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_RouterRoute)
+    ->ArgsProduct({{10, 100}, {0, 1024}})
+    ->ArgNames({"roads", "cache"})
+    ->Unit(benchmark::kMicrosecond);
+
+/** Reference line mixing all the geometries, about 1 km long */
+ReferenceLine makeReferenceLine() {
+  ReferenceLine line;
+  line.addLine(200)
+      .addSpiral(100, 0, 0.01)
+      .addArc(200, 0.01)
+      .addSpiral(100, 0.01, 0)
+      .addPoly3(200, 0, 0, 0.0005, -0.000001)
+      .addParamPoly3(200, {0, 1, 0, 0}, {0, 0, 0.001, 0}, false);
+  return line;
+}
+
+/** Sample a reference line one point at a time */
+void BM_ReferenceLinePoint(benchmark::State& state) {
+  const ReferenceLine line = makeReferenceLine();
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const double step = line.length() / static_cast<double>(n);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) benchmark::DoNotOptimize(line.point(step * static_cast<double>(i)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Sample a reference line in a single batch */
+void BM_ReferenceLineSample(benchmark::State& state) {
+  const ReferenceLine line = makeReferenceLine();
+  const auto n = static_cast<std::size_t>(state.range(0));
+  std::vector<double> s(n), x(n), y(n), heading(n), curvature(n);
+  for (std::size_t i = 0; i < n; ++i) s[i] = line.length() * static_cast<double>(i) / static_cast<double>(n);
+  for (auto _ : state) {
+    line.sample(s.data(), n, x.data(), y.data(), heading.data(), curvature.data());
+    benchmark::DoNotOptimize(x.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Transform the poses of many entities into Frenet coordinates, split across threads */
+void BM_FrenetTransform(benchmark::State& state) {
+  FrenetTransform transform{makeReferenceLine(), {3.5, 3.5}, {3.5, 3.5}};
+  transform.setThreads(static_cast<std::size_t>(state.range(1)));
+  const auto n = static_cast<std::size_t>(state.range(0));
+  std::mt19937 generator{0};
+  std::uniform_real_distribution<double> station{0, transform.reference_line().end()}, offset{-7, 7};
+  std::vector<double> poses;
+  for (std::size_t i = 0; i < n; ++i) {
+    const ReferenceLine::Point point = transform.reference_line().point(station(generator));
+    const double d = offset(generator);
+    poses.insert(poses.end(), {point.x - d * std::sin(point.heading), point.y + d * std::cos(point.heading), 0});
+  }
+  std::vector<double> s(n), d(n), heading_error(n);
+  std::vector<int> lane(n);
+  std::vector<std::size_t> road(n);
+  for (auto _ : state) {
+    transform.toFrenet(poses.data(), n, s.data(), d.data(), heading_error.data(), lane.data(), road.data());
+    benchmark::DoNotOptimize(s.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_FrenetTransform)
+    ->ArgsProduct({{100, 10000}, {1, 4}})
+    ->ArgNames({"entities", "threads"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_ReferenceLinePoint)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(BM_ReferenceLineSample)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(BM_RoadNetworkImport)->RangeMultiplier(10)->Range(1, 100)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RoadNetworkLocate)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace symaware
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include "scenario.h"
+
+namespace symaware {
+
+/**
+ * Decode the output of the sensors of type @p sensor_type.
+ * The first argument is the number of entities, each with one sensor,
+ * the second the number of detections in the output of each sensor.
+ */
+template <SensorType sensor_type>
+void BM_SensorUpdateState(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    scenario.addSensor(scenario.addEntity(), sensor_type, sensorSetup(sensor_type, state.range(1)));
+  scenario.initialise();
+  for (auto _ : state) {
+    for (const auto& sensor : scenario.sensors()) {
+      sensor->step(&scenario.simulation());
+      benchmark::DoNotOptimize(sensor->state().data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Access the already decoded output of the AIR sensors, which is cached until the next step */
+void BM_SensorCachedState(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    scenario.addSensor(scenario.addEntity(), SensorType::AIR, sensorSetup(SensorType::AIR, 8));
+  scenario.initialise();
+  for (const auto& sensor : scenario.sensors()) sensor->state();
+  for (auto _ : state) {
+    for (const auto& sensor : scenario.sensors()) benchmark::DoNotOptimize(sensor->state().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Track the objects detected by the AIR sensors in the world frame, instead of decoding their output.
+ * The first argument is the number of entities, each with one sensor,
+ * the second the number of detections in the output of each sensor.
+ */
+void BM_SensorTrackDetections(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    scenario.addSensor(scenario.addEntity(), SensorType::AIR, sensorSetup(SensorType::AIR, state.range(1)))
+        .setTrackTable(TrackTable::Setup{});
+  }
+  scenario.initialise();
+  for (auto _ : state) {
+    for (const auto& sensor : scenario.sensors()) {
+      sensor->step(&scenario.simulation());
+      benchmark::DoNotOptimize(sensor->trackTable()->x().data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SensorUpdateState<SensorType::AIR>)->ArgsProduct({{1, 10, 100, 1000, 10000}, {8, 64}});
+BENCHMARK(BM_SensorUpdateState<SensorType::BRS>)->ArgsProduct({{1, 10, 100, 1000, 10000}, {8, 64}});
+BENCHMARK(BM_SensorUpdateState<SensorType::LMS>)->ArgsProduct({{1, 10, 100, 1000, 10000}, {8, 64}});
+BENCHMARK(BM_SensorTrackDetections)->ArgsProduct({{1, 10, 100, 1000, 10000}, {8, 64}});
+BENCHMARK(BM_SensorCachedState)->RangeMultiplier(10)->Range(1, 10000);
+
+}  // namespace symaware
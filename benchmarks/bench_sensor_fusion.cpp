@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "symaware/prescan/sensor_fusion.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr double sample_time = 0.05;
+constexpr std::size_t frames = 256;
+
+/**
+ * Detections of @p size targets on a grid with 5 m spacing, each moving at its own constant velocity,
+ * as seen from the origin by a sensor measuring their positions and one measuring their bearings.
+ * The frames are stored one after the other.
+ */
+struct Scenario {
+  Scenario(const std::size_t size, const bool with_ids)
+      : size{size}, ids(size), x(size * frames), y(size * frames), bearing(size * frames) {
+    const std::size_t side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(size))));
+    for (std::size_t i = 0; i < size; ++i) {
+      ids[i] = with_ids ? static_cast<std::int32_t>(i) : -1;
+      const double x0 = 10 + 5.0 * static_cast<double>(i % side);
+      const double y0 = -25 + 5.0 * static_cast<double>(i / side);
+      const double vx = std::sin(static_cast<double>(i));
+      const double vy = std::cos(static_cast<double>(i));
+      for (std::size_t f = 0; f < frames; ++f) {
+        const double t = static_cast<double>(f) * sample_time;
+        x[f * size + i] = x0 + vx * t;
+        y[f * size + i] = y0 + vy * t;
+        bearing[f * size + i] = std::atan2(y[f * size + i], x[f * size + i]);
+      }
+    }
+  }
+  std::size_t size;
+  std::vector<std::int32_t> ids;
+  std::vector<double> x, y, bearing;
+};
+
+}  // namespace
+
+/**
+ * Step the fusion with the positions and the bearings of all the targets.
+ * The first argument is the number of targets, the second whether the detections carry the id of the targets.
+ * Without ids, the detections are associated to the tracks by gated nearest neighbour.
+ */
+void BM_SensorFusion(benchmark::State& state) {
+  const Scenario scenario{static_cast<std::size_t>(state.range(0)), state.range(1) != 0};
+  const std::size_t size = scenario.size;
+  const Position origin{0, 0, 0};
+  SensorFusion fusion{};
+  std::size_t frame = 0;
+  for (auto _ : state) {
+    if (frame == frames) {
+      fusion.clear();
+      frame = 0;
+    }
+    const std::size_t offset = frame++ * size;
+    fusion.predict(sample_time);
+    fusion.updatePositions(scenario.ids.data(), scenario.x.data() + offset, scenario.y.data() + offset, size);
+    fusion.updateBearings(origin, scenario.ids.data(), scenario.bearing.data() + offset, size);
+    benchmark::DoNotOptimize(fusion.tracks().data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  state.counters["tracks"] = static_cast<double>(fusion.size());
+}
+
+BENCHMARK(BM_SensorFusion)->ArgsProduct({{50, 200, 800}, {0, 1}});
+
+}  // namespace symaware
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "symaware/prescan/sensor_noise.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr std::size_t width = 6;
+
+/** @return @p size detections of an AIR sensor, spread in front of it */
+std::vector<double> detections(const std::size_t size) {
+  std::vector<double> values(size * width);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double x = static_cast<double>(i);
+    double* const row = values.data() + i * width;
+    row[0] = 5 + x * 0.01;
+    row[1] = -0.5 + static_cast<double>(i % 100) * 0.01;
+    row[2] = 0;
+    row[3] = x;
+    row[4] = 10;
+    row[5] = 0.1;
+  }
+  return values;
+}
+
+}  // namespace
+
+/**
+ * Corrupt the detections of an AIR sensor with all the stages of the noise.
+ * The first argument is the number of detections, the second the distribution of the noise.
+ */
+void BM_SensorNoise(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<double> exact = detections(size);
+  SensorNoise noise{SensorNoise::Setup{{0.1, 0.01, 0.01, 0, 0.1, 0.01},
+                                       static_cast<SensorNoise::Distribution>(state.range(1)),
+                                       {0.05, 0, 0, 0, 0, 0},
+                                       0.1,
+                                       2,
+                                       {0, -0.5, 0, -1, 0, -3.14},
+                                       {100, 0.5, 0, -1, 20, 3.14},
+                                       1,
+                                       1},
+                    width};
+  std::vector<double> values;
+  for (auto _ : state) {
+    values = exact;
+    noise.beginStep();
+    values.resize(noise.corrupt(values.data(), size) * width);
+    noise.addFalsePositives(values);
+    noise.delay(values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_SensorNoise)->ArgsProduct({{64, 1024, 16384}, {0, 1}});
+
+}  // namespace symaware
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include "scenario.h"
+
+namespace symaware {
+
+/** Step all the entities of the environment, each controlled by a model of type @p T */
+template <class T>
+void BM_SimulationModelStep(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i) scenario.addEntity(makeModel<T>());
+  scenario.initialise();
+  for (auto _ : state) scenario.model().step(&scenario.simulation());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Step all the entities of the environment, each with an AIR sensor whose output is decoded after the step */
+void BM_SimulationModelStepWithSensors(benchmark::State& state) {
+  Scenario scenario;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    scenario.addSensor(scenario.addEntity(makeModel<CustomDynamicalModel>()), SensorType::AIR,
+                       sensorSetup(SensorType::AIR, 8));
+  scenario.initialise();
+  for (auto _ : state) {
+    scenario.model().step(&scenario.simulation());
+    for (const auto& sensor : scenario.sensors()) benchmark::DoNotOptimize(sensor->state().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SimulationModelStep<CustomDynamicalModel>)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_SimulationModelStep<AmesimDynamicalModel>)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_SimulationModelStep<TrackModel>)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_SimulationModelStepWithSensors)->RangeMultiplier(10)->Range(1, 10000);
+
+}  // namespace symaware
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "symaware/map/spatial_hash.h"
+
+namespace symaware {
+
+namespace {
+
+/** Positions of @p count entities spread over a square with the density of a busy road scene */
+void makePositions(const std::int64_t count, std::vector<double>& x, std::vector<double>& y) {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> distribution{0, 20.0 * static_cast<double>(count) / 10};
+  x.resize(static_cast<std::size_t>(count));
+  y.resize(static_cast<std::size_t>(count));
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    x[i] = distribution(generator);
+    y[i] = distribution(generator) / 100;
+  }
+}
+
+}  // namespace
+
+/** Rebuild the index from the positions of the entities, as done at every step */
+void BM_SpatialHashBuild(benchmark::State& state) {
+  std::vector<double> x, y;
+  makePositions(state.range(0), x, y);
+  SpatialHash hash{10};
+  for (auto _ : state) {
+    hash.build(x, y);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Find the neighbours within 30 m of every entity */
+void BM_SpatialHashRadiusAll(benchmark::State& state) {
+  std::vector<double> x, y;
+  makePositions(state.range(0), x, y);
+  SpatialHash hash{static_cast<double>(state.range(1))};
+  hash.build(x, y);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < x.size(); ++i) benchmark::DoNotOptimize(hash.queryRadius(x[i], y[i], 30));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Find the neighbours within 30 m of every entity by comparing all the pairs, as a baseline */
+void BM_BruteForceRadiusAll(benchmark::State& state) {
+  std::vector<double> x, y;
+  makePositions(state.range(0), x, y);
+  std::vector<std::size_t> found;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      found.clear();
+      for (std::size_t j = 0; j < x.size(); ++j)
+        if ((x[j] - x[i]) * (x[j] - x[i]) + (y[j] - y[i]) * (y[j] - y[i]) <= 30 * 30) found.push_back(j);
+      benchmark::DoNotOptimize(found.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Find the 8 nearest neighbours of every entity */
+void BM_SpatialHashNearestAll(benchmark::State& state) {
+  std::vector<double> x, y;
+  makePositions(state.range(0), x, y);
+  SpatialHash hash{10};
+  hash.build(x, y);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < x.size(); ++i) benchmark::DoNotOptimize(hash.queryNearest(x[i], y[i], 8));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Find all the pairs of entities closer than 5 m */
+void BM_SpatialHashPairs(benchmark::State& state) {
+  std::vector<double> x, y;
+  makePositions(state.range(0), x, y);
+  SpatialHash hash{10};
+  hash.build(x, y);
+  for (auto _ : state) benchmark::DoNotOptimize(hash.queryPairs(5));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SpatialHashBuild)->RangeMultiplier(10)->Range(100, 10000)->Arg(5000);
+BENCHMARK(BM_SpatialHashRadiusAll)->ArgsProduct({{100, 1000, 5000, 10000}, {10, 30}});
+BENCHMARK(BM_BruteForceRadiusAll)->RangeMultiplier(10)->Range(100, 10000)->Arg(5000);
+BENCHMARK(BM_SpatialHashNearestAll)->RangeMultiplier(10)->Range(100, 10000)->Arg(5000);
+BENCHMARK(BM_SpatialHashPairs)->RangeMultiplier(10)->Range(100, 10000)->Arg(5000);
+
+}  // namespace symaware
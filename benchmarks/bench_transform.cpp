@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "symaware/prescan/transform.h"
+
+namespace symaware {
+
+namespace {
+
+const Pose sensor_pose{12.5, -3.2, 1.4, 0.01, -0.05, 0.7};
+
+/** Pseudo-random coordinates in a 100 m cube */
+std::vector<double> coordinates(const std::size_t size, const double step) {
+  std::vector<double> values(size);
+  for (std::size_t i = 0; i < size; ++i) values[i] = std::fmod(static_cast<double>(i) * step, 100.0) - 50;
+  return values;
+}
+
+void reportPoints(benchmark::State& state) {
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  state.SetLabel(avx2Transforms() ? "avx2" : "scalar");
+}
+
+}  // namespace
+
+/** Transform the points, stored as separate arrays of coordinates */
+void BM_TransformPoints(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<double> x = coordinates(size, 7.31), y = coordinates(size, 3.17), z = coordinates(size, 1.93);
+  std::vector<double> out_x(size), out_y(size), out_z(size);
+  for (auto _ : state) {
+    transformPoints(sensor_pose, x.data(), y.data(), z.data(), size, out_x.data(), out_y.data(), out_z.data());
+    benchmark::DoNotOptimize(out_x.data());
+    benchmark::ClobberMemory();
+  }
+  reportPoints(state);
+}
+
+/** Transform the points laid out like the state of an LMS sensor, with a curvature after each point */
+void BM_TransformStridedPoints(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<double> x = coordinates(size, 7.31), y = coordinates(size, 3.17), z = coordinates(size, 1.93);
+  std::vector<double> points(size * 4);
+  for (std::size_t i = 0; i < size; ++i) {
+    points[4 * i] = x[i];
+    points[4 * i + 1] = y[i];
+    points[4 * i + 2] = z[i];
+  }
+  std::vector<double> out(size * 3);
+  for (auto _ : state) {
+    transformPoints(sensor_pose, points.data(), size, 4, out.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  reportPoints(state);
+}
+
+/** Transform the points one at a time, computing the rotation of the pose every time */
+void BM_TransformPointByPoint(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<double> x = coordinates(size, 7.31), y = coordinates(size, 3.17), z = coordinates(size, 1.93);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) {
+      benchmark::DoNotOptimize(transformPoint(sensor_pose, Position{x[i], y[i], z[i]}));
+    }
+  }
+  reportPoints(state);
+}
+
+BENCHMARK(BM_TransformPoints)->Arg(64)->Arg(4096)->Arg(65536);
+BENCHMARK(BM_TransformStridedPoints)->Arg(64)->Arg(4096)->Arg(65536);
+BENCHMARK(BM_TransformPointByPoint)->Arg(64)->Arg(4096)->Arg(65536);
+
+}  // namespace symaware
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "symaware/prescan/type.h"
+
+namespace {
+/** Number of allocations performed by the whole program */
+std::atomic<std::int64_t> allocations{0};
+}  // namespace
+
+void* operator new(const std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* const ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc{};
+}
+void operator delete(void* const ptr) noexcept { std::free(ptr); }
+void operator delete(void* const ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace symaware {
+
+namespace {
+
+constexpr auto num_object_types = to_underlying(ObjectType::TrafficSignPole) + 1;
+
+/** Names of all the object types, in order */
+std::vector<std::string> objectTypeNames() {
+  std::vector<std::string> names;
+  for (auto i = 0; i < num_object_types; ++i) names.emplace_back(to_string_view(static_cast<ObjectType>(i)));
+  return names;
+}
+
+/** Report the number of allocations per conversion performed since @p start */
+void reportAllocations(benchmark::State& state, const std::int64_t start) {
+  const std::int64_t conversions = static_cast<std::int64_t>(state.iterations()) * num_object_types;
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations.load() - start) / static_cast<double>(conversions));
+  state.SetItemsProcessed(conversions);
+}
+
+}  // namespace
+
+/** Convert all the object types to their name, without copying it */
+void BM_ObjectTypeToStringView(benchmark::State& state) {
+  const std::int64_t start = allocations.load();
+  for (auto _ : state) {
+    for (auto i = 0; i < num_object_types; ++i) benchmark::DoNotOptimize(to_string_view(static_cast<ObjectType>(i)));
+  }
+  reportAllocations(state, start);
+}
+
+/** Convert all the object types to their name, copied in a std::string */
+void BM_ObjectTypeToString(benchmark::State& state) {
+  const std::int64_t start = allocations.load();
+  for (auto _ : state) {
+    for (auto i = 0; i < num_object_types; ++i) benchmark::DoNotOptimize(to_string(static_cast<ObjectType>(i)));
+  }
+  reportAllocations(state, start);
+}
+
+/** Convert the names of all the object types back to the object type with the perfect hash */
+void BM_ObjectTypeFromString(benchmark::State& state) {
+  const std::vector<std::string> names = objectTypeNames();
+  const std::int64_t start = allocations.load();
+  for (auto _ : state) {
+    for (const std::string& name : names) benchmark::DoNotOptimize(from_string<ObjectType>(name));
+  }
+  reportAllocations(state, start);
+}
+
+/** Convert the names of all the object types back to the object type, comparing them with every name in turn */
+void BM_ObjectTypeFromStringLinear(benchmark::State& state) {
+  const std::vector<std::string> names = objectTypeNames();
+  const std::int64_t start = allocations.load();
+  for (auto _ : state) {
+    for (const std::string& name : names) {
+      for (auto i = 0; i < num_object_types; ++i) {
+        if (to_string_view(static_cast<ObjectType>(i)) != name) continue;
+        benchmark::DoNotOptimize(i);
+        break;
+      }
+    }
+  }
+  reportAllocations(state, start);
+}
+
+BENCHMARK(BM_ObjectTypeToStringView);
+BENCHMARK(BM_ObjectTypeToString);
+BENCHMARK(BM_ObjectTypeFromString);
+BENCHMARK(BM_ObjectTypeFromStringLinear);
+
+}  // namespace symaware
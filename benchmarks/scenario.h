@@ -0,0 +1,130 @@
+/**
+ * @file scenario.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Scenario shared by the benchmarks
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <prescan/sim/ManualSimulation.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "symaware/prescan.h"
+#include "symaware/util/constants.h"
+
+namespace symaware {
+
+/**
+ * @brief Environment populated with entities laid out on a grid, ready to be simulated.
+ *
+ * The scenario owns all the objects it creates, so that their addresses stay valid for the whole benchmark.
+ * The simulation is driven manually, one step at a time, through the @ref SimulationModel of the environment.
+ */
+class Scenario {
+ public:
+  Scenario() : environment_{}, models_{}, sensors_{}, entities_{}, model_{environment_}, simulation_{&model_} {}
+
+  /**
+   * @brief Add a new entity to the environment.
+   * @param model model controlling the entity. If null, the entity will not be controlled
+   * @return new entity
+   */
+  Entity& addEntity(std::unique_ptr<EntityModel> model = nullptr) {
+    const double offset = 5.0 * static_cast<double>(entities_.size());
+    EntityModel* const model_ptr = model.get();
+    if (model != nullptr) models_.push_back(std::move(model));
+    entities_.push_back(std::make_unique<Entity>(
+        ObjectType::Audi_A8_Sedan,
+        Entity::Setup{Position{std::fmod(offset, 1000.0), std::floor(offset / 1000.0) * 5.0, 0},
+                      Orientation{0, 0, 0},
+                      Position{0, 0, 0},
+                      true,
+                      true,
+                      prescan::api::types::SensorDetectability::SensorDetectabilityDetectable},
+        model_ptr));
+    environment_.addEntity(*entities_.back());
+    return *entities_.back();
+  }
+  /**
+   * @brief Attach a new sensor to the @p entity.
+   * @param entity entity the sensor will be attached to
+   * @param sensor_type type of the sensor
+   * @param setup setup of the sensor
+   * @return new sensor
+   */
+  Sensor& addSensor(Entity& entity, const SensorType sensor_type, std::vector<double> setup) {
+    sensors_.push_back(std::make_unique<Sensor>(sensor_type, std::move(setup)));
+    entity.addSensor(*sensors_.back());
+    return *sensors_.back();
+  }
+
+  /**
+   * @brief Register the simulation units and initialise all the entities.
+   */
+  void initialise() { simulation_.initialize(environment_.experiment()); }
+
+  Environment& environment() { return environment_; }
+  SimulationModel& model() { return model_; }
+  prescan::sim::ManualSimulation& simulation() { return simulation_; }
+  const std::vector<std::unique_ptr<Entity>>& entities() const { return entities_; }
+  const std::vector<std::unique_ptr<EntityModel>>& models() const { return models_; }
+  const std::vector<std::unique_ptr<Sensor>>& sensors() const { return sensors_; }
+
+ private:
+  Environment environment_;                           ///< Environment the entities are added to
+  std::vector<std::unique_ptr<EntityModel>> models_;  ///< Models of the entities
+  std::vector<std::unique_ptr<Sensor>> sensors_;      ///< Sensors attached to the entities
+  std::vector<std::unique_ptr<Entity>> entities_;     ///< Entities in the environment
+  SimulationModel model_;                             ///< Model stepping all the entities
+  prescan::sim::ManualSimulation simulation_;         ///< Simulation driving the model
+};
+
+/**
+ * @brief Create a new active model of type @p T.
+ *
+ * Track models follow a straight path long enough not to be exhausted during the benchmark.
+ * @tparam T type of the model
+ * @return new model
+ */
+template <class T>
+std::unique_ptr<EntityModel> makeModel() {
+  if constexpr (std::is_same_v<T, TrackModel>) {
+    return std::make_unique<TrackModel>(TrackModel::Setup{false, true, {{0, 0, 0}, {1e6, 0, 0}}, 10, 0.1},
+                                        TrackModel::Input{});
+  } else {
+    return std::make_unique<T>();
+  }
+}
+
+/**
+ * @brief Setup of a sensor of the given @p sensor_type that will output up to @p num_detections values.
+ *
+ * AIR and BRS sensors detect up to @p num_detections of the objects around them, with a field of view wide enough
+ * to see most of the grid, while LMS sensors detect 4 lines of `num_detections / 4` points each.
+ * @param sensor_type type of the sensor
+ * @param num_detections number of detections in the output of the sensor
+ * @return setup of the sensor
+ */
+inline std::vector<double> sensorSetup(const SensorType sensor_type, const std::size_t num_detections) {
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  const auto detections = static_cast<double>(num_detections);
+  switch (sensor_type) {
+    case SensorType::AIR:
+      return {0, 0, 0, 0, 0, 0, nan, 2 * pi, detections, nan};
+    case SensorType::BRS:
+      return {0, 0, 0, 0, 0, 0, 3, 1, nan, detections, nan, nan};
+    case SensorType::LMS:
+      return {0, 0, 0, 0, 0, 0, nan, 4, std::ceil(detections / 4), nan, nan};
+    default:
+      return {};
+  }
+}
+
+}  // namespace symaware
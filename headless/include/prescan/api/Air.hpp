@@ -0,0 +1,35 @@
+/**
+ * @file Air.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan AIR sensor
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "prescan/api/types/SensorBase.hpp"
+
+namespace prescan::api::air {
+
+class AirSensor : public types::SensorBase {
+ public:
+  using SensorBase::SensorBase;
+  void setDetectionType(const types::DetectionType detection_type) { data_->detection_type = detection_type; }
+  void setFov(const double fov) { data_->fov = fov; }
+  void setMaxDetectableObjects(const std::int32_t max_detectable_objects) {
+    data_->max_detectable_objects = max_detectable_objects;
+  }
+  void setRange(const double range) { data_->range = range; }
+};
+
+inline AirSensor createAirSensor(const types::WorldObject& object) {
+  return types::createSensor<AirSensor>(object, "AIR");
+}
+inline std::vector<AirSensor> getAttachedAirSensors(const types::WorldObject& object) {
+  return types::getAttachedSensors<AirSensor>(object, "AIR");
+}
+
+}  // namespace prescan::api::air
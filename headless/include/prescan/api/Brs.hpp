@@ -0,0 +1,39 @@
+/**
+ * @file Brs.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan BRS sensor
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "prescan/api/types/SensorBase.hpp"
+
+namespace prescan::api::brs {
+
+class BrsSensor : public types::SensorBase {
+ public:
+  using SensorBase::SensorBase;
+  double fovHorizontal() const { return data_->fov_horizontal; }
+  std::int32_t resolutionX() const { return data_->resolution_x; }
+  void setFovHorizontal(const double fov) { data_->fov_horizontal = fov; }
+  void setFovVertical(const double fov) { data_->fov_vertical = fov; }
+  void setFrequency(const std::int32_t frequency) { data_->frequency = frequency; }
+  void setMaxDetectableObjects(const std::int32_t max_detectable_objects) {
+    data_->max_detectable_objects = max_detectable_objects;
+  }
+  void setResolutionX(const std::int32_t resolution) { data_->resolution_x = resolution; }
+  void setResolutionY(const std::int32_t resolution) { data_->resolution_y = resolution; }
+};
+
+inline BrsSensor createBrsSensor(const types::WorldObject& object) {
+  return types::createSensor<BrsSensor>(object, "BRS");
+}
+inline std::vector<BrsSensor> getAttachedBrsSensors(const types::WorldObject& object) {
+  return types::getAttachedSensors<BrsSensor>(object, "BRS");
+}
+
+}  // namespace prescan::api::brs
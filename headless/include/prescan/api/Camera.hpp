@@ -0,0 +1,46 @@
+/**
+ * @file Camera.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan camera sensor
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/types/SensorBase.hpp"
+
+namespace prescan::api::camera {
+
+class Imager {
+ public:
+  explicit Imager(std::shared_ptr<types::SensorData> data) : data_{std::move(data)} {}
+  void setWidth(const double width) { data_->imager_width = width; }
+  void setHeight(const double height) { data_->imager_height = height; }
+  void setResolutionX(const std::int32_t resolution) { data_->resolution_x = resolution; }
+  void setResolutionY(const std::int32_t resolution) { data_->resolution_y = resolution; }
+
+ private:
+  std::shared_ptr<types::SensorData> data_;
+};
+
+class CameraSensor : public types::SensorBase {
+ public:
+  using SensorBase::SensorBase;
+  Imager imager() { return Imager{data_}; }
+  void setFocalLength(const double focal_length) { data_->focal_length = focal_length; }
+  void setImageFormat(const ImageFormat image_format) { data_->image_format = image_format; }
+};
+
+inline CameraSensor createCameraSensor(const types::WorldObject& object) {
+  return types::createSensor<CameraSensor>(object, "CAMERA");
+}
+inline std::vector<CameraSensor> getAttachedCameraSensors(const types::WorldObject& object) {
+  return types::getAttachedSensors<CameraSensor>(object, "CAMERA");
+}
+
+}  // namespace prescan::api::camera
@@ -0,0 +1,10 @@
+/**
+ * @file Experiment.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan experiment module
+ */
+#pragma once
+
+#include "prescan/api/experiment/Experiment.hpp"
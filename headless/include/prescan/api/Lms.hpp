@@ -0,0 +1,34 @@
+/**
+ * @file Lms.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan LMS sensor
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "prescan/api/types/SensorBase.hpp"
+
+namespace prescan::api::lms {
+
+class LmsSensor : public types::SensorBase {
+ public:
+  using SensorBase::SensorBase;
+  void setFovHorizontal(const double fov) { data_->fov_horizontal = fov; }
+  void setMaxLines(const std::int32_t max_lines) { data_->max_lines = max_lines; }
+  void setMaxPointsPerLine(const std::int32_t max_points_per_line) { data_->max_points_per_line = max_points_per_line; }
+  void setPointSpacing(const double point_spacing) { data_->point_spacing = point_spacing; }
+  void setRange(const double range) { data_->range = range; }
+};
+
+inline LmsSensor createLmsSensor(const types::WorldObject& object) {
+  return types::createSensor<LmsSensor>(object, "LMS");
+}
+inline std::vector<LmsSensor> getAttachedLmsSensors(const types::WorldObject& object) {
+  return types::getAttachedSensors<LmsSensor>(object, "LMS");
+}
+
+}  // namespace prescan::api::lms
@@ -0,0 +1,19 @@
+/**
+ * @file Opendrive.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan OpenDRIVE importer
+ */
+#pragma once
+
+#include <string>
+
+#include "prescan/api/experiment/Experiment.hpp"
+
+namespace prescan::api::opendrive {
+
+/** The headless backend does not build any road: importing a network is a no-op */
+inline void importOpenDriveFile(experiment::Experiment&, const std::string&) {}
+
+}  // namespace prescan::api::opendrive
@@ -0,0 +1,99 @@
+/**
+ * @file Roads.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan roads
+ *
+ * Only the length of the road is tracked. Lanes, parking spaces and appearance settings are accepted and ignored.
+ */
+#pragma once
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api::roads::types {
+
+enum RoadSideType { RoadSideTypeLeft, RoadSideTypeRight };
+enum LaneType { LaneTypeDriving, LaneTypeBiking, LaneTypeSideWalk };
+enum LaneSideType { LaneSideTypeInner, LaneSideTypeOuter };
+enum ParameterRange { ParamPolyRangeTypeArcLength, ParamPolyRangeTypeNormalized };
+enum TrafficSide { TrafficSideTypeLeftHandTraffic, TrafficSideTypeRightHandTraffic };
+enum AsphaltType { AsphaltTypeStandard, AsphaltTypeSingleColor, AsphaltTypeColoredTexture };
+enum AsphaltTone { AsphaltToneStandard, AsphaltToneLight, AsphaltToneLighter, AsphaltToneDark, AsphaltToneDarker };
+
+class Lane {
+ public:
+  void setType(LaneType) {}
+};
+
+class RoadCoordinates {
+ public:
+  void setRoadSide(RoadSideType) {}
+  void setSideOffset(double) {}
+  void setSOffset(double) {}
+};
+
+class ParkingSpace {
+ public:
+  RoadCoordinates& roadCoordinates() { return road_coordinates_; }
+  void setAsRectangle(double, double) {}
+  void setYaw(double) {}
+
+ private:
+  RoadCoordinates road_coordinates_;
+};
+
+class SpeedLimitProfile {
+ public:
+  void setValue(double, double, double) {}
+};
+
+class Color {
+ public:
+  void setRGB(double, double, double) {}
+};
+
+class Asphalt {
+ public:
+  Color& color() { return color_; }
+  void setType(AsphaltType) {}
+  void setTextureScale(double) {}
+  void setTone(AsphaltTone) {}
+
+ private:
+  Color color_;
+};
+
+class Road {
+ public:
+  void addArcSection(const double length, double) { length_ += length; }
+  void addCubicPolynomialSection(const double length, double, double, double, double) { length_ += length; }
+  void addParametricCubicPolynomialSection(const double length, double, double, double, double, double, double,
+                                           double, double, ParameterRange) {
+    length_ += length;
+  }
+  void addSpiralSection(const double length, double, double) { length_ += length; }
+  void addStraightSection(const double length) { length_ += length; }
+  Lane addLane(RoadSideType, double, double, double) { return Lane{}; }
+  ParkingSpace addParkingSpace() { return ParkingSpace{}; }
+  SpeedLimitProfile& speedLimitProfile() { return speed_limit_profile_; }
+  void setTrafficSide(TrafficSide) {}
+  Asphalt& asphalt() { return asphalt_; }
+  api::types::Pose& pose() { return pose_; }
+  double length() const { return length_; }
+
+ private:
+  double length_{0};
+  SpeedLimitProfile speed_limit_profile_;
+  Asphalt asphalt_;
+  api::types::Pose pose_;
+};
+
+}  // namespace prescan::api::roads::types
+
+namespace prescan::api::roads {
+
+inline types::Road createRoad(experiment::Experiment&) { return types::Road{}; }
+
+}  // namespace prescan::api::roads
@@ -0,0 +1,111 @@
+/**
+ * @file Trajectory.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan trajectories
+ *
+ * Paths are polylines through the fitted points, speed profiles have a constant speed.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api::trajectory {
+
+class Path {
+ public:
+  Path() = default;
+  Path(std::vector<double> x, std::vector<double> y, std::vector<double> z)
+      : x_{std::move(x)}, y_{std::move(y)}, z_{std::move(z)}, distances_(x_.size(), 0.0) {
+    for (std::size_t i = 1; i < x_.size(); ++i)
+      distances_[i] = distances_[i - 1] + std::hypot(x_[i] - x_[i - 1], y_[i] - y_[i - 1], z_[i] - z_[i - 1]);
+  }
+
+  double length() const { return distances_.empty() ? 0.0 : distances_.back(); }
+  /**
+   * @brief Pose of the point of the path at the given @p distance from its start.
+   * @param distance distance along the path, clamped to [0, length]
+   * @return pose of the point, with the yaw tangent to the path
+   */
+  types::Pose poseAtDistance(const double distance) const {
+    types::Pose pose;
+    if (x_.empty()) return pose;
+    if (x_.size() == 1) {
+      pose.position().setXYZ(x_[0], y_[0], z_[0]);
+      return pose;
+    }
+    const auto it = std::upper_bound(distances_.begin(), distances_.end(), distance);
+    std::size_t segment = it == distances_.begin() ? 0 : static_cast<std::size_t>(it - distances_.begin()) - 1;
+    segment = std::min(segment, distances_.size() - 2);
+    const double segment_length = distances_[segment + 1] - distances_[segment];
+    const double t =
+        segment_length > 0 ? std::clamp((distance - distances_[segment]) / segment_length, 0.0, 1.0) : 0.0;
+    pose.position().setXYZ(x_[segment] + t * (x_[segment + 1] - x_[segment]),
+                           y_[segment] + t * (y_[segment + 1] - y_[segment]),
+                           z_[segment] + t * (z_[segment + 1] - z_[segment]));
+    pose.orientation().setYaw(std::atan2(y_[segment + 1] - y_[segment], x_[segment + 1] - x_[segment]));
+    return pose;
+  }
+
+ private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<double> distances_;  ///< Cumulative distance of each point from the start of the path
+};
+
+class SpeedProfile {
+ public:
+  SpeedProfile() = default;
+  explicit SpeedProfile(const double speed) : speed_{speed} {}
+  double speed() const { return speed_; }
+
+ private:
+  double speed_{0};
+};
+
+struct TrajectoryData {
+  Path path;
+  SpeedProfile speed_profile;
+};
+
+class Trajectory {
+ public:
+  Trajectory() = default;
+  explicit Trajectory(std::shared_ptr<TrajectoryData> data) : data_{std::move(data)} {}
+  const Path& path() const { return data_->path; }
+  const SpeedProfile& speedProfile() const { return data_->speed_profile; }
+
+ private:
+  std::shared_ptr<TrajectoryData> data_;
+};
+
+inline Path createFittedPath(experiment::Experiment&, const std::vector<double>& x, const std::vector<double>& y,
+                             const std::vector<double>& z, double) {
+  return Path{x, y, z};
+}
+inline SpeedProfile createSpeedProfileOfConstantSpeed(experiment::Experiment&, const double speed) {
+  return SpeedProfile{speed};
+}
+inline Trajectory createTrajectory(const types::WorldObject& object, const Path& path,
+                                   const SpeedProfile& speed_profile) {
+  object.data().trajectory = std::make_shared<TrajectoryData>(TrajectoryData{path, speed_profile});
+  return Trajectory{object.data().trajectory};
+}
+/** @throw std::runtime_error if the @p object has no trajectory */
+inline Trajectory getActiveTrajectory(const types::WorldObject& object) {
+  if (object.data().trajectory == nullptr) throw std::runtime_error("No trajectory attached to " + object.name());
+  return Trajectory{object.data().trajectory};
+}
+
+}  // namespace prescan::api::trajectory
@@ -0,0 +1,10 @@
+/**
+ * @file Vehicledynamics.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan vehicle dynamics module
+ */
+#pragma once
+
+#include "prescan/api/vehicledynamics/AmesimPreconfiguredDynamics.hpp"
@@ -0,0 +1,58 @@
+/**
+ * @file Viewer.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan viewer
+ *
+ * There is nothing to render in the headless backend: viewers only keep their window settings.
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/api/types/WindowSettings.hpp"
+
+namespace prescan::api::viewer {
+
+class Viewer {
+ public:
+  Viewer(experiment::Experiment experiment, std::shared_ptr<types::WindowSettingsData> window_settings)
+      : experiment_{std::move(experiment)}, window_settings_{std::move(window_settings)} {}
+  void assignFreeCamera() {}
+  void remove() {
+    std::vector<std::shared_ptr<types::WindowSettingsData>>& viewers = experiment_.data().viewers;
+    viewers.erase(std::remove(viewers.begin(), viewers.end(), window_settings_), viewers.end());
+  }
+  types::WindowSettings windowSettings() const { return types::WindowSettings{window_settings_}; }
+
+ private:
+  experiment::Experiment experiment_;
+  std::shared_ptr<types::WindowSettingsData> window_settings_;
+};
+
+class Viewers {
+ public:
+  explicit Viewers(std::vector<Viewer> viewers) : viewers_{std::move(viewers)} {}
+  std::vector<Viewer> asVector() const { return viewers_; }
+
+ private:
+  std::vector<Viewer> viewers_;
+};
+
+inline Viewer createViewer(experiment::Experiment& experiment) {
+  experiment.data().viewers.push_back(std::make_shared<types::WindowSettingsData>());
+  return Viewer{experiment, experiment.data().viewers.back()};
+}
+inline Viewers getViewers(experiment::Experiment& experiment) {
+  std::vector<Viewer> viewers;
+  for (const std::shared_ptr<types::WindowSettingsData>& window_settings : experiment.data().viewers)
+    viewers.emplace_back(experiment, window_settings);
+  return Viewers{std::move(viewers)};
+}
+
+}  // namespace prescan::api::viewer
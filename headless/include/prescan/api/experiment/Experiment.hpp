@@ -0,0 +1,211 @@
+/**
+ * @file Experiment.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan experiment
+ *
+ * The experiment is the world of the headless backend: it owns the objects and their kinematic state.
+ * Saving and loading are not supported: saved experiments are not written to disk
+ * and loaded ones start empty.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/types/WindowSettings.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api {
+
+namespace types {
+
+enum SkyLightPollution {
+  SkyLightPollutionNone,
+  SkyLightPollutionDarkSite,
+  SkyLightPollutionRural,
+  SkyLightPollutionRuralSuburban,
+  SkyLightPollutionSuburban,
+  SkyLightPollutionBrightSuburban,
+  SkyLightPollutionSuburbanUrban,
+  SkyLightPollutionCity,
+  SkyLightPollutionInnerCity,
+};
+
+enum SimulationSpeed {
+  SimulationSpeedAsFastAsPossible,
+  SimulationSpeedHalfWallClockTime,
+  SimulationSpeedQuarterWallClockTime,
+  SimulationSpeedWallClockTime,
+};
+
+}  // namespace types
+
+namespace experiment {
+
+struct ExperimentData {
+  std::vector<std::shared_ptr<types::WorldObjectData>> objects;  ///< Objects in order of creation, indexed by id
+  std::unordered_map<std::string, std::shared_ptr<types::WorldObjectData>> objects_by_name;
+  std::unordered_map<std::string, std::size_t> type_counts;
+  std::int32_t simulation_frequency{20};
+  std::int32_t integration_frequency{20};
+  types::SimulationSpeed simulation_speed{types::SimulationSpeedAsFastAsPossible};
+  bool ignore_frame_overrun{false};
+  bool is_raining{false};
+  bool is_snowing{false};
+  bool is_fog_enabled{false};
+  double fog_visibility{0};
+  int sky_preset{0};
+  types::SkyLightPollution light_pollution{types::SkyLightPollutionNone};
+  std::vector<std::shared_ptr<types::WindowSettingsData>> viewers;  ///< Window settings of each viewer
+
+  /**
+   * @brief Reset the kinematic state of all the objects.
+   *
+   * The velocity of the objects with vehicle dynamics is their initial velocity along their heading,
+   * while all the other objects start still.
+   */
+  void resetKinematics();
+  /**
+   * @brief Update the kinematic state of all the objects after they have moved for @p dt seconds.
+   *
+   * Velocities and yaw rates are the finite differences between the current and the previous poses.
+   * @param dt time elapsed since the previous update, in seconds
+   */
+  void updateKinematics(double dt);
+};
+
+}  // namespace experiment
+
+namespace types {
+
+class Precipitation {
+ public:
+  explicit Precipitation(std::shared_ptr<experiment::ExperimentData> data) : data_{std::move(data)} {}
+  void setDisabled() { data_->is_raining = data_->is_snowing = false; }
+  void setDefaultRain() {
+    data_->is_raining = true;
+    data_->is_snowing = false;
+  }
+  void setDefaultSnow() {
+    data_->is_raining = false;
+    data_->is_snowing = true;
+  }
+
+ private:
+  std::shared_ptr<experiment::ExperimentData> data_;
+};
+
+class Fog {
+ public:
+  explicit Fog(std::shared_ptr<experiment::ExperimentData> data) : data_{std::move(data)} {}
+  void setEnabled(const bool enabled) { data_->is_fog_enabled = enabled; }
+  void setVisibility(const double visibility) { data_->fog_visibility = visibility; }
+
+ private:
+  std::shared_ptr<experiment::ExperimentData> data_;
+};
+
+class Weather {
+ public:
+  explicit Weather(std::shared_ptr<experiment::ExperimentData> data) : data_{std::move(data)} {}
+  Precipitation precipitation() { return Precipitation{data_}; }
+  Fog fog() { return Fog{data_}; }
+
+ private:
+  std::shared_ptr<experiment::ExperimentData> data_;
+};
+
+class Sky {
+ public:
+  explicit Sky(std::shared_ptr<experiment::ExperimentData> data) : data_{std::move(data)} {}
+  void setPresetDawn() { data_->sky_preset = 0; }
+  void setPresetDay() { data_->sky_preset = 1; }
+  void setPresetDusk() { data_->sky_preset = 2; }
+  void setPresetNight() { data_->sky_preset = 3; }
+  void setLightPollution(const SkyLightPollution light_pollution) { data_->light_pollution = light_pollution; }
+
+ private:
+  std::shared_ptr<experiment::ExperimentData> data_;
+};
+
+class Scheduler {
+ public:
+  explicit Scheduler(std::shared_ptr<experiment::ExperimentData> data) : data_{std::move(data)} {}
+  void setFrequencies(const std::int32_t simulation_frequency, const std::int32_t integration_frequency) {
+    data_->simulation_frequency = simulation_frequency;
+    data_->integration_frequency = integration_frequency;
+  }
+  void setSimulationSpeed(const SimulationSpeed simulation_speed) { data_->simulation_speed = simulation_speed; }
+  void setIgnoreFrameOverrun(const bool ignore_frame_overrun) { data_->ignore_frame_overrun = ignore_frame_overrun; }
+  std::int32_t simulationFrequency() const { return data_->simulation_frequency; }
+
+ private:
+  std::shared_ptr<experiment::ExperimentData> data_;
+};
+
+}  // namespace types
+
+namespace experiment {
+
+class Experiment {
+ public:
+  Experiment() : data_{std::make_shared<ExperimentData>()} {}
+
+  /**
+   * @brief Create a new object of the given @p type.
+   *
+   * Objects are named after their type followed by an incremental counter, e.g. `Audi_A8_Sedan_1`.
+   * @param type type of the object
+   * @return new object
+   */
+  types::WorldObject createObject(const std::string& type) {
+    auto object = std::make_shared<types::WorldObjectData>();
+    object->id = static_cast<std::int32_t>(data_->objects.size());
+    object->type = type;
+    object->name = type + "_" + std::to_string(++data_->type_counts[type]);
+    object->experiment = data_;
+    data_->objects.push_back(object);
+    data_->objects_by_name[object->name] = object;
+    return types::WorldObject{object};
+  }
+
+  /** @throw std::runtime_error if no object with the given @p name exists */
+  template <class T>
+  T getObjectByName(const std::string& name) const {
+    const auto it = data_->objects_by_name.find(name);
+    if (it == data_->objects_by_name.end() || it->second->is_removed)
+      throw std::runtime_error("No object named '" + name + "' in the experiment");
+    return T{it->second};
+  }
+  /**
+   * @brief Types of the objects in the experiment.
+   *
+   * There is no object library in the headless backend: any type can be created,
+   * hence only the types already in use are listed, in alphabetical order.
+   * @return types of the objects
+   */
+  std::vector<std::string> objectTypes() const;
+
+  void saveToFile(const std::string&) const {}
+
+  types::Weather weather() const { return types::Weather{data_}; }
+  types::Sky sky() const { return types::Sky{data_}; }
+  types::Scheduler scheduler() const { return types::Scheduler{data_}; }
+  ExperimentData& data() const { return *data_; }
+
+ private:
+  std::shared_ptr<ExperimentData> data_;
+};
+
+inline Experiment createExperiment() { return Experiment{}; }
+inline Experiment loadExperimentFromFile(const std::string&) { return Experiment{}; }
+
+}  // namespace experiment
+}  // namespace prescan::api
@@ -0,0 +1,112 @@
+/**
+ * @file SensorBase.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless base class of the Prescan sensors
+ *
+ * All sensors share the same state, of which each sensor class exposes its own subset.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api {
+
+namespace camera {
+enum ImageFormat {
+  CameraSensorImageFormatBGRU8,
+  CameraSensorImageFormatRGBU8,
+  CameraSensorImageFormatMonoU8,
+};
+}  // namespace camera
+
+namespace types {
+
+enum DetectionType {
+  DetectionTypeCenterOfBoundingBox,
+  DetectionTypeClosestPointOfBoundingBox,
+};
+
+struct SensorData {
+  std::string kind;
+  std::weak_ptr<WorldObjectData> object;  ///< Object the sensor is attached to
+  Pose pose;
+  DetectionType detection_type{DetectionTypeCenterOfBoundingBox};
+  double fov{1.0};
+  double fov_horizontal{1.0};
+  double fov_vertical{1.0};
+  double range{150.0};
+  double point_spacing{0.1};
+  double focal_length{0.01};
+  double imager_width{0.01};
+  double imager_height{0.01};
+  std::int32_t frequency{20};
+  std::int32_t max_detectable_objects{5};
+  std::int32_t max_lines{4};
+  std::int32_t max_points_per_line{16};
+  std::int32_t resolution_x{640};
+  std::int32_t resolution_y{480};
+  camera::ImageFormat image_format{camera::CameraSensorImageFormatBGRU8};
+};
+
+class SensorBase {
+ public:
+  explicit SensorBase(std::shared_ptr<SensorData> data) : data_{std::move(data)} {}
+  virtual ~SensorBase() = default;
+
+  Pose& pose() { return data_->pose; }
+  const Pose& pose() const { return data_->pose; }
+  const SensorData& data() const { return *data_; }
+  /** @throw std::runtime_error if the object the sensor was attached to no longer exists */
+  WorldObject object() const {
+    std::shared_ptr<WorldObjectData> object = data_->object.lock();
+    if (object == nullptr) throw std::runtime_error("The sensor is not attached to any object");
+    return WorldObject{std::move(object)};
+  }
+
+ protected:
+  std::shared_ptr<SensorData> data_;
+};
+
+/**
+ * @brief Create a new sensor of the given @p kind and attach it to the @p object.
+ * @tparam T sensor class
+ * @param object object the sensor will be attached to
+ * @param kind kind of the sensor
+ * @return new sensor
+ */
+template <class T>
+T createSensor(const WorldObject& object, const char* const kind) {
+  auto data = std::make_shared<SensorData>();
+  data->kind = kind;
+  data->object = object.data().weak_from_this();
+  object.data().sensors.push_back(data);
+  return T{data};
+}
+
+/**
+ * @brief Collect all the sensors of the given @p kind attached to the @p object, in order of creation.
+ * @tparam T sensor class
+ * @param object object the sensors are attached to
+ * @param kind kind of the sensors
+ * @return sensors of the given kind
+ */
+template <class T>
+std::vector<T> getAttachedSensors(const WorldObject& object, const char* const kind) {
+  std::vector<T> sensors;
+  for (const std::shared_ptr<SensorData>& data : object.data().sensors)
+    if (data->kind == kind) sensors.emplace_back(data);
+  return sensors;
+}
+
+}  // namespace types
+}  // namespace prescan::api
@@ -0,0 +1,57 @@
+/**
+ * @file WindowSettings.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan window settings
+ *
+ * The settings are stored, but there is no window to apply them to.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace prescan::api::types {
+
+struct WindowSettingsData {
+  bool always_on_top{false};
+  bool fullscreen{false};
+  std::int32_t height{720};
+  std::int32_t width{1280};
+  std::int32_t origin_x{0};
+  std::int32_t origin_y{0};
+  std::int32_t screen_id{0};
+  double visualization_frequency{20};
+  bool window_decoration{true};
+};
+
+class WindowSettings {
+ public:
+  explicit WindowSettings(std::shared_ptr<WindowSettingsData> data) : data_{std::move(data)} {}
+
+  bool alwaysOnTop() const { return data_->always_on_top; }
+  void setAlwaysOnTop(const bool always_on_top) { data_->always_on_top = always_on_top; }
+  bool fullscreen() const { return data_->fullscreen; }
+  void setFullscreen(const bool fullscreen) { data_->fullscreen = fullscreen; }
+  std::int32_t height() const { return data_->height; }
+  void setHeight(const std::int32_t height) { data_->height = height; }
+  std::int32_t width() const { return data_->width; }
+  void setWidth(const std::int32_t width) { data_->width = width; }
+  std::int32_t originX() const { return data_->origin_x; }
+  void setOriginX(const std::int32_t origin_x) { data_->origin_x = origin_x; }
+  std::int32_t originY() const { return data_->origin_y; }
+  void setOriginY(const std::int32_t origin_y) { data_->origin_y = origin_y; }
+  std::int32_t screenId() const { return data_->screen_id; }
+  void setScreenId(const std::int32_t screen_id) { data_->screen_id = screen_id; }
+  double visualizationFrequency() const { return data_->visualization_frequency; }
+  void setVisualizationFrequency(const double frequency) { data_->visualization_frequency = frequency; }
+  bool windowDecoration() const { return data_->window_decoration; }
+  void setWindowDecoration(const bool window_decoration) { data_->window_decoration = window_decoration; }
+
+ private:
+  std::shared_ptr<WindowSettingsData> data_;
+};
+
+}  // namespace prescan::api::types
@@ -0,0 +1,162 @@
+/**
+ * @file WorldObject.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless world objects
+ *
+ * Only the subset of the Prescan API used by symaware is provided.
+ * Objects are lightweight handles sharing their state, like the ones of the real API.
+ * On top of their pose, objects keep track of their kinematic state, which is updated by the simulation at every step
+ * and read back by the self sensor and the ground truth sensors.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace prescan::api {
+
+namespace experiment {
+struct ExperimentData;
+}  // namespace experiment
+
+namespace trajectory {
+struct TrajectoryData;
+}  // namespace trajectory
+
+namespace types {
+
+enum SensorDetectability {
+  SensorDetectabilityDetectable,
+  SensorDetectabilityInvisible,
+  SensorDetectabilityOccluding,
+};
+
+class Vector3 {
+ public:
+  Vector3() = default;
+  Vector3(const double x, const double y, const double z) : x_{x}, y_{y}, z_{z} {}
+
+  double x() const { return x_; }
+  double y() const { return y_; }
+  double z() const { return z_; }
+  void setX(const double x) { x_ = x; }
+  void setY(const double y) { y_ = y; }
+  void setZ(const double z) { z_ = z; }
+  void setXYZ(const double x, const double y, const double z) {
+    x_ = x;
+    y_ = y;
+    z_ = z;
+  }
+
+ private:
+  double x_{0};
+  double y_{0};
+  double z_{0};
+};
+
+class Orientation {
+ public:
+  double roll() const { return roll_; }
+  double pitch() const { return pitch_; }
+  double yaw() const { return yaw_; }
+  void setRoll(const double roll) { roll_ = roll; }
+  void setPitch(const double pitch) { pitch_ = pitch; }
+  void setYaw(const double yaw) { yaw_ = yaw; }
+  void setRPY(const double roll, const double pitch, const double yaw) {
+    roll_ = roll;
+    pitch_ = pitch;
+    yaw_ = yaw;
+  }
+
+ private:
+  double roll_{0};
+  double pitch_{0};
+  double yaw_{0};
+};
+
+class Pose {
+ public:
+  Vector3& position() { return position_; }
+  const Vector3& position() const { return position_; }
+  Orientation& orientation() { return orientation_; }
+  const Orientation& orientation() const { return orientation_; }
+
+ private:
+  Vector3 position_;
+  Orientation orientation_;
+};
+
+struct SensorData;
+
+struct WorldObjectData : std::enable_shared_from_this<WorldObjectData> {
+  std::int32_t id{0};                                    ///< Unique identifier, reported by the ground truth sensors
+  std::string name;                                      ///< Unique name of the object in the experiment
+  std::string type;                                      ///< Type of the object
+  std::weak_ptr<experiment::ExperimentData> experiment;  ///< Experiment the object belongs to
+  Pose pose;                                             ///< Current pose of the object
+  Vector3 cog_offset;  ///< Offset of the centre of gravity from the origin of the object
+  Vector3 bounding_box{4.5, 1.8, 1.5};                   ///< Length, width and height of the object
+  bool is_movable{true};
+  bool is_collision_detectable{true};
+  bool is_removed{false};
+  SensorDetectability sensor_detectability{SensorDetectabilityDetectable};
+  std::vector<std::shared_ptr<SensorData>> sensors;
+  std::shared_ptr<trajectory::TrajectoryData> trajectory;
+  bool has_dynamics{false};
+  bool is_flat_ground{true};
+  double initial_velocity{0};
+  Vector3 velocity;    ///< Velocity of the object in the world frame, estimated from the last step
+  double yaw_rate{0};  ///< Yaw rate of the object, estimated from the last step
+  Pose previous_pose;  ///< Pose of the object at the previous step
+};
+
+class WorldObject {
+ public:
+  WorldObject() = default;
+  explicit WorldObject(std::shared_ptr<WorldObjectData> data) : data_{std::move(data)} {}
+
+  /** @throw std::runtime_error if the object is not bound to the experiment, like the real API */
+  const void* handle() const {
+    if (data_ == nullptr) throw std::runtime_error("WorldObject is not bound to an experiment");
+    return data_.get();
+  }
+  std::string name() const { return data().name; }
+  /**
+   * @brief Rename the object.
+   * @param name new name of the object
+   * @throw std::runtime_error if another object in the experiment already has the same @p name
+   */
+  void setName(const std::string& name);
+  void remove() { data().is_removed = true; }
+
+  Pose& pose() { return data().pose; }
+  const Pose& pose() const { return data().pose; }
+  Vector3& cogOffset() { return data().cog_offset; }
+  const Vector3& cogOffset() const { return data().cog_offset; }
+  bool movable() const { return data().is_movable; }
+  void setMovable(const bool is_movable) { data().is_movable = is_movable; }
+  bool collisionDetectable() const { return data().is_collision_detectable; }
+  void setCollisionDetectable(const bool is_collision_detectable) {
+    data().is_collision_detectable = is_collision_detectable;
+  }
+  SensorDetectability sensorDetectability() const { return data().sensor_detectability; }
+  void setSensorDetectability(const SensorDetectability sensor_detectability) {
+    data().sensor_detectability = sensor_detectability;
+  }
+
+  WorldObjectData& data() const {
+    if (data_ == nullptr) throw std::runtime_error("WorldObject is not bound to an experiment");
+    return *data_;
+  }
+
+ private:
+  std::shared_ptr<WorldObjectData> data_;
+};
+
+}  // namespace types
+}  // namespace prescan::api
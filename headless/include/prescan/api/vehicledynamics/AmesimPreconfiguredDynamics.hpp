@@ -0,0 +1,38 @@
+/**
+ * @file AmesimPreconfiguredDynamics.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan preconfigured Amesim dynamics
+ */
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api::vehicledynamics {
+
+class AmesimPreconfiguredDynamics {
+ public:
+  explicit AmesimPreconfiguredDynamics(types::WorldObject object) : object_{std::move(object)} {}
+  void setFlatGround(const bool is_flat_ground) { object_.data().is_flat_ground = is_flat_ground; }
+  void setInitialVelocity(const double initial_velocity) { object_.data().initial_velocity = initial_velocity; }
+  const types::WorldObject& object() const { return object_; }
+
+ private:
+  types::WorldObject object_;
+};
+
+inline AmesimPreconfiguredDynamics createAmesimPreconfiguredDynamics(const types::WorldObject& object) {
+  object.data().has_dynamics = true;
+  return AmesimPreconfiguredDynamics{object};
+}
+/** @throw std::runtime_error if the @p object has no dynamics attached */
+inline AmesimPreconfiguredDynamics getAttachedAmesimPreconfiguredDynamics(const types::WorldObject& object) {
+  if (!object.data().has_dynamics) throw std::runtime_error("No Amesim dynamics attached to " + object.name());
+  return AmesimPreconfiguredDynamics{object};
+}
+
+}  // namespace prescan::api::vehicledynamics
@@ -0,0 +1,48 @@
+/**
+ * @file AirSensorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan AIR sensor unit
+ *
+ * The unit outputs the ground truth of the detectable objects within the range and field of view of the sensor,
+ * sorted by increasing range and capped to the maximum number of detectable objects.
+ * Occlusions are not modelled: occluding objects are never detected, but they do not hide the ones behind them.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "prescan/api/Air.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct AirSensorDetection {
+  double Range{0};      ///< Distance from the sensor to the detected point
+  double Azimuth{0};    ///< Horizontal angle of the detected point in the frame of the sensor
+  double Elevation{0};  ///< Vertical angle of the detected point in the frame of the sensor
+  std::int32_t ID{0};   ///< Unique identifier of the detected object
+  double Velocity{0};   ///< Rate of change of the range, negative if the object is approaching
+  double Heading{0};    ///< Yaw of the detected object relative to the one of the sensor
+};
+
+class AirSensorUnit : public Unit {
+ public:
+  explicit AirSensorUnit(const api::air::AirSensor& sensor);
+
+  void initialize(ISimulation* simulation) override;
+  void step(ISimulation* simulation) override;
+
+  const std::vector<const AirSensorDetection*>& airSensorOutput() const { return output_; }
+
+ private:
+  api::air::AirSensor sensor_;                     ///< Sensor the unit simulates
+  api::types::WorldObject object_;                 ///< Object the sensor is attached to
+  std::vector<AirSensorDetection> detections_;     ///< Storage for the detections
+  std::vector<const AirSensorDetection*> output_;  ///< Detections of the last step
+};
+
+}  // namespace prescan::sim
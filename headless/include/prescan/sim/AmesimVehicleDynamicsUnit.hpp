@@ -0,0 +1,54 @@
+/**
+ * @file AmesimVehicleDynamicsUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan Amesim vehicle dynamics unit
+ *
+ * Instead of the Amesim model, the unit integrates a kinematic bicycle model on flat ground.
+ * Throttle and brake are mapped to a longitudinal acceleration, in the direction given by the gear,
+ * and the steering wheel angle to the steering angle of the front wheels through a fixed steering ratio.
+ * The vehicle is never accelerated backwards by the brake: it stops instead.
+ */
+#pragma once
+
+#include <string>
+
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/api/vehicledynamics/AmesimPreconfiguredDynamics.hpp"
+#include "prescan/sim/StateActuatorUnit.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct VehicleControlData {
+  double Throttle{0};
+  double Brake{0};
+  double SteeringWheelAngle{0};
+  int Gear{0};
+};
+
+class AmesimVehicleDynamicsUnit : public Unit {
+ public:
+  static constexpr double wheelbase = 2.9;         ///< Distance between the axles, in m
+  static constexpr double steering_ratio = 15.0;   ///< Ratio between the steering wheel and the wheels angles
+  static constexpr double max_acceleration = 4.0;  ///< Acceleration at full throttle, in m/s^2
+  static constexpr double max_deceleration = 9.0;  ///< Deceleration at full brake, in m/s^2
+
+  AmesimVehicleDynamicsUnit(const api::vehicledynamics::AmesimPreconfiguredDynamics& dynamics,
+                            std::string simulation_path);
+
+  void initialize(ISimulation* simulation) override;
+  void step(ISimulation* simulation) override;
+
+  VehicleControlData& vehicleControlInput() { return control_; }
+  const StateActuatorData& stateActuatorOutput() const { return output_; }
+
+ private:
+  api::types::WorldObject object_;  ///< Vehicle driven by the dynamics
+  double speed_;                    ///< Signed longitudinal speed of the vehicle, in m/s
+  VehicleControlData control_;      ///< Control input of the vehicle
+  StateActuatorData output_;        ///< State of the vehicle
+};
+
+}  // namespace prescan::sim
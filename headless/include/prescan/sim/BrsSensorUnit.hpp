@@ -0,0 +1,49 @@
+/**
+ * @file BrsSensorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan BRS sensor unit
+ *
+ * The unit outputs the bounding boxes of the detectable objects in front of the sensor,
+ * projected on its image plane by an ideal pinhole camera and clipped to the image.
+ * Boxes are expressed in pixels, with the origin in the bottom left corner of the image,
+ * sorted by increasing distance and capped to the maximum number of detectable objects.
+ * Objects partially behind the sensor are not detected.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "prescan/api/Brs.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct BrsSensorDetection {
+  std::int32_t ObjectID{0};  ///< Unique identifier of the detected object
+  double Left{0};            ///< Left edge of the bounding box
+  double Right{0};           ///< Right edge of the bounding box
+  double Bottom{0};          ///< Bottom edge of the bounding box
+  double Top{0};             ///< Top edge of the bounding box
+};
+
+class BrsSensorUnit : public Unit {
+ public:
+  explicit BrsSensorUnit(const api::brs::BrsSensor& sensor);
+
+  void initialize(ISimulation* simulation) override;
+  void step(ISimulation* simulation) override;
+
+  const std::vector<const BrsSensorDetection*>& brsSensorOutput() const { return output_; }
+
+ private:
+  api::brs::BrsSensor sensor_;                     ///< Sensor the unit simulates
+  api::types::WorldObject object_;                 ///< Object the sensor is attached to
+  std::vector<BrsSensorDetection> detections_;     ///< Storage for the detections
+  std::vector<const BrsSensorDetection*> output_;  ///< Detections of the last step
+};
+
+}  // namespace prescan::sim
@@ -0,0 +1,37 @@
+/**
+ * @file CameraSensorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan camera sensor unit
+ *
+ * Nothing is rendered: the image output is always empty.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "prescan/api/Camera.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+class CameraSensorUnit : public Unit {
+ public:
+  struct Image {
+    const std::uint8_t* data;
+    std::int32_t width;
+    std::int32_t height;
+    api::camera::ImageFormat format;
+  };
+
+  explicit CameraSensorUnit(const api::camera::CameraSensor& sensor)
+      : Unit{StageSensing}, image_{nullptr, 0, 0, sensor.data().image_format} {}
+
+  const Image& imageOutput() const { return image_; }
+
+ private:
+  Image image_;
+};
+
+}  // namespace prescan::sim
@@ -0,0 +1,39 @@
+/**
+ * @file ISimulation.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan simulation interface
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+class ISimulation {
+ public:
+  virtual ~ISimulation() = default;
+  virtual Unit* registerUnit(std::unique_ptr<Unit> unit) = 0;
+  virtual const std::string& getSimulationPath() const = 0;
+  virtual void stop() = 0;
+  virtual double getSampleTime() const = 0;
+};
+
+/**
+ * @brief Construct a new unit of type @p T and register it to the @p simulation, which takes ownership of it.
+ * @tparam T type of the unit
+ * @param simulation simulation to register the unit to
+ * @param args arguments forwarded to the constructor of the unit
+ * @return registered unit
+ */
+template <class T, class... Args>
+T* registerUnit(ISimulation* const simulation, Args&&... args) {
+  return static_cast<T*>(simulation->registerUnit(std::make_unique<T>(std::forward<Args>(args)...)));
+}
+
+}  // namespace prescan::sim
@@ -0,0 +1,28 @@
+/**
+ * @file ISimulationLogger.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan simulation logger
+ */
+#pragma once
+
+namespace prescan::sim {
+
+class ISimulationLogger {
+ public:
+  enum LogLevel {
+    LogLevelOff,
+    LogLevelCritical,
+    LogLevelError,
+    LogLevelWarning,
+    LogLevelNotice,
+    LogLevelInfo,
+    LogLevelDebug,
+    LogLevelCrawl,
+    LogLevelClean,
+    LogLevelInherit,
+  };
+};
+
+}  // namespace prescan::sim
@@ -0,0 +1,24 @@
+/**
+ * @file ISimulationModel.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan simulation model interface
+ */
+#pragma once
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/sim/ISimulation.hpp"
+
+namespace prescan::sim {
+
+class ISimulationModel {
+ public:
+  virtual ~ISimulationModel() = default;
+  virtual void registerSimulationUnits(const api::experiment::Experiment& experiment, ISimulation* simulation) = 0;
+  virtual void initialize(ISimulation* simulation) = 0;
+  virtual void step(ISimulation* simulation) = 0;
+  virtual void terminate(ISimulation* simulation) = 0;
+};
+
+}  // namespace prescan::sim
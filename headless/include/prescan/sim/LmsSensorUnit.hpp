@@ -0,0 +1,39 @@
+/**
+ * @file LmsSensorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan LMS sensor unit
+ *
+ * The headless backend has no road geometry to scan.
+ * The unit assumes the sensor is on a straight, flat road and outputs, in the frame of the sensor,
+ * the maximum number of parallel lane lines 3.5 m apart, sampled every point spacing up to the range of the sensor.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "prescan/api/Lms.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct LmsSensorPoint {
+  double X{0};
+  double Y{0};
+  double Z{0};
+  double Curvature{0};
+};
+
+class LmsSensorUnit : public Unit {
+ public:
+  LmsSensorUnit(const api::lms::LmsSensor& sensor, std::string simulation_path);
+
+  const std::vector<std::vector<LmsSensorPoint>>& linesOutput() const { return lines_; }
+
+ private:
+  std::vector<std::vector<LmsSensorPoint>> lines_;  ///< Lines detected by the sensor
+};
+
+}  // namespace prescan::sim
@@ -0,0 +1,79 @@
+/**
+ * @file ManualSimulation.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan manual simulation
+ *
+ * The simulation runs in the calling thread, with a fixed step given by the scheduler of the experiment.
+ * Each step moves the objects, updates their kinematic state, runs the sensors and finally steps the model,
+ * so that the model always sees the sensor outputs of the current state of the world.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/ISimulationLogger.hpp"
+#include "prescan/sim/ISimulationModel.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+class ManualSimulation : public ISimulation {
+ public:
+  explicit ManualSimulation(ISimulationModel* const model)
+      : model_{model},
+        experiment_{},
+        simulation_path_{},
+        sample_time_{0.05},
+        is_stopped_{false},
+        units_{},
+        sensing_begin_{0} {}
+
+  Unit* registerUnit(std::unique_ptr<Unit> unit) override {
+    units_.push_back(std::move(unit));
+    return units_.back().get();
+  }
+  const std::string& getSimulationPath() const override { return simulation_path_; }
+  void stop() override { is_stopped_ = true; }
+  double getSampleTime() const override { return sample_time_; }
+
+  void setSimulationPath(std::string simulation_path) { simulation_path_ = std::move(simulation_path); }
+  void setLogLevel(ISimulationLogger::LogLevel) {}
+
+  /**
+   * @brief Register the units of the model and initialise them.
+   *
+   * The kinematic state of the objects in the @p experiment is reset.
+   * @param experiment experiment to simulate
+   */
+  void initialize(const api::experiment::Experiment& experiment);
+  /** @brief Advance the simulation by one sample time */
+  void step();
+  void terminate();
+  void run(const api::experiment::Experiment& experiment, const double seconds) {
+    initialize(experiment);
+    const auto steps = static_cast<std::size_t>(seconds / sample_time_);
+    for (std::size_t i = 0; i < steps && !is_stopped_; ++i) step();
+    terminate();
+  }
+
+  const std::vector<std::unique_ptr<Unit>>& units() const { return units_; }
+
+ private:
+  ISimulationModel* model_;                   ///< Model driven by the simulation
+  api::experiment::Experiment experiment_;    ///< Experiment being simulated
+  std::string simulation_path_;               ///< Path of the simulation, used by the units loading assets
+  double sample_time_;                        ///< Fixed step of the simulation, in seconds
+  bool is_stopped_;                           ///< Whether a stop has been requested
+  std::vector<std::unique_ptr<Unit>> units_;  ///< Registered units, sorted by stage
+  std::size_t sensing_begin_;                 ///< Index of the first unit in the sensing stage
+};
+
+}  // namespace prescan::sim
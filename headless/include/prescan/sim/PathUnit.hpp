@@ -0,0 +1,49 @@
+/**
+ * @file PathUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan path unit
+ *
+ * The pose at the distance received as input is computed along the path at every step.
+ * The velocity received as input is applied along the tangent of the path.
+ */
+#pragma once
+
+#include <cmath>
+#include <utility>
+
+#include "prescan/api/Trajectory.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/SpeedProfileUnit.hpp"
+#include "prescan/sim/StateActuatorUnit.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+class PathUnit : public Unit {
+ public:
+  PathUnit(api::trajectory::Path path, const api::types::WorldObject&) : path_{std::move(path)}, input_{}, output_{} {}
+
+  void initialize(ISimulation* const simulation) override { step(simulation); }
+  void step(ISimulation*) override {
+    const api::types::Pose pose = path_.poseAtDistance(input_.Distance);
+    output_.PositionX = pose.position().x();
+    output_.PositionY = pose.position().y();
+    output_.PositionZ = pose.position().z();
+    output_.OrientationYaw = pose.orientation().yaw();
+    output_.VelocityX = input_.Velocity * std::cos(pose.orientation().yaw());
+    output_.VelocityY = input_.Velocity * std::sin(pose.orientation().yaw());
+  }
+
+  MotionData& motionInput() { return input_; }
+  const StateActuatorData& stateActuatorOutput() const { return output_; }
+
+ private:
+  api::trajectory::Path path_;
+  MotionData input_;
+  StateActuatorData output_;
+};
+
+}  // namespace prescan::sim
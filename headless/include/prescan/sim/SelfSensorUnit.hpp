@@ -0,0 +1,62 @@
+/**
+ * @file SelfSensorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan self sensor unit
+ *
+ * The output is refreshed at every step with the pose and the kinematic state of the object.
+ * The velocity is the component of the velocity of the object along its heading.
+ */
+#pragma once
+
+#include <cmath>
+#include <utility>
+
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct SelfSensorData {
+  double PositionX{0};
+  double PositionY{0};
+  double PositionZ{0};
+  double OrientationRoll{0};
+  double OrientationPitch{0};
+  double OrientationYaw{0};
+  double Velocity{0};
+  double Yaw_rate{0};
+};
+
+class SelfSensorUnit : public Unit {
+ public:
+  explicit SelfSensorUnit(api::types::WorldObject object)
+      : Unit{StageSensing}, object_{std::move(object)}, output_{} {}
+
+  void initialize(ISimulation*) override { update(); }
+  void step(ISimulation*) override { update(); }
+
+  const SelfSensorData& selfSensorOutput() const { return output_; }
+
+ private:
+  void update() {
+    const api::types::Pose& pose = object_.pose();
+    output_.PositionX = pose.position().x();
+    output_.PositionY = pose.position().y();
+    output_.PositionZ = pose.position().z();
+    output_.OrientationRoll = pose.orientation().roll();
+    output_.OrientationPitch = pose.orientation().pitch();
+    output_.OrientationYaw = pose.orientation().yaw();
+    const api::types::WorldObjectData& data = object_.data();
+    output_.Velocity = data.velocity.x() * std::cos(pose.orientation().yaw()) +
+                       data.velocity.y() * std::sin(pose.orientation().yaw());
+    output_.Yaw_rate = data.yaw_rate;
+  }
+
+  api::types::WorldObject object_;
+  SelfSensorData output_;
+};
+
+}  // namespace prescan::sim
@@ -0,0 +1,13 @@
+/**
+ * @file Simulation.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan simulation module
+ */
+#pragma once
+
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/ISimulationLogger.hpp"
+#include "prescan/sim/ISimulationModel.hpp"
+#include "prescan/sim/Unit.hpp"
@@ -0,0 +1,37 @@
+/**
+ * @file SpeedProfileUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan speed profile unit
+ */
+#pragma once
+
+#include "prescan/api/Trajectory.hpp"
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct MotionData {
+  double Velocity{0};
+  double Acceleration{0};
+  double Distance{0};
+};
+
+class SpeedProfileUnit : public Unit {
+ public:
+  explicit SpeedProfileUnit(const api::trajectory::SpeedProfile& speed_profile)
+      : speed_{speed_profile.speed()}, output_{} {}
+
+  void initialize(ISimulation*) override { output_ = MotionData{speed_, 0, 0}; }
+  void step(ISimulation* const simulation) override { output_.Distance += speed_ * simulation->getSampleTime(); }
+
+  const MotionData& motionOutput() const { return output_; }
+
+ private:
+  double speed_;
+  MotionData output_;
+};
+
+}  // namespace prescan::sim
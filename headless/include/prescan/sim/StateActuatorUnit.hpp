@@ -0,0 +1,67 @@
+/**
+ * @file StateActuatorUnit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless Prescan state actuator unit
+ *
+ * The position and orientation received as input are applied to the object at every step.
+ * The kinematic state of the object is then derived by the simulation from the displacement of the object,
+ * hence velocities and accelerations received as input are ignored.
+ */
+#pragma once
+
+#include <utility>
+
+#include "prescan/api/types/WorldObject.hpp"
+#include "prescan/sim/ISimulation.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+struct StateActuatorData {
+  double PositionX{0};
+  double PositionY{0};
+  double PositionZ{0};
+  double OrientationRoll{0};
+  double OrientationPitch{0};
+  double OrientationYaw{0};
+  double VelocityX{0};
+  double VelocityY{0};
+  double VelocityZ{0};
+  double AccelerationX{0};
+  double AccelerationY{0};
+  double AccelerationZ{0};
+  double AngularVelocityRoll{0};
+  double AngularVelocityPitch{0};
+  double AngularVelocityYaw{0};
+};
+
+class StateActuatorUnit : public Unit {
+ public:
+  explicit StateActuatorUnit(api::types::WorldObject object)
+      : Unit{StageActuation}, object_{std::move(object)}, input_{} {
+    const api::types::Pose& pose = object_.pose();
+    input_.PositionX = pose.position().x();
+    input_.PositionY = pose.position().y();
+    input_.PositionZ = pose.position().z();
+    input_.OrientationRoll = pose.orientation().roll();
+    input_.OrientationPitch = pose.orientation().pitch();
+    input_.OrientationYaw = pose.orientation().yaw();
+  }
+
+  void step(ISimulation*) override {
+    api::types::Pose& pose = object_.pose();
+    pose.position().setXYZ(input_.PositionX, input_.PositionY, input_.PositionZ);
+    pose.orientation().setRPY(input_.OrientationRoll, input_.OrientationPitch, input_.OrientationYaw);
+  }
+
+  StateActuatorData& stateActuatorInput() { return input_; }
+  const StateActuatorData& stateActuatorInput() const { return input_; }
+
+ private:
+  api::types::WorldObject object_;
+  StateActuatorData input_;
+};
+
+}  // namespace prescan::sim
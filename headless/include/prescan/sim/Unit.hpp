@@ -0,0 +1,41 @@
+/**
+ * @file Unit.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Headless base class of the Prescan simulation units
+ */
+#pragma once
+
+namespace prescan::sim {
+
+class ISimulation;
+
+/**
+ * @brief Base class of the simulation units.
+ *
+ * Units are stepped by the simulation before the simulation model, so that their outputs are up to date.
+ * Within a step, units are grouped by @ref Stage: first the ones computing the motion of the objects,
+ * then the ones applying it to the objects and lastly the sensors, which observe the world once everything has moved.
+ */
+class Unit {
+ public:
+  enum Stage {
+    StageMotion,     ///< The unit computes the motion of an object, e.g. vehicle dynamics or paths
+    StageActuation,  ///< The unit moves an object in the world
+    StageSensing,    ///< The unit observes the world
+  };
+
+  explicit Unit(const Stage stage = StageMotion) : stage_{stage} {}
+  virtual ~Unit() = default;
+  virtual void initialize(ISimulation*) {}
+  virtual void step(ISimulation*) {}
+  virtual void terminate(ISimulation*) {}
+
+  Stage stage() const { return stage_; }
+
+ private:
+  Stage stage_;  ///< Stage of the step the unit belongs to
+};
+
+}  // namespace prescan::sim
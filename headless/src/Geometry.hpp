@@ -0,0 +1,131 @@
+/**
+ * @file Geometry.hpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Rigid transformations shared by the units of the headless backend
+ *
+ * Frames follow the Prescan convention: x forward, y left and z up,
+ * with the orientation given as roll, pitch and yaw applied in the z-y-x order.
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::headless {
+
+using Point = std::array<double, 3>;
+
+constexpr double pi = 3.14159265358979323846;
+
+/** Frame of reference expressed in the world frame */
+struct Frame {
+  Point origin;                               ///< Origin of the frame
+  std::array<std::array<double, 3>, 3> axes;  ///< Rotation matrix from the frame to the world frame
+};
+
+/**
+ * @brief Wrap the @p angle in the range [-pi, pi].
+ * @param angle angle in radians
+ * @return equivalent angle in [-pi, pi]
+ */
+inline double wrapAngle(const double angle) { return std::remainder(angle, 2.0 * pi); }
+
+/**
+ * @brief Frame with the given @p pose in the world frame.
+ * @param pose pose of the frame
+ * @return frame
+ */
+inline Frame frameOf(const api::types::Pose& pose) {
+  const double cr = std::cos(pose.orientation().roll()), sr = std::sin(pose.orientation().roll());
+  const double cp = std::cos(pose.orientation().pitch()), sp = std::sin(pose.orientation().pitch());
+  const double cy = std::cos(pose.orientation().yaw()), sy = std::sin(pose.orientation().yaw());
+  return Frame{{pose.position().x(), pose.position().y(), pose.position().z()},
+               {{{cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr},
+                 {sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr},
+                 {-sp, cp * sr, cp * cr}}}};
+}
+
+/**
+ * @brief Convert the @p point from the @p frame to the world frame.
+ * @param frame frame the point is expressed in
+ * @param point point in the frame
+ * @return point in the world frame
+ */
+inline Point toWorld(const Frame& frame, const Point& point) {
+  Point world = frame.origin;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) world[i] += frame.axes[i][j] * point[j];
+  return world;
+}
+
+/**
+ * @brief Convert the @p point from the world frame to the @p frame.
+ * @param frame frame to express the point in
+ * @param point point in the world frame
+ * @return point in the frame
+ */
+inline Point toLocal(const Frame& frame, const Point& point) {
+  Point local{};
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) local[i] += frame.axes[j][i] * (point[j] - frame.origin[j]);
+  return local;
+}
+
+/**
+ * @brief Frame with the given @p pose relative to the @p parent frame.
+ *
+ * Used to compute the frame of a sensor from the one of the object it is attached to.
+ * @param parent parent frame
+ * @param pose pose relative to the parent frame
+ * @return frame in the world frame
+ */
+inline Frame compose(const Frame& parent, const api::types::Pose& pose) {
+  const Frame child = frameOf(pose);
+  Frame frame{toWorld(parent, child.origin), {}};
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 3; ++k) frame.axes[i][j] += parent.axes[i][k] * child.axes[k][j];
+  return frame;
+}
+
+/**
+ * @brief Yaw of the @p frame in the world frame.
+ * @param frame frame
+ * @return yaw in [-pi, pi]
+ */
+inline double yawOf(const Frame& frame) { return std::atan2(frame.axes[1][0], frame.axes[0][0]); }
+
+/**
+ * @brief Centre of the bounding box of the @p object in the world frame.
+ *
+ * The origin of the object lies at the centre of the bottom face of its bounding box.
+ * @param object object
+ * @return centre of the bounding box
+ */
+inline Point boundingBoxCentre(const api::types::WorldObjectData& object) {
+  return toWorld(frameOf(object.pose), {0, 0, object.bounding_box.z() / 2});
+}
+
+/**
+ * @brief Whether the bounding box of the @p object may be within @p range from the @p point.
+ *
+ * Cheap conservative test, used to discard far away objects before any transformation.
+ * @param object object
+ * @param point point in the world frame
+ * @param range maximum distance from the point
+ * @return false if the object is certainly farther than @p range from the point
+ */
+inline bool mayBeWithin(const api::types::WorldObjectData& object, const Point& point, const double range) {
+  const double dx = object.pose.position().x() - point[0];
+  const double dy = object.pose.position().y() - point[1];
+  const double dz = object.pose.position().z() - point[2];
+  const double reach = range + std::hypot(object.bounding_box.x() / 2, object.bounding_box.y() / 2,
+                                          object.bounding_box.z());
+  return dx * dx + dy * dy + dz * dz <= reach * reach;
+}
+
+}  // namespace prescan::headless
@@ -0,0 +1,68 @@
+#include "prescan/api/experiment/Experiment.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Geometry.hpp"
+#include "prescan/api/types/WorldObject.hpp"
+
+namespace prescan::api {
+
+namespace experiment {
+
+void ExperimentData::resetKinematics() {
+  for (const std::shared_ptr<types::WorldObjectData>& object : objects) {
+    const double yaw = object->pose.orientation().yaw();
+    const double speed = object->has_dynamics ? object->initial_velocity : 0.0;
+    object->velocity.setXYZ(speed * std::cos(yaw), speed * std::sin(yaw), 0);
+    object->yaw_rate = 0;
+    object->previous_pose = object->pose;
+  }
+}
+
+void ExperimentData::updateKinematics(const double dt) {
+  if (dt <= 0) return;
+  for (const std::shared_ptr<types::WorldObjectData>& object : objects) {
+    if (object->is_removed) continue;
+    const types::Vector3& position = object->pose.position();
+    const types::Vector3& previous_position = object->previous_pose.position();
+    object->velocity.setXYZ((position.x() - previous_position.x()) / dt,
+                            (position.y() - previous_position.y()) / dt,
+                            (position.z() - previous_position.z()) / dt);
+    object->yaw_rate =
+        headless::wrapAngle(object->pose.orientation().yaw() - object->previous_pose.orientation().yaw()) / dt;
+    object->previous_pose = object->pose;
+  }
+}
+
+std::vector<std::string> Experiment::objectTypes() const {
+  std::vector<std::string> types;
+  types.reserve(data_->type_counts.size());
+  for (const auto& [type, count] : data_->type_counts) types.push_back(type);
+  std::sort(types.begin(), types.end());
+  return types;
+}
+
+}  // namespace experiment
+
+namespace types {
+
+void WorldObject::setName(const std::string& name) {
+  WorldObjectData& object = data();
+  if (object.name == name) return;
+  const std::shared_ptr<experiment::ExperimentData> experiment = object.experiment.lock();
+  if (experiment != nullptr) {
+    if (experiment->objects_by_name.count(name) > 0)
+      throw std::runtime_error("An object named '" + name + "' already exists in the experiment");
+    experiment->objects_by_name.erase(object.name);
+    experiment->objects_by_name[name] = data_;
+  }
+  object.name = name;
+}
+
+}  // namespace types
+}  // namespace prescan::api
@@ -0,0 +1,84 @@
+#include "prescan/sim/AirSensorUnit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "Geometry.hpp"
+#include "prescan/api/experiment/Experiment.hpp"
+
+namespace prescan::sim {
+
+namespace {
+
+/**
+ * @brief Point of the bounding box of the @p object closest to the @p point.
+ * @param object object
+ * @param point point in the world frame
+ * @return closest point of the bounding box in the world frame
+ */
+headless::Point closestPointOfBoundingBox(const api::types::WorldObjectData& object, const headless::Point& point) {
+  const headless::Frame frame = headless::frameOf(object.pose);
+  headless::Point local = headless::toLocal(frame, point);
+  local[0] = std::clamp(local[0], -object.bounding_box.x() / 2, object.bounding_box.x() / 2);
+  local[1] = std::clamp(local[1], -object.bounding_box.y() / 2, object.bounding_box.y() / 2);
+  local[2] = std::clamp(local[2], 0.0, object.bounding_box.z());
+  return headless::toWorld(frame, local);
+}
+
+}  // namespace
+
+AirSensorUnit::AirSensorUnit(const api::air::AirSensor& sensor)
+    : Unit{StageSensing}, sensor_{sensor}, object_{sensor.object()}, detections_{}, output_{} {
+  output_.reserve(static_cast<std::size_t>(std::max(sensor.data().max_detectable_objects, 0)));
+}
+
+void AirSensorUnit::initialize(ISimulation* const simulation) { step(simulation); }
+
+void AirSensorUnit::step(ISimulation*) {
+  const api::types::SensorData& setup = sensor_.data();
+  const api::types::WorldObjectData& self = object_.data();
+  const headless::Frame frame = headless::compose(headless::frameOf(self.pose), setup.pose);
+  const double yaw = headless::yawOf(frame);
+
+  detections_.clear();
+  output_.clear();
+  const std::shared_ptr<api::experiment::ExperimentData> experiment = self.experiment.lock();
+  if (experiment == nullptr) return;
+  for (const std::shared_ptr<api::types::WorldObjectData>& other : experiment->objects) {
+    if (other.get() == &self || other->is_removed) continue;
+    if (other->sensor_detectability != api::types::SensorDetectabilityDetectable) continue;
+    if (!headless::mayBeWithin(*other, frame.origin, setup.range)) continue;
+
+    const headless::Point target = setup.detection_type == api::types::DetectionTypeClosestPointOfBoundingBox
+                                       ? closestPointOfBoundingBox(*other, frame.origin)
+                                       : headless::boundingBoxCentre(*other);
+    const headless::Point local = headless::toLocal(frame, target);
+    const double range = std::hypot(local[0], local[1], local[2]);
+    if (range > setup.range) continue;
+    const double azimuth = std::atan2(local[1], local[0]);
+    if (std::abs(azimuth) > setup.fov / 2) continue;
+
+    const double range_rate =
+        range > 0 ? ((target[0] - frame.origin[0]) * (other->velocity.x() - self.velocity.x()) +
+                     (target[1] - frame.origin[1]) * (other->velocity.y() - self.velocity.y()) +
+                     (target[2] - frame.origin[2]) * (other->velocity.z() - self.velocity.z())) /
+                        range
+                  : 0.0;
+    detections_.push_back(AirSensorDetection{range,
+                                             azimuth,
+                                             std::atan2(local[2], std::hypot(local[0], local[1])),
+                                             other->id,
+                                             range_rate,
+                                             headless::wrapAngle(other->pose.orientation().yaw() - yaw)});
+  }
+
+  const auto max_detections = static_cast<std::size_t>(std::max(setup.max_detectable_objects, 0));
+  const std::size_t size = std::min(detections_.size(), max_detections);
+  std::partial_sort(
+      detections_.begin(), detections_.begin() + static_cast<std::ptrdiff_t>(size), detections_.end(),
+      [](const AirSensorDetection& lhs, const AirSensorDetection& rhs) { return lhs.Range < rhs.Range; });
+  for (std::size_t i = 0; i < size; ++i) output_.push_back(&detections_[i]);
+}
+
+}  // namespace prescan::sim
@@ -0,0 +1,51 @@
+#include "prescan/sim/AmesimVehicleDynamicsUnit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "prescan/sim/ISimulation.hpp"
+
+namespace prescan::sim {
+
+AmesimVehicleDynamicsUnit::AmesimVehicleDynamicsUnit(
+    const api::vehicledynamics::AmesimPreconfiguredDynamics& dynamics, std::string)
+    : Unit{StageMotion}, object_{dynamics.object()}, speed_{0}, control_{}, output_{} {}
+
+void AmesimVehicleDynamicsUnit::initialize(ISimulation*) {
+  const api::types::Pose& pose = object_.pose();
+  speed_ = object_.data().initial_velocity;
+  output_ = StateActuatorData{};
+  output_.PositionX = pose.position().x();
+  output_.PositionY = pose.position().y();
+  output_.PositionZ = pose.position().z();
+  output_.OrientationYaw = pose.orientation().yaw();
+  output_.VelocityX = speed_ * std::cos(output_.OrientationYaw);
+  output_.VelocityY = speed_ * std::sin(output_.OrientationYaw);
+}
+
+void AmesimVehicleDynamicsUnit::step(ISimulation* const simulation) {
+  const double dt = simulation->getSampleTime();
+  const double direction = control_.Gear == 1 ? 1.0 : control_.Gear == -1 ? -1.0 : 0.0;
+  const double throttle = std::clamp(control_.Throttle, 0.0, 1.0);
+  const double brake = std::clamp(control_.Brake, 0.0, 1.0);
+
+  double speed = speed_ + direction * throttle * max_acceleration * dt;
+  const double deceleration = brake * max_deceleration * dt;
+  speed = speed > 0 ? std::max(speed - deceleration, 0.0) : std::min(speed + deceleration, 0.0);
+
+  // Integrate the kinematic bicycle model with the midpoint rule
+  const double mean_speed = (speed_ + speed) / 2;
+  const double yaw_rate = mean_speed * std::tan(control_.SteeringWheelAngle / steering_ratio) / wheelbase;
+  const double mean_yaw = output_.OrientationYaw + yaw_rate * dt / 2;
+  output_.PositionX += mean_speed * std::cos(mean_yaw) * dt;
+  output_.PositionY += mean_speed * std::sin(mean_yaw) * dt;
+  output_.OrientationYaw += yaw_rate * dt;
+  output_.VelocityX = speed * std::cos(output_.OrientationYaw);
+  output_.VelocityY = speed * std::sin(output_.OrientationYaw);
+  output_.AccelerationX = (speed - speed_) / dt;
+  output_.AngularVelocityYaw = yaw_rate;
+  speed_ = speed;
+}
+
+}  // namespace prescan::sim
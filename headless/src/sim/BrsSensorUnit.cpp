@@ -0,0 +1,87 @@
+#include "prescan/sim/BrsSensorUnit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Geometry.hpp"
+#include "prescan/api/experiment/Experiment.hpp"
+
+namespace prescan::sim {
+
+BrsSensorUnit::BrsSensorUnit(const api::brs::BrsSensor& sensor)
+    : Unit{StageSensing}, sensor_{sensor}, object_{sensor.object()}, detections_{}, output_{} {
+  output_.reserve(static_cast<std::size_t>(std::max(sensor.data().max_detectable_objects, 0)));
+}
+
+void BrsSensorUnit::initialize(ISimulation* const simulation) { step(simulation); }
+
+void BrsSensorUnit::step(ISimulation*) {
+  const api::types::SensorData& setup = sensor_.data();
+  const api::types::WorldObjectData& self = object_.data();
+  const headless::Frame frame = headless::compose(headless::frameOf(self.pose), setup.pose);
+  const double focal_x = 1.0 / std::tan(setup.fov_horizontal / 2);
+  const double focal_y = 1.0 / std::tan(setup.fov_vertical / 2);
+  const double width = setup.resolution_x;
+  const double height = setup.resolution_y;
+
+  detections_.clear();
+  output_.clear();
+  const std::shared_ptr<api::experiment::ExperimentData> experiment = self.experiment.lock();
+  if (experiment == nullptr) return;
+  std::vector<double> distances;
+  for (const std::shared_ptr<api::types::WorldObjectData>& other : experiment->objects) {
+    if (other.get() == &self || other->is_removed) continue;
+    if (other->sensor_detectability != api::types::SensorDetectabilityDetectable) continue;
+    if (!headless::mayBeWithin(*other, frame.origin, setup.range)) continue;
+
+    const headless::Point centre = headless::toLocal(frame, headless::boundingBoxCentre(*other));
+    const double distance = std::hypot(centre[0], centre[1], centre[2]);
+    if (distance > setup.range) continue;
+
+    // Project the corners of the bounding box on the image plane, in normalised coordinates
+    const headless::Frame object_frame = headless::frameOf(other->pose);
+    const double half_length = other->bounding_box.x() / 2, half_width = other->bounding_box.y() / 2;
+    double left = std::numeric_limits<double>::infinity(), right = -left, bottom = left, top = -left;
+    bool is_behind = false;
+    for (const double x : {-half_length, half_length}) {
+      for (const double y : {-half_width, half_width}) {
+        for (const double z : {0.0, other->bounding_box.z()}) {
+          const headless::Point corner = headless::toLocal(frame, headless::toWorld(object_frame, {x, y, z}));
+          if (corner[0] <= 0) {
+            is_behind = true;
+            break;
+          }
+          const double u = (1 - focal_x * corner[1] / corner[0]) / 2;
+          const double v = (1 + focal_y * corner[2] / corner[0]) / 2;
+          left = std::min(left, u);
+          right = std::max(right, u);
+          bottom = std::min(bottom, v);
+          top = std::max(top, v);
+        }
+        if (is_behind) break;
+      }
+      if (is_behind) break;
+    }
+    if (is_behind || right <= 0 || left >= 1 || top <= 0 || bottom >= 1) continue;
+
+    detections_.push_back(BrsSensorDetection{other->id, std::max(left, 0.0) * width, std::min(right, 1.0) * width,
+                                             std::max(bottom, 0.0) * height, std::min(top, 1.0) * height});
+    distances.push_back(distance);
+  }
+
+  // Sort the detections by distance through an index, since the distance is not part of the output
+  std::vector<std::size_t> order(detections_.size());
+  for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+  const auto max_detections = static_cast<std::size_t>(std::max(setup.max_detectable_objects, 0));
+  const std::size_t size = std::min(order.size(), max_detections);
+  std::partial_sort(
+      order.begin(), order.begin() + static_cast<std::ptrdiff_t>(size), order.end(),
+      [&distances](const std::size_t lhs, const std::size_t rhs) { return distances[lhs] < distances[rhs]; });
+  for (std::size_t i = 0; i < size; ++i) output_.push_back(&detections_[order[i]]);
+}
+
+}  // namespace prescan::sim
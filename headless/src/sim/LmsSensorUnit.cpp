@@ -0,0 +1,30 @@
+#include "prescan/sim/LmsSensorUnit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace prescan::sim {
+
+namespace {
+constexpr double lane_width = 3.5;  ///< Distance between two consecutive lane lines, in m
+}  // namespace
+
+LmsSensorUnit::LmsSensorUnit(const api::lms::LmsSensor& sensor, std::string)
+    : Unit{StageSensing}, lines_(static_cast<std::size_t>(std::max(sensor.data().max_lines, 0))) {
+  const api::types::SensorData& setup = sensor.data();
+  std::size_t points = static_cast<std::size_t>(std::max(setup.max_points_per_line, 0));
+  if (setup.point_spacing > 0)
+    points = std::min(points, static_cast<std::size_t>(std::floor(setup.range / setup.point_spacing)));
+  const double centre = (static_cast<double>(lines_.size()) - 1) / 2;
+  for (std::size_t line = 0; line < lines_.size(); ++line) {
+    lines_[line].resize(points);
+    for (std::size_t point = 0; point < points; ++point) {
+      lines_[line][point] = LmsSensorPoint{static_cast<double>(point + 1) * setup.point_spacing,
+                                           (centre - static_cast<double>(line)) * lane_width,
+                                           -setup.pose.position().z(), 0};
+    }
+  }
+}
+
+}  // namespace prescan::sim
@@ -0,0 +1,44 @@
+#include "prescan/sim/ManualSimulation.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "prescan/api/experiment/Experiment.hpp"
+#include "prescan/sim/Unit.hpp"
+
+namespace prescan::sim {
+
+void ManualSimulation::initialize(const api::experiment::Experiment& experiment) {
+  units_.clear();
+  is_stopped_ = false;
+  experiment_ = experiment;
+  sample_time_ = 1.0 / experiment.scheduler().simulationFrequency();
+  experiment_.data().resetKinematics();
+  model_->registerSimulationUnits(experiment, this);
+  std::stable_sort(units_.begin(), units_.end(),
+                   [](const std::unique_ptr<Unit>& lhs, const std::unique_ptr<Unit>& rhs) {
+                     return lhs->stage() < rhs->stage();
+                   });
+  sensing_begin_ = static_cast<std::size_t>(
+      std::find_if(units_.begin(), units_.end(),
+                   [](const std::unique_ptr<Unit>& unit) { return unit->stage() == Unit::StageSensing; }) -
+      units_.begin());
+  for (const std::unique_ptr<Unit>& unit : units_) unit->initialize(this);
+  model_->initialize(this);
+}
+
+void ManualSimulation::step() {
+  for (std::size_t i = 0; i < sensing_begin_; ++i) units_[i]->step(this);
+  experiment_.data().updateKinematics(sample_time_);
+  for (std::size_t i = sensing_begin_; i < units_.size(); ++i) units_[i]->step(this);
+  model_->step(this);
+}
+
+void ManualSimulation::terminate() {
+  model_->terminate(this);
+  for (const std::unique_ptr<Unit>& unit : units_) unit->terminate(this);
+  units_.clear();
+  sensing_begin_ = 0;
+}
+
+}  // namespace prescan::sim
@@ -0,0 +1,17 @@
+/**
+ * @file map.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Public header of the map module of the symaware library
+ */
+#pragma once
+
+#include "symaware/map/frenet_transform.h"
+#include "symaware/map/json.h"
+#include "symaware/map/lane_index.h"
+#include "symaware/map/reference_line.h"
+#include "symaware/map/road_network.h"
+#include "symaware/map/router.h"
+#include "symaware/map/spatial_hash.h"
+#include "symaware/map/xml.h"
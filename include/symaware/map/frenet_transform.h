@@ -0,0 +1,137 @@
+/**
+ * @file frenet_transform.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief FrenetTransform class
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "symaware/map/lane_index.h"
+#include "symaware/map/reference_line.h"
+
+namespace symaware {
+
+class RoadNetwork;
+
+/**
+ * @brief Batch transform between Cartesian poses and road relative Frenet coordinates.
+ *
+ * The transform works either on a single reference line or on a whole @ref RoadNetwork.
+ * Each pose is first matched to a stretch of the reference line through a spatial index,
+ * then its arc length is refined with Newton iterations by @ref ReferenceLine::project.
+ * On a single reference line, the index covers a corridor of `max_offset` metres on both sides of the line,
+ * while on a road network the index of the network is used, so only poses lying on a lane are transformed.
+ *
+ * Batches are split across threads, since each pose is transformed independently of the others.
+ * The threads belong to a pool shared by all the transforms, started with the first batch large enough to be split.
+ * The transform keeps a copy of the reference line, but only a reference to the road network,
+ * which must outlive it.
+ */
+class FrenetTransform {
+ public:
+  /** Frenet coordinates of a batch of poses, stored by coordinate */
+  struct Coordinates {
+    std::vector<double> s;              ///< Arc length along the reference line
+    std::vector<double> d;              ///< Lateral offset from the reference line, positive to the left
+    std::vector<double> heading_error;  ///< Heading relative to the driving direction of the lane, in [-π, π]
+    std::vector<int> lane;              ///< Id of the lane, or 0 if the pose is not on any lane
+    std::vector<std::size_t> road;      ///< Index of the road, or @ref npos if the pose could not be transformed
+
+    std::size_t size() const { return s.size(); }
+  };
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);  ///< Missing road
+
+  /**
+   * @brief Construct a new transform over a single reference @p line.
+   *
+   * Lanes are assumed to keep a constant width along the whole line.
+   * @param line reference line of the road
+   * @param left_widths widths of the lanes to the left of the line, from the innermost outwards
+   * @param right_widths widths of the lanes to the right of the line, from the innermost outwards
+   * @param max_offset maximum lateral offset of the poses that can be transformed
+   * @param step length of the stretches of the reference line stored in the spatial index
+   * @throw std::invalid_argument if the @p line has no geometries or @p max_offset or @p step are not positive
+   */
+  explicit FrenetTransform(ReferenceLine line, std::vector<double> left_widths = {},
+                           std::vector<double> right_widths = {}, double max_offset = 50, double step = 1);
+  /**
+   * @brief Construct a new transform over all the lanes of a road @p network.
+   * @param network road network, which must outlive the transform
+   */
+  explicit FrenetTransform(const RoadNetwork& network);
+
+  /**
+   * @brief Transform @p n Cartesian poses into Frenet coordinates.
+   *
+   * Poses that cannot be transformed get NaN coordinates, lane 0 and road @ref npos.
+   * On a single reference line, the road is always 0.
+   * @param poses row-major array of @p n poses `x, y, heading`
+   * @param n number of poses
+   * @param s output arc lengths, @p n elements
+   * @param d output lateral offsets, @p n elements
+   * @param heading_error output heading errors, @p n elements
+   * @param lane output lane ids, @p n elements
+   * @param road output road indices, @p n elements
+   */
+  void toFrenet(const double* poses, std::size_t n, double* s, double* d, double* heading_error, int* lane,
+                std::size_t* road) const;
+  /**
+   * @brief Transform the Cartesian @p poses into Frenet coordinates.
+   * @param poses row-major array of poses `x, y, heading`
+   * @return Frenet coordinates of the poses
+   * @throw std::invalid_argument if the size of @p poses is not a multiple of 3
+   */
+  Coordinates toFrenet(const std::vector<double>& poses) const;
+  /**
+   * @brief Transform @p n Frenet coordinates back into Cartesian poses.
+   *
+   * The heading of each pose is the heading of the reference line at its arc length.
+   * Consecutive coordinates on the same road are sampled together by @ref ReferenceLine::sample.
+   * Arc lengths outside the road are clamped to its ends.
+   * @param road road index of the coordinates, @p n elements. Ignored on a single reference line
+   * @param s arc lengths, @p n elements
+   * @param d lateral offsets, @p n elements
+   * @param n number of coordinates
+   * @param poses output row-major array of @p n poses `x, y, heading`
+   * @throw std::out_of_range if a road index is not in the road network
+   */
+  void fromFrenet(const std::size_t* road, const double* s, const double* d, std::size_t n, double* poses) const;
+
+  /**
+   * @brief Set the number of threads batches are split across.
+   * @param threads number of threads. If 0, the number of hardware threads is used
+   */
+  void setThreads(std::size_t threads) { threads_ = threads; }
+
+  const RoadNetwork* network() const { return network_; }
+  const ReferenceLine& reference_line() const { return line_; }
+  const std::vector<double>& left_widths() const { return left_widths_; }
+  const std::vector<double>& right_widths() const { return right_widths_; }
+  double max_offset() const { return max_offset_; }
+  std::size_t threads() const { return threads_; }
+
+ private:
+  /** Transform the poses in [@p begin, @p end) on the reference line */
+  void toFrenetLine(const double* poses, std::size_t begin, std::size_t end, double* s, double* d,
+                    double* heading_error, int* lane, std::size_t* road) const;
+  /** Transform the poses in [@p begin, @p end) on the road network */
+  void toFrenetNetwork(const double* poses, std::size_t begin, std::size_t end, double* s, double* d,
+                       double* heading_error, int* lane, std::size_t* road) const;
+  /** @return id of the lane at the lateral offset @p d from the reference line */
+  int laneId(double d) const;
+
+  const RoadNetwork* network_;        ///< Road network, or nullptr when transforming on the reference line
+  ReferenceLine line_;                ///< Reference line, when not transforming on a road network
+  std::vector<double> left_widths_;   ///< Widths of the lanes to the left of the reference line
+  std::vector<double> right_widths_;  ///< Widths of the lanes to the right of the reference line
+  double max_offset_;                 ///< Maximum lateral offset of the poses on the reference line
+  LaneIndex index_;                   ///< Corridors around the stretches of the reference line
+  std::size_t threads_;               ///< Number of threads batches are split across, 0 for the hardware threads
+};
+
+}  // namespace symaware
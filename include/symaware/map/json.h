@@ -0,0 +1,136 @@
+/**
+ * @file json.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Minimal streaming JSON reader
+ */
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Pull reader of JSON documents.
+ *
+ * The document is read from the stream in fixed size chunks and returned one token at a time,
+ * so that arbitrarily large documents can be processed without keeping them in memory.
+ * The grammar of the document is validated as it is read.
+ * @code
+ * JsonReader reader{stream};
+ * reader.expect(JsonReader::Token::BEGIN_OBJECT);
+ * while (reader.next() == JsonReader::Token::KEY) {
+ *   if (reader.string() == "value") value = reader.readNumber();
+ *   else reader.skipValue();
+ * }
+ * @endcode
+ */
+class JsonReader {
+ public:
+  /** Token of a JSON document */
+  enum class Token {
+    BEGIN_OBJECT,  ///< Start of an object
+    END_OBJECT,    ///< End of an object
+    BEGIN_ARRAY,   ///< Start of an array
+    END_ARRAY,     ///< End of an array
+    KEY,           ///< Key of a member of an object. The value follows
+    STRING,        ///< String value
+    NUMBER,        ///< Number value
+    BOOLEAN,       ///< Boolean value
+    NULL_VALUE,    ///< Null value
+    END,           ///< End of the document
+  };
+
+  /**
+   * @brief Construct a new reader of the document in the stream @p is.
+   * @param is stream containing the document. It must outlive the reader
+   */
+  explicit JsonReader(std::istream& is);
+
+  /**
+   * @brief Read the next token of the document.
+   * @return token read
+   * @throw std::runtime_error if the document is malformed
+   */
+  Token next();
+  /**
+   * @brief Read the next token of the document and check it is @p token.
+   * @param token expected token
+   * @throw std::runtime_error if the document is malformed or the token is not the expected one
+   */
+  void expect(Token token);
+  /**
+   * @brief Skip the next value of the document, including all its content if it is an object or an array.
+   * @throw std::runtime_error if the document is malformed
+   */
+  void skipValue();
+  /**
+   * @brief Read the next token of the document, which must be a number.
+   * @return value of the number
+   * @throw std::runtime_error if the document is malformed or the token is not a number
+   */
+  double readNumber();
+  /**
+   * @brief Read the next token of the document, which must be a string.
+   * @return value of the string
+   * @throw std::runtime_error if the document is malformed or the token is not a string
+   */
+  const std::string& readString();
+  /**
+   * @brief Read the next token of the document, which must be a boolean.
+   * @return value of the boolean
+   * @throw std::runtime_error if the document is malformed or the token is not a boolean
+   */
+  bool readBoolean();
+  /**
+   * @brief Report an error at the current position of the document.
+   * @param message description of the error
+   * @throw std::runtime_error always. The message reports the line of the error
+   */
+  [[noreturn]] void error(std::string_view message) const;
+
+  /** @return last token read */
+  Token token() const { return token_; }
+  /** @return value of the last key or string read */
+  const std::string& string() const { return string_; }
+  /** @return value of the last number read */
+  double number() const { return number_; }
+  /** @return value of the last boolean read */
+  bool boolean() const { return boolean_; }
+  /** @return line of the document the reader is at, starting from 1 */
+  std::size_t line() const { return line_; }
+
+ private:
+  /** @return next character of the document without consuming it, or EOF at the end of the stream */
+  int peek() { return pos_ < size_ ? static_cast<unsigned char>(buffer_[pos_]) : refill(); }
+  /** Read the next chunk of the document from the stream. @return first character of the chunk, or EOF */
+  int refill();
+  /** @return next character of the document, or EOF at the end of the stream */
+  int get();
+  void skipSpaces();
+  void readStringContent();
+  void readNumberContent();
+  void readLiteral(std::string_view literal);
+
+  std::istream& is_;              ///< Stream the document is read from
+  std::vector<char> buffer_;      ///< Chunk of the document read from the stream
+  std::size_t pos_;               ///< Position of the next character in the buffer
+  std::size_t size_;              ///< Number of valid characters in the buffer
+  std::size_t line_;              ///< Line of the document the reader is at
+  std::vector<char> containers_;  ///< Opening characters of the containers the reader is in
+  bool expect_value_;             ///< Whether a value, or a key inside an object, is expected next
+  bool allow_close_;              ///< Whether the current container can be closed right away, as it is still empty
+  bool after_key_;                ///< Whether a key has just been read and its value is expected next
+  Token token_;                   ///< Last token read
+  std::string string_;            ///< Value of the last key or string read
+  std::string number_text_;       ///< Text of the last number read, kept to reuse its storage
+  double number_;                 ///< Value of the last number read
+  bool boolean_;                  ///< Value of the last boolean read
+};
+
+}  // namespace symaware
@@ -0,0 +1,104 @@
+/**
+ * @file lane_index.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief LaneIndex class
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Uniform grid over the quadrilaterals sampled along the lanes of a road network.
+ *
+ * Each quadrilateral covers a short stretch of a single lane and is registered in all the cells overlapped by its
+ * bounding box.
+ * After @ref build, the cells are stored contiguously, so that a query costs a hash lookup and a few
+ * point-in-quadrilateral tests, independently of the size of the network.
+ */
+class LaneIndex {
+ public:
+  /** Stretch of a lane between two arc lengths */
+  struct Quad {
+    std::array<double, 4> x;  ///< X coordinates of the corners, in order around the quadrilateral
+    std::array<double, 4> y;  ///< Y coordinates of the corners, in order around the quadrilateral
+    std::size_t lane;         ///< Index of the lane in the road network
+    double s_start;           ///< Arc length of the reference line at the start of the quadrilateral
+    double s_end;             ///< Arc length of the reference line at the end of the quadrilateral
+
+    /**
+     * @brief Check whether the point (@p x, @p y) lies inside the quadrilateral.
+     * @param px X coordinate of the point
+     * @param py Y coordinate of the point
+     * @return true if the point is inside or on the boundary of the quadrilateral
+     * @return false if the point is outside the quadrilateral
+     */
+    bool contains(double px, double py) const;
+  };
+
+  /**
+   * @brief Construct a new empty index.
+   * @param cell_size side of the cells of the grid
+   */
+  explicit LaneIndex(double cell_size = 8);
+
+  /**
+   * @brief Add a @p quad to the index.
+   *
+   * The quadrilateral will only be found by @ref query after the next @ref build.
+   * @param quad quadrilateral to add
+   */
+  void insert(const Quad& quad);
+  /**
+   * @brief Lay out the cells of the grid for querying.
+   */
+  void build();
+  /**
+   * @brief Remove all the quadrilaterals from the index.
+   */
+  void clear();
+
+  /**
+   * @brief Call @p callback with every quadrilateral containing the point (@p x, @p y).
+   * @tparam F callable with signature `void(const Quad&)`
+   * @param x X coordinate of the point
+   * @param y Y coordinate of the point
+   * @param callback callback invoked for each quadrilateral containing the point
+   */
+  template <class F>
+  void query(const double x, const double y, F&& callback) const {
+    const auto it = cells_.find(cellKey(x, y));
+    if (it == cells_.end()) return;
+    for (std::uint32_t i = it->second.first; i < it->second.second; ++i) {
+      const Quad& quad = quads_[entries_[i]];
+      if (quad.contains(x, y)) callback(quad);
+    }
+  }
+
+  double cell_size() const { return cell_size_; }
+  const std::vector<Quad>& quads() const { return quads_; }
+
+ private:
+  /** @return key of the cell with coordinates (@p i, @p j) */
+  static std::uint64_t cellKey(std::int64_t i, std::int64_t j) {
+    return (static_cast<std::uint64_t>(i) << 32) ^ (static_cast<std::uint64_t>(j) & 0xFFFFFFFFu);
+  }
+  /** @return key of the cell containing the point (@p x, @p y) */
+  std::uint64_t cellKey(double x, double y) const;
+
+  double cell_size_;                                                                  ///< Side of the cells of the grid
+  std::vector<Quad> quads_;                                                           ///< Quadrilaterals in the index
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> pending_;                      ///< Cell-quad pairs to lay out
+  std::vector<std::uint32_t> entries_;                                                ///< Quadrilaterals sorted by cell
+  std::unordered_map<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>> cells_;  ///< Range of entries by cell
+};
+
+}  // namespace symaware
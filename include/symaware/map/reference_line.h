@@ -0,0 +1,236 @@
+/**
+ * @file reference_line.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief ReferenceLine class
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Fresnel integrals `C(x) = ∫cos(πt²/2)dt` and `S(x) = ∫sin(πt²/2)dt` over [0, x].
+ *
+ * Small arguments use the power series, larger ones the continued fraction of the complementary error function.
+ * @param x upper bound of the integrals
+ * @return pair `(C(x), S(x))`
+ */
+std::pair<double, double> fresnel(double x);
+
+/**
+ * @brief Reference line of a road, as a sequence of planar geometries following the OpenDRIVE plan view.
+ *
+ * The line is parametrised by its arc length `s`, starting from the `s` of the first geometry.
+ * Each geometry carries its own starting pose, so the line stays correct even if consecutive geometries
+ * do not join perfectly.
+ * Geometries can also be chained, mirroring the sections of a @ref Road:
+ * each one starts at the end of the previous one, or at the origin of the line.
+ * The lateral offset `t` is positive to the left of the line.
+ */
+class ReferenceLine {
+ public:
+  /** Type of a geometry, matching the elements of the OpenDRIVE plan view */
+  enum class GeometryType {
+    Line,        ///< Straight line
+    Arc,         ///< Arc with constant curvature
+    Spiral,      ///< Clothoid, with curvature changing linearly along the geometry
+    Poly3,       ///< Cubic polynomial `v(u)` in the local frame of the geometry
+    ParamPoly3,  ///< Parametric cubic polynomials `u(p)` and `v(p)` in the local frame of the geometry
+  };
+  /** Geometry of the reference line */
+  struct Geometry {
+    GeometryType type;  ///< Type of the geometry
+    double s;           ///< Arc length at the start of the geometry
+    double x;           ///< X coordinate of the start of the geometry
+    double y;           ///< Y coordinate of the start of the geometry
+    double heading;     ///< Heading at the start of the geometry
+    double length;      ///< Length of the geometry
+    /**
+     * Parameters of the geometry:
+     * the curvature of an arc, the start and end curvature of a spiral,
+     * `a, b, c, d` of a cubic polynomial, `aU, bU, cU, dU, aV, bV, cV, dV` of a parametric cubic polynomial
+     */
+    std::array<double, 8> parameters;
+    /** Whether the parameter of a parametric cubic polynomial ranges in [0, 1] instead of [0, length] */
+    bool normalized;
+
+    static Geometry line(double s, double x, double y, double heading, double length);
+    static Geometry arc(double s, double x, double y, double heading, double length, double curvature);
+    static Geometry spiral(double s, double x, double y, double heading, double length, double curvature_start,
+                           double curvature_end);
+    static Geometry poly3(double s, double x, double y, double heading, double length, double a, double b, double c,
+                          double d);
+    static Geometry paramPoly3(double s, double x, double y, double heading, double length,
+                               const std::array<double, 4>& u, const std::array<double, 4>& v, bool normalized);
+  };
+  /** Point on the reference line */
+  struct Point {
+    double x;          ///< X coordinate
+    double y;          ///< Y coordinate
+    double heading;    ///< Heading of the tangent
+    double curvature;  ///< Signed curvature, positive when turning left
+  };
+  /** Points of the reference line, stored by coordinate */
+  struct Samples {
+    std::vector<double> s;          ///< Arc length of the points
+    std::vector<double> x;          ///< X coordinate of the points
+    std::vector<double> y;          ///< Y coordinate of the points
+    std::vector<double> heading;    ///< Heading of the tangent at the points
+    std::vector<double> curvature;  ///< Signed curvature at the points
+
+    std::size_t size() const { return s.size(); }
+  };
+
+  /**
+   * @brief Construct a new empty reference line.
+   * @param x X coordinate of the origin, where the first chained geometry starts
+   * @param y Y coordinate of the origin, where the first chained geometry starts
+   * @param heading heading at the origin
+   */
+  explicit ReferenceLine(double x = 0, double y = 0, double heading = 0);
+
+  /**
+   * @brief Append a @p geometry to the reference line.
+   * @param geometry geometry to append
+   * @throw std::invalid_argument if the length of the geometry is not positive
+   * or the geometry starts before the end of the previous one
+   */
+  void addGeometry(const Geometry& geometry);
+  /**
+   * @brief Chain a straight line to the reference line.
+   * @param length length of the line
+   * @return instance reference
+   * @throw std::invalid_argument if the @p length is not positive
+   */
+  ReferenceLine& addLine(double length);
+  /**
+   * @brief Chain an arc to the reference line.
+   * @param length length of the arc
+   * @param curvature curvature of the arc, positive when turning left
+   * @return instance reference
+   * @throw std::invalid_argument if the @p length is not positive
+   */
+  ReferenceLine& addArc(double length, double curvature);
+  /**
+   * @brief Chain a clothoid to the reference line.
+   * @param length length of the clothoid
+   * @param curvature_start curvature at the start of the clothoid
+   * @param curvature_end curvature at the end of the clothoid
+   * @return instance reference
+   * @throw std::invalid_argument if the @p length is not positive
+   */
+  ReferenceLine& addSpiral(double length, double curvature_start, double curvature_end);
+  /**
+   * @brief Chain a cubic polynomial `v(u) = a + b u + c u² + d u³` to the reference line.
+   * @param length arc length of the polynomial
+   * @return instance reference
+   * @throw std::invalid_argument if the @p length is not positive
+   */
+  ReferenceLine& addPoly3(double length, double a, double b, double c, double d);
+  /**
+   * @brief Chain the parametric cubic polynomials `u(p)` and `v(p)` to the reference line.
+   * @param length arc length of the polynomials
+   * @param u coefficients `aU, bU, cU, dU`
+   * @param v coefficients `aV, bV, cV, dV`
+   * @param normalized whether `p` ranges in [0, 1] instead of [0, length]
+   * @return instance reference
+   * @throw std::invalid_argument if the @p length is not positive
+   */
+  ReferenceLine& addParamPoly3(double length, const std::array<double, 4>& u, const std::array<double, 4>& v,
+                               bool normalized);
+  /**
+   * @brief Move the origin of the reference line, rigidly moving all its geometries along with it.
+   * @param x X coordinate of the new origin
+   * @param y Y coordinate of the new origin
+   * @param heading heading at the new origin
+   */
+  void setOrigin(double x, double y, double heading);
+
+  /**
+   * @brief Point of the reference line at the arc length @p s.
+   *
+   * Values of @p s outside the line are clamped to its ends.
+   * @param s arc length
+   * @return point at the arc length @p s
+   */
+  Point point(double s) const;
+  /**
+   * @brief Sample the reference line at the @p n arc lengths @p s.
+   *
+   * Consecutive arc lengths falling in the same geometry are evaluated together by a loop specialised for that
+   * geometry, which hoists the constants of the geometry out of the loop.
+   * Sorted arc lengths are hence the fastest to evaluate.
+   * Values of @p s outside the line are clamped to its ends.
+   * @param s arc lengths to sample, @p n elements
+   * @param n number of samples
+   * @param x output X coordinates, @p n elements
+   * @param y output Y coordinates, @p n elements
+   * @param heading output headings, @p n elements
+   * @param curvature output curvatures, @p n elements
+   */
+  void sample(const double* s, std::size_t n, double* x, double* y, double* heading, double* curvature) const;
+  /**
+   * @brief Sample the reference line at the arc lengths @p s.
+   * @param s arc lengths to sample
+   * @return points at the arc lengths @p s
+   */
+  Samples sample(std::vector<double> s) const;
+  /**
+   * @brief Sample the reference line every @p step metres, from its start to its end included.
+   * @param step distance between consecutive samples
+   * @return points of the reference line
+   * @throw std::invalid_argument if the @p step is not positive
+   */
+  Samples sampleUniform(double step) const;
+  /**
+   * @brief Project the point (@p x, @p y) onto the reference line.
+   *
+   * Newton iterations on the arc length start from @p s and stop once the update is negligible.
+   * The projection is only guaranteed to be the closest one if @p s is already close to it.
+   * @param x X coordinate of the point
+   * @param y Y coordinate of the point
+   * @param s initial guess of the arc length of the projection
+   * @return pair `(s, t)` of the projection, with `t` the lateral offset of the point from the line
+   */
+  std::pair<double, double> project(double x, double y, double s) const;
+
+  /** @return arc length at the start of the reference line */
+  double start() const { return geometries_.empty() ? 0 : geometries_.front().s; }
+  /** @return arc length at the end of the reference line */
+  double end() const { return geometries_.empty() ? 0 : geometries_.back().s + geometries_.back().length; }
+  /** @return total length of the geometries of the reference line */
+  double length() const;
+  const std::vector<Geometry>& geometries() const { return geometries_; }
+  double origin_x() const { return origin_x_; }
+  double origin_y() const { return origin_y_; }
+  double origin_heading() const { return origin_heading_; }
+
+ private:
+  /** Arc length of a cubic polynomial geometry sampled along its `u` parameter */
+  struct ArcLengthTable {
+    std::vector<double> u;  ///< Samples of the parameter
+    std::vector<double> s;  ///< Arc length at each sample
+  };
+
+  /** @return index of the geometry containing the arc length @p s */
+  std::size_t geometryIndex(double s) const;
+  /** @return point where the next chained geometry starts */
+  Point chainStart() const;
+  /** Sample the @p index-th geometry at the @p n arc lengths @p s, clamped to the geometry */
+  void sampleGeometry(std::size_t index, const double* s, std::size_t n, double* x, double* y, double* heading,
+                      double* curvature) const;
+
+  double origin_x_;                                ///< X coordinate of the origin of the line
+  double origin_y_;                                ///< Y coordinate of the origin of the line
+  double origin_heading_;                          ///< Heading at the origin of the line
+  std::vector<Geometry> geometries_;               ///< Geometries of the reference line, sorted by arc length
+  std::vector<ArcLengthTable> arc_length_tables_;  ///< Arc length tables of the cubic polynomial geometries
+};
+
+}  // namespace symaware
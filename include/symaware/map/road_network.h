@@ -0,0 +1,262 @@
+/**
+ * @file road_network.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief RoadNetwork class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/lane_index.h"
+#include "symaware/map/reference_line.h"
+
+namespace symaware {
+
+struct XmlNode;
+
+/**
+ * @brief Road network loaded from OpenDRIVE 1.4 files.
+ *
+ * The network keeps the roads with their reference lines, lane sections and links, as well as a lane graph in the
+ * driving direction and a @ref LaneIndex over the lane surfaces, used to locate points in the network.
+ * Lanes follow the OpenDRIVE conventions: positive ids are to the left of the reference line,
+ * negative ids to the right, with right hand traffic.
+ * Elements and attributes the network does not use are ignored.
+ */
+class RoadNetwork {
+ public:
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();  ///< Missing index
+
+  /** Cubic polynomial `a + b ds + c ds² + d ds³`, with `ds` the distance from @ref s */
+  struct CubicPolynomial {
+    double s;  ///< Arc length the polynomial starts from
+    double a;  ///< Constant coefficient
+    double b;  ///< Linear coefficient
+    double c;  ///< Quadratic coefficient
+    double d;  ///< Cubic coefficient
+
+    double operator()(const double value) const {
+      const double ds = value - s;
+      return a + ds * (b + ds * (c + ds * d));
+    }
+  };
+  /** End of a road a link is attached to */
+  enum class ContactPoint {
+    Start,  ///< Start of the road
+    End,    ///< End of the road
+  };
+  /** Link of a road to the element preceding or following it */
+  struct Link {
+    /** Type of the linked element */
+    enum class ElementType {
+      None,      ///< The road is not linked
+      Road,      ///< The road is linked to another road
+      Junction,  ///< The road is linked to a junction
+    };
+    ElementType element_type{ElementType::None};      ///< Type of the linked element
+    std::string element_id;                           ///< Id of the linked element
+    ContactPoint contact_point{ContactPoint::Start};  ///< End of the linked road the link is attached to
+  };
+  /** Lane of a lane section */
+  struct Lane {
+    int id;                               ///< Id of the lane, positive to the left of the reference line
+    std::string type;                     ///< Type of the lane, e.g. `driving`, `sidewalk`, `shoulder`
+    std::vector<CubicPolynomial> widths;  ///< Width of the lane, relative to the start of the lane section
+    std::optional<int> predecessor;       ///< Id of the preceding lane, if any
+    std::optional<int> successor;         ///< Id of the following lane, if any
+    std::size_t node{npos};               ///< Index of the lane in the lane graph
+  };
+  /** Stretch of road with a constant set of lanes */
+  struct LaneSection {
+    double s;                 ///< Arc length at the start of the section
+    double s_end;             ///< Arc length at the end of the section
+    std::vector<Lane> left;   ///< Lanes to the left of the reference line, from the innermost outwards
+    std::vector<Lane> right;  ///< Lanes to the right of the reference line, from the innermost outwards
+
+    /**
+     * @brief Lane with the given @p id.
+     * @param id id of the lane
+     * @return pointer to the lane, or nullptr if the section has no such lane
+     */
+    const Lane* lane(int id) const;
+  };
+  /** Road of the network */
+  struct Road {
+    std::string id;                             ///< Id of the road
+    std::string name;                           ///< Name of the road
+    double length;                              ///< Length of the road
+    std::string junction;                       ///< Id of the junction the road belongs to, or `-1`
+    Link predecessor;                           ///< Element preceding the road
+    Link successor;                             ///< Element following the road
+    ReferenceLine reference_line;               ///< Reference line of the road
+    std::vector<CubicPolynomial> elevations;    ///< Elevation profile of the reference line
+    std::vector<CubicPolynomial> lane_offsets;  ///< Lateral offset of the centre lane from the reference line
+    std::vector<LaneSection> sections;          ///< Lane sections, sorted by arc length
+
+    /**
+     * @brief Lane section at the arc length @p s.
+     * @param s arc length
+     * @return index of the lane section containing @p s
+     */
+    std::size_t section(double s) const;
+    /**
+     * @brief Elevation of the reference line at the arc length @p s.
+     * @param s arc length
+     * @return elevation at @p s, or 0 if the road has no elevation profile
+     */
+    double elevation(double s) const;
+    /**
+     * @brief Lateral offset of the centre lane at the arc length @p s.
+     * @param s arc length
+     * @return offset at @p s, or 0 if the road has no lane offsets
+     */
+    double laneOffset(double s) const;
+  };
+  /** Connection of an incoming road to a connecting road inside a junction */
+  struct Connection {
+    std::string id;                               ///< Id of the connection
+    std::string incoming_road;                    ///< Id of the road entering the junction
+    std::string connecting_road;                  ///< Id of the road inside the junction
+    ContactPoint contact_point;                   ///< End of the connecting road attached to the incoming road
+    std::vector<std::pair<int, int>> lane_links;  ///< Pairs of incoming and connecting lane ids
+  };
+  /** Junction of the network */
+  struct Junction {
+    std::string id;                       ///< Id of the junction
+    std::string name;                     ///< Name of the junction
+    std::vector<Connection> connections;  ///< Connections of the junction
+  };
+  /** Node of the lane graph, one for each lane of each lane section */
+  struct LaneNode {
+    std::size_t road;                       ///< Index of the road
+    std::size_t section;                    ///< Index of the lane section in the road
+    int lane;                               ///< Id of the lane in the lane section
+    std::vector<std::size_t> successors;    ///< Lanes that can be entered at the end of this one
+    std::vector<std::size_t> predecessors;  ///< Lanes this one can be entered from
+    std::size_t left{npos};                 ///< Adjacent lane on the left, in the driving direction
+    std::size_t right{npos};                ///< Adjacent lane on the right, in the driving direction
+  };
+  /** Location of a point in the network */
+  struct LaneLocation {
+    std::size_t road;     ///< Index of the road
+    std::size_t section;  ///< Index of the lane section in the road
+    int lane;             ///< Id of the lane
+    std::size_t node;     ///< Index of the lane in the lane graph
+    double s;             ///< Arc length of the projection of the point on the reference line
+    double t;             ///< Lateral offset of the point from the reference line, positive to the left
+  };
+
+  /**
+   * @brief Construct a new empty road network.
+   * @param sample_step maximum length of the stretches of lane stored in the spatial index
+   * @param cell_size side of the cells of the spatial index
+   */
+  explicit RoadNetwork(double sample_step = 1, double cell_size = 8);
+
+  /**
+   * @brief Import the roads and junctions of an OpenDRIVE file into the network.
+   * @param filename path to the OpenDRIVE file
+   * @throw std::runtime_error if the file cannot be read or is not a valid OpenDRIVE file
+   */
+  void importOpenDriveFile(const std::string& filename);
+  /**
+   * @brief Import the roads and junctions of an OpenDRIVE document into the network.
+   *
+   * Links are resolved and the spatial index is rebuilt over the whole network,
+   * so roads of different documents can refer to each other.
+   * @param content content of the OpenDRIVE document
+   * @throw std::runtime_error if the document is not a valid OpenDRIVE document
+   */
+  void importOpenDrive(std::string_view content);
+  /**
+   * @brief Remove all the roads and junctions from the network.
+   */
+  void clear();
+
+  /**
+   * @brief Locate the point (@p x, @p y) in the network.
+   *
+   * If lanes overlap, e.g. inside a junction, the lane whose centre is closest to the point is chosen.
+   * @param x X coordinate of the point
+   * @param y Y coordinate of the point
+   * @return location of the point, or an empty optional if the point is not on any lane
+   */
+  std::optional<LaneLocation> locate(double x, double y) const;
+  /**
+   * @brief Locate the point (@p x, @p y) in all the lanes it lies on.
+   * @param x X coordinate of the point
+   * @param y Y coordinate of the point
+   * @return locations of the point, one for each lane it lies on
+   */
+  std::vector<LaneLocation> locateAll(double x, double y) const;
+
+  /**
+   * @brief Lateral offsets of the boundaries of a lane.
+   * @param road index of the road
+   * @param section index of the lane section in the road
+   * @param lane id of the lane
+   * @param s arc length
+   * @return pair of lateral offsets of the inner and outer boundary of the lane at @p s
+   */
+  std::pair<double, double> laneBoundaries(std::size_t road, std::size_t section, int lane, double s) const;
+  /**
+   * @brief Index of the road with the given @p id.
+   * @param id id of the road
+   * @return index of the road, or @ref npos if there is no such road
+   */
+  std::size_t roadIndex(const std::string& id) const;
+  /**
+   * @brief Index of the lane in the lane graph.
+   * @param road index of the road
+   * @param section index of the lane section in the road
+   * @param lane id of the lane
+   * @return index of the lane, or @ref npos if there is no such lane
+   */
+  std::size_t laneNode(std::size_t road, std::size_t section, int lane) const;
+
+  const std::vector<Road>& roads() const { return roads_; }
+  const std::vector<Junction>& junctions() const { return junctions_; }
+  const std::vector<LaneNode>& lanes() const { return lanes_; }
+  const LaneIndex& index() const { return index_; }
+  double sample_step() const { return sample_step_; }
+
+ private:
+  /** Parse the roads and junctions of the @p root element of an OpenDRIVE document */
+  void parse(const XmlNode& root);
+  /** Build the lane graph from the links of the roads and junctions */
+  void buildLaneGraph();
+  /** Sample the lanes of the network into the spatial index */
+  void buildIndex();
+  /** Locate the point (@p x, @p y) in the lane of the @p quad */
+  LaneLocation locate(const LaneIndex::Quad& quad, double x, double y) const;
+
+  double sample_step_;                                         ///< Maximum length of the sampled stretches of lane
+  std::vector<Road> roads_;                                    ///< Roads of the network
+  std::vector<Junction> junctions_;                            ///< Junctions of the network
+  std::vector<LaneNode> lanes_;                                ///< Lane graph of the network
+  std::unordered_map<std::string, std::size_t> road_indices_;  ///< Index of each road by id
+  LaneIndex index_;                                            ///< Spatial index over the lanes
+};
+
+std::ostream& operator<<(std::ostream& os, const RoadNetwork::LaneLocation& location);
+std::ostream& operator<<(std::ostream& os, const RoadNetwork& network);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::RoadNetwork::LaneLocation> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::RoadNetwork> : fmt::ostream_formatter {};
@@ -0,0 +1,145 @@
+/**
+ * @file router.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Router class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/road_network.h"
+
+namespace symaware {
+
+/**
+ * @brief Shortest routes between points of a @ref RoadNetwork, following its lane graph.
+ *
+ * Routes are searched with A* over the driving lanes of the network, using the straight line distance to the
+ * destination as heuristic.
+ * Moving to the following lane costs the distance driven along the centre of the current lane,
+ * while moving to an adjacent lane of the same lane section costs a fixed amount, expressed in metres of driving.
+ * To keep the heuristic admissible, the cost of a lane change should not be smaller than the width of the lanes.
+ *
+ * The sequences of lanes found by the search are kept in a least recently used cache,
+ * so routing many entities between the same lanes only costs the generation of the waypoints.
+ * Since the cache is updated by @ref route, a router must not be shared across threads.
+ * The router keeps a reference to the road network, which must outlive it and not change while it is in use.
+ */
+class Router {
+ public:
+  /** Point of a route */
+  struct Waypoint {
+    double x;  ///< X coordinate
+    double y;  ///< Y coordinate
+    double z;  ///< Z coordinate, from the elevation profile of the road
+  };
+  /** Route between two points of the network */
+  struct Route {
+    std::vector<std::size_t> lanes;   ///< Lanes traversed by the route, as indices in the lane graph of the network
+    std::vector<Waypoint> waypoints;  ///< Points along the centre of the lanes, from the start to the destination
+    double length;                    ///< Distance driven along the waypoints
+    std::size_t lane_changes;         ///< Number of lane changes along the route
+  };
+
+  /**
+   * @brief Construct a new router over the driving lanes of the road @p network.
+   * @param network road network, which must outlive the router
+   * @param lane_change_cost cost of a lane change, in metres of driving
+   * @param lane_change_length distance driven along the lane while changing lane
+   * @param waypoint_step maximum arc length of the reference line between consecutive waypoints
+   * @param cache_capacity maximum number of lane sequences kept in the cache. If 0, nothing is cached
+   * @throw std::invalid_argument if @p lane_change_cost or @p lane_change_length are negative
+   * or @p waypoint_step is not positive
+   */
+  explicit Router(const RoadNetwork& network, double lane_change_cost = 20, double lane_change_length = 20,
+                  double waypoint_step = 2, std::size_t cache_capacity = 1024);
+
+  /**
+   * @brief Shortest route between two locations of the network.
+   * @param from start of the route
+   * @param to destination of the route
+   * @return route between the two locations, or an empty optional if either one is not on a driving lane
+   * or the destination cannot be reached
+   */
+  std::optional<Route> route(const RoadNetwork::LaneLocation& from, const RoadNetwork::LaneLocation& to);
+  /**
+   * @brief Shortest route between the points (@p from_x, @p from_y) and (@p to_x, @p to_y).
+   *
+   * The points are located in the network with @ref RoadNetwork::locate.
+   * @param from_x X coordinate of the start of the route
+   * @param from_y Y coordinate of the start of the route
+   * @param to_x X coordinate of the destination of the route
+   * @param to_y Y coordinate of the destination of the route
+   * @return route between the two points, or an empty optional if either one is not on a driving lane
+   * or the destination cannot be reached
+   */
+  std::optional<Route> route(double from_x, double from_y, double to_x, double to_y);
+  /**
+   * @brief Remove all the lane sequences from the cache.
+   */
+  void clearCache();
+
+  const RoadNetwork& network() const { return network_; }
+  double lane_change_cost() const { return lane_change_cost_; }
+  double lane_change_length() const { return lane_change_length_; }
+  double waypoint_step() const { return waypoint_step_; }
+  std::size_t cache_capacity() const { return cache_capacity_; }
+  std::size_t cache_size() const { return cache_.size(); }
+  std::size_t cache_hits() const { return cache_hits_; }
+  std::size_t cache_misses() const { return cache_misses_; }
+
+ private:
+  /** Point sampled along the centre of a lane, in the driving direction */
+  struct Sample {
+    double s;         ///< Arc length of the reference line
+    double x;         ///< X coordinate
+    double y;         ///< Y coordinate
+    double z;         ///< Z coordinate
+    double distance;  ///< Distance from the start of the lane along the samples
+  };
+
+  /** @return whether the lane with the given @p node index can be routed on */
+  bool routable(std::size_t node) const { return !centres_[node].empty(); }
+  /** @return distance along the centre of the lane @p node from its start to the arc length @p s */
+  double progress(std::size_t node, double s) const;
+  /** @return point at the given @p distance along the centre of the lane @p node */
+  Sample interpolate(std::size_t node, double distance) const;
+  /** Search the sequence of lanes from @p from to @p to with A* */
+  std::vector<std::size_t> search(const RoadNetwork::LaneLocation& from, const RoadNetwork::LaneLocation& to) const;
+  /** Generate the waypoints of the route along the @p lanes */
+  Route makeRoute(std::vector<std::size_t> lanes, const RoadNetwork::LaneLocation& from,
+                  const RoadNetwork::LaneLocation& to) const;
+
+  const RoadNetwork& network_;                ///< Road network the routes are searched on
+  double lane_change_cost_;                   ///< Cost of a lane change, in metres of driving
+  double lane_change_length_;                 ///< Distance driven along the lane while changing lane
+  double waypoint_step_;                      ///< Maximum arc length between consecutive waypoints
+  std::vector<std::vector<Sample>> centres_;  ///< Centre of each driving lane, empty for the other lanes
+  std::size_t cache_capacity_;                ///< Maximum number of lane sequences in the cache
+
+  std::list<std::pair<std::uint64_t, std::vector<std::size_t>>> cache_;          ///< Lane sequences, most recent first
+  std::unordered_map<std::uint64_t, decltype(cache_)::iterator> cache_entries_;  ///< Cached lane sequences by key
+  std::size_t cache_hits_;                                                       ///< Number of cache hits
+  std::size_t cache_misses_;                                                     ///< Number of cache misses
+};
+
+std::ostream& operator<<(std::ostream& os, const Router::Route& route);
+std::ostream& operator<<(std::ostream& os, const Router& router);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::Router::Route> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::Router> : fmt::ostream_formatter {};
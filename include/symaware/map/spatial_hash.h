@@ -0,0 +1,143 @@
+/**
+ * @file spatial_hash.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief SpatialHash class
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Uniform grid over a set of points in the plane, hashed into a fixed number of buckets.
+ *
+ * The grid is rebuilt from scratch in linear time by counting sort,
+ * so it can be refreshed at every step of the simulation.
+ * The points of each bucket are stored contiguously, together with the cell they belong to,
+ * so that cells sharing the same bucket are told apart without looking up the original points.
+ * Queries only visit the cells overlapping the region of interest,
+ * making their cost proportional to the number of points nearby rather than to the total.
+ */
+class SpatialHash {
+ public:
+  /**
+   * @brief Construct a new empty spatial hash.
+   * @param cell_size side of the cells of the grid. Ideally close to the typical query radius
+   * @throw std::invalid_argument if @p cell_size is not positive
+   */
+  explicit SpatialHash(double cell_size = 10);
+
+  /**
+   * @brief Replace the points in the grid with the @p count points with coordinates @p x and @p y.
+   *
+   * Points are identified by their index in the arrays.
+   * @param x X coordinates of the points
+   * @param y Y coordinates of the points
+   * @param count number of points
+   * @throw std::runtime_error if any of the coordinates is not finite
+   */
+  void build(const double* x, const double* y, std::size_t count);
+  /** @overload */
+  void build(const std::vector<double>& x, const std::vector<double>& y);
+  /**
+   * @brief Remove all the points from the grid.
+   */
+  void clear();
+
+  /**
+   * @brief Call @p callback with every point at distance at most @p radius from (@p x, @p y).
+   * @tparam F callable with signature `void(std::size_t index, double squared_distance)`
+   * @param x X coordinate of the centre
+   * @param y Y coordinate of the centre
+   * @param radius radius of the query
+   * @param callback callback invoked for each point in range, in no particular order
+   */
+  template <class F>
+  void forEachInRadius(const double x, const double y, const double radius, F&& callback) const {
+    if (points_.empty() || !(radius >= 0)) return;
+    const double squared_radius = radius * radius;
+    const auto visit = [&](const Point& point) {
+      const double squared_distance = (point.x - x) * (point.x - x) + (point.y - y) * (point.y - y);
+      if (squared_distance <= squared_radius) callback(static_cast<std::size_t>(point.index), squared_distance);
+    };
+    // When the query covers more cells than there are points, scanning all the points is cheaper
+    const double span = 2 * radius / cell_size_ + 1;
+    if (span * span > static_cast<double>(points_.size())) {
+      for (const Point& point : points_) visit(point);
+      return;
+    }
+    const std::int64_t i_max = cellOf(x + radius), j_max = cellOf(y + radius);
+    for (std::int64_t i = cellOf(x - radius); i <= i_max; ++i)
+      for (std::int64_t j = cellOf(y - radius); j <= j_max; ++j) forEachInCell(i, j, visit);
+  }
+
+  /**
+   * @brief Find the points at distance at most @p radius from (@p x, @p y).
+   * @param x X coordinate of the centre
+   * @param y Y coordinate of the centre
+   * @param radius radius of the query
+   * @return indices of the points in range, sorted by increasing distance
+   */
+  std::vector<std::size_t> queryRadius(double x, double y, double radius) const;
+  /**
+   * @brief Find the @p k points closest to (@p x, @p y).
+   * @param x X coordinate of the query point
+   * @param y Y coordinate of the query point
+   * @param k number of points to find
+   * @return indices of the closest points, sorted by increasing distance.
+   * Fewer than @p k if the grid does not contain enough points
+   */
+  std::vector<std::size_t> queryNearest(double x, double y, std::size_t k) const;
+  /**
+   * @brief Find all the pairs of points at distance at most @p distance from each other.
+   * @param distance maximum distance between the points of a pair
+   * @return pairs of indices, with the smaller index first, sorted lexicographically
+   */
+  std::vector<std::pair<std::size_t, std::size_t>> queryPairs(double distance) const;
+
+  double cell_size() const { return cell_size_; }
+  std::size_t size() const { return points_.size(); }
+  bool empty() const { return points_.empty(); }
+
+ private:
+  /** Point stored in the grid */
+  struct Point {
+    double x;             ///< X coordinate
+    double y;             ///< Y coordinate
+    std::int64_t i;       ///< Column of the cell containing the point
+    std::int64_t j;       ///< Row of the cell containing the point
+    std::uint32_t index;  ///< Index of the point in the arrays it was built from
+  };
+
+  /** @return column or row of the cell containing the coordinate @p v */
+  std::int64_t cellOf(const double v) const { return static_cast<std::int64_t>(std::floor(v / cell_size_)); }
+  /** @return bucket the cell (@p i, @p j) is hashed into */
+  std::size_t bucketOf(const std::int64_t i, const std::int64_t j) const {
+    return static_cast<std::size_t>((static_cast<std::uint64_t>(i) * 73856093u) ^
+                                    (static_cast<std::uint64_t>(j) * 19349663u)) &
+           bucket_mask_;
+  }
+  /** Call @p callback with every point in the cell (@p i, @p j) */
+  template <class F>
+  void forEachInCell(const std::int64_t i, const std::int64_t j, F&& callback) const {
+    const std::size_t bucket = bucketOf(i, j);
+    for (std::uint32_t k = bucket_start_[bucket]; k < bucket_start_[bucket + 1]; ++k) {
+      const Point& point = points_[k];
+      if (point.i == i && point.j == j) callback(point);
+    }
+  }
+
+  double cell_size_;                         ///< Side of the cells of the grid
+  std::size_t bucket_mask_;                  ///< Number of buckets minus one. The number of buckets is a power of 2
+  std::vector<std::uint32_t> bucket_start_;  ///< Position of the first point of each bucket, plus the end
+  std::vector<Point> points_;                ///< Points sorted by bucket
+};
+
+}  // namespace symaware
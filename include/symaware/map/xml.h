@@ -0,0 +1,52 @@
+/**
+ * @file xml.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Minimal XML reader
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Element of an XML document.
+ *
+ * The reader supports the subset of XML needed by the map formats: elements, attributes, text, CDATA sections
+ * and the predefined and numeric character references.
+ * Comments, processing instructions and document type declarations are skipped.
+ */
+struct XmlNode {
+  std::string name;                                             ///< Name of the element
+  std::vector<std::pair<std::string, std::string>> attributes;  ///< Attributes of the element, in document order
+  std::vector<XmlNode> children;                                ///< Child elements, in document order
+  std::string text;                                             ///< Concatenated text content of the element
+
+  /**
+   * @brief Value of the attribute with the given @p name.
+   * @param name name of the attribute
+   * @return pointer to the value of the attribute, or nullptr if the element has no such attribute
+   */
+  const std::string* attribute(std::string_view name) const;
+  /**
+   * @brief First child element with the given @p name.
+   * @param name name of the child
+   * @return pointer to the child, or nullptr if the element has no such child
+   */
+  const XmlNode* child(std::string_view name) const;
+};
+
+/**
+ * @brief Parse an XML document.
+ * @param content content of the document
+ * @return root element of the document
+ * @throw std::runtime_error if the document is malformed. The message reports the line of the error
+ */
+XmlNode parseXml(std::string_view content);
+
+}  // namespace symaware
@@ -7,10 +7,21 @@
  */
 #pragma once
 
+#include "symaware/prescan/broadphase.h"
 #include "symaware/prescan/data.h"
 #include "symaware/prescan/entity.h"
 #include "symaware/prescan/environment.h"
 #include "symaware/prescan/experiment_guard.h"
+#include "symaware/prescan/history_exporter.h"
+#include "symaware/prescan/kpi_evaluator.h"
 #include "symaware/prescan/model.h"
+#include "symaware/prescan/object_catalog.h"
+#include "symaware/prescan/point_cloud_filter.h"
 #include "symaware/prescan/road.h"
+#include "symaware/prescan/road_builder.h"
+#include "symaware/prescan/sensor_fusion.h"
+#include "symaware/prescan/sensor_noise.h"
 #include "symaware/prescan/simulation.h"
+#include "symaware/prescan/track_table.h"
+#include "symaware/prescan/transform.h"
+#include "symaware/prescan/trigger_system.h"
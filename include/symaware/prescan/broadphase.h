@@ -0,0 +1,88 @@
+/**
+ * @file broadphase.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Broadphase class
+ */
+#pragma once
+
+#include <cstddef>
+#include <prescan/sim/Simulation.hpp>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/spatial_hash.h"
+#include "symaware/prescan/environment.h"
+#include "symaware/prescan/simulation_observer.h"
+
+namespace symaware {
+
+/**
+ * @brief Observer indexing the positions of the entities in the horizontal plane, to answer proximity queries.
+ *
+ * The index is rebuilt from the state of the entities after every step of the simulation,
+ * so that radius, nearest neighbour and close pair queries don't have to compare all the entities with each other.
+ * Entities are identified by their position in @ref entities, which is stable as long as no entity is added to or
+ * removed from the environment.
+ * Entities without a valid state, e.g. because they are not simulated, are left out.
+ */
+class Broadphase : public SimulationObserver {
+ public:
+  /**
+   * @brief Construct a new Broadphase object.
+   * @param cell_size side of the cells of the grid. Ideally close to the typical query radius
+   */
+  explicit Broadphase(double cell_size = 10);
+
+  void initialise(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void step(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+
+  /**
+   * @brief Rebuild the index from the current state of the entities in the @p environment.
+   * @param environment environment containing the entities
+   */
+  void update(const Environment& environment);
+
+  /**
+   * @brief Find the entities at distance at most @p radius from (@p x, @p y).
+   * @param x X coordinate of the centre
+   * @param y Y coordinate of the centre
+   * @param radius radius of the query
+   * @return indices of the entities in range, sorted by increasing distance
+   */
+  std::vector<std::size_t> queryRadius(double x, double y, double radius) const {
+    return index_.queryRadius(x, y, radius);
+  }
+  /**
+   * @brief Find the @p k entities closest to (@p x, @p y).
+   * @param x X coordinate of the query point
+   * @param y Y coordinate of the query point
+   * @param k number of entities to find
+   * @return indices of the closest entities, sorted by increasing distance
+   */
+  std::vector<std::size_t> queryNearest(double x, double y, std::size_t k) const {
+    return index_.queryNearest(x, y, k);
+  }
+  /**
+   * @brief Find all the pairs of entities at distance at most @p distance from each other.
+   * @param distance maximum distance between the entities of a pair
+   * @return pairs of indices, with the smaller index first, sorted lexicographically
+   */
+  std::vector<std::pair<std::size_t, std::size_t>> queryPairs(double distance) const {
+    return index_.queryPairs(distance);
+  }
+
+  const std::vector<const Entity*>& entities() const { return entities_; }
+  const std::vector<double>& x() const { return x_; }
+  const std::vector<double>& y() const { return y_; }
+  const SpatialHash& index() const { return index_; }
+
+ private:
+  SpatialHash index_;                    ///< Grid over the positions of the entities
+  std::vector<const Entity*> entities_;  ///< Entities in the index, by index
+  std::vector<double> x_;                ///< X coordinate of the entities, by index
+  std::vector<double> y_;                ///< Y coordinate of the entities, by index
+};
+
+}  // namespace symaware
@@ -11,14 +11,18 @@
 
 #include <iosfwd>
 #include <limits>
+#include <optional>
 #include <prescan/api/types/WorldObject.hpp>
 #include <prescan/sim/SelfSensorUnit.hpp>
 #include <string>
+#include <vector>
 
 #include "symaware/prescan/data.h"
 #include "symaware/prescan/environment.h"
 #include "symaware/prescan/model/entity_model.h"
 #include "symaware/prescan/sensor.h"
+#include "symaware/prescan/sensor_fusion.h"
+#include "symaware/util/profiler.h"
 
 namespace symaware {
 class Entity {
@@ -71,6 +75,15 @@ class Entity {
    * @brief Remove the @ref object_ from the experiment.
    */
   void remove();
+  /**
+   * @brief Detach the @ref object_ from the entity without removing it from the experiment.
+   *
+   * The object is moved out of sight and made non movable, non collidable and invisible to sensors,
+   * so that it can be reused by another entity of the same type with @ref reuseObject.
+   * The sensors of the entity are detached, but the ones they created remain attached to the object.
+   * @return the parked object
+   */
+  ParkedObject park();
 
   /**
    * @brief Add a sensor to the entity.
@@ -79,6 +92,19 @@ class Entity {
    * @param sensor sensor to add
    */
   void addSensor(Sensor& sensor);
+  /**
+   * @brief Fuse the detections of the sensors of the entity at each step with a @ref SensorFusion.
+   *
+   * The positions of the objects detected by AIR sensors and the bearings of the ones seen by BRS sensors
+   * update a single list of tracks in the world frame.
+   * The fusion must be set before the simulation starts, and is emptied when it starts.
+   * @param setup parameters of the fusion
+   */
+  void setSensorFusion(const SensorFusion::Setup& setup);
+  /**
+   * @brief Stop fusing the detections of the sensors of the entity.
+   */
+  void clearSensorFusion();
 
   /**
    * @brief Apply the @ref setup_ to the entity.
@@ -96,6 +122,16 @@ class Entity {
    * @param object object this entity will represent
    */
   void initialiseObject(prescan::api::experiment::Experiment& experiment, prescan::api::types::WorldObject object);
+  /**
+   * @brief Initialise the entity with an object @p parked by another entity, instead of a new one.
+   *
+   * The pose of the object is restored and the @ref setup_ is applied on top of it.
+   * Sensors already attached to the object are reused by the sensors of the entity of the same type,
+   * and the model is only created again if it is not the one the object was parked with.
+   * @param experiment underlying experiment
+   * @param parked parked object this entity will represent
+   */
+  void reuseObject(prescan::api::experiment::Experiment& experiment, const ParkedObject& parked);
 
   /**
    * @brief Forwards the registration of the model to the model itself, if present.
@@ -132,19 +168,31 @@ class Entity {
   std::string name() const { return object_.name(); }
   ObjectType type() const { return type_; }
   const Setup& setup() const { return setup_; }
+  EntityModel* model() { return model_; }
   const EntityModel* model() const { return model_; }
   const prescan::api::types::WorldObject& object() const { return object_; }
+  const std::vector<Sensor*>& sensors() const { return sensors_; }
+  /** @return fusion of the detections of the sensors of the entity, or nullptr if there is none */
+  const SensorFusion* sensorFusion() const { return sensor_fusion_.has_value() ? &sensor_fusion_.value() : nullptr; }
+  PhaseProfile& profile() { return profile_; }
+  const PhaseProfile& profile() const { return profile_; }
 
  private:
   void updateObject();
+  void detachObject();
+  /** Update the #sensor_fusion_ with the detections of the sensors in the last step */
+  void fuseDetections(double sample_time);
 
   ObjectType type_;     ///< The type of the entity
   Setup setup_;         ///< The initial state of the entity
   EntityModel* model_;  ///< The dynamical model of the entity. Only present if the entity is controllable
   prescan::api::types::WorldObject object_;    ///< The object that represents the entity in the simulation
+  bool has_object_;                            ///< Whether the entity has been bound to an object
   const prescan::sim::SelfSensorUnit* state_;  ///< The state of the entity in the simulation
-  int sensor_count_[20];                       ///< Number of sensors attached to the entity by type
+  int sensor_count_[sensor_type_count];        ///< Number of sensors attached to the entity by type
   std::vector<Sensor*> sensors_;               ///< The sensors attached to the entity
+  std::optional<SensorFusion> sensor_fusion_;  ///< Fusion of the detections of the sensors, if any
+  PhaseProfile profile_;                       ///< Time spent by the entity in each phase of the simulation
 };
 
 std::ostream& operator<<(std::ostream& os, const Entity::Setup& setup);
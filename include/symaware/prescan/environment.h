@@ -7,13 +7,16 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <prescan/api/Experiment.hpp>
 #include <prescan/api/Viewer.hpp>
-#include <prescan/api/experiment.hpp>
+#include <prescan/api/types/WorldObject.hpp>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "symaware/map/road_network.h"
 #include "symaware/prescan/data.h"
 #include "symaware/prescan/type.h"
 
@@ -24,6 +27,18 @@ class Entity;
 class Road;
 class EntityModel;
 
+/**
+ * @brief World object parked by a removed entity, ready to be reused by another entity of the same type.
+ *
+ * The sensors and the model created for the object stay in the experiment, so they are still simulated.
+ */
+struct ParkedObject {
+  prescan::api::types::WorldObject object;  ///< The parked object, still part of the experiment
+  prescan::api::types::Pose pose;           ///< The pose of the object before it was parked
+  std::uint64_t model_id;                   ///< The @ref EntityModel::id of the model attached to the object, or 0
+  int sensor_count[sensor_type_count];      ///< Number of sensors attached to the object by type
+};
+
 class Environment {
  public:
   Environment();
@@ -122,6 +137,30 @@ class Environment {
    * @return instance reference
    */
   Environment& addEntity(const std::string& name, Entity& entity);
+  /**
+   * @brief Add many entities to the environment at once.
+   *
+   * Equivalent to calling @ref addEntity(Entity&) on each entity, but cheaper when spawning many objects.
+   * The registry of the environment grows only once,
+   * and the objects are created grouped by type, so that the name of each type is only computed once.
+   * Within the same type, the objects are created in the order of @p entities.
+   * Entities that are already initialised are skipped, and entities that appear more than once are added only once.
+   * @param[in,out] entities entities representing the new objects to be added
+   * @param count number of entities
+   * @throw std::runtime_error if any of the entities is of type @ref ObjectType::Existing.
+   * In that case, none of the entities is added
+   * @return instance reference
+   */
+  Environment& addEntities(Entity* const* entities, std::size_t count);
+  /**
+   * @brief Add many entities to the environment at once.
+   * @param[in,out] entities entities representing the new objects to be added
+   * @return instance reference
+   * @see addEntities(Entity* const*, std::size_t)
+   */
+  Environment& addEntities(const std::vector<Entity*>& entities) {
+    return addEntities(entities.data(), entities.size());
+  }
 
   /**
    * @brief Remove an @p entity from both the experiment and the environment.
@@ -140,6 +179,26 @@ class Environment {
    * @return instance reference
    */
   Environment& removeEntity(const std::string& name);
+  /**
+   * @brief Enable or disable the pooling of the objects of removed entities.
+   *
+   * When pooling is enabled, removed entities park their object instead of removing it from the experiment.
+   * Parked objects are hidden from the simulation and reused by the next entities of the same type added
+   * to the environment, together with the sensors attached to them and the model they were parked with.
+   * This makes resetting an episode only as expensive as the number of objects that actually changed.
+   * Parked objects keep the sensors and the model created for them in the experiment,
+   * so Prescan keeps registering and stepping their units while they wait.
+   * Clear the pool with @ref clearPool when the parked objects are no longer needed.
+   * Disabling the pooling removes all the parked objects from the experiment.
+   * @param pooling whether to enable the pooling
+   * @return instance reference
+   */
+  Environment& setPooling(bool pooling);
+  /**
+   * @brief Remove all the parked objects from the experiment, emptying the pool.
+   * @return instance reference
+   */
+  Environment& clearPool();
 
   /**
    * @brief Add a road to the environment.
@@ -160,6 +219,9 @@ class Environment {
    * - the file should exist exist
    * - the file should adhere to the OpenDRIVE V1.4 specification, Revision H
    * - the experiment should not contain any roads yet
+   *
+   * The network is also loaded in the @ref roadNetwork of the environment, to locate points on its lanes.
+   * The file is parsed before it is imported, so the experiment is left untouched if it is not valid.
    * @param filename path to the OpenDRIVE file
    * @throw std::runtime_error if any of the conditions are not met
    * @return instance reference
@@ -171,6 +233,17 @@ class Environment {
    * @return experiment object
    */
   const prescan::api::experiment::Experiment& experiment() const { return experiment_; }
+  /**
+   * @brief Get the experiment object of the environment
+   * @return experiment object
+   */
+  prescan::api::experiment::Experiment& experiment() { return experiment_; }
+
+  /**
+   * @brief Get the road network imported in the environment
+   * @return road network
+   */
+  const RoadNetwork& roadNetwork() const { return road_network_; }
 
   /**
    * @brief Get the names of the entities in the environment
@@ -183,6 +256,17 @@ class Environment {
    * @return models
    */
   const std::vector<EntityModel*>& models() const { return models_; }
+  /**
+   * @brief Whether the objects of removed entities are parked to be reused
+   * @return pooling state
+   * @see setPooling
+   */
+  bool pooling() const { return pooling_; }
+  /**
+   * @brief Get the number of parked objects waiting to be reused
+   * @return number of parked objects
+   */
+  std::size_t pooledCount() const;
 
   /**
    * @brief Save the internal file to a file
@@ -203,9 +287,20 @@ class Environment {
   }
 
  private:
+  /**
+   * @brief Bind the @p entity to a parked object compatible with it, if any.
+   * @param entity entity to initialise
+   * @return true if a parked object has been reused
+   * @return false if no compatible object has been found in the pool
+   */
+  bool reuseParkedObject(Entity& entity);
+
   prescan::api::experiment::Experiment experiment_;
   std::unordered_map<std::string, Entity*> entities_;
   std::vector<EntityModel*> models_;
+  RoadNetwork road_network_;
+  bool pooling_;                                                     ///< Whether removed objects are parked
+  std::unordered_map<ObjectType, std::vector<ParkedObject>> pool_;  ///< Parked objects by type
 };
 
 }  // namespace symaware
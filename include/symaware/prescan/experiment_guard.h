@@ -7,7 +7,7 @@
  */
 #pragma once
 
-#include <prescan/api/experiment.hpp>
+#include <prescan/api/Experiment.hpp>
 
 namespace symaware {
 
@@ -0,0 +1,68 @@
+/**
+ * @file history_exporter.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief HistoryExporter class
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <prescan/sim/Simulation.hpp>
+#include <string>
+
+#include "symaware/prescan/environment.h"
+#include "symaware/prescan/simulation_observer.h"
+#include "symaware/util/arrow_writer.h"
+
+namespace symaware {
+
+/**
+ * @brief Observer that streams the history of the simulation to disk as Arrow IPC streams.
+ *
+ * Three files are created in the output directory, one per table, each with a fixed schema:
+ * - `entity_states.arrows`: step, time, entity, x, y, z, roll, pitch, yaw, velocity, yaw_rate
+ * - `air_detections.arrows`: step, time, entity, sensor, range, azimuth, elevation, object_id, velocity, heading
+ * - `brs_boxes.arrows`: step, time, entity, sensor, object_id, left, right, bottom, top
+ *
+ * The step counts from 0, while the time is the one at the end of the step, as for the other observers.
+ * The values are appended directly to the buffers of the writers and flushed as a record batch
+ * every @ref flush_interval steps, without creating any intermediate object.
+ * The files can be read with `pyarrow.ipc.open_stream` and converted to Parquet as they are.
+ */
+class HistoryExporter : public SimulationObserver {
+ public:
+  /**
+   * @brief Construct a new HistoryExporter object.
+   * @param directory directory the files will be written into. It must already exist
+   * @param flush_interval number of steps between two consecutive record batches
+   */
+  explicit HistoryExporter(std::string directory, std::size_t flush_interval = 100);
+
+  void initialise(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void step(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void terminate(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+
+  /**
+   * @brief Write all the rows accumulated so far to disk.
+   */
+  void flush();
+
+  const std::string& directory() const { return directory_; }
+  std::size_t flush_interval() const { return flush_interval_; }
+  std::int64_t steps() const { return steps_; }
+
+ private:
+  void exportEntity(const std::string& name, const Entity& entity, double time);
+
+  std::string directory_;                              ///< Directory the files are written into
+  std::size_t flush_interval_;                         ///< Number of steps between two consecutive record batches
+  std::int64_t steps_;                                 ///< Number of steps exported so far
+  std::unique_ptr<ArrowStreamWriter> entity_states_;   ///< Writer for the entity states
+  std::unique_ptr<ArrowStreamWriter> air_detections_;  ///< Writer for the detections of AIR sensors
+  std::unique_ptr<ArrowStreamWriter> brs_boxes_;       ///< Writer for the bounding boxes of BRS sensors
+};
+
+}  // namespace symaware
@@ -0,0 +1,151 @@
+/**
+ * @file kpi_evaluator.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief KpiEvaluator class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <prescan/sim/Simulation.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/spatial_hash.h"
+#include "symaware/prescan/entity.h"
+#include "symaware/prescan/environment.h"
+#include "symaware/prescan/simulation_observer.h"
+
+namespace symaware {
+
+/**
+ * @brief Observer computing safety key performance indicators while the simulation runs.
+ *
+ * After every step, the pairs of entities closer than the @ref Setup::interaction_radius are evaluated,
+ * with a @ref SpatialHash over their positions so that far away pairs are never considered.
+ * If any ego entity has been added with @ref addEgo, only the pairs involving at least one ego are relevant.
+ * For each pair the evaluator computes
+ * - the distance between the two entities, with a collision starting when it drops below the collision distance;
+ * - the time to collision, assuming both entities keep their velocity and heading;
+ * - the time headway of each entity following the other in the same lane.
+ *
+ * Entities with a model also count a lane departure each time they leave the lanes of the road network of the
+ * environment, if the network has any road.
+ * Only the minima of the indicators and the times they are reached are kept, together with the first time each
+ * threshold is violated, so the memory used does not grow with the length of the episode.
+ * The summary of each episode is stored when the simulation terminates.
+ */
+class KpiEvaluator : public SimulationObserver {
+ public:
+  /** Parameters of the evaluation */
+  struct Setup {
+    explicit Setup(double interaction_radius = 100, double collision_distance = 2, double ttc_threshold = 2,
+                   double headway_threshold = 1, double lane_width = 3.5);
+    double interaction_radius;  ///< Maximum distance between the entities of a relevant pair
+    double collision_distance;  ///< Distance below which two entities are colliding
+    double ttc_threshold;       ///< Time to collision below which the pair is in a critical situation
+    double headway_threshold;   ///< Time headway below which the follower is too close to the leader
+    double lane_width;          ///< Width of the lane, used to tell whether an entity is following another
+  };
+  /** Summary of the indicators over an episode. Times are NaN if the event never happened */
+  struct Summary {
+    std::int64_t steps;              ///< Number of steps evaluated
+    double duration;                 ///< Simulated time of the episode
+    double min_distance;             ///< Minimum distance between the entities of a relevant pair
+    double min_distance_time;        ///< Time the minimum distance was reached
+    double min_ttc;                  ///< Minimum time to collision
+    double min_ttc_time;             ///< Time the minimum time to collision was reached
+    double min_headway;              ///< Minimum time headway
+    double min_headway_time;         ///< Time the minimum time headway was reached
+    double first_ttc_violation;      ///< First time the time to collision was below the threshold
+    double first_headway_violation;  ///< First time the time headway was below the threshold
+    std::size_t collisions;          ///< Number of collisions started during the episode
+    double first_collision;          ///< Time the first collision started
+    std::size_t lane_departures;     ///< Number of times an entity with a model has left the lanes
+    double first_lane_departure;     ///< Time of the first lane departure
+  };
+
+  /**
+   * @brief Construct a new KpiEvaluator object.
+   * @param setup parameters of the evaluation
+   * @throw std::invalid_argument if the interaction radius is not positive or any other parameter is negative
+   */
+  explicit KpiEvaluator(Setup setup = Setup{});
+
+  void initialise(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void step(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void terminate(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+
+  /**
+   * @brief Evaluate the current state of the entities in the @p environment at time @p time.
+   * @param environment environment containing the entities
+   * @param time time of the state being evaluated
+   */
+  void evaluate(const Environment& environment, double time);
+  /**
+   * @brief Restrict the relevant pairs to the ones involving the @p entity.
+   *
+   * Multiple egos can be added. Pairs of egos are relevant as well.
+   * @param entity ego entity. It must outlive the evaluator
+   */
+  void addEgo(const Entity& entity);
+  /**
+   * @brief Consider all the pairs of entities relevant again.
+   */
+  void clearEgos();
+  /**
+   * @brief Reset the summary of the current episode, as if no step had been evaluated.
+   */
+  void reset();
+  /**
+   * @brief Remove the summaries of all the past episodes.
+   */
+  void clearSummaries();
+
+  const Setup& setup() const { return setup_; }
+  /** @return summary of the current episode, or of the last one if the simulation has terminated */
+  const Summary& summary() const { return summary_; }
+  /** @return summaries of all the episodes terminated so far, in order */
+  const std::vector<Summary>& summaries() const { return summaries_; }
+
+ private:
+  /** Pair of colliding entities, with the lower address first */
+  using EntityPair = std::pair<const Entity*, const Entity*>;
+
+  /** Evaluate the pair of entities with indices @p a and @p b */
+  void evaluatePair(std::size_t a, std::size_t b, double time);
+  /** Time headway of entity @p follower behind entity @p leader, or infinity if it is not following it */
+  double headway(std::size_t follower, std::size_t leader) const;
+  /** Update the lane departures of the entities with a model */
+  void evaluateLanes(const Environment& environment, double time);
+
+  Setup setup_;                                      ///< Parameters of the evaluation
+  Summary summary_;                                  ///< Summary of the current episode
+  std::vector<Summary> summaries_;                   ///< Summaries of the past episodes
+  std::unordered_set<const Entity*> egos_;           ///< Ego entities. If empty, all the pairs are relevant
+  SpatialHash index_;                                ///< Grid over the positions of the entities
+  std::vector<const Entity*> entities_;              ///< Entities evaluated in the current step
+  std::vector<Entity::State> states_;                ///< State of the entities evaluated in the current step
+  std::vector<double> x_;                            ///< X coordinate of the entities
+  std::vector<double> y_;                            ///< Y coordinate of the entities
+  std::vector<EntityPair> colliding_;                ///< Pairs colliding in the current step
+  std::vector<EntityPair> previous_colliding_;       ///< Pairs colliding in the previous step, sorted
+  std::unordered_map<const Entity*, bool> on_lane_;  ///< Whether each entity with a model was on a lane
+};
+
+std::ostream& operator<<(std::ostream& os, const KpiEvaluator::Setup& setup);
+std::ostream& operator<<(std::ostream& os, const KpiEvaluator::Summary& summary);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::KpiEvaluator::Setup> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::KpiEvaluator::Summary> : fmt::ostream_formatter {};
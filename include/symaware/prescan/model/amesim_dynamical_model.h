@@ -9,6 +9,7 @@
 
 #include <fmt/ostream.h>
 
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <prescan/api/experiment/Experiment.hpp>
@@ -71,8 +72,10 @@ class AmesimDynamicalModel : public EntityModel {
    */
   void updateInput(const Input& input);
 
-  void setInput(const std::vector<double>& input) override;
-  void updateInput(const std::vector<double>& input) override;
+  using EntityModel::setInput;
+  using EntityModel::updateInput;
+  void setInput(const double* input, std::size_t size) override;
+  void updateInput(const double* input, std::size_t size) override;
 
   void registerUnit(const prescan::api::experiment::Experiment& experiment,
                     prescan::sim::ISimulation* simulation) override;
@@ -9,6 +9,7 @@
 
 #include <fmt/ostream.h>
 
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <prescan/api/experiment/Experiment.hpp>
@@ -62,8 +63,10 @@ class CustomDynamicalModel : public EntityModel {
    */
   void updateInput(const Input& input);
 
-  void setInput(const std::vector<double>& input) override;
-  void updateInput(const std::vector<double>& input) override;
+  using EntityModel::setInput;
+  using EntityModel::updateInput;
+  void setInput(const double* input, std::size_t size) override;
+  void updateInput(const double* input, std::size_t size) override;
 
   const Input& input() const { return input_; }
 
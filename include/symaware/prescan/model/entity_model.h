@@ -7,13 +7,17 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <prescan/api/experiment/Experiment.hpp>
 #include <prescan/api/types/WorldObject.hpp>
 #include <prescan/sim/AmesimVehicleDynamicsUnit.hpp>
 #include <prescan/sim/Simulation.hpp>
 #include <prescan/sim/StateActuatorUnit.hpp>
+#include <vector>
 
 #include "symaware/prescan/data.h"
+#include "symaware/util/profiler.h"
 
 namespace symaware {
 
@@ -27,6 +31,19 @@ class EntityModel {
    * @param active whether the dynamical model will step in the simulation
    */
   explicit EntityModel(bool existing, bool active);
+  /**
+   * @brief Copy the @p other model.
+   *
+   * The copy is a different model, so it gets its own @ref id .
+   * @param other model to copy
+   */
+  EntityModel(const EntityModel& other);
+  /**
+   * @brief Copy the @p other model, keeping the @ref id of this one.
+   * @param other model to copy
+   * @return instance reference
+   */
+  EntityModel& operator=(const EntityModel& other);
 
   /**
    * @brief Initialise the model by assigning the object in the simulation.
@@ -62,7 +79,16 @@ class EntityModel {
    * The internal mapping between the vector elements and the input values depends on the model implementation.
    * @param input model input to set
    */
-  virtual void setInput(const std::vector<double>& input) = 0;
+  void setInput(const std::vector<double>& input) { setInput(input.data(), input.size()); }
+  /**
+   * @brief Set the new control input of the model, reading it in place from a contiguous buffer.
+   *
+   * Avoids copying buffers owned by someone else, e.g. numpy arrays, into a vector.
+   * @param input pointer to the first element of the model input
+   * @param size number of elements of the model input
+   * @throw std::runtime_error if the @p size does not match the one expected by the model
+   */
+  virtual void setInput(const double* input, std::size_t size) = 0;
   /**
    * @brief Use the provided @p input to update the @ref input_ .
    *
@@ -70,7 +96,14 @@ class EntityModel {
    * The internal mapping between the vector elements and the input values depends on the model implementation.
    * @param input model input used to update the current one
    */
-  virtual void updateInput(const std::vector<double>& input) = 0;
+  void updateInput(const std::vector<double>& input) { updateInput(input.data(), input.size()); }
+  /**
+   * @brief Use the provided @p input to update the @ref input_ , reading it in place from a contiguous buffer.
+   * @param input pointer to the first element of the model input
+   * @param size number of elements of the model input
+   * @throw std::runtime_error if the @p size does not match the one expected by the model
+   */
+  virtual void updateInput(const double* input, std::size_t size) = 0;
 
   /**
    * @brief Register the unit inside the @p simulaiton.
@@ -105,9 +138,19 @@ class EntityModel {
    */
   virtual void terminate(prescan::sim::ISimulation* simulation);
 
+  /**
+   * @brief Unique identifier of the model.
+   *
+   * Unlike the address of the model, it is never reused, even after the model is destroyed.
+   * Identifiers start from 1, so that 0 can stand for no model.
+   * @return identifier of the model
+   */
+  std::uint64_t id() const { return id_; }
   bool existing() const { return existing_; }
   bool active() const { return active_; }
   const prescan::sim::StateActuatorUnit& state() const;
+  PhaseProfile& profile() { return profile_; }
+  const PhaseProfile& profile() const { return profile_; }
 
  protected:
   /**
@@ -118,10 +161,12 @@ class EntityModel {
    */
   virtual void updateState() = 0;
 
+  std::uint64_t id_;                         ///< Unique identifier of the model
   bool existing_;                            ///< Whether the model is already present in the experiment
   bool active_;                              ///< Whether the model will step in the simulation
   prescan::sim::StateActuatorUnit* state_;   ///< The state of the entity in the simulation
   prescan::api::types::WorldObject object_;  ///< The object in the simulation this model is attached to
+  PhaseProfile profile_;                     ///< Time spent by the model in each phase of the simulation
 };
 
 }  // namespace symaware
@@ -14,6 +14,8 @@
 
 #include "symaware/prescan/entity.h"
 #include "symaware/prescan/environment.h"
+#include "symaware/prescan/simulation_observer.h"
+#include "symaware/util/profiler.h"
 
 namespace symaware {
 
@@ -31,10 +33,27 @@ class SimulationModel : public prescan::sim::ISimulationModel {
   const std::function<void()>& on_pre_step() { return on_pre_step_; }
   const std::function<void()>& on_post_step() { return on_post_step_; }
 
+  /**
+   * @brief Add an @p observer that will be notified at each stage of the simulation.
+   * @note The observer must outlive the simulation
+   * @param observer observer to add
+   */
+  void addObserver(SimulationObserver& observer);
+  /**
+   * @brief Remove the @p observer from the simulation.
+   * @param observer observer to remove
+   */
+  void removeObserver(SimulationObserver& observer);
+  const std::vector<SimulationObserver*>& observers() const { return observers_; }
+  PhaseProfile& profile() { return profile_; }
+  const PhaseProfile& profile() const { return profile_; }
+
  private:
   const Environment& environment_;
   std::function<void()> on_pre_step_;
   std::function<void()> on_post_step_;
+  std::vector<SimulationObserver*> observers_;  ///< Observers notified after each step
+  PhaseProfile profile_;                        ///< Time spent in each phase of the simulation, callbacks included
 };
 
 }  // namespace symaware
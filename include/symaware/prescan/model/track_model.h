@@ -9,6 +9,7 @@
 
 #include <fmt/ostream.h>
 
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <prescan/api/Trajectory.hpp>
@@ -19,6 +20,7 @@
 #include <prescan/sim/SpeedProfileUnit.hpp>
 #include <prescan/sim/StateActuatorUnit.hpp>
 
+#include "symaware/map/router.h"
 #include "symaware/prescan/data.h"
 #include "symaware/prescan/model/entity_model.h"
 
@@ -31,6 +33,15 @@ class TrackModel : public EntityModel {
     Setup() : existing{false}, active{false}, path{}, speed{0}, tolerance{0} {}
     Setup(bool existing, bool active, std::vector<Position> path, double speed, double tolerance)
         : existing{existing}, active{active}, path{std::move(path)}, speed{speed}, tolerance{tolerance} {}
+    /**
+     * @brief Setup following the waypoints of a @p route computed by a @ref Router.
+     * @param existing whether the model is already present in the experiment
+     * @param active whether the model is active
+     * @param route route whose waypoints will form the path of the track
+     * @param speed speed along the track
+     * @param tolerance tolerance of the track
+     */
+    Setup(bool existing, bool active, const Router::Route& route, double speed, double tolerance);
     bool existing;
     bool active;
     std::vector<Position> path;
@@ -59,8 +70,10 @@ class TrackModel : public EntityModel {
 
   void createIfNotExists(prescan::api::experiment::Experiment& experiment) override;
 
-  void setInput(const std::vector<double>& input) override;
-  void updateInput(const std::vector<double>& input) override;
+  using EntityModel::setInput;
+  using EntityModel::updateInput;
+  void setInput(const double* input, std::size_t size) override;
+  void updateInput(const double* input, std::size_t size) override;
 
   /**
    * @brief Set the new control input of the model.
@@ -0,0 +1,86 @@
+/**
+ * @file object_catalog.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Static catalog of the geometry and mass of each ObjectType, where known
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iosfwd>
+
+#include "symaware/prescan/type.h"
+
+namespace symaware {
+
+/** Broad category of an ObjectType */
+enum class ObjectCategory {
+  VEHICLE,     ///< Vehicles and trailers, including the soft targets that represent them
+  PEDESTRIAN,  ///< Pedestrians, cyclists, animals and the soft targets that represent them
+  STATIC,      ///< Buildings, road furniture and any other object not meant to move by itself
+  FOLIAGE,     ///< Trees and crops
+};
+
+/**
+ * @brief Geometry and mass of an ObjectType.
+ *
+ * The bounding box is aligned with the axes of the object, with its bottom face centred on the origin.
+ * Values that are not known, because they have not been taken from the Prescan object library yet, are NaN.
+ * Check them with `std::isnan` before using them in any computation.
+ */
+struct ObjectInfo {
+  ObjectType type;          ///< Type of the object
+  ObjectCategory category;  ///< Category of the object
+  double length;            ///< Extent of the bounding box along the x axis [m]. 0 if it depends on the placement
+  double width;             ///< Extent of the bounding box along the y axis [m]. 0 if it depends on the placement
+  double height;            ///< Extent of the bounding box along the z axis [m]. 0 if it depends on the placement
+  double cog_x;             ///< X coordinate of the centre of gravity [m]
+  double cog_y;             ///< Y coordinate of the centre of gravity [m]
+  double cog_z;             ///< Z coordinate of the centre of gravity [m]
+  double mass;              ///< Mass [kg]. 0 if the object is anchored to the ground
+};
+
+/** Number of entries in the @ref object_catalog, one for each ObjectType */
+inline constexpr std::size_t object_catalog_size =
+    static_cast<std::size_t>(to_underlying(ObjectType::TrafficSignPole)) + 1;
+
+/**
+ * @brief Catalog of all the ObjectTypes, indexed by their underlying value.
+ *
+ * The data come from `object_catalog.def`, so that it can be looked up at compile time without querying Prescan.
+ * Unknown values are NaN.
+ * @code
+ * constexpr double length = object_catalog[to_underlying(ObjectType::Audi_A8_Sedan)].length;
+ * @endcode
+ */
+inline constexpr std::array<ObjectInfo, object_catalog_size> object_catalog{{
+#define SYMAWARE_OBJECT(type, category, length, width, height, cog_x, cog_y, cog_z, mass) \
+  ObjectInfo{ObjectType::type, ObjectCategory::category, length, width, height, cog_x, cog_y, cog_z, mass},
+#include "symaware/prescan/object_catalog.def"
+#undef SYMAWARE_OBJECT
+}};
+
+/**
+ * @brief Geometry and mass of the @p type, NaN where unknown.
+ * @param type type of the object
+ * @return entry of the @ref object_catalog for the @p type
+ * @throw std::out_of_range if the @p type is not a valid ObjectType
+ */
+constexpr const ObjectInfo& objectInfo(const ObjectType type) {
+  return object_catalog.at(static_cast<std::size_t>(to_underlying(type)));
+}
+
+std::ostream& operator<<(std::ostream& os, ObjectCategory category);
+std::ostream& operator<<(std::ostream& os, const ObjectInfo& info);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::ObjectCategory> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::ObjectInfo> : fmt::ostream_formatter {};
@@ -0,0 +1,128 @@
+/**
+ * @file point_cloud_filter.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief PointCloudFilter class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include "symaware/prescan/data.h"
+
+namespace symaware {
+
+/**
+ * @brief Reduce a point cloud given in the frame of a sensor to the points of interest in the world frame.
+ *
+ * Processing a cloud
+ * 1. transforms the points to the world frame with the pose of the sensor;
+ * 2. replaces the points falling in the same cubic voxel with their centroid,
+ *    using a hash grid over the voxels, so that the number of points depends on the volume covered and not on the
+ *    density of the scan;
+ * 3. fits a ground plane to the remaining points with RANSAC and removes the points close to it.
+ *
+ * Only the planes whose normal is within @ref Setup::max_ground_slope of the vertical are considered ground.
+ * All the buffers are reused between clouds, so that processing a cloud does not allocate once they are large enough.
+ * @code
+ * PointCloudFilter filter{PointCloudFilter::Setup{0.5}};
+ * filter.process(sensor_pose, x.data(), y.data(), z.data(), x.size());
+ * for (std::size_t i = 0; i < filter.size(); ++i) use(filter.points()[3 * i], filter.points()[3 * i + 1], ...);
+ * @endcode
+ */
+class PointCloudFilter {
+ public:
+  /** Parameters of the processing */
+  struct Setup {
+    explicit Setup(double voxel_size = 0.2, double ground_threshold = 0.1, std::size_t ground_iterations = 64,
+                   double max_ground_slope = 0.3, std::uint32_t seed = 0);
+    double voxel_size;              ///< Side of the voxels. 0 keeps all the points
+    double ground_threshold;        ///< Maximum distance of a ground point from the ground plane. 0 keeps the ground
+    std::size_t ground_iterations;  ///< Number of candidate planes sampled by RANSAC
+    double max_ground_slope;        ///< Maximum angle between the normal of the ground plane and the Z axis, in rad
+    std::uint32_t seed;             ///< Seed of the sampling of the candidate planes
+  };
+
+  /**
+   * @brief Construct a new PointCloudFilter object.
+   * @param setup parameters of the processing
+   * @throw std::invalid_argument if any parameter is negative
+   */
+  explicit PointCloudFilter(Setup setup = Setup{});
+
+  /**
+   * @brief Process a cloud of @p size points, given as separate arrays of coordinates in the frame of the @p pose.
+   *
+   * The result replaces the one of the previous cloud.
+   * The sampling of the candidate ground planes restarts from the seed every time,
+   * so that the same cloud is always processed in the same way.
+   * @param pose pose of the sensor in the world
+   * @param x X coordinates of the points in the frame of the sensor
+   * @param y Y coordinates of the points in the frame of the sensor
+   * @param z Z coordinates of the points in the frame of the sensor
+   * @param size number of points
+   */
+  void process(const Pose& pose, const double* x, const double* y, const double* z, std::size_t size);
+  /**
+   * @brief Forget the last cloud processed.
+   */
+  void clear();
+
+  const Setup& setup() const { return setup_; }
+  /** @return X, Y and Z coordinates in the world frame of each point left after the processing, one after the other */
+  const std::vector<double>& points() const { return points_; }
+  /** @return number of points left after the processing */
+  std::size_t size() const { return points_.size() / 3; }
+  /** @return number of points of the last cloud processed */
+  std::size_t inputSize() const { return input_size_; }
+  /** @return number of points removed as ground */
+  std::size_t groundSize() const { return ground_size_; }
+  /**
+   * @brief Ground plane of the last cloud processed, as the coefficients @f$ (a, b, c, d) @f$ of
+   * @f$ ax + by + cz + d = 0 @f$ with @f$ (a, b, c) @f$ a unit normal pointing upwards.
+   * @return coefficients of the plane, NaN if no ground plane was found
+   */
+  const std::array<double, 4>& groundPlane() const { return ground_plane_; }
+
+ private:
+  /** Points falling in the same cell of the grid */
+  struct Voxel {
+    std::int64_t i;       ///< Index of the voxel along X
+    std::int64_t j;       ///< Index of the voxel along Y
+    std::int64_t k;       ///< Index of the voxel along Z
+    double x;             ///< Sum of the X coordinates of the points
+    double y;             ///< Sum of the Y coordinates of the points
+    double z;             ///< Sum of the Z coordinates of the points
+    std::uint32_t count;  ///< Number of points
+  };
+
+  /** Replace the points in #x_, #y_ and #z_ with the centroids of their voxels */
+  void downsample();
+  /** Fit the ground plane to the points in #x_, #y_ and #z_ and store the other ones in #points_ */
+  void removeGround();
+
+  Setup setup_;                         ///< Parameters of the processing
+  std::size_t input_size_;              ///< Number of points of the last cloud
+  std::size_t ground_size_;             ///< Number of points of the last cloud removed as ground
+  std::array<double, 4> ground_plane_;  ///< Ground plane of the last cloud
+  std::vector<double> x_;               ///< X coordinates of the points being processed
+  std::vector<double> y_;               ///< Y coordinates of the points being processed
+  std::vector<double> z_;               ///< Z coordinates of the points being processed
+  std::vector<Voxel> voxels_;           ///< Voxels containing at least a point
+  std::vector<std::uint32_t> slots_;    ///< Open addressing table over the voxels, holding their index plus one
+  std::vector<double> points_;          ///< Points left after the processing
+};
+
+std::ostream& operator<<(std::ostream& os, const PointCloudFilter::Setup& setup);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::PointCloudFilter::Setup> : fmt::ostream_formatter {};
@@ -10,7 +10,10 @@
 #include <limits>
 #include <prescan/api/Experiment.hpp>
 #include <prescan/api/Roads.hpp>
+#include <vector>
 
+#include "symaware/map/frenet_transform.h"
+#include "symaware/map/reference_line.h"
 #include "symaware/prescan/data.h"
 #include "symaware/prescan/environment.h"
 
@@ -24,10 +27,12 @@ class Road {
 
   Road& addCurveSection(double length, double curvature) {
     road_.addArcSection(length, curvature);
+    reference_line_.addArc(length, curvature);
     return *this;
   }
   Road& addCubicPolynomialSection(double length, double a, double b, double c, double d) {
     road_.addCubicPolynomialSection(length, a, b, c, d);
+    reference_line_.addPoly3(length, a, b, c, d);
     return *this;
   }
   Road& addLane(prescan::api::roads::types::RoadSideType road_side, double width,
@@ -35,6 +40,14 @@ class Road {
                 double start_offset = 0.0, double end_offset = std::numeric_limits<double>::infinity()) {
     prescan::api::roads::types::Lane lane{road_.addLane(road_side, width, start_offset, end_offset)};
     lane.setType(lane_type);
+    // Only lanes spanning the whole road are mirrored, since the transform assumes constant lane widths
+    if (start_offset == 0.0 && end_offset == std::numeric_limits<double>::infinity()) {
+      if (road_side == prescan::api::roads::types::RoadSideType::RoadSideTypeLeft) {
+        left_lane_widths_.push_back(width);
+      } else {
+        right_lane_widths_.push_back(width);
+      }
+    }
     // TODO: handle markers
     // lane.getLaneMarker(prescan::api::roads::types::LaneSideType::LaneSideTypeInner).
     return *this;
@@ -43,6 +56,9 @@ class Road {
                                             double bV, double cV, double dV,
                                             prescan::api::roads::types::ParameterRange parameterRange) {
     road_.addParametricCubicPolynomialSection(length, aU, bU, cU, dU, aV, bV, cV, dV, parameterRange);
+    reference_line_.addParamPoly3(
+        length, {aU, bU, cU, dU}, {aV, bV, cV, dV},
+        parameterRange == prescan::api::roads::types::ParameterRange::ParamPolyRangeTypeNormalized);
     return *this;
   }
   Road& addParkingSpace(
@@ -59,10 +75,12 @@ class Road {
   }
   Road& addSpiralSection(double length, double startCurvature, double endCurvature) {
     road_.addSpiralSection(length, startCurvature, endCurvature);
+    reference_line_.addSpiral(length, startCurvature, endCurvature);
     return *this;
   }
   Road& addStraightSection(double length) {
     road_.addStraightSection(length);
+    reference_line_.addLine(length);
     return *this;
   }
   Road& setSpeedLimitProfile(double value, double start_offset = 0.0,
@@ -92,14 +110,36 @@ class Road {
   }
   Road& setPosition(const Position& position) {
     road_.pose().position().setXYZ(position.x, position.y, position.z);
+    reference_line_.setOrigin(position.x, position.y, reference_line_.origin_heading());
     return *this;
   }
 
   double length() const { return road_.length(); }
   const prescan::api::roads::types::Road& road() const { return road_; }
+  /**
+   * @brief Get the reference line of the road, evaluated natively without going through Prescan.
+   *
+   * Only the sections added through this object are part of the reference line.
+   * @return reference line of the road
+   */
+  const ReferenceLine& referenceLine() const { return reference_line_; }
+  /**
+   * @brief Create a transform between Cartesian poses and Frenet coordinates along the road.
+   *
+   * Lanes added through this object that span the whole road are used to assign the lane ids.
+   * @param max_offset maximum lateral offset of the poses that can be transformed
+   * @return transform over the reference line of the road
+   * @throw std::invalid_argument if the road has no sections
+   */
+  FrenetTransform frenetTransform(double max_offset = 50) const;
+  const std::vector<double>& left_lane_widths() const { return left_lane_widths_; }
+  const std::vector<double>& right_lane_widths() const { return right_lane_widths_; }
 
  private:
   prescan::api::roads::types::Road road_;  ///< Road object in the experiment
+  ReferenceLine reference_line_;           ///< Mirror of the sections of the road
+  std::vector<double> left_lane_widths_;   ///< Widths of the lanes on the left spanning the whole road
+  std::vector<double> right_lane_widths_;  ///< Widths of the lanes on the right spanning the whole road
 };
 
 }  // namespace symaware
@@ -0,0 +1,153 @@
+/**
+ * @file road_builder.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief RoadBuilder class.
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <iosfwd>
+#include <prescan/api/Experiment.hpp>
+#include <string>
+#include <vector>
+
+#include "symaware/prescan/environment.h"
+#include "symaware/prescan/road.h"
+
+namespace symaware {
+
+/**
+ * @brief Build many roads at once from a declarative description.
+ *
+ * The description is streamed into the experiment in a single native pass,
+ * applying each element to the road it belongs to as soon as it is read,
+ * so that networks with thousands of roads can be built without holding the whole description in memory.
+ * Two equivalent formats are supported.
+ *
+ * The JSON format is an object with a `roads` array.
+ * The keys of each road are applied in document order, as if the corresponding methods of @ref Road were chained.
+ * @code{.json}
+ * {
+ *   "roads": [
+ *     {
+ *       "position": [0, 0, 0],
+ *       "traffic_side": "right",
+ *       "sections": [
+ *         {"type": "straight", "length": 100},
+ *         {"type": "arc", "length": 50, "curvature": 0.01},
+ *         {"type": "spiral", "length": 20, "start_curvature": 0.01, "end_curvature": 0},
+ *         {"type": "poly3", "length": 30, "a": 0, "b": 0, "c": 0.001, "d": 0},
+ *         {"type": "param_poly3", "length": 30, "u": [0, 30, 0, 0], "v": [0, 0, -3, 2], "normalized": true}
+ *       ],
+ *       "lanes": [{"side": "right", "width": 3.5, "type": "driving", "start": 0, "end": 100}],
+ *       "speed_limits": [{"value": 13.9, "start": 0, "end": 100}],
+ *       "parking_spaces": [{"length": 5, "width": 2.5, "yaw": 0, "side": "left", "side_offset": 0, "offset": 10}]
+ *     }
+ *   ]
+ * }
+ * @endcode
+ * Only `length`, `curvature`, `start_curvature`, `end_curvature`, `width`, `value` and the parking space `length` and
+ * `width` are required, the other keys default to the defaults of the methods of @ref Road.
+ * Lane types are `driving`, `biking` and `sidewalk`, sides are `left` and `right`.
+ *
+ * The binary format is more compact and faster to read.
+ * It starts with the magic `SYMR` followed by the version as a 32-bit unsigned integer, currently 1,
+ * and continues with a sequence of records.
+ * Each record is made of a one byte tag, followed by its enumerations, one byte each, and then by its numbers,
+ * as 64-bit IEEE 754 doubles. All values are in little endian order.
+ * It can be produced from the JSON format with @ref jsonToBinary.
+ * | Tag  | Record        | Enumerations                                   | Numbers                                  |
+ * |------|---------------|------------------------------------------------|------------------------------------------|
+ * | 0x01 | road          |                                                |                                          |
+ * | 0x02 | position      |                                                | x, y, z                                  |
+ * | 0x03 | traffic side  | 0 left-hand, 1 right-hand                      |                                          |
+ * | 0x10 | straight      |                                                | length                                   |
+ * | 0x11 | arc           |                                                | length, curvature                        |
+ * | 0x12 | spiral        |                                                | length, start curvature, end curvature   |
+ * | 0x13 | poly3         |                                                | length, a, b, c, d                       |
+ * | 0x14 | param poly3   | 0 arc length, 1 normalized                     | length, u (4), v (4)                     |
+ * | 0x20 | lane          | side (0 left, 1 right), type (0 driving, 1 biking, 2 sidewalk) | width, start, end        |
+ * | 0x30 | speed limit   |                                                | value, start, end                        |
+ * | 0x40 | parking space | side (0 left, 1 right)                         | length, width, yaw, side offset, offset  |
+ * A road record starts a new road, every other record applies to the last road started.
+ */
+class RoadBuilder {
+ public:
+  /** Summary of what has been built */
+  struct Report {
+    std::size_t roads;           ///< Number of roads built
+    std::size_t sections;        ///< Number of sections added to the roads
+    std::size_t lanes;           ///< Number of lanes added to the roads
+    std::size_t speed_limits;    ///< Number of speed limit profiles set on the roads
+    std::size_t parking_spaces;  ///< Number of parking spaces added to the roads
+    double build_time;           ///< Time spent reading the description and building the roads, in seconds
+  };
+
+  /**
+   * @brief Construct a new road builder adding the roads to the @p environment.
+   * @param environment environment to add the roads to. It must outlive the builder
+   */
+  explicit RoadBuilder(Environment& environment);
+  /**
+   * @brief Construct a new road builder adding the roads to the @p experiment.
+   * @param experiment experiment to add the roads to. It must outlive the builder
+   */
+  explicit RoadBuilder(prescan::api::experiment::Experiment& experiment);
+
+  /**
+   * @brief Build the roads described in JSON format in the stream @p is.
+   * @param is stream containing the description
+   * @return summary of the roads built
+   * @throw std::runtime_error if the description is malformed. The message reports the line of the error
+   */
+  Report buildJson(std::istream& is);
+  /**
+   * @brief Build the roads described in JSON format in the file @p filename.
+   * @param filename path of the file containing the description
+   * @return summary of the roads built
+   * @throw std::runtime_error if the file cannot be opened or the description is malformed
+   */
+  Report buildJsonFile(const std::string& filename);
+  /**
+   * @brief Build the roads described in binary format in the stream @p is.
+   * @param is stream containing the description, opened in binary mode
+   * @return summary of the roads built
+   * @throw std::runtime_error if the description is malformed. The message reports the offset of the error
+   */
+  Report buildBinary(std::istream& is);
+  /**
+   * @brief Build the roads described in binary format in the file @p filename.
+   * @param filename path of the file containing the description
+   * @return summary of the roads built
+   * @throw std::runtime_error if the file cannot be opened or the description is malformed
+   */
+  Report buildBinaryFile(const std::string& filename);
+
+  /**
+   * @brief Convert a description of the roads from JSON to binary format.
+   * @param json stream containing the description in JSON format
+   * @param binary stream the description in binary format is written to, opened in binary mode
+   * @throw std::runtime_error if the description is malformed
+   */
+  static void jsonToBinary(std::istream& json, std::ostream& binary);
+
+  /** @return all the roads built so far, in the order they were described */
+  const std::vector<Road>& roads() const { return roads_; }
+  /** @return all the roads built so far, in the order they were described */
+  std::vector<Road>& roads() { return roads_; }
+
+ private:
+  prescan::api::experiment::Experiment& experiment_;  ///< Experiment the roads are added to
+  std::vector<Road> roads_;                           ///< Roads built so far
+};
+
+std::ostream& operator<<(std::ostream& os, const RoadBuilder::Report& report);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::RoadBuilder::Report> : fmt::ostream_formatter {};
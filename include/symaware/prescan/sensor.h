@@ -7,15 +7,25 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <prescan/api/Experiment.hpp>
 #include <prescan/api/types/SensorBase.hpp>
 #include <prescan/api/types/WorldObject.hpp>
 #include <prescan/sim/CameraSensorUnit.hpp>
+#include <prescan/sim/SelfSensorUnit.hpp>
 #include <prescan/sim/Simulation.hpp>
 #include <vector>
 
+#include "symaware/prescan/data.h"
+#include "symaware/prescan/point_cloud_filter.h"
+#include "symaware/prescan/sensor_fusion.h"
+#include "symaware/prescan/sensor_noise.h"
+#include "symaware/prescan/track_table.h"
 #include "symaware/prescan/type.h"
+#include "symaware/util/profiler.h"
 
 namespace symaware {
 
@@ -29,6 +39,18 @@ class Sensor {
    * @param id id of the sensor among the ones of the same kind attached to the @p object
    */
   void createSensor(const prescan::api::types::WorldObject& object, int id);
+  /**
+   * @brief Initialise the sensor reusing the one with the same kind and @p id already attached to the @p object.
+   *
+   * The setup of the sensor is applied to the attached one.
+   * @param object object the sensor is attached to
+   * @param id id of the sensor among the ones of the same kind attached to the @p object
+   */
+  void reuseSensor(const prescan::api::types::WorldObject& object, int id);
+  /**
+   * @brief Detach the sensor from its object, so that it can be created again on another one.
+   */
+  void detach();
   /**
    * @brief Register the sensor.
    *
@@ -60,16 +82,109 @@ class Sensor {
    */
   void terminate(prescan::sim::ISimulation* simulation);
 
+  int id() const { return id_; }
   SensorType sensor_type() const { return sensor_type_; }
   const std::vector<double>& setup() const { return setup_; }
   const std::vector<double>& state();
+  /**
+   * @brief Number of detections of the sensor in the last step, without building its state.
+   *
+   * Detections are the objects seen by an AIR or BRS sensor, or the points of all the lines seen by an LMS sensor.
+   * @return number of detections, 0 for the other kinds of sensor or if the sensor is not simulated
+   */
+  std::size_t detectionCount() const;
   const prescan::sim::CameraSensorUnit::Image& image() const { return image_; }
+  /**
+   * @brief Process the points seen by the sensor at each step with a @ref PointCloudFilter.
+   *
+   * The points are taken in the world frame, using the pose of the object and the one of the sensor on it.
+   * The filter must be set before the simulation starts.
+   * @param setup parameters of the processing
+   * @throw std::runtime_error if the sensor is not an LMS sensor
+   */
+  void setPointCloudFilter(const PointCloudFilter::Setup& setup);
+  /**
+   * @brief Stop processing the points seen by the sensor.
+   */
+  void clearPointCloudFilter();
+  /** @return filter processing the points seen by the sensor, or nullptr if there is none */
+  const PointCloudFilter* pointCloudFilter() const {
+    return point_cloud_filter_.has_value() ? &point_cloud_filter_.value() : nullptr;
+  }
+  /**
+   * @brief Track the objects detected by the sensor at each step in a @ref TrackTable.
+   *
+   * The detections are taken in the world frame, using the pose of the object and the one of the sensor on it.
+   * The table must be set before the simulation starts, and is emptied when it starts.
+   * @param setup parameters of the table
+   * @throw std::runtime_error if the sensor is not an AIR sensor
+   */
+  void setTrackTable(const TrackTable::Setup& setup);
+  /**
+   * @brief Stop tracking the objects detected by the sensor.
+   */
+  void clearTrackTable();
+  /** @return table tracking the objects detected by the sensor, or nullptr if there is none */
+  const TrackTable* trackTable() const { return track_table_.has_value() ? &track_table_.value() : nullptr; }
+  /**
+   * @brief Corrupt the @ref state of the sensor at each step with a @ref SensorNoise.
+   *
+   * The rows corrupted are the detections of AIR and BRS sensors and the points of LMS sensors.
+   * Only the state is corrupted: the tables, filters and fusions fed by the sensor still see its exact output.
+   * The state is built at every step, so that the latency can be applied,
+   * and the random numbers of a step do not depend on when the state is read.
+   * Each simulation is a new episode of the noise, starting from the one of the first simulation.
+   * @param setup parameters of the corruption
+   * @throw std::invalid_argument if the @p setup does not match the state of the sensor
+   * @throw std::runtime_error if the sensor is not an AIR, BRS or LMS sensor
+   */
+  void setSensorNoise(const SensorNoise::Setup& setup);
+  /**
+   * @brief Stop corrupting the state of the sensor.
+   */
+  void clearSensorNoise();
+  /**
+   * @brief Select the episode of the noise of the next simulation, e.g. to reproduce one of a campaign.
+   * @param episode index of the episode
+   */
+  void setNoiseEpisode(std::uint64_t episode);
+  /** @return noise corrupting the state of the sensor, or nullptr if there is none */
+  const SensorNoise* sensorNoise() const { return sensor_noise_.has_value() ? &sensor_noise_.value() : nullptr; }
+  /**
+   * @brief Feed the objects detected by the sensor in the last step to the @p fusion.
+   *
+   * AIR sensors provide the positions of the objects, BRS sensors the bearings of the centres of their boxes,
+   * both in the world frame. The detections of the other kinds of sensor are ignored.
+   * @param object_pose pose of the object the sensor is attached to in the last step
+   * @param fusion fusion to update
+   */
+  void fuseDetections(const Pose& object_pose, SensorFusion& fusion);
+  PhaseProfile& profile() { return profile_; }
+  const PhaseProfile& profile() const { return profile_; }
 
  private:
+  void initialiseSensor(const prescan::api::types::WorldObject& object, int id, bool attached);
   template <class T>
   void applySetup(T* sensor_ptr);
   template <class T>
   void updateState();
+  /** Corrupt the #state_ of the last step with the #sensor_noise_ */
+  void corruptState();
+  /** Process the points seen by the LMS sensor in the last step with the #point_cloud_filter_ */
+  void filterPointCloud();
+  /** Update the #track_table_ with the objects detected by the AIR sensor in the last step */
+  void trackDetections(double sample_time);
+  /**
+   * @brief Convert the objects detected by the AIR sensor in the last step to the world frame.
+   *
+   * The #scratch_ is filled with the heading, X, Y and Z of the objects, in this order, after some scratch space.
+   * Their ids are stored in the #detection_ids_.
+   * @param pose pose of the sensor in the world
+   * @return number of objects
+   */
+  std::size_t worldDetections(const Pose& pose);
+  /** @return pose of the sensor in the world, from the pose of its object in the last step */
+  Pose worldPose() const;
 
   bool existing_;
   int id_;
@@ -78,6 +193,17 @@ class Sensor {
   std::vector<double> state_;
   prescan::sim::CameraSensorUnit::Image image_;
   const prescan::sim::Unit* sensor_unit_;
+  PhaseProfile profile_;
+  std::optional<PointCloudFilter> point_cloud_filter_;  ///< Filter of the points seen by the sensor, if any
+  std::optional<TrackTable> track_table_;               ///< Table of the objects detected by the sensor, if any
+  std::optional<SensorNoise> sensor_noise_;             ///< Corruption of the state of the sensor, if any
+  bool state_corrupted_;                                ///< Whether the #state_ of the last step has been corrupted
+  const prescan::sim::SelfSensorUnit* object_unit_;     ///< Pose of the object, registered only when needed
+  Pose mount_pose_;                                     ///< Pose of the sensor relative to the object
+  std::vector<double> scratch_;                         ///< Coordinates of the points or detections being processed
+  std::vector<std::int32_t> detection_ids_;             ///< Ids of the detections being processed
+  double fov_horizontal_;                               ///< Horizontal field of view of a BRS sensor
+  double resolution_x_;                                 ///< Horizontal resolution of a BRS sensor, in pixels
 };
 
 }  // namespace symaware
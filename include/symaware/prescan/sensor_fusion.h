@@ -0,0 +1,172 @@
+/**
+ * @file sensor_fusion.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief SensorFusion class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <unordered_map>
+#include <tuple>
+#include <vector>
+
+#include "symaware/prescan/data.h"
+
+namespace symaware {
+
+/**
+ * @brief Fuse the detections of the sensors of an entity into a single list of tracks on the ground plane.
+ *
+ * Each track follows an object with a constant velocity Kalman filter over its position and velocity.
+ * At each step, the tracks are first predicted, then updated with
+ * - the positions of the objects, e.g. from AIR sensors, which also start the new tracks;
+ * - the bearings of the objects from the sensor, e.g. from BRS sensors, with an extended Kalman filter update.
+ *
+ * A detection with an id, i.e. non-negative, updates the track of the object with the same id.
+ * A detection without an id is associated to the closest track, by Mahalanobis distance, within the gate.
+ * The associations are made from the closest pairs of detection and track, so that each track is updated
+ * at most once per batch of detections without an id.
+ * Detections with an id of an object without a track, and bearings without an associated track, are discarded.
+ * @code
+ * SensorFusion fusion{};
+ * fusion.predict(0.05);
+ * fusion.updatePositions(air_ids.data(), x.data(), y.data(), air_ids.size());
+ * fusion.updateBearings(sensor_position, brs_ids.data(), bearing.data(), brs_ids.size());
+ * for (const SensorFusion::Track& track : fusion.tracks()) use(track.id, track.state);
+ * @endcode
+ */
+class SensorFusion {
+ public:
+  /** Parameters of the fusion */
+  struct Setup {
+    explicit Setup(double position_noise = 0.5, double bearing_noise = 0.01, double acceleration_noise = 2,
+                   double initial_velocity_noise = 10, double position_gate = 9.21, double bearing_gate = 6.63,
+                   std::size_t max_age = 10);
+    double position_noise;          ///< Standard deviation of the measured positions, in m
+    double bearing_noise;           ///< Standard deviation of the measured bearings, in rad
+    double acceleration_noise;      ///< Standard deviation of the accelerations of the objects, in m/s^2
+    double initial_velocity_noise;  ///< Standard deviation of the velocity of a new track, in m/s
+    double position_gate;  ///< Maximum squared Mahalanobis distance of a position without an id from its track
+    double bearing_gate;   ///< Maximum squared Mahalanobis distance of a bearing without an id from its track
+    std::size_t max_age;   ///< Number of steps a track is kept after it was last updated
+  };
+
+  /** Kinds of measurement that updated a track */
+  enum Source : std::uint32_t {
+    POSITION = 1,  ///< Position of the object
+    BEARING = 2,   ///< Bearing of the object
+  };
+
+  /** Object followed by the fusion */
+  struct Track {
+    std::int32_t id;                    ///< Id of the object, -1 if unknown
+    std::int64_t last_seen;             ///< Last step the track was updated at
+    std::uint32_t sources;              ///< Mask of the @ref Source of the measurements in the last step
+    std::array<double, 4> state;        ///< X, Y, velocity along X and velocity along Y
+    std::array<double, 16> covariance;  ///< Covariance of the state, row-major
+  };
+
+  /**
+   * @brief Construct a new SensorFusion object.
+   * @param setup parameters of the fusion
+   * @throw std::invalid_argument if any noise is not positive or any gate is negative
+   */
+  explicit SensorFusion(Setup setup = Setup{});
+
+  /**
+   * @brief Start a new step, removing the old tracks and predicting the state of the others.
+   *
+   * Tracks not updated for more than @ref Setup::max_age steps are removed.
+   * The rows of the tracks may change.
+   * @param sample_time time elapsed since the previous step, in s
+   */
+  void predict(double sample_time);
+  /**
+   * @brief Update the tracks with the positions of the objects in the world frame.
+   *
+   * Positions of objects with an id but without a track, or without an id and outside the gate of any track,
+   * start a new track.
+   * @param ids ids of the objects, negative if unknown
+   * @param x X coordinates of the objects
+   * @param y Y coordinates of the objects
+   * @param size number of objects
+   */
+  void updatePositions(const std::int32_t* ids, const double* x, const double* y, std::size_t size);
+  /**
+   * @brief Update the tracks with the bearings of the objects seen from the @p origin.
+   * @param origin position of the sensor in the world frame. Only X and Y are used
+   * @param ids ids of the objects, negative if unknown
+   * @param bearing angles between the X axis of the world frame and the direction of the objects, in rad
+   * @param size number of objects
+   */
+  void updateBearings(const Position& origin, const std::int32_t* ids, const double* bearing, std::size_t size);
+  /**
+   * @brief Remove all the tracks and restart counting the steps from 0.
+   */
+  void clear();
+  /**
+   * @brief Find the track of the object with the given @p id.
+   * @param id id of the object
+   * @return row of the track, or -1 if the object is not tracked
+   */
+  std::ptrdiff_t find(std::int32_t id) const;
+
+  const Setup& setup() const { return setup_; }
+  const std::vector<Track>& tracks() const { return tracks_; }
+  /** @return number of tracks */
+  std::size_t size() const { return tracks_.size(); }
+  /** @return index of the current step, -1 before the first prediction */
+  std::int64_t step() const { return step_; }
+
+ private:
+  /** Start a new track at the position ( @p x, @p y) */
+  void addTrack(std::int32_t id, double x, double y);
+  /** Update the track in the @p row with the position ( @p x, @p y) */
+  void updatePosition(std::size_t row, double x, double y);
+  /** Update the track in the @p row with the @p bearing seen from ( @p ox, @p oy) */
+  void updateBearing(std::size_t row, double ox, double oy, double bearing);
+  /** @return squared Mahalanobis distance of the position ( @p x, @p y) from the track in the @p row */
+  double positionDistance(std::size_t row, double x, double y) const;
+  /** Store in #expected_ the bearing of each track seen from ( @p ox, @p oy) and the variance of its innovation */
+  void expectBearings(double ox, double oy);
+  /**
+   * @brief Associate the detections without an id to the tracks not yet updated in the current batch.
+   *
+   * Only the tracks in the rows marked in #assigned_ are considered taken.
+   * @param ids ids of the detections, only the negative ones are associated
+   * @param size number of detections
+   * @param gate maximum squared distance of an association
+   * @param distance squared distance of the detection with the given index from the track in the given row
+   * @return row of the track associated to each detection, or the number of tracks if there is none
+   */
+  template <class Distance>
+  const std::vector<std::size_t>& associate(const std::int32_t* ids, std::size_t size, double gate,
+                                            Distance distance);
+
+  Setup setup_;                                         ///< Parameters of the fusion
+  std::int64_t step_;                                   ///< Index of the current step
+  std::vector<Track> tracks_;                           ///< Tracks of the objects
+  std::unordered_map<std::int32_t, std::size_t> rows_;  ///< Row of the track of each object with an id
+  std::vector<std::tuple<double, std::size_t, std::size_t>> candidates_;  ///< Detections and tracks within the gate
+  std::vector<std::size_t> associations_;  ///< Row of the track associated to each detection
+  std::vector<bool> assigned_;             ///< Whether each track is taken in the current batch
+  std::vector<bool> associated_;           ///< Whether each detection is taken in the current batch
+  std::vector<double> expected_;           ///< Expected bearing and innovation variance of each track
+};
+
+std::ostream& operator<<(std::ostream& os, const SensorFusion::Setup& setup);
+std::ostream& operator<<(std::ostream& os, const SensorFusion::Track& track);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::SensorFusion::Setup> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::SensorFusion::Track> : fmt::ostream_formatter {};
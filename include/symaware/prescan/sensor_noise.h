@@ -0,0 +1,140 @@
+/**
+ * @file sensor_noise.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief SensorNoise class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Corrupt the detections of a sensor, to test the robustness of the components consuming them.
+ *
+ * The detections are rows of @ref width values, e.g. range, azimuth, elevation, id, velocity and heading for an AIR
+ * sensor, corrupted in place by a sequence of stages:
+ * 1. noise, added to each value with the scale of its column;
+ * 2. quantisation, rounding each value to a multiple of the step of its column;
+ * 3. dropout, removing each detection with the same probability;
+ * 4. false positives, adding detections drawn uniformly within the bounds of each column;
+ * 5. latency, returning the detections of a previous step.
+ *
+ * The random numbers come from a counter-based generator: each of them is a hash of the seed, the episode,
+ * the step and its position in the step, so they are drawn in independent batches
+ * and the same episode is corrupted in the same way regardless of what happened before.
+ * @code
+ * SensorNoise noise{SensorNoise::Setup{{0.1, 0.01, 0.01, 0, 0.1, 0.01}}, 6};
+ * noise.reset(episode);
+ * // ... at each step
+ * noise.beginStep();
+ * state.resize(noise.corrupt(state.data(), state.size() / 6) * 6);
+ * noise.addFalsePositives(state);
+ * noise.delay(state);
+ * @endcode
+ */
+class SensorNoise {
+ public:
+  /** Distribution of the noise added to the values */
+  enum class Distribution {
+    GAUSSIAN,  ///< Normal distribution, with the scale as standard deviation
+    LAPLACE,   ///< Laplace distribution, with the scale as diversity, i.e. a standard deviation of scale * sqrt(2)
+  };
+
+  /** Parameters of the corruption. Empty vectors disable the corresponding stage */
+  struct Setup {
+    explicit Setup(std::vector<double> noise = {}, Distribution distribution = Distribution::GAUSSIAN,
+                   std::vector<double> quantisation = {}, double dropout = 0, double false_positives = 0,
+                   std::vector<double> false_positive_low = {}, std::vector<double> false_positive_high = {},
+                   std::size_t latency = 0, std::size_t latency_jitter = 0, std::uint64_t seed = 0);
+    std::vector<double> noise;                ///< Scale of the noise of each column, 0 to leave it unchanged
+    Distribution distribution;                ///< Distribution of the noise
+    std::vector<double> quantisation;         ///< Step of each column, 0 to leave it unchanged
+    double dropout;                           ///< Probability of removing each detection
+    double false_positives;                   ///< Average number of false detections added at each step
+    std::vector<double> false_positive_low;   ///< Lower bound of each column of the false detections
+    std::vector<double> false_positive_high;  ///< Upper bound of each column of the false detections
+    std::size_t latency;                      ///< Number of steps the detections are delayed by
+    std::size_t latency_jitter;               ///< Maximum number of steps randomly added to the latency at each step
+    std::uint64_t seed;                       ///< Seed of the random numbers
+  };
+
+  /**
+   * @brief Construct a new SensorNoise object.
+   * @param setup parameters of the corruption
+   * @param width number of values of each detection
+   * @throw std::invalid_argument if the vectors of the @p setup are neither empty nor @p width long,
+   * if a probability is not in [0, 1] or if a scale, a step or the average number of false detections is negative.
+   * The bounds of the false detections can not be empty if their average number is positive
+   */
+  SensorNoise(Setup setup, std::size_t width);
+
+  /**
+   * @brief Start the given @p episode, emptying the delay buffer.
+   * @param episode index of the episode, which selects the random numbers along with the seed
+   */
+  void reset(std::uint64_t episode);
+  /**
+   * @brief Start a new step, drawing new random numbers.
+   */
+  void beginStep();
+  /**
+   * @brief Add the noise to the detections, quantise them and drop some of them, in place.
+   *
+   * The kept detections are moved to the front, in the same order.
+   * @param rows detections, one row of @ref width values after the other
+   * @param size number of detections
+   * @param first index of the first detection among the ones of the step, if they are corrupted in more batches
+   * @return number of detections kept
+   */
+  std::size_t corrupt(double* rows, std::size_t size, std::size_t first = 0);
+  /**
+   * @brief Append the false detections of the step to the @p rows.
+   * @param rows detections, one row of @ref width values after the other
+   * @return number of false detections added
+   */
+  std::size_t addFalsePositives(std::vector<double>& rows);
+  /**
+   * @brief Store the @p rows of the step and replace them with the ones of the step the latency points to.
+   *
+   * The @p rows are emptied if the latency points to a step before the start of the episode.
+   * @pre @ref beginStep must have been called since the last @ref reset
+   * @param rows detections of the step, replaced by the delayed ones
+   * @throw std::runtime_error if the step has not begun and there is a latency
+   */
+  void delay(std::vector<double>& rows);
+
+  const Setup& setup() const { return setup_; }
+  std::size_t width() const { return width_; }
+  std::uint64_t episode() const { return episode_; }
+  /** @return index of the current step in the episode, -1 before the first one */
+  std::int64_t step() const { return step_; }
+
+ private:
+  /** @return key of the random numbers of the given @p stream in the current step */
+  std::uint64_t key(std::uint64_t stream) const;
+
+  Setup setup_;                              ///< Parameters of the corruption
+  std::size_t width_;                        ///< Number of values of each detection
+  std::uint64_t episode_;                    ///< Index of the current episode
+  std::int64_t step_;                        ///< Index of the current step in the episode
+  std::vector<double> samples_;              ///< Random numbers of the batch being corrupted
+  std::vector<std::vector<double>> buffer_;  ///< Detections of the last steps, indexed by step modulo its size
+};
+
+std::ostream& operator<<(std::ostream& os, SensorNoise::Distribution distribution);
+std::ostream& operator<<(std::ostream& os, const SensorNoise::Setup& setup);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::SensorNoise::Distribution> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::SensorNoise::Setup> : fmt::ostream_formatter {};
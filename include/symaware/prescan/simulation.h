@@ -13,6 +13,7 @@
 
 #include "symaware/prescan/environment.h"
 #include "symaware/prescan/model/simulation_model.h"
+#include "symaware/util/profiler.h"
 
 namespace symaware {
 
@@ -58,10 +59,27 @@ class Simulation {
    */
   void setLogLevel(prescan::sim::ISimulationLogger::LogLevel log_level);
 
+  /**
+   * @brief Summary of the time spent in each phase of the simulation by each component.
+   *
+   * The components are the simulation itself (including the pre/post step callbacks), each entity,
+   * its model and its sensors, and the models added directly to the environment.
+   * Components that do not belong to an entity have an empty entity name.
+   * Only phases measured while the @ref Profiler was enabled are included.
+   * @return one summary for each component and phase, in nanoseconds
+   */
+  std::vector<ProfileStats> stats() const;
+  /**
+   * @brief Remove all the measures collected so far by the profiler.
+   */
+  void resetStats();
+
   void setOnPreStep(const std::function<void()>& callback) { model_.setOnPreStep(callback); }
   void setOpPostStep(const std::function<void()>& callback) { model_.setOpPostStep(callback); }
   void removeOnPreStep() { model_.setOnPreStep(nullptr); }
   void removeOnPostStep() { model_.setOpPostStep(nullptr); }
+  void addObserver(SimulationObserver& observer) { model_.addObserver(observer); }
+  void removeObserver(SimulationObserver& observer) { model_.removeObserver(observer); }
 
  private:
   bool is_initialised_;
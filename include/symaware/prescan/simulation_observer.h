@@ -0,0 +1,53 @@
+/**
+ * @file simulation_observer.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief SimulationObserver class
+ */
+#pragma once
+
+#include <prescan/sim/Simulation.hpp>
+
+#include "symaware/prescan/environment.h"
+
+namespace symaware {
+
+/**
+ * @brief Passive component notified by the @ref SimulationModel at each stage of the simulation.
+ *
+ * Observers are stepped after all the entities and models have been stepped,
+ * so they always see the most recent state of the @ref Environment.
+ * They must not modify the environment.
+ */
+class SimulationObserver {
+ public:
+  virtual ~SimulationObserver() = default;
+
+  /**
+   * @brief Initialise the observer.
+   *
+   * Called before the first step of the @p simulation.
+   * @param environment environment being simulated
+   * @param simulation simulation that is about to run the experiment
+   */
+  virtual void initialise(const Environment& /* environment */, prescan::sim::ISimulation* /* simulation */) {}
+  /**
+   * @brief Observe the current state of the @p environment.
+   *
+   * Called at each step of the @p simulation.
+   * @param environment environment being simulated
+   * @param simulation simulation that is running the experiment
+   */
+  virtual void step(const Environment& environment, prescan::sim::ISimulation* simulation) = 0;
+  /**
+   * @brief Terminate the observer.
+   *
+   * Called at the end of the @p simulation.
+   * @param environment environment being simulated
+   * @param simulation simulation that has run the experiment
+   */
+  virtual void terminate(const Environment& /* environment */, prescan::sim::ISimulation* /* simulation */) {}
+};
+
+}  // namespace symaware
@@ -0,0 +1,112 @@
+/**
+ * @file track_table.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief TrackTable class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+namespace symaware {
+
+/**
+ * @brief Table of the objects detected by a sensor, keyed by their id.
+ *
+ * Each track holds the last position and heading of an object in the world frame, the step it was last seen at,
+ * and its velocity, estimated by finite differences between the last two positions.
+ * The tracks are stored as separate arrays, one per quantity, with the same row for the same track.
+ * Tracks not seen for more than @ref Setup::max_age steps are removed, moving the last track in their row,
+ * so the rows of the tracks may change at every update.
+ * @code
+ * TrackTable table{};
+ * table.update(0.05, ids.data(), x.data(), y.data(), z.data(), heading.data(), ids.size());
+ * const std::ptrdiff_t row = table.find(id);
+ * if (row >= 0) use(table.x()[row], table.vx()[row]);
+ * @endcode
+ */
+class TrackTable {
+ public:
+  /** Parameters of the table */
+  struct Setup {
+    explicit Setup(std::size_t max_age = 10);
+    std::size_t max_age;  ///< Number of steps a track is kept after the object was last seen
+  };
+
+  /**
+   * @brief Construct a new TrackTable object.
+   * @param setup parameters of the table
+   */
+  explicit TrackTable(Setup setup = Setup{});
+
+  /**
+   * @brief Advance the table by one step, updating it with the objects detected in the step.
+   *
+   * The velocity of a track is NaN until its object has been seen in two different steps.
+   * @param sample_time time elapsed since the previous step, in s
+   * @param ids ids of the objects
+   * @param x X coordinates of the objects in the world frame
+   * @param y Y coordinates of the objects in the world frame
+   * @param z Z coordinates of the objects in the world frame
+   * @param heading yaw of the objects in the world frame
+   * @param size number of objects
+   */
+  void update(double sample_time, const std::int32_t* ids, const double* x, const double* y, const double* z,
+              const double* heading, std::size_t size);
+  /**
+   * @brief Remove all the tracks and restart counting the steps from 0.
+   */
+  void clear();
+  /**
+   * @brief Find the track of the object with the given @p id.
+   * @param id id of the object
+   * @return row of the track, or -1 if the object is not tracked
+   */
+  std::ptrdiff_t find(std::int32_t id) const;
+
+  const Setup& setup() const { return setup_; }
+  /** @return number of tracks */
+  std::size_t size() const { return ids_.size(); }
+  /** @return index of the last step, -1 before the first update */
+  std::int64_t step() const { return step_; }
+  const std::vector<std::int32_t>& ids() const { return ids_; }
+  const std::vector<std::int64_t>& lastSeen() const { return last_seen_; }
+  const std::vector<double>& x() const { return x_; }
+  const std::vector<double>& y() const { return y_; }
+  const std::vector<double>& z() const { return z_; }
+  const std::vector<double>& vx() const { return vx_; }
+  const std::vector<double>& vy() const { return vy_; }
+  const std::vector<double>& vz() const { return vz_; }
+  const std::vector<double>& heading() const { return heading_; }
+
+ private:
+  /** Remove the track in the @p row, moving the last track in its place */
+  void remove(std::size_t row);
+
+  Setup setup_;                                         ///< Parameters of the table
+  std::int64_t step_;                                   ///< Index of the last step
+  std::unordered_map<std::int32_t, std::size_t> rows_;  ///< Row of the track of each object
+  std::vector<std::int32_t> ids_;                       ///< Id of the object of each track
+  std::vector<std::int64_t> last_seen_;                 ///< Step each object was last seen at
+  std::vector<double> x_;                               ///< Last X coordinate of each object
+  std::vector<double> y_;                               ///< Last Y coordinate of each object
+  std::vector<double> z_;                               ///< Last Z coordinate of each object
+  std::vector<double> vx_;                              ///< Velocity of each object along X
+  std::vector<double> vy_;                              ///< Velocity of each object along Y
+  std::vector<double> vz_;                              ///< Velocity of each object along Z
+  std::vector<double> heading_;                         ///< Last yaw of each object
+};
+
+std::ostream& operator<<(std::ostream& os, const TrackTable::Setup& setup);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::TrackTable::Setup> : fmt::ostream_formatter {};
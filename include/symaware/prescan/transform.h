@@ -0,0 +1,163 @@
+/**
+ * @file transform.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Frame transforms between poses
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+
+#include "symaware/prescan/data.h"
+
+namespace symaware {
+
+/**
+ * @brief Rotation matrix, stored by rows.
+ *
+ * The rotation of an @ref Orientation is the one used by Prescan, @f$ R = R_z(yaw) R_y(pitch) R_x(roll) @f$,
+ * so that the columns of the matrix are the axes of the rotated frame expressed in the original one.
+ */
+using RotationMatrix = std::array<double, 9>;
+
+/** Unit quaternion representing a rotation */
+struct Quaternion {
+  double w;  ///< Real part
+  double x;  ///< First imaginary part
+  double y;  ///< Second imaginary part
+  double z;  ///< Third imaginary part
+};
+
+/** @return whether the batch transforms have been compiled with the AVX2 kernels */
+bool avx2Transforms();
+
+/**
+ * @brief Rotation matrix of the @p orientation.
+ * @param orientation roll, pitch and yaw of the rotation
+ * @return rotation matrix, stored by rows
+ */
+RotationMatrix rotationMatrix(const Orientation& orientation);
+/**
+ * @brief Quaternion of the @p orientation.
+ * @param orientation roll, pitch and yaw of the rotation
+ * @return unit quaternion, with a non-negative real part
+ */
+Quaternion quaternion(const Orientation& orientation);
+/**
+ * @brief Roll, pitch and yaw of the @p rotation.
+ *
+ * The pitch is in @f$ [-\pi/2, \pi/2] @f$, while the roll and the yaw are in @f$ [-\pi, \pi] @f$.
+ * @param rotation rotation matrix, stored by rows
+ * @return orientation of the rotation
+ */
+Orientation orientation(const RotationMatrix& rotation);
+/**
+ * @brief Roll, pitch and yaw of the @p quaternion.
+ * @param quaternion unit quaternion
+ * @return orientation of the rotation
+ */
+Orientation orientation(const Quaternion& quaternion);
+
+/**
+ * @brief Compose two poses.
+ *
+ * If @p parent is the pose of frame B in frame A and @p child is the pose of frame C in frame B,
+ * the result is the pose of frame C in frame A, e.g. the pose of a sensor in the world from the pose of its entity.
+ * @param parent pose of the intermediate frame
+ * @param child pose relative to the intermediate frame
+ * @return pose of the @p child in the frame of the @p parent
+ */
+Pose compose(const Pose& parent, const Pose& child);
+/**
+ * @brief Invert a pose.
+ *
+ * If @p pose is the pose of frame B in frame A, the result is the pose of frame A in frame B.
+ * @param pose pose to invert
+ * @return inverse pose
+ */
+Pose inverse(const Pose& pose);
+
+/**
+ * @brief Express a @p point given in the frame of the @p pose in the frame the @p pose is given in.
+ * @param pose pose of the local frame
+ * @param point point in the local frame
+ * @return point in the parent frame
+ */
+Position transformPoint(const Pose& pose, const Position& point);
+/**
+ * @brief Express a @p point given in the frame the @p pose is given in in the frame of the @p pose.
+ * @param pose pose of the local frame
+ * @param point point in the parent frame
+ * @return point in the local frame
+ */
+Position inverseTransformPoint(const Pose& pose, const Position& point);
+
+/**
+ * @brief Express @p size points given in the frame of the @p pose in the frame the @p pose is given in.
+ *
+ * The points are stored as separate arrays of coordinates, processed four at a time with AVX2 when available.
+ * The output arrays may be the same as the input ones, to transform the points in place.
+ * @param pose pose of the local frame
+ * @param x X coordinates of the points in the local frame
+ * @param y Y coordinates of the points in the local frame
+ * @param z Z coordinates of the points in the local frame
+ * @param size number of points
+ * @param out_x X coordinates of the points in the parent frame
+ * @param out_y Y coordinates of the points in the parent frame
+ * @param out_z Z coordinates of the points in the parent frame
+ */
+void transformPoints(const Pose& pose, const double* x, const double* y, const double* z, std::size_t size,
+                     double* out_x, double* out_y, double* out_z);
+/**
+ * @brief Express @p size points given in the frame the @p pose is given in in the frame of the @p pose.
+ * @see transformPoints
+ */
+void inverseTransformPoints(const Pose& pose, const double* x, const double* y, const double* z, std::size_t size,
+                            double* out_x, double* out_y, double* out_z);
+/**
+ * @brief Express @p size points given in the frame of the @p pose in the frame the @p pose is given in.
+ *
+ * Each point starts every @p stride doubles, with its X, Y and Z coordinates first,
+ * e.g. 4 for the points in the state of an LMS sensor, which are followed by their curvature.
+ * The points are copied in blocks to separate arrays of coordinates, so that they can be processed like the others.
+ * @param pose pose of the local frame
+ * @param points points in the local frame
+ * @param size number of points
+ * @param stride number of doubles between the start of two consecutive points. Must be at least 3
+ * @param out points in the parent frame, as consecutive X, Y and Z coordinates. Must not overlap with @p points
+ * @throw std::invalid_argument if the @p stride is less than 3
+ */
+void transformPoints(const Pose& pose, const double* points, std::size_t size, std::size_t stride, double* out);
+/**
+ * @brief Express @p size points given in the frame the @p pose is given in in the frame of the @p pose.
+ * @see transformPoints
+ */
+void inverseTransformPoints(const Pose& pose, const double* points, std::size_t size, std::size_t stride,
+                            double* out);
+
+/**
+ * @brief Cartesian coordinates of @p size points given by range, azimuth and elevation, e.g. AIR detections.
+ *
+ * The azimuth is measured counterclockwise from the X axis in the XY plane, the elevation upwards from that plane.
+ * @param range distance of the points from the origin
+ * @param azimuth azimuth of the points
+ * @param elevation elevation of the points
+ * @param size number of points
+ * @param out_x X coordinates of the points
+ * @param out_y Y coordinates of the points
+ * @param out_z Z coordinates of the points
+ */
+void polarToCartesian(const double* range, const double* azimuth, const double* elevation, std::size_t size,
+                      double* out_x, double* out_y, double* out_z);
+
+std::ostream& operator<<(std::ostream& os, const Quaternion& quaternion);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::Quaternion> : fmt::ostream_formatter {};
@@ -0,0 +1,200 @@
+/**
+ * @file trigger_system.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief TriggerSystem class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <prescan/sim/Simulation.hpp>
+#include <vector>
+
+#include "symaware/prescan/entity.h"
+#include "symaware/prescan/environment.h"
+#include "symaware/prescan/sensor.h"
+#include "symaware/prescan/simulation_observer.h"
+
+namespace symaware {
+
+/**
+ * @brief Observer evaluating conditions on the simulation after every step,
+ * calling back only when a condition starts or stops holding.
+ *
+ * Each trigger compares a value, e.g. the velocity of an entity or the distance between two entities,
+ * against a threshold.
+ * A trigger becomes active as soon as the value crosses the threshold,
+ * but only becomes inactive again once the value has moved back past the threshold by more than the hysteresis,
+ * so that values oscillating around the threshold do not produce a callback every step.
+ * All the triggers are inactive when the simulation is initialised.
+ * @code
+ * TriggerSystem triggers;
+ * triggers.addPointDistanceTrigger(ego, stop_x, stop_y, TriggerSystem::Comparison::BELOW, 5, 0.5,
+ *                                  [](std::size_t, bool active, double time) { ... });
+ * simulation.addObserver(triggers);
+ * @endcode
+ */
+class TriggerSystem : public SimulationObserver {
+ public:
+  /** Quantity of the state of an entity a trigger can be defined on */
+  enum class Quantity {
+    X,         ///< X coordinate of the position
+    Y,         ///< Y coordinate of the position
+    Z,         ///< Z coordinate of the position
+    ROLL,      ///< Roll of the orientation
+    PITCH,     ///< Pitch of the orientation
+    YAW,       ///< Yaw of the orientation
+    VELOCITY,  ///< Velocity
+    YAW_RATE,  ///< Yaw rate
+  };
+  /** Comparison between the value of a trigger and its threshold */
+  enum class Comparison {
+    BELOW,  ///< The trigger is active while the value is below the threshold
+    ABOVE,  ///< The trigger is active while the value is above the threshold
+  };
+  /**
+   * @brief Function called when a trigger changes state.
+   *
+   * Its arguments are the id of the trigger, whether it has become active and the time at the end of the step.
+   */
+  using Callback = std::function<void(std::size_t trigger, bool active, double time)>;
+
+  TriggerSystem();
+
+  void initialise(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+  void step(const Environment& environment, prescan::sim::ISimulation* simulation) override;
+
+  /**
+   * @brief Add a trigger on a @p quantity of the state of the @p entity.
+   * @param entity entity whose state is observed. It must outlive the trigger system
+   * @param quantity quantity of the state compared against the @p threshold
+   * @param comparison whether the trigger is active below or above the @p threshold
+   * @param threshold threshold the trigger becomes active at
+   * @param hysteresis distance from the @p threshold the value must move back by for the trigger to become inactive
+   * @param callback function called when the trigger changes state
+   * @return id of the trigger
+   * @throw std::invalid_argument if the @p hysteresis is negative
+   */
+  std::size_t addStateTrigger(const Entity& entity, Quantity quantity, Comparison comparison, double threshold,
+                              double hysteresis, Callback callback);
+  /**
+   * @brief Add a trigger on the distance in the horizontal plane between two entities.
+   * @param first first entity. It must outlive the trigger system
+   * @param second second entity. It must outlive the trigger system
+   * @param comparison whether the trigger is active below or above the @p threshold
+   * @param threshold threshold the trigger becomes active at
+   * @param hysteresis distance from the @p threshold the value must move back by for the trigger to become inactive
+   * @param callback function called when the trigger changes state
+   * @return id of the trigger
+   * @throw std::invalid_argument if the @p hysteresis is negative
+   */
+  std::size_t addDistanceTrigger(const Entity& first, const Entity& second, Comparison comparison, double threshold,
+                                 double hysteresis, Callback callback);
+  /**
+   * @brief Add a trigger on the distance in the horizontal plane between the @p entity and the point (@p x, @p y).
+   * @param entity entity whose position is observed. It must outlive the trigger system
+   * @param x X coordinate of the point
+   * @param y Y coordinate of the point
+   * @param comparison whether the trigger is active below or above the @p threshold
+   * @param threshold threshold the trigger becomes active at
+   * @param hysteresis distance from the @p threshold the value must move back by for the trigger to become inactive
+   * @param callback function called when the trigger changes state
+   * @return id of the trigger
+   * @throw std::invalid_argument if the @p hysteresis is negative
+   */
+  std::size_t addPointDistanceTrigger(const Entity& entity, double x, double y, Comparison comparison,
+                                      double threshold, double hysteresis, Callback callback);
+  /**
+   * @brief Add a trigger on the number of detections of the @p sensor.
+   *
+   * Detections are the objects seen by an AIR or BRS sensor, or the points of all the lines seen by an LMS sensor.
+   * @param sensor sensor whose detections are counted. It must outlive the trigger system
+   * @param comparison whether the trigger is active below or above the @p threshold
+   * @param threshold threshold the trigger becomes active at
+   * @param hysteresis distance from the @p threshold the value must move back by for the trigger to become inactive
+   * @param callback function called when the trigger changes state
+   * @return id of the trigger
+   * @throw std::invalid_argument if the @p hysteresis is negative
+   */
+  std::size_t addDetectionTrigger(const Sensor& sensor, Comparison comparison, double threshold, double hysteresis,
+                                  Callback callback);
+  /**
+   * @brief Remove all the triggers.
+   *
+   * The ids of the triggers added afterwards start from 0 again.
+   */
+  void clear();
+
+  /**
+   * @brief Evaluate all the triggers at time @p time, calling back the ones that changed state.
+   * @param time time of the step being evaluated
+   */
+  void evaluate(double time);
+
+  /**
+   * @brief Whether the trigger with the given @p id is active.
+   * @param id id of the trigger
+   * @return true if the trigger is active
+   * @throw std::out_of_range if there is no trigger with the given @p id
+   */
+  bool active(std::size_t id) const;
+  /**
+   * @brief Current value of the trigger with the given @p id, as of the last evaluation.
+   * @param id id of the trigger
+   * @return value compared against the threshold, NaN if it has not been evaluated yet
+   * @throw std::out_of_range if there is no trigger with the given @p id
+   */
+  double value(std::size_t id) const;
+
+  std::size_t size() const { return triggers_.size(); }
+  std::int64_t steps() const { return steps_; }
+
+ private:
+  /** Kind of value observed by a trigger */
+  enum class Kind {
+    STATE,           ///< Quantity of the state of an entity
+    DISTANCE,        ///< Distance between two entities
+    POINT_DISTANCE,  ///< Distance between an entity and a point
+    DETECTIONS,      ///< Number of detections of a sensor
+  };
+  /** Condition evaluated after every step */
+  struct Trigger {
+    Kind kind;              ///< Kind of value observed
+    const Entity* first;    ///< Entity observed, if any
+    const Entity* second;   ///< Second entity observed, if any
+    const Sensor* sensor;   ///< Sensor observed, if any
+    Quantity quantity;      ///< Quantity of the state observed
+    double x;               ///< X coordinate of the point
+    double y;               ///< Y coordinate of the point
+    Comparison comparison;  ///< Whether the trigger is active below or above the threshold
+    double threshold;       ///< Threshold the trigger becomes active at
+    double hysteresis;      ///< Distance from the threshold the value must move back by to become inactive
+    Callback callback;      ///< Function called when the trigger changes state
+    bool active;            ///< Whether the trigger is active
+    double value;           ///< Value at the last evaluation
+  };
+
+  /** Add the @p trigger, after checking it is valid. @return id of the trigger */
+  std::size_t add(Trigger trigger);
+  /** @return current value observed by the @p trigger */
+  static double valueOf(const Trigger& trigger);
+
+  std::vector<Trigger> triggers_;  ///< Triggers, by id
+  std::int64_t steps_;             ///< Number of steps evaluated since the simulation was initialised
+};
+
+std::ostream& operator<<(std::ostream& os, TriggerSystem::Quantity quantity);
+std::ostream& operator<<(std::ostream& os, TriggerSystem::Comparison comparison);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::TriggerSystem::Quantity> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::TriggerSystem::Comparison> : fmt::ostream_formatter {};
@@ -9,8 +9,11 @@
 
 #include <fmt/ostream.h>
 
+#include <cstddef>
 #include <iosfwd>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace symaware {
@@ -44,6 +47,8 @@ enum class SensorType {
   ULTRASONIC = 18,
   WORLD_VIEWER = 19,
 };
+/** Number of SensorType values, to size tables indexed by them */
+inline constexpr std::size_t sensor_type_count = static_cast<std::size_t>(SensorType::WORLD_VIEWER) + 1;
 enum class WeatherType { SUNNY, RAINY, SNOWY };
 enum class SkyType { DAWN, DAY, DUSK, NIGHT };
 enum class ObjectType {
@@ -342,12 +347,48 @@ constexpr typename std::underlying_type<E>::type to_underlying(E e) noexcept {
   return static_cast<typename std::underlying_type<E>::type>(e);
 }
 
+/**
+ * @brief Name of an enum value.
+ *
+ * The names are stored in tables built at compile time, so the conversion does not allocate.
+ * @return name of the value, or `Unknown` if the value is not valid
+ */
+std::string_view to_string_view(Gear gear);
+std::string_view to_string_view(SensorType sensor_type);
+std::string_view to_string_view(WeatherType weather_type);
+std::string_view to_string_view(SkyType sky_type);
+std::string_view to_string_view(ObjectType object_type);
+
 std::string to_string(Gear gear);
 std::string to_string(SensorType sensor_type);
 std::string to_string(WeatherType weather_type);
 std::string to_string(SkyType sky_type);
 std::string to_string(ObjectType object_type);
 
+/**
+ * @brief Enum value with the given @p name, the inverse of @ref to_string_view.
+ *
+ * The lookup uses a perfect hash built at compile time, so it takes constant time and does not allocate.
+ * @code
+ * std::optional<ObjectType> type = from_string<ObjectType>("Audi_A8_Sedan");
+ * @endcode
+ * @tparam E one of Gear, SensorType, WeatherType, SkyType and ObjectType
+ * @param name name of the value, case sensitive
+ * @return value with the given @p name, or an empty optional if there is no such value
+ */
+template <class E>
+std::optional<E> from_string(std::string_view name);
+template <>
+std::optional<Gear> from_string(std::string_view name);
+template <>
+std::optional<SensorType> from_string(std::string_view name);
+template <>
+std::optional<WeatherType> from_string(std::string_view name);
+template <>
+std::optional<SkyType> from_string(std::string_view name);
+template <>
+std::optional<ObjectType> from_string(std::string_view name);
+
 std::ostream& operator<<(std::ostream& os, Gear gear);
 std::ostream& operator<<(std::ostream& os, SensorType sensor_type);
 std::ostream& operator<<(std::ostream& os, WeatherType weather_type);
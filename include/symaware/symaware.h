@@ -9,5 +9,6 @@
  */
 #pragma once
 
+#include "symaware/map.h"
 #include "symaware/prescan.h"
 #include "symaware/util.h"
@@ -7,4 +7,10 @@
  */
 #pragma once
 
+#include "symaware/util/arrow_writer.h"
+#include "symaware/util/constants.h"
 #include "symaware/util/exception.h"
+#include "symaware/util/histogram.h"
+#include "symaware/util/perfect_hash.h"
+#include "symaware/util/profiler.h"
+#include "symaware/util/trace.h"
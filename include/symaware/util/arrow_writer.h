@@ -0,0 +1,152 @@
+/**
+ * @file arrow_writer.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Minimal Apache Arrow IPC stream writer
+ *
+ * Only the subset of the format needed to store simulation histories is supported:
+ * non-nullable columns of primitive types (int32, int64, float64) and utf8 strings.
+ * The output can be read by any Arrow implementation (e.g. `pyarrow.ipc.open_stream`)
+ * and converted to Parquet without any further transformation.
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace symaware {
+
+/** Logical type of a column in an Arrow record batch */
+enum class ArrowType {
+  INT32,    ///< 32 bit signed integer
+  INT64,    ///< 64 bit signed integer
+  FLOAT64,  ///< 64 bit floating point number
+  UTF8,     ///< Variable length utf8 string
+};
+
+/** Name and type of a column in an Arrow schema */
+struct ArrowField {
+  std::string name;  ///< Name of the column
+  ArrowType type;    ///< Type of the values stored in the column
+};
+
+/**
+ * @brief Column of an Arrow record batch.
+ *
+ * The values are stored with the exact memory layout used by the body of an Arrow IPC message,
+ * so that they can be written to the stream without any intermediate copy.
+ */
+class ArrowColumn {
+ public:
+  explicit ArrowColumn(ArrowField field);
+
+  /**
+   * @brief Append a value to the column.
+   * @pre The type of the @p value must match the type of the column
+   * @param value value to append
+   */
+  void append(std::int32_t value);
+  /** @overload */
+  void append(std::int64_t value);
+  /** @overload */
+  void append(double value);
+  /** @overload */
+  void append(const std::string& value);
+  /**
+   * @brief Reserve space for @p size more values.
+   * @param size number of values to reserve space for
+   */
+  void reserve(std::size_t size);
+  /**
+   * @brief Remove all the values in the column, keeping the allocated memory.
+   */
+  void clear();
+
+  const ArrowField& field() const { return field_; }
+  const std::string& name() const { return field_.name; }
+  ArrowType type() const { return field_.type; }
+  std::size_t size() const { return size_; }
+  /** @brief Values of primitive columns, or characters of utf8 columns */
+  const std::vector<char>& data() const { return data_; }
+  /** @brief Offsets of utf8 columns. Always empty for primitive columns */
+  const std::vector<std::int32_t>& offsets() const { return offsets_; }
+
+ private:
+  template <class T>
+  void appendPrimitive(T value);
+
+  ArrowField field_;                   ///< Name and type of the column
+  std::size_t size_;                   ///< Number of values stored in the column
+  std::vector<char> data_;             ///< Raw values of the column
+  std::vector<std::int32_t> offsets_;  ///< Offsets of each string in @ref data_. Only used by utf8 columns
+};
+
+/**
+ * @brief Streaming writer for the Arrow IPC stream format.
+ *
+ * The schema is written as soon as the writer is created.
+ * Rows are accumulated in the @ref columns until @ref flush is called, which writes them as a single record batch.
+ * The end-of-stream marker is written by @ref close, which is also invoked by the destructor.
+ * Unlike @ref close, the destructor does not throw: if the columns have different lengths, their rows are dropped.
+ * @code
+ * ArrowStreamWriter writer{"out.arrows", {{"step", ArrowType::INT64}, {"x", ArrowType::FLOAT64}}};
+ * writer.column(0).append(std::int64_t{0});
+ * writer.column(1).append(1.5);
+ * writer.flush();
+ * @endcode
+ */
+class ArrowStreamWriter {
+ public:
+  /**
+   * @brief Open the file @p filename and write the schema described by @p fields.
+   * @param filename path of the file to write the stream to. It will be overwritten
+   * @param fields name and type of each column
+   * @throw std::runtime_error if the file cannot be opened
+   */
+  ArrowStreamWriter(const std::string& filename, std::vector<ArrowField> fields);
+  ~ArrowStreamWriter();
+
+  ArrowStreamWriter(const ArrowStreamWriter&) = delete;
+  ArrowStreamWriter& operator=(const ArrowStreamWriter&) = delete;
+
+  /**
+   * @brief Write all the rows accumulated so far as a record batch and clear the columns.
+   *
+   * Does nothing if there are no rows to write.
+   * @pre All columns must have the same number of values
+   */
+  void flush();
+  /**
+   * @brief Flush the remaining rows and write the end-of-stream marker.
+   *
+   * Further calls have no effect.
+   */
+  void close();
+
+  ArrowColumn& column(std::size_t i) { return columns_.at(i); }
+  const std::vector<ArrowColumn>& columns() const { return columns_; }
+  std::size_t num_rows() const { return columns_.empty() ? 0 : columns_.front().size(); }
+  std::size_t num_batches() const { return num_batches_; }
+  bool is_open() const { return stream_.is_open(); }
+
+ private:
+  void writeMessage(const std::vector<char>& metadata);
+  void writeBuffer(const char* data, std::size_t size);
+
+  std::ofstream stream_;              ///< Output stream
+  std::vector<ArrowColumn> columns_;  ///< Columns accumulating the rows of the next record batch
+  std::size_t num_batches_;           ///< Number of record batches written so far
+};
+
+std::ostream& operator<<(std::ostream& os, ArrowType type);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::ArrowType> : fmt::ostream_formatter {};
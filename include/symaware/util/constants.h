@@ -0,0 +1,15 @@
+/**
+ * @file constants.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Mathematical constants shared by all the modules
+ */
+#pragma once
+
+namespace symaware {
+
+/** Ratio between the circumference and the diameter of a circle. M_PI is not standard and missing on MSVC */
+constexpr double pi = 3.14159265358979323846;
+
+}  // namespace symaware
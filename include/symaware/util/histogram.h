@@ -0,0 +1,120 @@
+/**
+ * @file histogram.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief LatencyHistogram class
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace symaware {
+
+/**
+ * @brief Log-linear histogram of non-negative integer values, in the style of HdrHistogram.
+ *
+ * Values are split in power-of-two ranges, each divided into @ref sub_buckets linear buckets.
+ * Values smaller than @ref sub_buckets are stored exactly, while larger values are stored
+ * with a relative error of at most `1 / sub_buckets` (~3%).
+ * Recording a value is a constant time operation that does not allocate memory.
+ * Values larger than 2^@ref max_magnitude are clamped into the last bucket.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr int sub_bucket_bits = 5;                              ///< Bits used to index the linear buckets
+  static constexpr std::uint64_t sub_buckets = 1ull << sub_bucket_bits;  ///< Linear buckets per power of two
+  static constexpr int max_magnitude = 40;  ///< Largest power of two that can be recorded without clamping
+  static constexpr std::size_t num_buckets = (max_magnitude - sub_bucket_bits + 2) * sub_buckets;  ///< Total buckets
+
+  LatencyHistogram();
+
+  /**
+   * @brief Record a @p value in the histogram.
+   * @param value value to record
+   */
+  void record(const std::uint64_t value) {
+    counts_[bucketIndex(value)]++;
+    count_++;
+    sum_ += value;
+    if (value < min_) min_ = value;
+    if (value > max_) max_ = value;
+  }
+  /**
+   * @brief Add all the values recorded in the @p other histogram to this one.
+   * @param other histogram to merge into this one
+   */
+  void merge(const LatencyHistogram& other);
+  /**
+   * @brief Remove all the recorded values.
+   */
+  void reset();
+
+  /**
+   * @brief Value below which the @p percentile of the recorded values fall.
+   *
+   * The result is the upper bound of the bucket containing the percentile, clamped to @ref max.
+   * @param percentile percentile to compute, in the range [0, 100]
+   * @return value at the given percentile, or 0 if the histogram is empty
+   */
+  std::uint64_t percentile(double percentile) const;
+
+  std::uint64_t count() const { return count_; }
+  std::uint64_t min() const { return count_ == 0 ? 0 : min_; }
+  std::uint64_t max() const { return max_; }
+  std::uint64_t sum() const { return sum_; }
+  double mean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_); }
+  const std::vector<std::uint64_t>& counts() const { return counts_; }
+
+  /**
+   * @brief Index of the bucket the @p value falls in.
+   * @param value value to look up
+   * @return index of the bucket
+   */
+  static std::size_t bucketIndex(std::uint64_t value) {
+    if (value < sub_buckets) return static_cast<std::size_t>(value);
+    const int magnitude = mostSignificantBit(value);
+    if (magnitude > max_magnitude) return num_buckets - 1;
+    const int shift = magnitude - sub_bucket_bits;
+    return static_cast<std::size_t>((shift + 1) * sub_buckets + ((value >> shift) - sub_buckets));
+  }
+  /**
+   * @brief Largest value that falls in the bucket with the given @p index.
+   * @param index index of the bucket
+   * @return upper bound of the bucket, inclusive
+   */
+  static std::uint64_t bucketUpperBound(std::size_t index);
+
+ private:
+  static int mostSignificantBit(const std::uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+  }
+
+  std::vector<std::uint64_t> counts_;  ///< Number of values recorded in each bucket
+  std::uint64_t count_;                ///< Total number of values recorded
+  std::uint64_t sum_;                  ///< Sum of all the values recorded
+  std::uint64_t min_;                  ///< Smallest value recorded
+  std::uint64_t max_;                  ///< Largest value recorded
+};
+
+std::ostream& operator<<(std::ostream& os, const LatencyHistogram& histogram);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::LatencyHistogram> : fmt::ostream_formatter {};
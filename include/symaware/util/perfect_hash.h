@@ -0,0 +1,144 @@
+/**
+ * @file perfect_hash.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief PerfectHash class
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace symaware {
+
+/**
+ * @brief Minimal perfect hash over a fixed set of @p N distinct strings, built at compile time.
+ *
+ * The keys are split into buckets by a first hash.
+ * Starting from the largest bucket, each bucket is assigned the first seed of a second hash that sends all its keys
+ * to free slots, while buckets with a single key are assigned a free slot directly.
+ * Looking up a string then takes two hashes and a single string comparison, with no allocation.
+ * @code
+ * constexpr PerfectHash<3> hash{{"red", "green", "blue"}};
+ * static_assert(hash.find("green") == 1);
+ * static_assert(hash.find("yellow") == hash.npos);
+ * @endcode
+ * @tparam N number of keys
+ */
+template <std::size_t N>
+class PerfectHash {
+ public:
+  static constexpr std::size_t npos = N;                 ///< Index returned for strings that are not keys
+  static constexpr std::size_t num_buckets = N / 2 + 1;  ///< Number of buckets the keys are split into
+
+  /**
+   * @brief Build the perfect hash over the @p keys.
+   * @param keys distinct keys. Their storage must outlive the hash
+   * @throw std::logic_error if the keys are not distinct. When evaluated at compile time, the build fails instead
+   */
+  constexpr explicit PerfectHash(const std::array<std::string_view, N>& keys)
+      : keys_{keys}, seeds_{}, slots_{} {
+    if constexpr (N > 0) build();
+  }
+
+  /**
+   * @brief Find the @p key among the keys of the hash.
+   * @param key string to look for
+   * @return index of the @p key in the array the hash was built from, or @ref npos if it is not a key
+   */
+  constexpr std::size_t find(const std::string_view key) const noexcept {
+    if constexpr (N == 0) {
+      return npos;
+    } else {
+      const std::int32_t seed = seeds_[hash(key, 0) % num_buckets];
+      const std::size_t slot = seed < 0 ? static_cast<std::size_t>(-seed - 1) : hash(key, seed) % N;
+      const std::size_t index = slots_[slot];
+      return keys_[index] == key ? index : npos;
+    }
+  }
+
+  constexpr const std::array<std::string_view, N>& keys() const { return keys_; }
+  static constexpr std::size_t size() { return N; }
+
+ private:
+  static constexpr std::int32_t max_seed = 1 << 16;  ///< Largest seed tried for each bucket
+
+  /** FNV-1a hash of the @p key, mixed with the @p seed and finalised to spread the low bits */
+  static constexpr std::uint64_t hash(const std::string_view key, const std::uint64_t seed) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+    for (const char c : key) {
+      h ^= static_cast<unsigned char>(c);
+      h *= 0x100000001b3ull;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  /** Assign a seed or a slot to every bucket */
+  constexpr void build() {
+    // Counting sort of the keys by bucket
+    std::array<std::size_t, num_buckets + 1> start{};
+    std::array<std::size_t, N> order{};
+    for (std::size_t k = 0; k < N; ++k) ++start[hash(keys_[k], 0) % num_buckets + 1];
+    std::size_t max_size = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b) {
+      max_size = start[b + 1] > max_size ? start[b + 1] : max_size;
+      start[b + 1] += start[b];
+    }
+    std::array<std::size_t, num_buckets> next{};
+    for (std::size_t b = 0; b < num_buckets; ++b) next[b] = start[b];
+    for (std::size_t k = 0; k < N; ++k) order[next[hash(keys_[k], 0) % num_buckets]++] = k;
+
+    // Buckets with more keys are harder to place, so they go first, while most slots are still free
+    std::array<bool, N> used{};
+    std::array<std::size_t, N> chosen{};
+    for (std::size_t size = max_size; size >= 2; --size) {
+      for (std::size_t b = 0; b < num_buckets; ++b) {
+        if (start[b + 1] - start[b] == size) placeBucket(b, order, start, used, chosen);
+      }
+    }
+    // Single keys take the remaining slots, in order
+    std::size_t free_slot = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b) {
+      if (start[b + 1] - start[b] != 1) continue;
+      while (used[free_slot]) ++free_slot;
+      used[free_slot] = true;
+      slots_[free_slot] = order[start[b]];
+      seeds_[b] = -static_cast<std::int32_t>(free_slot) - 1;
+    }
+  }
+
+  /** Find the seed placing all the keys of the bucket @p b in free slots. @p chosen is scratch space for the slots */
+  constexpr void placeBucket(const std::size_t b, const std::array<std::size_t, N>& order,
+                             const std::array<std::size_t, num_buckets + 1>& start, std::array<bool, N>& used,
+                             std::array<std::size_t, N>& chosen) {
+    for (std::int32_t seed = 1; seed <= max_seed; ++seed) {
+      bool placed = true;
+      for (std::size_t i = start[b]; i < start[b + 1] && placed; ++i) {
+        chosen[i] = hash(keys_[order[i]], static_cast<std::uint64_t>(seed)) % N;
+        placed = !used[chosen[i]];
+        for (std::size_t j = start[b]; j < i && placed; ++j) placed = chosen[j] != chosen[i];
+      }
+      if (!placed) continue;
+      for (std::size_t i = start[b]; i < start[b + 1]; ++i) {
+        used[chosen[i]] = true;
+        slots_[chosen[i]] = order[i];
+      }
+      seeds_[b] = seed;
+      return;
+    }
+    throw std::logic_error("PerfectHash: the keys must be distinct");
+  }
+
+  std::array<std::string_view, N> keys_;         ///< Keys, in the order they were given
+  std::array<std::int32_t, num_buckets> seeds_;  ///< Seed of each bucket, or minus the slot plus one of single keys
+  std::array<std::size_t, N> slots_;             ///< Index of the key in each slot
+};
+
+}  // namespace symaware
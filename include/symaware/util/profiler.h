@@ -0,0 +1,156 @@
+/**
+ * @file profiler.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Lightweight per-phase profiler
+ *
+ * Profiling is disabled by default and can be toggled at runtime with @ref Profiler::setEnabled.
+ * When disabled, a @ref ScopedTimer costs a single relaxed atomic load.
+ */
+#pragma once
+
+#include <fmt/ostream.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "symaware/util/histogram.h"
+
+namespace symaware {
+
+/** Phase of the simulation lifecycle being measured */
+enum class ProfilePhase {
+  REGISTER,      ///< Registration of the simulation units
+  INITIALISE,    ///< Initialisation, before the first step
+  STEP,          ///< Simulation step
+  TERMINATE,     ///< Termination, after the last step
+  PRE_STEP,      ///< Callback invoked before each step
+  POST_STEP,     ///< Callback invoked after each step
+  UPDATE_STATE,  ///< Decoding of the output of a simulation unit
+};
+
+/** Global switch of the profiler */
+class Profiler {
+ public:
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void setEnabled(const bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+ private:
+  inline static std::atomic<bool> enabled_{false};
+};
+
+/**
+ * @brief Collection of latency histograms, one for each @ref ProfilePhase.
+ *
+ * Histograms are only allocated the first time a duration is recorded for the corresponding phase,
+ * so that objects that are never profiled do not pay any memory overhead.
+ * All durations are expressed in nanoseconds.
+ */
+class PhaseProfile {
+ public:
+  static constexpr std::size_t num_phases = static_cast<std::size_t>(ProfilePhase::UPDATE_STATE) + 1;
+
+  PhaseProfile() = default;
+  PhaseProfile(const PhaseProfile& other);
+  PhaseProfile(PhaseProfile&& other) noexcept = default;
+  PhaseProfile& operator=(const PhaseProfile& other);
+  PhaseProfile& operator=(PhaseProfile&& other) noexcept = default;
+
+  /**
+   * @brief Record the @p duration of a @p phase.
+   * @param phase phase the measure refers to
+   * @param duration duration of the phase in nanoseconds
+   */
+  void record(ProfilePhase phase, std::uint64_t duration);
+  /**
+   * @brief Remove all the recorded durations.
+   */
+  void reset();
+
+  /**
+   * @brief Histogram of the durations of the given @p phase.
+   * @param phase phase to look up
+   * @return histogram of the phase, or nullptr if no duration has ever been recorded for it
+   */
+  const LatencyHistogram* histogram(const ProfilePhase phase) const {
+    return histograms_[static_cast<std::size_t>(phase)].get();
+  }
+
+ private:
+  std::array<std::unique_ptr<LatencyHistogram>, num_phases> histograms_;  ///< Histograms indexed by phase
+};
+
+/**
+ * @brief Measure the lifetime of the object with a monotonic clock and record it in a @ref PhaseProfile.
+ *
+ * Nothing is measured if the @ref Profiler is disabled when the timer is created.
+ * @code
+ * {
+ *   ScopedTimer timer{profile_, ProfilePhase::STEP};
+ *   // ... code to measure
+ * }
+ * @endcode
+ */
+class ScopedTimer {
+ public:
+  ScopedTimer(PhaseProfile& profile, const ProfilePhase phase)
+      : profile_{Profiler::enabled() ? &profile : nullptr}, phase_{phase}, start_{} {
+    if (profile_ != nullptr) start_ = std::chrono::steady_clock::now();
+  }
+  ~ScopedTimer() {
+    if (profile_ == nullptr) return;
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    profile_->record(phase_, static_cast<std::uint64_t>(duration.count()));
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  PhaseProfile* profile_;                        ///< Profile to record into. Null if profiling is disabled
+  ProfilePhase phase_;                           ///< Phase being measured
+  std::chrono::steady_clock::time_point start_;  ///< Time the timer was created
+};
+
+/** Summary of the durations of a phase of a component, in nanoseconds */
+struct ProfileStats {
+  ProfileStats(std::string entity, std::string component, ProfilePhase phase, const LatencyHistogram& histogram);
+  std::string entity;     ///< Name of the entity the component belongs to
+  std::string component;  ///< Name of the component
+  ProfilePhase phase;     ///< Phase measured
+  std::uint64_t count;    ///< Number of measures
+  std::uint64_t min;      ///< Shortest duration
+  double mean;            ///< Average duration
+  std::uint64_t p50;      ///< Median duration
+  std::uint64_t p90;      ///< 90th percentile of the durations
+  std::uint64_t p99;      ///< 99th percentile of the durations
+  std::uint64_t max;      ///< Longest duration
+};
+
+/**
+ * @brief Append to @p stats a summary for each phase of the @p profile that has been measured at least once.
+ * @param stats vector the summaries are appended to
+ * @param entity name of the entity the component belongs to
+ * @param component name of the component
+ * @param profile profile to summarise
+ */
+void appendProfileStats(std::vector<ProfileStats>& stats, const std::string& entity, const std::string& component,
+                        const PhaseProfile& profile);
+
+std::ostream& operator<<(std::ostream& os, ProfilePhase phase);
+std::ostream& operator<<(std::ostream& os, const ProfileStats& stats);
+
+}  // namespace symaware
+
+template <>
+struct fmt::formatter<symaware::ProfilePhase> : fmt::ostream_formatter {};
+template <>
+struct fmt::formatter<symaware::ProfileStats> : fmt::ostream_formatter {};
@@ -0,0 +1,109 @@
+/**
+ * @file trace.h
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Trace Event recorder
+ *
+ * Scoped spans are recorded in per-thread buffers and can be written to a JSON file
+ * in the Trace Event format, which can be opened with Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+ * Tracing is disabled by default and can be toggled at runtime with @ref Tracer::setEnabled.
+ * When disabled, a span costs a single relaxed atomic load.
+ * Defining `SYMAWARE_DISABLE_TRACING` removes the spans at compile time.
+ * @code
+ * void Entity::step(prescan::sim::ISimulation* simulation) {
+ *   SYMAWARE_TRACE_SCOPE("Entity::step");
+ *   // ...
+ * }
+ * @endcode
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#ifdef SYMAWARE_DISABLE_TRACING
+#define SYMAWARE_TRACE_SCOPE(name) ((void)0)
+#else
+#define SYMAWARE_TRACE_CONCAT_IMPL(a, b) a##b
+#define SYMAWARE_TRACE_CONCAT(a, b) SYMAWARE_TRACE_CONCAT_IMPL(a, b)
+#define SYMAWARE_TRACE_SCOPE(name) \
+  const ::symaware::TraceScope SYMAWARE_TRACE_CONCAT(symaware_trace_scope_, __LINE__) { name }
+#endif
+
+namespace symaware {
+
+/** Complete event (a span with a start and a duration) of the Trace Event format */
+struct TraceEvent {
+  const char* name;       ///< Name of the span. Must point to a string with static storage duration
+  std::int64_t start;     ///< Start time in nanoseconds, relative to the start of the program
+  std::int64_t duration;  ///< Duration in nanoseconds
+};
+
+/**
+ * @brief Global recorder of the spans.
+ *
+ * Each thread appends its spans to its own buffer, made of fixed size chunks.
+ * Only the registration of a new thread takes a lock:
+ * afterwards, recording a span never blocks and never moves previously recorded events,
+ * so the buffers can be written to file while other threads keep recording.
+ */
+class Tracer {
+ public:
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void setEnabled(const bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  /**
+   * @brief Record a span in the buffer of the calling thread.
+   * @param event span to record
+   */
+  static void record(const TraceEvent& event);
+  /**
+   * @brief Write all the spans recorded so far to @p filename in the Trace Event JSON format.
+   * @param filename path of the file to write. It will be overwritten
+   * @throw std::runtime_error if the file cannot be opened
+   */
+  static void write(const std::string& filename);
+  /**
+   * @brief Remove all the spans recorded so far.
+   * @warning No thread may be recording spans while the buffers are cleared.
+   * Disable the tracer with @ref setEnabled before calling this method.
+   */
+  static void clear();
+  /**
+   * @brief Current time in nanoseconds, relative to the start of the program.
+   * @return current time
+   */
+  static std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count();
+  }
+
+ private:
+  inline static std::atomic<bool> enabled_{false};
+  inline static const std::chrono::steady_clock::time_point epoch_{std::chrono::steady_clock::now()};
+};
+
+/**
+ * @brief Record a span covering the lifetime of the object.
+ *
+ * Use it through the @ref SYMAWARE_TRACE_SCOPE macro.
+ * Nothing is recorded if the @ref Tracer is disabled when the span is created.
+ */
+class TraceScope {
+ public:
+  explicit TraceScope(const char* const name) : name_{name}, start_{Tracer::enabled() ? Tracer::now() : -1} {}
+  ~TraceScope() {
+    if (start_ >= 0) Tracer::record({name_, start_, Tracer::now() - start_});
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* name_;    ///< Name of the span
+  std::int64_t start_;  ///< Start time of the span. Negative if the tracer was disabled
+};
+
+}  // namespace symaware
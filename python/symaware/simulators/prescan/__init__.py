@@ -1,16 +1,59 @@
+from typing import TYPE_CHECKING
+
 from ._symaware_prescan import (
     Acceleration,
     AngularVelocity,
+    Broadphase,
+    FrenetTransform,
     Gear,
+    HistoryExporter,
+    KpiEvaluator,
+    KpiSummary,
+    LaneLocation,
+    ObjectCategory,
+    ObjectInfo,
     ObjectType,
     Orientation,
+    PointCloudFilter,
     Pose,
     Position,
+    Quaternion,
+    ReferenceLine,
     Road,
+    RoadBuilder,
+    RoadNetwork,
+    Route,
+    Router,
+    SensorFusion,
+    SensorNoise,
     SensorType,
     SkyLightPollution,
     SkyType,
+    SpatialHash,
+    TrackTable,
+    TriggerComparison,
+    TriggerQuantity,
+    TriggerSystem,
     WeatherType,
+    avx2_transforms,
+    clear_trace,
+    compose,
+    inverse,
+    inverse_transform_point,
+    inverse_transform_points,
+    is_profiling_enabled,
+    is_tracing_enabled,
+    object_catalog,
+    object_info,
+    orientation,
+    polar_to_cartesian,
+    quaternion,
+    rotation_matrix,
+    set_profiling_enabled,
+    set_tracing_enabled,
+    transform_point,
+    transform_points,
+    write_trace,
 )
 from .dynamical_model import (
     AmesimDynamicalModel,
@@ -22,295 +65,317 @@ from .dynamical_model import (
     TrackModelInput,
 )
 from .entity import (
-    ADACtargetyellowmercEntity,
-    ApartmentBuildingEntity,
-    ArrowBoardTrailerEntity,
-    Ash10yEntity,
-    Ash20yEntity,
-    AudiA3Entity,
-    AudiA8SedanEntity,
-    AustrianPine10yEntity,
-    AustrianPine20yEntity,
-    BalloonCarEntity,
-    BarrierFenceEntity,
-    BEPoliceVolvoXC60Entity,
-    Birch10yEntity,
-    Birch20yEntity,
-    BlueSpruce10yEntity,
-    BlueSpruce20yEntity,
-    BMWX5SUVEntity,
-    BMWZ3ConvertibleEntity,
-    BottsDotsWhiteEntity,
-    BottsDotsYellowEntity,
-    BoxEntity,
-    Boy100Entity,
-    Boy150Entity,
-    Building00AEntity,
-    Building01AEntity,
-    Building02AEntity,
-    Building03AEntity,
-    Building04AEntity,
-    Building05AEntity,
-    Building06AEntity,
-    Building07AEntity,
-    Building08AEntity,
-    BusstopEntity,
-    CadillacEscaladeEntity,
-    CapsuleEntity,
-    CarDealerEntity,
-    CarTrailerSmallEntity,
-    CAT725Entity,
-    CatsEyesREntity,
-    CatsEyesWEntity,
-    CatsEyesWREntity,
-    CatsEyesWYEntity,
-    CatsEyesYEntity,
-    ChildLeaningEntity,
-    ChildOverweightEntity,
-    ChildRegularEntity,
-    ChildSittingEntity,
-    ChurchEntity,
-    CinderBlockAEntity,
-    CinderBlockBEntity,
-    CinderBlockCEntity,
-    CitroenC3HatchbackEntity,
-    ConcreteGuardrailEntity,
-    ConeEntity,
-    ConstructionSignJPEntity,
-    ContainerTrailerEntity,
-    CornerReflector138mmEntity,
-    CornerReflector1768mmEntity,
-    CornerReflector4635mmEntity,
-    CottonAEntity,
-    CottonBEntity,
-    CottonCEntity,
-    CylinderEntity,
-    DAF95XFEntity,
-    DAFEuro6XFEntity,
-    DeerEntity,
-    Dogwood10yEntity,
-    Dogwood20yEntity,
-    Dumpster2300LEntity,
-    DutchChurchEntity,
-    EmptyLightNodeEntity,
     Entity,
     ExistingEntity,
-    FactoryEntity,
-    FAWJiefangJ6MEntity,
-    FemaleBendingEntity,
-    FemaleLeaningEntity,
-    FemaleOverweightEntity,
-    FemaleRegularEntity,
-    FemalewBuggyEntity,
-    FemalewLongCoatEntity,
-    FemalewRaincoatEntity,
-    FemalewShoppingCartEntity,
-    FenceEntity,
-    FiatBravoHatchbackEntity,
-    FireBrigadeEntity,
-    FordFiestaHatchbackEntity,
-    FordFocusStationwagonEntity,
-    FShape150cmEntity,
-    FShape250cmEntity,
-    FShape350cmEntity,
-    FullTrailerEntity,
-    GarageGroundFloorEntity,
-    GarageMidFloorEntity,
-    GarageTopFloorEntity,
-    GasStationEntity,
-    GenesisGV80Entity,
-    GuardrailEntity,
-    GuardrailReflectorRectREntity,
-    GuardrailReflectorRectWEntity,
-    GuardrailReflectorRectWREntity,
-    GuardrailReflectorRoundREntity,
-    GuardrailReflectorRoundWEntity,
-    GuardrailReflectorRoundWREntity,
-    GuardrailReflectorRoundYEntity,
-    GuidedSoftTargetEntity,
-    HinoBlueRibbonEntity,
-    HondaPanEuropeanMotorcycleEntity,
-    HondaPanEuropeanMotorcycleWithDriverEntity,
-    HouseEntity,
-    HouseModernEntity,
-    HouseOld1Entity,
-    HouseOld2Entity,
-    HouseOld3Entity,
-    HouseOld4Entity,
-    HouseOld5Entity,
-    HouseOld6Entity,
-    Houses1930sEntity,
-    HOWOT5GCementTruckEntity,
-    Hyundaii30NLineEntity,
-    HyundaiIoniq5Entity,
-    IsuzuDMaxEntity,
-    IsuzuGigaFireTruckEntity,
-    JACHFCSeriesEntity,
-    JapaneseMaple10yEntity,
-    JapaneseMaple20yEntity,
-    JobyAviationS4Entity,
-    KiaEV6Entity,
-    KiaEV6wRoofRackEntity,
-    KiaEV6wRoofRackSiemensEntity,
-    LexusGS450hFSportSedanEntity,
-    LexusLS600hFSportEntity,
-    LightPostEntity,
-    Lilac10yEntity,
-    Lilac20yEntity,
-    LinePlacedRoadImperfectionEntity,
-    Magnolia10yEntity,
-    Magnolia20yEntity,
-    Male200Entity,
-    MaleAfricanEntity,
-    MaleBendingEntity,
-    MaleBendingOverEntity,
-    MaleCyclingCyclistEntity,
-    MaleFemaleHandInHandEntity,
-    MaleLargeShoulderSuitcaseEntity,
-    MaleLeaningBackEntity,
-    MaleLeaningEntity,
-    MaleLyingDownEntity,
-    MaleOldWhiteWithStickEntity,
-    MaleOldWhiteWithWalkerEntity,
-    MaleOldWhiteWithWalkerWithWheelsEntity,
-    MaleOverweightEntity,
-    MaleRegularEntity,
-    MaleShoppingBagEntity,
-    MaleSittingEntity,
-    MalewBackpackEntity,
-    MalewBicycleEntity,
-    MalewLargeBackpackEntity,
-    MalewLongCoatEntity,
-    MalewRaincoatEntity,
-    MalewSuitcaseEntity,
-    MalewSuitEntity,
-    Man250Entity,
-    ManAsianEntity,
-    MazdaRX8CoupeEntity,
-    MercedesBenzActros1851LS4x2Entity,
-    MercedesBenzActros1860LS4x2Entity,
-    MercedesBenzActros2541L6x2Entity,
-    MitsubishiOutlanderPHEVEntity,
-    MonumentEntity,
-    NCAPAdultEntity,
-    NCAPChildEntity,
-    NCAPCyclistEntity,
-    NCAPEBTAEntity,
-    NCAPGVTEntity,
-    NCAPMotorcycleEntity,
-    NCAPScooterEntity,
-    NCAPStreetLightEntity,
-    NissanAriyaEntity,
-    NissanCabstarBoxtruckEntity,
-    NLAmbulanceVolvoXC60Entity,
-    OfficeBrownFlatEntity,
-    OfficeBrownTall1Entity,
-    OfficeBrownTall2Entity,
-    OfficeEntity,
-    OfficeGreenTallEntity,
-    Overhang1LightJPEntity,
-    Overhang1LightKREntity,
-    Overhang1LightNLEntity,
-    Overhang1LightUSEntity,
-    Overhang1PostJPEntity,
-    Overhang1PostKREntity,
-    Overhang1PostNLEntity,
-    Overhang1PostUSEntity,
-    Overhang2LightsJPEntity,
-    Overhang2LightsKREntity,
-    Overhang2LightsNLEntity,
-    Overhang2LightsUSEntity,
-    Overhang2PostJPEntity,
-    Overhang2PostKREntity,
-    Overhang2PostNLEntity,
-    Overhang2PostUSEntity,
-    OverhangDH2LightsUSEntity,
-    OverhangDHPostUSEntity,
-    PalletEntity,
-    PedestrianSignalJPEntity,
-    Peterbilt579Entity,
-    Peterbilt579TrailerEntity,
-    PlasticBarrier100cmEntity,
-    PrismSign51015Entity,
-    PrismSign305070Entity,
-    PrismSign80100110Entity,
-    PrismSignV51015Entity,
-    PrismSignV305070Entity,
-    PrismSignV80100110Entity,
-    Pylon01Entity,
-    Pylon02Entity,
-    ReflectorSignEntity,
-    ReflectorSignSimpleEntity,
-    RivianR1TEntity,
-    RivianR1TwCoverEntity,
-    RoadClosedwLightsEntity,
-    RoadsideLightNLEntity,
-    RoadsideMarkerEntity,
-    RoadsidePostEntity,
-    RoadsidePostNLEntity,
-    Roewe550SSedanEntity,
-    RowCropTractorEntity,
-    SchoolEntity,
-    ScooterEntity,
-    ScooterwBoxEntity,
-    Serviceberry5yEntity,
-    Serviceberry10yEntity,
-    Serviceberry15yEntity,
-    ShoppingCartEntity,
-    SiemenseRodEntity,
-    SignalCasing20cmNLEntity,
-    SignalCasing30cmDHUSEntity,
-    SignalCasing30cmJPEntity,
-    SignalCasing30cmNLEntity,
-    SignalCasing30cmUSEntity,
-    SignalCasing330cmKREntity,
-    SignalCasing430cmKREntity,
-    SkywellEntity,
-    SoundAbsorbingWallEntity,
-    SpeedBump250cmEntity,
-    SpeedBump350cmEntity,
-    SphereEntity,
-    SportsBikeEntity,
-    SportsBikewDriverEntity,
-    SpringPost46cmEntity,
-    SpringPost75cmEntity,
-    SpringPost95cmEntity,
-    SuzukiHustlerHybridEntity,
-    TerracedHousesEntity,
-    TeslaModel3Entity,
-    TireHorizontalEntity,
-    TireVerticalEntity,
-    Toddler050Entity,
-    ToyotaPreviaMPVEntity,
-    ToyotaPriusSedanEntity,
-    ToyotaYarisHatchbackEntity,
-    TrafficSignPoleEntity,
-    TrashBin240LEntity,
-    TrashCanRnd130LEntity,
-    TrashCanSqr160LEntity,
-    TriangleParkingSpaceLockEntity,
-    TripodEntity,
-    TurkishHazel10yEntity,
-    TurkishHazel20yEntity,
-    USPoliceVolvoXC60Entity,
-    VehicleSignal30cmFJPEntity,
-    VehicleSignal30cmFLJPEntity,
-    VehicleSignal30cmFRJPEntity,
-    VehicleSignal30cmLJPEntity,
-    VehicleSignal30cmRJPEntity,
-    VehicleSignalGreen30cmJPEntity,
-    VehicleSignalOrange30cmJPEntity,
-    VehicleSignalRed30cmJPEntity,
-    VolvoFH16Entity,
-    VolvoXC60Entity,
-    WallEntity,
-    WarehouseEntity,
-    WheatAEntity,
-    WheatBEntity,
-    WheatCEntity,
-    WheelieBin1100LEntity,
-    WindmillEntity,
-    WulingHongguangEntity,
+    entity_class,
+    entity_class_name,
+    entity_object_types,
 )
 from .environment import Environment
 from .sensor import AirSensor, BrsSensor, LmsSensor, Sensor
+
+if TYPE_CHECKING:
+    from .entity import (
+        ADACtargetyellowmercEntity,
+        ApartmentBuildingEntity,
+        ArrowBoardTrailerEntity,
+        Ash10yEntity,
+        Ash20yEntity,
+        AudiA3Entity,
+        AudiA8SedanEntity,
+        AustrianPine10yEntity,
+        AustrianPine20yEntity,
+        BalloonCarEntity,
+        BarrierFenceEntity,
+        BEPoliceVolvoXC60Entity,
+        Birch10yEntity,
+        Birch20yEntity,
+        BlueSpruce10yEntity,
+        BlueSpruce20yEntity,
+        BMWX5SUVEntity,
+        BMWZ3ConvertibleEntity,
+        BottsDotsWhiteEntity,
+        BottsDotsYellowEntity,
+        BoxEntity,
+        Boy100Entity,
+        Boy150Entity,
+        Building00AEntity,
+        Building01AEntity,
+        Building02AEntity,
+        Building03AEntity,
+        Building04AEntity,
+        Building05AEntity,
+        Building06AEntity,
+        Building07AEntity,
+        Building08AEntity,
+        BusstopEntity,
+        CadillacEscaladeEntity,
+        CapsuleEntity,
+        CarDealerEntity,
+        CarTrailerSmallEntity,
+        CAT725Entity,
+        CatsEyesREntity,
+        CatsEyesWEntity,
+        CatsEyesWREntity,
+        CatsEyesWYEntity,
+        CatsEyesYEntity,
+        ChildLeaningEntity,
+        ChildOverweightEntity,
+        ChildRegularEntity,
+        ChildSittingEntity,
+        ChurchEntity,
+        CinderBlockAEntity,
+        CinderBlockBEntity,
+        CinderBlockCEntity,
+        CitroenC3HatchbackEntity,
+        ConcreteGuardrailEntity,
+        ConeEntity,
+        ConstructionSignJPEntity,
+        ContainerTrailerEntity,
+        CornerReflector138mmEntity,
+        CornerReflector1768mmEntity,
+        CornerReflector4635mmEntity,
+        CottonAEntity,
+        CottonBEntity,
+        CottonCEntity,
+        CylinderEntity,
+        DAF95XFEntity,
+        DAFEuro6XFEntity,
+        DeerEntity,
+        Dogwood10yEntity,
+        Dogwood20yEntity,
+        Dumpster2300LEntity,
+        DutchChurchEntity,
+        EmptyLightNodeEntity,
+        FactoryEntity,
+        FAWJiefangJ6MEntity,
+        FemaleBendingEntity,
+        FemaleLeaningEntity,
+        FemaleOverweightEntity,
+        FemaleRegularEntity,
+        FemalewBuggyEntity,
+        FemalewLongCoatEntity,
+        FemalewRaincoatEntity,
+        FemalewShoppingCartEntity,
+        FenceEntity,
+        FiatBravoHatchbackEntity,
+        FireBrigadeEntity,
+        FordFiestaHatchbackEntity,
+        FordFocusStationwagonEntity,
+        FShape150cmEntity,
+        FShape250cmEntity,
+        FShape350cmEntity,
+        FullTrailerEntity,
+        GarageGroundFloorEntity,
+        GarageMidFloorEntity,
+        GarageTopFloorEntity,
+        GasStationEntity,
+        GenesisGV80Entity,
+        GuardrailEntity,
+        GuardrailReflectorRectREntity,
+        GuardrailReflectorRectWEntity,
+        GuardrailReflectorRectWREntity,
+        GuardrailReflectorRoundREntity,
+        GuardrailReflectorRoundWEntity,
+        GuardrailReflectorRoundWREntity,
+        GuardrailReflectorRoundYEntity,
+        GuidedSoftTargetEntity,
+        HinoBlueRibbonEntity,
+        HondaPanEuropeanMotorcycleEntity,
+        HondaPanEuropeanMotorcycleWithDriverEntity,
+        HouseEntity,
+        HouseModernEntity,
+        HouseOld1Entity,
+        HouseOld2Entity,
+        HouseOld3Entity,
+        HouseOld4Entity,
+        HouseOld5Entity,
+        HouseOld6Entity,
+        Houses1930sEntity,
+        HOWOT5GCementTruckEntity,
+        Hyundaii30NLineEntity,
+        HyundaiIoniq5Entity,
+        IsuzuDMaxEntity,
+        IsuzuGigaFireTruckEntity,
+        JACHFCSeriesEntity,
+        JapaneseMaple10yEntity,
+        JapaneseMaple20yEntity,
+        JobyAviationS4Entity,
+        KiaEV6Entity,
+        KiaEV6wRoofRackEntity,
+        KiaEV6wRoofRackSiemensEntity,
+        LexusGS450hFSportSedanEntity,
+        LexusLS600hFSportEntity,
+        LightPostEntity,
+        Lilac10yEntity,
+        Lilac20yEntity,
+        LinePlacedRoadImperfectionEntity,
+        Magnolia10yEntity,
+        Magnolia20yEntity,
+        Male200Entity,
+        MaleAfricanEntity,
+        MaleBendingEntity,
+        MaleBendingOverEntity,
+        MaleCyclingCyclistEntity,
+        MaleFemaleHandInHandEntity,
+        MaleLargeShoulderSuitcaseEntity,
+        MaleLeaningBackEntity,
+        MaleLeaningEntity,
+        MaleLyingDownEntity,
+        MaleOldWhiteWithStickEntity,
+        MaleOldWhiteWithWalkerEntity,
+        MaleOldWhiteWithWalkerWithWheelsEntity,
+        MaleOverweightEntity,
+        MaleRegularEntity,
+        MaleShoppingBagEntity,
+        MaleSittingEntity,
+        MalewBackpackEntity,
+        MalewBicycleEntity,
+        MalewLargeBackpackEntity,
+        MalewLongCoatEntity,
+        MalewRaincoatEntity,
+        MalewSuitcaseEntity,
+        MalewSuitEntity,
+        Man250Entity,
+        ManAsianEntity,
+        MazdaRX8CoupeEntity,
+        MercedesBenzActros1851LS4x2Entity,
+        MercedesBenzActros1860LS4x2Entity,
+        MercedesBenzActros2541L6x2Entity,
+        MitsubishiOutlanderPHEVEntity,
+        MonumentEntity,
+        NCAPAdultEntity,
+        NCAPChildEntity,
+        NCAPCyclistEntity,
+        NCAPEBTAEntity,
+        NCAPGVTEntity,
+        NCAPMotorcycleEntity,
+        NCAPScooterEntity,
+        NCAPStreetLightEntity,
+        NissanAriyaEntity,
+        NissanCabstarBoxtruckEntity,
+        NLAmbulanceVolvoXC60Entity,
+        OfficeBrownFlatEntity,
+        OfficeBrownTall1Entity,
+        OfficeBrownTall2Entity,
+        OfficeEntity,
+        OfficeGreenTallEntity,
+        Overhang1LightJPEntity,
+        Overhang1LightKREntity,
+        Overhang1LightNLEntity,
+        Overhang1LightUSEntity,
+        Overhang1PostJPEntity,
+        Overhang1PostKREntity,
+        Overhang1PostNLEntity,
+        Overhang1PostUSEntity,
+        Overhang2LightsJPEntity,
+        Overhang2LightsKREntity,
+        Overhang2LightsNLEntity,
+        Overhang2LightsUSEntity,
+        Overhang2PostJPEntity,
+        Overhang2PostKREntity,
+        Overhang2PostNLEntity,
+        Overhang2PostUSEntity,
+        OverhangDH2LightsUSEntity,
+        OverhangDHPostUSEntity,
+        PalletEntity,
+        PedestrianSignalJPEntity,
+        Peterbilt579Entity,
+        Peterbilt579TrailerEntity,
+        PlasticBarrier100cmEntity,
+        PrismSign51015Entity,
+        PrismSign305070Entity,
+        PrismSign80100110Entity,
+        PrismSignV51015Entity,
+        PrismSignV305070Entity,
+        PrismSignV80100110Entity,
+        Pylon01Entity,
+        Pylon02Entity,
+        ReflectorSignEntity,
+        ReflectorSignSimpleEntity,
+        RivianR1TEntity,
+        RivianR1TwCoverEntity,
+        RoadClosedwLightsEntity,
+        RoadsideLightNLEntity,
+        RoadsideMarkerEntity,
+        RoadsidePostEntity,
+        RoadsidePostNLEntity,
+        Roewe550SSedanEntity,
+        RowCropTractorEntity,
+        SchoolEntity,
+        ScooterEntity,
+        ScooterwBoxEntity,
+        Serviceberry5yEntity,
+        Serviceberry10yEntity,
+        Serviceberry15yEntity,
+        ShoppingCartEntity,
+        SiemenseRodEntity,
+        SignalCasing20cmNLEntity,
+        SignalCasing30cmDHUSEntity,
+        SignalCasing30cmJPEntity,
+        SignalCasing30cmNLEntity,
+        SignalCasing30cmUSEntity,
+        SignalCasing330cmKREntity,
+        SignalCasing430cmKREntity,
+        SkywellEntity,
+        SoundAbsorbingWallEntity,
+        SpeedBump250cmEntity,
+        SpeedBump350cmEntity,
+        SphereEntity,
+        SportsBikeEntity,
+        SportsBikewDriverEntity,
+        SpringPost46cmEntity,
+        SpringPost75cmEntity,
+        SpringPost95cmEntity,
+        SuzukiHustlerHybridEntity,
+        TerracedHousesEntity,
+        TeslaModel3Entity,
+        TireHorizontalEntity,
+        TireVerticalEntity,
+        Toddler050Entity,
+        ToyotaPreviaMPVEntity,
+        ToyotaPriusSedanEntity,
+        ToyotaYarisHatchbackEntity,
+        TrafficSignPoleEntity,
+        TrashBin240LEntity,
+        TrashCanRnd130LEntity,
+        TrashCanSqr160LEntity,
+        TriangleParkingSpaceLockEntity,
+        TripodEntity,
+        TurkishHazel10yEntity,
+        TurkishHazel20yEntity,
+        USPoliceVolvoXC60Entity,
+        VehicleSignal30cmFJPEntity,
+        VehicleSignal30cmFLJPEntity,
+        VehicleSignal30cmFRJPEntity,
+        VehicleSignal30cmLJPEntity,
+        VehicleSignal30cmRJPEntity,
+        VehicleSignalGreen30cmJPEntity,
+        VehicleSignalOrange30cmJPEntity,
+        VehicleSignalRed30cmJPEntity,
+        VolvoFH16Entity,
+        VolvoXC60Entity,
+        WallEntity,
+        WarehouseEntity,
+        WheatAEntity,
+        WheatBEntity,
+        WheatCEntity,
+        WheelieBin1100LEntity,
+        WindmillEntity,
+        WulingHongguangEntity,
+    )
+
+
+def __getattr__(name: str):
+    # The entity classes of each object type, e.g. AudiA8SedanEntity, are only created when first accessed
+    object_type = entity_object_types().get(name)
+    if object_type is None:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    return entity_class(object_type)
+
+
+def __dir__() -> "list[str]":
+    return sorted(set(globals()) | set(entity_object_types()))
+
+
+__all__ = [name for name in __dir__() if not name.startswith("_") and name != "TYPE_CHECKING"]
@@ -21,8 +21,14 @@ __all__ = [
     "AsphaltTypeColoredTexture",
     "AsphaltTypeSingleColor",
     "AsphaltTypeStandard",
+    "Broadphase",
     "Forward",
+    "FrenetTransform",
     "Gear",
+    "HistoryExporter",
+    "KpiEvaluator",
+    "KpiSummary",
+    "LaneLocation",
     "LaneSideType",
     "LaneSideTypeInner",
     "LaneSideTypeOuter",
@@ -42,22 +48,34 @@ __all__ = [
     "LogLevelOff",
     "LogLevelWarning",
     "Neutral",
+    "ObjectCategory",
+    "ObjectInfo",
     "ObjectType",
     "Orientation",
     "ParamPolyRangeTypeArcLength",
     "ParamPolyRangeTypeNormalized",
     "ParameterRange",
+    "PointCloudFilter",
     "Pose",
     "Position",
+    "Quaternion",
+    "ReferenceLine",
     "Reverse",
     "Road",
+    "RoadBuildReport",
+    "RoadBuilder",
+    "RoadNetwork",
     "RoadSideType",
     "RoadSideTypeLeft",
     "RoadSideTypeRight",
+    "Route",
+    "Router",
     "SensorDetectability",
     "SensorDetectabilityDetectable",
     "SensorDetectabilityInvisible",
     "SensorDetectabilityOccluding",
+    "SensorFusion",
+    "SensorNoise",
     "SensorType",
     "SimulationSpeed",
     "SimulationSpeedAsFastAsPossible",
@@ -75,18 +93,43 @@ __all__ = [
     "SkyLightPollutionSuburban",
     "SkyLightPollutionSuburbanUrban",
     "SkyType",
+    "SpatialHash",
+    "TrackTable",
     "TrafficSide",
     "TrafficSideTypeLeftHandTraffic",
     "TrafficSideTypeRightHandTraffic",
+    "TriggerComparison",
+    "TriggerQuantity",
+    "TriggerSystem",
     "Undefined",
     "Velocity",
     "WeatherType",
+    "avx2_transforms",
+    "clear_trace",
+    "compose",
+    "inverse",
+    "inverse_transform_point",
+    "inverse_transform_points",
+    "is_profiling_enabled",
+    "is_tracing_enabled",
+    "object_catalog",
+    "object_info",
+    "orientation",
+    "polar_to_cartesian",
+    "quaternion",
+    "rotation_matrix",
+    "set_profiling_enabled",
+    "set_tracing_enabled",
+    "transform_point",
+    "transform_points",
+    "write_trace",
 ]
 
 class Acceleration:
     x: float
     y: float
     z: float
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the Acceleration, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -106,6 +149,7 @@ class AngularVelocity:
     pitch: float
     roll: float
     yaw: float
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the AngularVelocity, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -191,6 +235,80 @@ class AsphaltType:
     @property
     def value(self) -> int: ...
 
+class Broadphase(_SimulationObserver):
+    def __init__(self, cell_size: float = 10) -> None: ...
+    def query_nearest(self, x: float, y: float, k: int) -> numpy.ndarray[numpy.int64]:
+        """
+        Indices of the k entities closest to (x, y), sorted by increasing distance
+        """
+
+    def query_pairs(self, distance: float) -> numpy.ndarray[numpy.int64]:
+        """
+        (N, 2) array of the indices of the pairs of entities closer than distance
+        """
+
+    def query_radius(self, x: float, y: float, radius: float) -> numpy.ndarray[numpy.int64]:
+        """
+        Indices of the entities within radius from (x, y), sorted by increasing distance
+        """
+
+    def update(self, environment: _Environment) -> None:
+        """
+        Rebuild the index from the current state of the entities
+        """
+
+    @property
+    def entities(self) -> list[_Entity]:
+        """
+        Entities in the index, by index
+        """
+
+    @property
+    def positions(self) -> numpy.ndarray[numpy.float64]:
+        """
+        (N, 2) array of the positions x, y of the entities in the index
+        """
+
+class FrenetTransform:
+    @typing.overload
+    def __init__(
+        self,
+        line: ReferenceLine,
+        left_widths: list[float] = [],
+        right_widths: list[float] = [],
+        max_offset: float = 50,
+        step: float = 1,
+    ) -> None: ...
+    @typing.overload
+    def __init__(self, network: RoadNetwork) -> None: ...
+    def from_frenet(
+        self,
+        s: numpy.ndarray[numpy.float64],
+        d: numpy.ndarray[numpy.float64],
+        road: numpy.ndarray[numpy.int64] | None = None,
+    ) -> numpy.ndarray[numpy.float64]:
+        """
+        Transform Frenet coordinates into an (N, 3) array of poses x, y, heading. The road is only needed when transforming on a road network
+        """
+
+    def to_frenet(self, poses: numpy.ndarray[numpy.float64]) -> tuple[
+        numpy.ndarray[numpy.float64],
+        numpy.ndarray[numpy.float64],
+        numpy.ndarray[numpy.float64],
+        numpy.ndarray[numpy.int32],
+        numpy.ndarray[numpy.int64],
+    ]:
+        """
+        Transform an (N, 3) array of poses x, y, heading into the arrays (s, d, heading_error, lane, road). Poses that cannot be transformed get NaN coordinates and road -1
+        """
+
+    @property
+    def max_offset(self) -> float: ...
+    @property
+    def threads(self) -> int: ...
+    @threads.setter
+    def threads(self, arg1: int) -> None: ...
+
 class Gear:
     """
     Members:
@@ -226,6 +344,201 @@ class Gear:
     @property
     def value(self) -> int: ...
 
+class HistoryExporter(_SimulationObserver):
+    def __init__(self, directory: str, flush_interval: int = 100) -> None: ...
+    def flush(self) -> None:
+        """
+        Write all the rows accumulated so far to disk.
+        """
+
+    @property
+    def directory(self) -> str: ...
+    @property
+    def flush_interval(self) -> int: ...
+    @property
+    def steps(self) -> int: ...
+
+class KpiEvaluator(_SimulationObserver):
+    def __init__(
+        self,
+        interaction_radius: float = 100,
+        collision_distance: float = 2,
+        ttc_threshold: float = 2,
+        headway_threshold: float = 1,
+        lane_width: float = 3.5,
+    ) -> None: ...
+    def add_ego(self, entity: _Entity) -> None:
+        """
+        Restrict the relevant pairs to the ones involving the entity
+        """
+
+    def clear_egos(self) -> None:
+        """
+        Consider all the pairs of entities relevant again
+        """
+
+    def clear_summaries(self) -> None:
+        """
+        Remove the summaries of all the past episodes
+        """
+
+    def evaluate(self, environment: _Environment, time: float) -> None:
+        """
+        Evaluate the current state of the entities at time
+        """
+
+    def reset(self) -> None:
+        """
+        Reset the summary of the current episode
+        """
+
+    @property
+    def collision_distance(self) -> float: ...
+    @property
+    def headway_threshold(self) -> float: ...
+    @property
+    def interaction_radius(self) -> float: ...
+    @property
+    def lane_width(self) -> float: ...
+    @property
+    def summaries(self) -> list[KpiSummary]:
+        """
+        Summaries of all the episodes terminated so far, in order
+        """
+
+    @property
+    def summary(self) -> KpiSummary:
+        """
+        Summary of the current episode, or of the last one if the simulation has terminated
+        """
+
+    @property
+    def ttc_threshold(self) -> float: ...
+
+class KpiSummary:
+    def __repr__(self) -> str: ...
+    @property
+    def collisions(self) -> int:
+        """
+        Number of collisions started during the episode
+        """
+
+    @property
+    def duration(self) -> float:
+        """
+        Simulated time of the episode
+        """
+
+    @property
+    def first_collision(self) -> float:
+        """
+        Time the first collision started
+        """
+
+    @property
+    def first_headway_violation(self) -> float:
+        """
+        First time the time headway was below the threshold
+        """
+
+    @property
+    def first_lane_departure(self) -> float:
+        """
+        Time of the first lane departure
+        """
+
+    @property
+    def first_ttc_violation(self) -> float:
+        """
+        First time the time to collision was below the threshold
+        """
+
+    @property
+    def lane_departures(self) -> int:
+        """
+        Number of times an entity with a model has left the lanes
+        """
+
+    @property
+    def min_distance(self) -> float:
+        """
+        Minimum distance between the entities of a relevant pair
+        """
+
+    @property
+    def min_distance_time(self) -> float:
+        """
+        Time the minimum distance was reached
+        """
+
+    @property
+    def min_headway(self) -> float:
+        """
+        Minimum time headway
+        """
+
+    @property
+    def min_headway_time(self) -> float:
+        """
+        Time the minimum time headway was reached
+        """
+
+    @property
+    def min_ttc(self) -> float:
+        """
+        Minimum time to collision
+        """
+
+    @property
+    def min_ttc_time(self) -> float:
+        """
+        Time the minimum time to collision was reached
+        """
+
+    @property
+    def steps(self) -> int:
+        """
+        Number of steps evaluated
+        """
+
+class LaneLocation:
+    def __repr__(self) -> str: ...
+    @property
+    def lane(self) -> int:
+        """
+        Id of the lane
+        """
+
+    @property
+    def node(self) -> int:
+        """
+        Index of the lane in the lane graph
+        """
+
+    @property
+    def road(self) -> int:
+        """
+        Index of the road
+        """
+
+    @property
+    def s(self) -> float:
+        """
+        Arc length along the reference line
+        """
+
+    @property
+    def section(self) -> int:
+        """
+        Index of the lane section in the road
+        """
+
+    @property
+    def t(self) -> float:
+        """
+        Lateral offset from the reference line
+        """
+
 class LaneSideType:
     """
     Members:
@@ -340,6 +653,97 @@ class LogLevel:
     @property
     def value(self) -> int: ...
 
+class ObjectCategory:
+    """
+    Members:
+
+      VEHICLE : Vehicles and trailers
+
+      PEDESTRIAN : Pedestrians, cyclists and animals
+
+      STATIC : Buildings, road furniture and other static objects
+
+      FOLIAGE : Trees and crops
+    """
+
+    VEHICLE: typing.ClassVar[ObjectCategory]  # value = <ObjectCategory.VEHICLE: 0>
+    PEDESTRIAN: typing.ClassVar[ObjectCategory]  # value = <ObjectCategory.PEDESTRIAN: 1>
+    STATIC: typing.ClassVar[ObjectCategory]  # value = <ObjectCategory.STATIC: 2>
+    FOLIAGE: typing.ClassVar[ObjectCategory]  # value = <ObjectCategory.FOLIAGE: 3>
+    __members__: typing.ClassVar[
+        dict[str, ObjectCategory]
+    ]  # value = {'VEHICLE': <ObjectCategory.VEHICLE: 0>, 'PEDESTRIAN': <ObjectCategory.PEDESTRIAN: 1>, 'STATIC': <ObjectCategory.STATIC: 2>, 'FOLIAGE': <ObjectCategory.FOLIAGE: 3>}
+    def __eq__(self, other: typing.Any) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: typing.Any) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    def __str__(self) -> str: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+class ObjectInfo:
+    def __repr__(self) -> str: ...
+    @property
+    def category(self) -> ObjectCategory:
+        """
+        Category of the object
+        """
+
+    @property
+    def cog_x(self) -> float:
+        """
+        X coordinate of the centre of gravity [m]
+        """
+
+    @property
+    def cog_y(self) -> float:
+        """
+        Y coordinate of the centre of gravity [m]
+        """
+
+    @property
+    def cog_z(self) -> float:
+        """
+        Z coordinate of the centre of gravity [m]
+        """
+
+    @property
+    def height(self) -> float:
+        """
+        Extent of the bounding box along the z axis [m]
+        """
+
+    @property
+    def length(self) -> float:
+        """
+        Extent of the bounding box along the x axis [m]
+        """
+
+    @property
+    def mass(self) -> float:
+        """
+        Mass [kg]. 0 if the object is anchored to the ground, NaN if unknown
+        """
+
+    @property
+    def type(self) -> ObjectType:
+        """
+        Type of the object
+        """
+
+    @property
+    def width(self) -> float:
+        """
+        Extent of the bounding box along the y axis [m]
+        """
+
 class ObjectType:
     """
     Members:
@@ -1241,6 +1645,7 @@ class Orientation:
     pitch: float
     roll: float
     yaw: float
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the Orientation, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -1289,9 +1694,72 @@ class ParameterRange:
     @property
     def value(self) -> int: ...
 
+class PointCloudFilter:
+    class Setup:
+        ground_iterations: int
+        ground_threshold: float
+        max_ground_slope: float
+        seed: int
+        voxel_size: float
+        def __init__(
+            self,
+            voxel_size: float = 0.2,
+            ground_threshold: float = 0.1,
+            ground_iterations: int = 64,
+            max_ground_slope: float = 0.3,
+            seed: int = 0,
+        ) -> None: ...
+        def __repr__(self) -> str: ...
+
+    def __init__(self, setup: PointCloudFilter.Setup = ...) -> None: ...
+    def __len__(self) -> int: ...
+    def clear(self) -> None:
+        """
+        Forget the last cloud processed
+        """
+
+    def process(
+        self,
+        pose: Pose,
+        x: numpy.ndarray[numpy.float64],
+        y: numpy.ndarray[numpy.float64],
+        z: numpy.ndarray[numpy.float64],
+    ) -> None:
+        """
+        Process the points, given as separate arrays of coordinates in the frame of the pose of the sensor
+        """
+
+    @property
+    def ground_plane(self) -> numpy.ndarray[numpy.float64]:
+        """
+        Coefficients (a, b, c, d) of the ground plane ax + by + cz + d = 0, NaN if not found
+        """
+
+    @property
+    def ground_size(self) -> int:
+        """
+        Number of points removed as ground
+        """
+
+    @property
+    def input_size(self) -> int:
+        """
+        Number of points of the last cloud processed
+        """
+
+    @property
+    def points(self) -> numpy.ndarray[numpy.float64]:
+        """
+        Points left after the processing, as an (N, 3) array
+        """
+
+    @property
+    def setup(self) -> PointCloudFilter.Setup: ...
+
 class Pose:
     orientation: Orientation
     position: Position
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the Pose, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -1311,6 +1779,7 @@ class Position:
     x: float
     y: float
     z: float
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the Position, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -1326,12 +1795,89 @@ class Position:
     def __init__(self, array: numpy.ndarray[numpy.float64]) -> None: ...
     def __repr__(self) -> str: ...
 
-class Road:
-    def add_cubic_polynomial_section(self, length: float, a: float, b: float, c: float, d: float) -> Road:
-        """
-        Add a cubic polynomial section to the road
-        """
-
+class Quaternion:
+    w: float
+    x: float
+    y: float
+    z: float
+    def __array__(self) -> numpy.ndarray[numpy.float64]: ...
+    @typing.overload
+    def __init__(self) -> None:
+        """
+        Identity rotation
+        """
+
+    @typing.overload
+    def __init__(self, w: float, x: float, y: float, z: float) -> None: ...
+    def __repr__(self) -> str: ...
+
+class ReferenceLine:
+    def __init__(self, x: float = 0, y: float = 0, heading: float = 0) -> None: ...
+    def add_arc(self, length: float, curvature: float) -> ReferenceLine:
+        """
+        Chain an arc
+        """
+
+    def add_line(self, length: float) -> ReferenceLine:
+        """
+        Chain a straight line
+        """
+
+    def add_param_poly3(
+        self, length: float, u: typing.Sequence[float], v: typing.Sequence[float], normalized: bool
+    ) -> ReferenceLine:
+        """
+        Chain parametric cubic polynomials
+        """
+
+    def add_poly3(self, length: float, a: float, b: float, c: float, d: float) -> ReferenceLine:
+        """
+        Chain a cubic polynomial
+        """
+
+    def add_spiral(self, length: float, curvature_start: float, curvature_end: float) -> ReferenceLine:
+        """
+        Chain a clothoid
+        """
+
+    def point(self, s: float) -> tuple[float, float, float, float]:
+        """
+        Point of the reference line at the arc length s, as (x, y, heading, curvature)
+        """
+
+    def project(self, x: float, y: float, s: float) -> tuple[float, float]:
+        """
+        Project a point onto the reference line, returning (s, t)
+        """
+
+    def sample(self, s: numpy.ndarray) -> numpy.ndarray:
+        """
+        Sample the reference line at the given arc lengths. Columns are s, x, y, heading and curvature
+        """
+
+    def sample_uniform(self, step: float) -> numpy.ndarray:
+        """
+        Sample the reference line every step metres. Columns are s, x, y, heading and curvature
+        """
+
+    def set_origin(self, x: float, y: float, heading: float) -> None:
+        """
+        Move the origin of the reference line
+        """
+
+    @property
+    def end(self) -> float: ...
+    @property
+    def length(self) -> float: ...
+    @property
+    def start(self) -> float: ...
+
+class Road:
+    def add_cubic_polynomial_section(self, length: float, a: float, b: float, c: float, d: float) -> Road:
+        """
+        Add a cubic polynomial section to the road
+        """
+
     def add_curve_section(self, length: float, curvature: float) -> Road:
         """
         Add a curve section to the road
@@ -1389,6 +1935,11 @@ class Road:
         Add a straight section to the road
         """
 
+    def frenet_transform(self, max_offset: float = 50) -> FrenetTransform:
+        """
+        Create a transform between Cartesian poses and Frenet coordinates along the road
+        """
+
     def set_asphalt_color(self, r: float, g: float, b: float) -> Road:
         """
         Set the asphalt color
@@ -1432,6 +1983,142 @@ class Road:
         Get the length of the road
         """
 
+    @property
+    def reference_line(self) -> ReferenceLine:
+        """
+        Get the reference line of the road, evaluated without going through Prescan
+        """
+
+class RoadBuildReport:
+    def __repr__(self) -> str: ...
+    @property
+    def build_time(self) -> float:
+        """
+        Time spent reading the description and building the roads, in seconds
+        """
+
+    @property
+    def lanes(self) -> int:
+        """
+        Number of lanes added to the roads
+        """
+
+    @property
+    def parking_spaces(self) -> int:
+        """
+        Number of parking spaces added to the roads
+        """
+
+    @property
+    def roads(self) -> int:
+        """
+        Number of roads built
+        """
+
+    @property
+    def sections(self) -> int:
+        """
+        Number of sections added to the roads
+        """
+
+    @property
+    def speed_limits(self) -> int:
+        """
+        Number of speed limit profiles set on the roads
+        """
+
+class RoadBuilder:
+    @staticmethod
+    def json_to_binary(content: str) -> bytes:
+        """
+        Convert a description of the roads from JSON to binary format
+        """
+
+    def __init__(self, environment: Environment) -> None: ...
+    def build_binary(self, content: bytes) -> RoadBuildReport:
+        """
+        Build the roads described by a binary document
+        """
+
+    def build_binary_file(self, filename: str) -> RoadBuildReport:
+        """
+        Build the roads described by a binary file
+        """
+
+    def build_json(self, content: str) -> RoadBuildReport:
+        """
+        Build the roads described by a JSON document
+        """
+
+    def build_json_file(self, filename: str) -> RoadBuildReport:
+        """
+        Build the roads described by a JSON file
+        """
+
+    @property
+    def roads(self) -> list[Road]:
+        """
+        Copy of the roads built so far, in the order they were described
+        """
+
+class RoadNetwork:
+    def __init__(self, sample_step: float = 1, cell_size: float = 8) -> None: ...
+    def __repr__(self) -> str: ...
+    def clear(self) -> None:
+        """
+        Remove all the roads and junctions
+        """
+
+    def import_open_drive(self, content: str) -> None:
+        """
+        Import the roads and junctions of an OpenDRIVE document
+        """
+
+    def import_open_drive_file(self, filename: str) -> None:
+        """
+        Import the roads and junctions of an OpenDRIVE file
+        """
+
+    def locate(self, x: float, y: float) -> LaneLocation | None:
+        """
+        Locate a point in the lanes of the network. Return None if the point is not on any lane
+        """
+
+    def locate_all(self, x: float, y: float) -> list[LaneLocation]:
+        """
+        Locate a point in all the lanes it lies on
+        """
+
+    def predecessors(self, node: int) -> list[int]:
+        """
+        Lanes the given one can be entered from
+        """
+
+    def reference_line(self, road: int) -> ReferenceLine:
+        """
+        Reference line of the road with the given index
+        """
+
+    def road_id(self, road: int) -> str:
+        """
+        Id of the road with the given index
+        """
+
+    def road_index(self, id: str) -> int:
+        """
+        Index of the road with the given id
+        """
+
+    def successors(self, node: int) -> list[int]:
+        """
+        Lanes that can be entered at the end of the given one
+        """
+
+    @property
+    def num_lanes(self) -> int: ...
+    @property
+    def num_roads(self) -> int: ...
+
 class RoadSideType:
     """
     Members:
@@ -1461,6 +2148,72 @@ class RoadSideType:
     @property
     def value(self) -> int: ...
 
+class Route:
+    def __repr__(self) -> str: ...
+    @property
+    def lane_changes(self) -> int:
+        """
+        Number of lane changes
+        """
+
+    @property
+    def lanes(self) -> list[int]:
+        """
+        Lanes traversed by the route, in the lane graph
+        """
+
+    @property
+    def length(self) -> float:
+        """
+        Distance driven along the waypoints
+        """
+
+    @property
+    def path(self) -> list[Position]:
+        """
+        Waypoints of the route as positions, ready to be used as the path of a track model
+        """
+
+    @property
+    def waypoints(self) -> numpy.ndarray[numpy.float64]:
+        """
+        Waypoints of the route as an (N, 3) array
+        """
+
+class Router:
+    def __init__(
+        self,
+        network: RoadNetwork,
+        lane_change_cost: float = 20,
+        lane_change_length: float = 20,
+        waypoint_step: float = 2,
+        cache_capacity: int = 1024,
+    ) -> None: ...
+    def __repr__(self) -> str: ...
+    def clear_cache(self) -> None:
+        """
+        Remove all the routes from the cache
+        """
+
+    @typing.overload
+    def route(self, from_x: float, from_y: float, to_x: float, to_y: float) -> Route | None:
+        """
+        Shortest route between two points. Return None if there is no route
+        """
+
+    @typing.overload
+    def route(self, start: LaneLocation, destination: LaneLocation) -> Route | None:
+        """
+        Shortest route between two locations. Return None if there is no route
+        """
+
+    @property
+    def cache_hits(self) -> int: ...
+    @property
+    def cache_misses(self) -> int: ...
+    @property
+    def cache_size(self) -> int: ...
+
 class SensorDetectability:
     """
     Members:
@@ -1499,6 +2252,192 @@ class SensorDetectability:
     @property
     def value(self) -> int: ...
 
+class SensorFusion:
+    class Setup:
+        acceleration_noise: float
+        bearing_gate: float
+        bearing_noise: float
+        initial_velocity_noise: float
+        max_age: int
+        position_gate: float
+        position_noise: float
+        def __init__(
+            self,
+            position_noise: float = 0.5,
+            bearing_noise: float = 0.01,
+            acceleration_noise: float = 2,
+            initial_velocity_noise: float = 10,
+            position_gate: float = 9.21,
+            bearing_gate: float = 6.63,
+            max_age: int = 10,
+        ) -> None: ...
+        def __repr__(self) -> str: ...
+
+    class Source:
+        """
+        Members:
+
+          POSITION
+
+          BEARING
+        """
+
+        BEARING: typing.ClassVar[SensorFusion.Source]  # value = <Source.BEARING: 2>
+        POSITION: typing.ClassVar[SensorFusion.Source]  # value = <Source.POSITION: 1>
+        __members__: typing.ClassVar[
+            dict[str, SensorFusion.Source]
+        ]  # value = {'POSITION': <Source.POSITION: 1>, 'BEARING': <Source.BEARING: 2>}
+        def __and__(self, other: typing.Any) -> typing.Any: ...
+        def __eq__(self, other: typing.Any) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: typing.Any) -> bool: ...
+        def __or__(self, other: typing.Any) -> typing.Any: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        def __str__(self) -> str: ...
+        @property
+        def name(self) -> str: ...
+        @property
+        def value(self) -> int: ...
+
+    BEARING: typing.ClassVar[SensorFusion.Source]  # value = <Source.BEARING: 2>
+    POSITION: typing.ClassVar[SensorFusion.Source]  # value = <Source.POSITION: 1>
+    def __array__(self) -> numpy.ndarray[numpy.float64]:
+        """
+        (9, N) array with the id, last seen step, sources, x, y, vx, vy and the standard deviations of x and y of each track
+        """
+
+    def __init__(self, setup: SensorFusion.Setup = ...) -> None: ...
+    def __len__(self) -> int: ...
+    def clear(self) -> None:
+        """
+        Remove all the tracks
+        """
+
+    def find(self, id: int) -> int:
+        """
+        Row of the track of the object with the given id, or -1 if the object is not tracked
+        """
+
+    def predict(self, sample_time: float) -> None:
+        """
+        Start a new step, removing the old tracks and predicting the state of the others
+        """
+
+    def update_bearings(
+        self, origin: Position, ids: numpy.ndarray[numpy.int32], bearing: numpy.ndarray[numpy.float64]
+    ) -> None:
+        """
+        Update the tracks with the bearings of the objects seen from the origin, negative ids being unknown
+        """
+
+    def update_positions(
+        self, ids: numpy.ndarray[numpy.int32], x: numpy.ndarray[numpy.float64], y: numpy.ndarray[numpy.float64]
+    ) -> None:
+        """
+        Update the tracks with the positions of the objects in the world frame, negative ids being unknown
+        """
+
+    @property
+    def covariances(self) -> numpy.ndarray[numpy.float64]:
+        """
+        (N, 4, 4) array with the covariance of the x, y, vx and vy of each track
+        """
+
+    @property
+    def setup(self) -> SensorFusion.Setup: ...
+    @property
+    def step(self) -> int:
+        """
+        Index of the current step, -1 before the first one
+        """
+
+class SensorNoise:
+    class Distribution:
+        """
+        Members:
+
+          GAUSSIAN
+
+          LAPLACE
+        """
+
+        GAUSSIAN: typing.ClassVar[SensorNoise.Distribution]  # value = <Distribution.GAUSSIAN: 0>
+        LAPLACE: typing.ClassVar[SensorNoise.Distribution]  # value = <Distribution.LAPLACE: 1>
+        __members__: typing.ClassVar[
+            dict[str, SensorNoise.Distribution]
+        ]  # value = {'GAUSSIAN': <Distribution.GAUSSIAN: 0>, 'LAPLACE': <Distribution.LAPLACE: 1>}
+        def __eq__(self, other: typing.Any) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: typing.Any) -> bool: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        def __str__(self) -> str: ...
+        @property
+        def name(self) -> str: ...
+        @property
+        def value(self) -> int: ...
+
+    class Setup:
+        distribution: SensorNoise.Distribution
+        dropout: float
+        false_positive_high: list[float]
+        false_positive_low: list[float]
+        false_positives: float
+        latency: int
+        latency_jitter: int
+        noise: list[float]
+        quantisation: list[float]
+        seed: int
+        def __init__(
+            self,
+            noise: list[float] = [],
+            distribution: SensorNoise.Distribution = ...,
+            quantisation: list[float] = [],
+            dropout: float = 0,
+            false_positives: float = 0,
+            false_positive_low: list[float] = [],
+            false_positive_high: list[float] = [],
+            latency: int = 0,
+            latency_jitter: int = 0,
+            seed: int = 0,
+        ) -> None: ...
+        def __repr__(self) -> str: ...
+
+    GAUSSIAN: typing.ClassVar[SensorNoise.Distribution]  # value = <Distribution.GAUSSIAN: 0>
+    LAPLACE: typing.ClassVar[SensorNoise.Distribution]  # value = <Distribution.LAPLACE: 1>
+    def __init__(self, setup: SensorNoise.Setup, width: int) -> None: ...
+    def apply(self, rows: numpy.ndarray[numpy.float64]) -> numpy.ndarray[numpy.float64]:
+        """
+        Start a new step and return the (N, width) array of the rows corrupted by all the stages
+        """
+
+    def reset(self, episode: int) -> None:
+        """
+        Start the given episode, emptying the delay buffer
+        """
+
+    @property
+    def episode(self) -> int: ...
+    @property
+    def setup(self) -> SensorNoise.Setup: ...
+    @property
+    def step(self) -> int:
+        """
+        Index of the current step in the episode, -1 before the first one
+        """
+
+    @property
+    def width(self) -> int: ...
+
 class SensorType:
     """
     Members:
@@ -1641,37 +2580,199 @@ class SkyLightPollution:
 
       SkyLightPollutionRural
 
-      SkyLightPollutionRuralSuburban
+      SkyLightPollutionRuralSuburban
+
+      SkyLightPollutionSuburban
+
+      SkyLightPollutionSuburbanUrban
+    """
+
+    SkyLightPollutionBrightSuburban: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionBrightSuburban: 6>
+    SkyLightPollutionCity: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionCity: 8>
+    SkyLightPollutionDarkSite: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionDarkSite: 2>
+    SkyLightPollutionInnerCity: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionInnerCity: 9>
+    SkyLightPollutionNone: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionNone: 0>
+    SkyLightPollutionRural: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionRural: 3>
+    SkyLightPollutionRuralSuburban: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionRuralSuburban: 4>
+    SkyLightPollutionSuburban: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionSuburban: 5>
+    SkyLightPollutionSuburbanUrban: typing.ClassVar[
+        SkyLightPollution
+    ]  # value = <SkyLightPollution.SkyLightPollutionSuburbanUrban: 7>
+    __members__: typing.ClassVar[
+        dict[str, SkyLightPollution]
+    ]  # value = {'SkyLightPollutionBrightSuburban': <SkyLightPollution.SkyLightPollutionBrightSuburban: 6>, 'SkyLightPollutionCity': <SkyLightPollution.SkyLightPollutionCity: 8>, 'SkyLightPollutionDarkSite': <SkyLightPollution.SkyLightPollutionDarkSite: 2>, 'SkyLightPollutionInnerCity': <SkyLightPollution.SkyLightPollutionInnerCity: 9>, 'SkyLightPollutionNone': <SkyLightPollution.SkyLightPollutionNone: 0>, 'SkyLightPollutionRural': <SkyLightPollution.SkyLightPollutionRural: 3>, 'SkyLightPollutionRuralSuburban': <SkyLightPollution.SkyLightPollutionRuralSuburban: 4>, 'SkyLightPollutionSuburban': <SkyLightPollution.SkyLightPollutionSuburban: 5>, 'SkyLightPollutionSuburbanUrban': <SkyLightPollution.SkyLightPollutionSuburbanUrban: 7>}
+    def __eq__(self, other: typing.Any) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: typing.Any) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    def __str__(self) -> str: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+class SkyType:
+    """
+    Members:
+
+      DAY
+
+      NIGHT
+
+      DAWN
+
+      DUSK
+    """
+
+    DAWN: typing.ClassVar[SkyType]  # value = <SkyType.DAWN: 0>
+    DAY: typing.ClassVar[SkyType]  # value = <SkyType.DAY: 1>
+    DUSK: typing.ClassVar[SkyType]  # value = <SkyType.DUSK: 2>
+    NIGHT: typing.ClassVar[SkyType]  # value = <SkyType.NIGHT: 3>
+    __members__: typing.ClassVar[
+        dict[str, SkyType]
+    ]  # value = {'DAY': <SkyType.DAY: 1>, 'NIGHT': <SkyType.NIGHT: 3>, 'DAWN': <SkyType.DAWN: 0>, 'DUSK': <SkyType.DUSK: 2>}
+    def __eq__(self, other: typing.Any) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: typing.Any) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    def __str__(self) -> str: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+class SpatialHash:
+    def __init__(self, cell_size: float = 10) -> None: ...
+    def __len__(self) -> int: ...
+    def build(self, x: numpy.ndarray[numpy.float64], y: numpy.ndarray[numpy.float64]) -> None:
+        """
+        Replace the points in the grid with the ones with coordinates x and y
+        """
+
+    def clear(self) -> None:
+        """
+        Remove all the points from the grid
+        """
+
+    def query_nearest(self, x: float, y: float, k: int) -> numpy.ndarray[numpy.int64]:
+        """
+        Indices of the k points closest to (x, y), sorted by increasing distance
+        """
+
+    def query_pairs(self, distance: float) -> numpy.ndarray[numpy.int64]:
+        """
+        (N, 2) array of the indices of the pairs of points closer than distance
+        """
+
+    def query_radius(self, x: float, y: float, radius: float) -> numpy.ndarray[numpy.int64]:
+        """
+        Indices of the points within radius from (x, y), sorted by increasing distance
+        """
+
+    @property
+    def cell_size(self) -> float: ...
+
+class TrackTable:
+    class Setup:
+        max_age: int
+        def __init__(self, max_age: int = 10) -> None: ...
+        def __repr__(self) -> str: ...
+
+    def __array__(self) -> numpy.ndarray[numpy.float64]:
+        """
+        (9, N) array with the id, last seen step, x, y, z, vx, vy, vz and heading of each track
+        """
+
+    def __init__(self, setup: TrackTable.Setup = ...) -> None: ...
+    def __len__(self) -> int: ...
+    def clear(self) -> None:
+        """
+        Remove all the tracks
+        """
+
+    def find(self, id: int) -> int:
+        """
+        Row of the track of the object with the given id, or -1 if the object is not tracked
+        """
+
+    def update(
+        self,
+        sample_time: float,
+        ids: numpy.ndarray[numpy.int32],
+        x: numpy.ndarray[numpy.float64],
+        y: numpy.ndarray[numpy.float64],
+        z: numpy.ndarray[numpy.float64],
+        heading: numpy.ndarray[numpy.float64],
+    ) -> None:
+        """
+        Advance the table by one step, updating it with the objects detected in the step
+        """
+
+    @property
+    def heading(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def ids(self) -> numpy.ndarray[numpy.int32]: ...
+    @property
+    def last_seen(self) -> numpy.ndarray[numpy.int64]: ...
+    @property
+    def setup(self) -> TrackTable.Setup: ...
+    @property
+    def step(self) -> int:
+        """
+        Index of the last step, -1 before the first one
+        """
+
+    @property
+    def vx(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def vy(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def vz(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def x(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def y(self) -> numpy.ndarray[numpy.float64]: ...
+    @property
+    def z(self) -> numpy.ndarray[numpy.float64]: ...
+
+class TrafficSide:
+    """
+    Members:
 
-      SkyLightPollutionSuburban
+      TrafficSideTypeLeftHandTraffic
 
-      SkyLightPollutionSuburbanUrban
+      TrafficSideTypeRightHandTraffic
     """
 
-    SkyLightPollutionBrightSuburban: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionBrightSuburban: 6>
-    SkyLightPollutionCity: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionCity: 8>
-    SkyLightPollutionDarkSite: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionDarkSite: 2>
-    SkyLightPollutionInnerCity: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionInnerCity: 9>
-    SkyLightPollutionNone: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionNone: 0>
-    SkyLightPollutionRural: typing.ClassVar[SkyLightPollution]  # value = <SkyLightPollution.SkyLightPollutionRural: 3>
-    SkyLightPollutionRuralSuburban: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionRuralSuburban: 4>
-    SkyLightPollutionSuburban: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionSuburban: 5>
-    SkyLightPollutionSuburbanUrban: typing.ClassVar[
-        SkyLightPollution
-    ]  # value = <SkyLightPollution.SkyLightPollutionSuburbanUrban: 7>
+    TrafficSideTypeLeftHandTraffic: typing.ClassVar[
+        TrafficSide
+    ]  # value = <TrafficSide.TrafficSideTypeLeftHandTraffic: 1>
+    TrafficSideTypeRightHandTraffic: typing.ClassVar[
+        TrafficSide
+    ]  # value = <TrafficSide.TrafficSideTypeRightHandTraffic: 0>
     __members__: typing.ClassVar[
-        dict[str, SkyLightPollution]
-    ]  # value = {'SkyLightPollutionBrightSuburban': <SkyLightPollution.SkyLightPollutionBrightSuburban: 6>, 'SkyLightPollutionCity': <SkyLightPollution.SkyLightPollutionCity: 8>, 'SkyLightPollutionDarkSite': <SkyLightPollution.SkyLightPollutionDarkSite: 2>, 'SkyLightPollutionInnerCity': <SkyLightPollution.SkyLightPollutionInnerCity: 9>, 'SkyLightPollutionNone': <SkyLightPollution.SkyLightPollutionNone: 0>, 'SkyLightPollutionRural': <SkyLightPollution.SkyLightPollutionRural: 3>, 'SkyLightPollutionRuralSuburban': <SkyLightPollution.SkyLightPollutionRuralSuburban: 4>, 'SkyLightPollutionSuburban': <SkyLightPollution.SkyLightPollutionSuburban: 5>, 'SkyLightPollutionSuburbanUrban': <SkyLightPollution.SkyLightPollutionSuburbanUrban: 7>}
+        dict[str, TrafficSide]
+    ]  # value = {'TrafficSideTypeLeftHandTraffic': <TrafficSide.TrafficSideTypeLeftHandTraffic: 1>, 'TrafficSideTypeRightHandTraffic': <TrafficSide.TrafficSideTypeRightHandTraffic: 0>}
     def __eq__(self, other: typing.Any) -> bool: ...
     def __getstate__(self) -> int: ...
     def __hash__(self) -> int: ...
@@ -1687,26 +2788,20 @@ class SkyLightPollution:
     @property
     def value(self) -> int: ...
 
-class SkyType:
+class TriggerComparison:
     """
     Members:
 
-      DAY
-
-      NIGHT
-
-      DAWN
+      BELOW : The trigger is active while the value is below the threshold
 
-      DUSK
+      ABOVE : The trigger is active while the value is above the threshold
     """
 
-    DAWN: typing.ClassVar[SkyType]  # value = <SkyType.DAWN: 0>
-    DAY: typing.ClassVar[SkyType]  # value = <SkyType.DAY: 1>
-    DUSK: typing.ClassVar[SkyType]  # value = <SkyType.DUSK: 2>
-    NIGHT: typing.ClassVar[SkyType]  # value = <SkyType.NIGHT: 3>
+    BELOW: typing.ClassVar[TriggerComparison]  # value = <TriggerComparison.BELOW: 0>
+    ABOVE: typing.ClassVar[TriggerComparison]  # value = <TriggerComparison.ABOVE: 1>
     __members__: typing.ClassVar[
-        dict[str, SkyType]
-    ]  # value = {'DAY': <SkyType.DAY: 1>, 'NIGHT': <SkyType.NIGHT: 3>, 'DAWN': <SkyType.DAWN: 0>, 'DUSK': <SkyType.DUSK: 2>}
+        dict[str, TriggerComparison]
+    ]  # value = {'BELOW': <TriggerComparison.BELOW: 0>, 'ABOVE': <TriggerComparison.ABOVE: 1>}
     def __eq__(self, other: typing.Any) -> bool: ...
     def __getstate__(self) -> int: ...
     def __hash__(self) -> int: ...
@@ -1722,24 +2817,38 @@ class SkyType:
     @property
     def value(self) -> int: ...
 
-class TrafficSide:
+class TriggerQuantity:
     """
     Members:
 
-      TrafficSideTypeLeftHandTraffic
+      X : X coordinate of the position
 
-      TrafficSideTypeRightHandTraffic
+      Y : Y coordinate of the position
+
+      Z : Z coordinate of the position
+
+      ROLL : Roll of the orientation
+
+      PITCH : Pitch of the orientation
+
+      YAW : Yaw of the orientation
+
+      VELOCITY : Velocity
+
+      YAW_RATE : Yaw rate
     """
 
-    TrafficSideTypeLeftHandTraffic: typing.ClassVar[
-        TrafficSide
-    ]  # value = <TrafficSide.TrafficSideTypeLeftHandTraffic: 1>
-    TrafficSideTypeRightHandTraffic: typing.ClassVar[
-        TrafficSide
-    ]  # value = <TrafficSide.TrafficSideTypeRightHandTraffic: 0>
+    X: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.X: 0>
+    Y: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.Y: 1>
+    Z: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.Z: 2>
+    ROLL: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.ROLL: 3>
+    PITCH: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.PITCH: 4>
+    YAW: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.YAW: 5>
+    VELOCITY: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.VELOCITY: 6>
+    YAW_RATE: typing.ClassVar[TriggerQuantity]  # value = <TriggerQuantity.YAW_RATE: 7>
     __members__: typing.ClassVar[
-        dict[str, TrafficSide]
-    ]  # value = {'TrafficSideTypeLeftHandTraffic': <TrafficSide.TrafficSideTypeLeftHandTraffic: 1>, 'TrafficSideTypeRightHandTraffic': <TrafficSide.TrafficSideTypeRightHandTraffic: 0>}
+        dict[str, TriggerQuantity]
+    ]  # value = {'X': <TriggerQuantity.X: 0>, 'Y': <TriggerQuantity.Y: 1>, 'Z': <TriggerQuantity.Z: 2>, 'ROLL': <TriggerQuantity.ROLL: 3>, 'PITCH': <TriggerQuantity.PITCH: 4>, 'YAW': <TriggerQuantity.YAW: 5>, 'VELOCITY': <TriggerQuantity.VELOCITY: 6>, 'YAW_RATE': <TriggerQuantity.YAW_RATE: 7>}
     def __eq__(self, other: typing.Any) -> bool: ...
     def __getstate__(self) -> int: ...
     def __hash__(self) -> int: ...
@@ -1755,10 +2864,57 @@ class TrafficSide:
     @property
     def value(self) -> int: ...
 
+class TriggerSystem(_SimulationObserver):
+    def __init__(self) -> None: ...
+    def __len__(self) -> int: ...
+    def active(self, id: int) -> bool:
+        """
+        Whether the trigger with the given id is active
+        """
+
+    def add_detection_trigger(self, sensor: _Sensor, comparison: TriggerComparison, threshold: float, hysteresis: float, callback: typing.Callable[[int, bool, float], None]) -> int:
+        """
+        Add a trigger on the number of detections of the sensor. Return the id of the trigger
+        """
+
+    def add_distance_trigger(self, first: _Entity, second: _Entity, comparison: TriggerComparison, threshold: float, hysteresis: float, callback: typing.Callable[[int, bool, float], None]) -> int:
+        """
+        Add a trigger on the distance between two entities. Return the id of the trigger
+        """
+
+    def add_point_distance_trigger(self, entity: _Entity, x: float, y: float, comparison: TriggerComparison, threshold: float, hysteresis: float, callback: typing.Callable[[int, bool, float], None]) -> int:
+        """
+        Add a trigger on the distance between the entity and the point (x, y). Return the id of the trigger
+        """
+
+    def add_state_trigger(self, entity: _Entity, quantity: TriggerQuantity, comparison: TriggerComparison, threshold: float, hysteresis: float, callback: typing.Callable[[int, bool, float], None]) -> int:
+        """
+        Add a trigger on a quantity of the state of the entity. Return the id of the trigger
+        """
+
+    def clear(self) -> None:
+        """
+        Remove all the triggers, releasing their callbacks and anything they reference
+        """
+
+    def evaluate(self, time: float) -> None:
+        """
+        Evaluate all the triggers at time, calling back the ones that changed state
+        """
+
+    def value(self, id: int) -> float:
+        """
+        Value of the trigger with the given id at the last evaluation
+        """
+
+    @property
+    def steps(self) -> int: ...
+
 class Velocity:
     x: float
     y: float
     z: float
+    dtype: typing.ClassVar[numpy.dtype]  # Structured numpy dtype of the Velocity, to store many of them in a single array
     def __array__(self) -> numpy.ndarray[numpy.float64]: ...
     @typing.overload
     def __init__(self) -> None: ...
@@ -1971,6 +3127,11 @@ class _Entity:
     def apply_setup(self) -> None: ...
     @typing.overload
     def apply_setup(self, setup: _Entity.Setup) -> None: ...
+    def clear_sensor_fusion(self) -> None:
+        """
+        Stop fusing the detections of the sensors of the entity
+        """
+
     def initialise(self, simulation: _ISimulation) -> None: ...
     def initialise_object(self, experiment: _Experiment, object: _WorldObject) -> None: ...
     def register_unit(self, experiment: _Experiment, simulation: _ISimulation) -> None: ...
@@ -1979,6 +3140,11 @@ class _Entity:
         Remove the object from the experiment
         """
 
+    def set_sensor_fusion(self, setup: SensorFusion.Setup) -> None:
+        """
+        Fuse the detections of the AIR and BRS sensors of the entity at each step
+        """
+
     def step(self, simulation: _ISimulation) -> None: ...
     def terminate(self, simulation: _ISimulation) -> None: ...
     @property
@@ -1993,6 +3159,12 @@ class _Entity:
         Get the worldobject wrapped by the entity
         """
 
+    @property
+    def sensor_fusion(self) -> SensorFusion | None:
+        """
+        Fusion of the detections of the sensors of the entity, None if there is none
+        """
+
     @property
     def setup(self) -> _Entity.Setup:
         """
@@ -2040,7 +3212,7 @@ class _EntityModel:
         Register the unit of the model
         """
 
-    def set_input(self, input: list[float]) -> None:
+    def set_input(self, input: numpy.ndarray[numpy.float64]) -> None:
         """
         Set the input of the model
         """
@@ -2055,7 +3227,7 @@ class _EntityModel:
         Called when the simulation is terminated
         """
 
-    def update_input(self, input: list[float]) -> None:
+    def update_input(self, input: numpy.ndarray[numpy.float64]) -> None:
         """
         Update the input of the model
         """
@@ -2083,6 +3255,25 @@ class _Environment:
         Collect an existing entity from the experiment
         """
 
+    @typing.overload
+    def add_entities(self, entities: list[_Entity]) -> _Environment:
+        """
+        Add many entities to the environment at once
+        """
+
+    @typing.overload
+    def add_entities(
+        self,
+        object_types: numpy.ndarray[numpy.int32],
+        poses: numpy.ndarray,
+        is_collision_detectable: bool = True,
+        is_movable: bool = True,
+        sensor_detectability: SensorDetectability = SensorDetectability.SensorDetectabilityDetectable,
+    ) -> tuple[_Entity, ...]:
+        """
+        Create and add many entities to the environment at once, given their object types and their poses, as an (N, 6) array of (x, y, z, roll, pitch, yaw) or an array with the Pose dtype
+        """
+
     def add_free_viewer(self) -> _Viewer:
         """
         Add a free viewer in the environment
@@ -2098,6 +3289,11 @@ class _Environment:
         Add a road to the environment
         """
 
+    def clear_pool(self) -> _Environment:
+        """
+        Remove all the parked objects from the experiment
+        """
+
     def import_open_drive_network(self, filename: str) -> _Environment:
         """
         Import an OpenDrive network from a file
@@ -2130,6 +3326,12 @@ class _Environment:
         Save the experiment to file
         """
 
+    def set_pooling(self, pooling: bool) -> _Environment:
+        """
+        Enable or disable the pooling of the objects of removed entities.
+        The sensors and the model of a parked object stay in the experiment and are still simulated
+        """
+
     def set_scheduler_frequencies(self, simulation_frequency: int, integration_frequency: int) -> _Environment:
         """
         Set the scheduler frequencies of the environment
@@ -2156,6 +3358,24 @@ class _Environment:
         Get the experiment of the environment
         """
 
+    @property
+    def pooled_count(self) -> int:
+        """
+        Number of parked objects waiting to be reused
+        """
+
+    @property
+    def pooling(self) -> bool:
+        """
+        Whether the objects of removed entities are parked to be reused
+        """
+
+    @property
+    def road_network(self) -> RoadNetwork:
+        """
+        Get the road network imported in the environment
+        """
+
 class _Experiment:
     @staticmethod
     def create_experiment() -> _Experiment: ...
@@ -2173,20 +3393,83 @@ class _Sensor:
     def __init__(self, sensor_type: SensorType, existing: bool = False) -> None: ...
     @typing.overload
     def __init__(self, arg0: SensorType, arg1: numpy.ndarray[numpy.float64], arg2: bool) -> None: ...
+    def clear_point_cloud_filter(self) -> None:
+        """
+        Stop processing the points seen by the sensor
+        """
+
+    def clear_sensor_noise(self) -> None:
+        """
+        Stop corrupting the state of the sensor
+        """
+
+    def clear_track_table(self) -> None:
+        """
+        Stop tracking the objects detected by the sensor
+        """
+
     def create_sensor(self, object: _WorldObject, id: int) -> None: ...
     def initialise(self, simulation: _ISimulation) -> None: ...
     def register_unit(self, object: _WorldObject, experiment: _Experiment, simulation: _ISimulation) -> None: ...
+    def set_point_cloud_filter(self, setup: PointCloudFilter.Setup) -> None:
+        """
+        Process the points seen by the LMS sensor at each step
+        """
+
+    def set_noise_episode(self, episode: int) -> None:
+        """
+        Select the episode of the noise of the next simulation
+        """
+
+    def set_sensor_noise(self, setup: SensorNoise.Setup) -> None:
+        """
+        Corrupt the state of the AIR, BRS or LMS sensor at each step
+        """
+
+    def set_track_table(self, setup: TrackTable.Setup) -> None:
+        """
+        Track the objects detected by the AIR sensor at each step
+        """
+
     def step(self, simulation: _ISimulation) -> None: ...
     def terminate(self, simulation: _ISimulation) -> None: ...
+    @property
+    def detection_count(self) -> int:
+        """
+        Number of detections of the sensor in the last step, counting each point for LMS sensors
+        """
+
+    @property
+    def point_cloud_filter(self) -> PointCloudFilter | None:
+        """
+        Filter processing the points seen by the sensor, None if there is none
+        """
+
+    @property
+    def sensor_noise(self) -> SensorNoise | None:
+        """
+        Noise corrupting the state of the sensor, None if there is none
+        """
+
     @property
     def sensor_type(self) -> SensorType: ...
     @property
     def setup(self) -> list[float]: ...
     @property
     def state(self) -> list[float]: ...
+    @property
+    def track_table(self) -> TrackTable | None:
+        """
+        Table tracking the objects detected by the sensor, None if there is none
+        """
 
 class _Simulation:
     def __init__(self, environment: _Environment) -> None: ...
+    def add_observer(self, observer: _SimulationObserver) -> None:
+        """
+        Add an observer notified at each stage of the simulation.
+        """
+
     def initialise(self) -> None:
         """
         Initialise the simulation.
@@ -2202,6 +3485,16 @@ class _Simulation:
         Set a callback to be called as the first operation at each step.
         """
 
+    def remove_observer(self, observer: _SimulationObserver) -> None:
+        """
+        Remove an observer from the simulation.
+        """
+
+    def reset_stats(self) -> None:
+        """
+        Remove all the timing statistics collected so far.
+        """
+
     def run(self, seconds: float = -1.0) -> None:
         """
         Run the simulation automatically.
@@ -2222,6 +3515,11 @@ class _Simulation:
         Set a callback to be called as the first operation at each step.
         """
 
+    def stats(self) -> dict:
+        """
+        Timing statistics of each phase of each component, in nanoseconds, as a dictionary of arrays.
+        """
+
     def step(self) -> None:
         """
         Advance the simulation manually.
@@ -2232,6 +3530,9 @@ class _Simulation:
         Terminate the simulation and clean up.
         """
 
+class _SimulationObserver:
+    pass
+
 class _TrackModel(_EntityModel):
     class Input:
         acceleration_multiplier: float
@@ -2271,6 +3572,22 @@ class _TrackModel(_EntityModel):
         def __init__(
             self, existing: bool, active: bool, path: list[Position], speed: float, tolerance: float
         ) -> None: ...
+        @typing.overload
+        def __init__(self, existing: bool, active: bool, path: numpy.ndarray, speed: float, tolerance: float) -> None:
+            """
+            Initialise with the path given as an (N, 3) array of positions or an array with the Position dtype
+            """
+
+        @typing.overload
+        def __init__(self, existing: bool, active: bool, route: Route, speed: float, tolerance: float) -> None: ...
+        @property
+        def path_array(self) -> numpy.ndarray[numpy.float64]:
+            """
+            Path as an (N, 3) array of positions. Set it with an (N, 3) array or an array with the Position dtype
+            """
+
+        @path_array.setter
+        def path_array(self, arg1: numpy.ndarray) -> None: ...
 
     @typing.overload
     def __init__(self) -> None: ...
@@ -2319,6 +3636,123 @@ class _WorldObject:
     sensor_detectability: SensorDetectability
     def remove(self) -> None: ...
 
+def avx2_transforms() -> bool:
+    """
+    Whether the batch transforms use the AVX2 kernels
+    """
+
+def clear_trace() -> None:
+    """
+    Remove the spans recorded so far. Tracing must be disabled when this is called.
+    """
+
+def compose(parent: Pose, child: Pose) -> Pose:
+    """
+    Pose of the child, given relative to the parent, in the frame the parent is given in
+    """
+
+def inverse(pose: Pose) -> Pose:
+    """
+    Pose of the parent frame in the frame of the pose
+    """
+
+def inverse_transform_point(pose: Pose, point: Position) -> Position:
+    """
+    Express a point given in the frame the pose is given in in the frame of the pose
+    """
+
+@typing.overload
+def inverse_transform_points(pose: Pose, points: numpy.ndarray[numpy.float64]) -> numpy.ndarray[numpy.float64]:
+    """
+    Express the points, an (N, K) array with the coordinates in the first 3 columns, given in the frame the pose is given in in the frame of the pose. Returns an (N, 3) array
+    """
+
+@typing.overload
+def inverse_transform_points(pose: Pose, x: numpy.ndarray[numpy.float64], y: numpy.ndarray[numpy.float64], z: numpy.ndarray[numpy.float64]) -> tuple[numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64]]:
+    """
+    Express the points, given as separate arrays of coordinates, in the frame of the pose. Returns the arrays of the transformed coordinates
+    """
+
+def is_profiling_enabled() -> bool:
+    """
+    Whether timing statistics are being collected for each phase of the simulation.
+    """
+
+def is_tracing_enabled() -> bool:
+    """
+    Whether the spans of the simulation lifecycle are being recorded.
+    """
+
+def object_catalog() -> numpy.ndarray:
+    """
+    Structured array with the geometry and mass of each object type, indexed by its value.
+    The fields are type, category, length, width, height, cog_x, cog_y, cog_z and mass. Unknown values are NaN
+    """
+
+def object_info(object_type: ObjectType) -> ObjectInfo:
+    """
+    Geometry and mass of the object type. Unknown values are NaN
+    """
+
+@typing.overload
+def orientation(rotation: numpy.ndarray[numpy.float64]) -> Orientation:
+    """
+    Roll, pitch and yaw of a 3x3 rotation matrix
+    """
+
+@typing.overload
+def orientation(quaternion: Quaternion) -> Orientation:
+    """
+    Roll, pitch and yaw of a quaternion
+    """
+
+def polar_to_cartesian(range: numpy.ndarray[numpy.float64], azimuth: numpy.ndarray[numpy.float64], elevation: numpy.ndarray[numpy.float64]) -> tuple[numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64]]:
+    """
+    Cartesian coordinates of points given by range, azimuth and elevation, e.g. the detections of an AIR sensor. Returns the arrays of the X, Y and Z coordinates
+    """
+
+def quaternion(orientation: Orientation) -> Quaternion:
+    """
+    Quaternion of the orientation
+    """
+
+def rotation_matrix(orientation: Orientation) -> numpy.ndarray[numpy.float64]:
+    """
+    Rotation matrix of the orientation, R = Rz(yaw) Ry(pitch) Rx(roll)
+    """
+
+def set_profiling_enabled(enabled: bool) -> None:
+    """
+    Enable or disable the collection of timing statistics for each phase of the simulation.
+    """
+
+def set_tracing_enabled(enabled: bool) -> None:
+    """
+    Enable or disable the recording of the spans of the simulation lifecycle.
+    """
+
+def transform_point(pose: Pose, point: Position) -> Position:
+    """
+    Express a point given in the frame of the pose in the frame the pose is given in
+    """
+
+@typing.overload
+def transform_points(pose: Pose, points: numpy.ndarray[numpy.float64]) -> numpy.ndarray[numpy.float64]:
+    """
+    Express the points, an (N, K) array with the coordinates in the first 3 columns, given in the frame of the pose in the frame the pose is given in. Returns an (N, 3) array
+    """
+
+@typing.overload
+def transform_points(pose: Pose, x: numpy.ndarray[numpy.float64], y: numpy.ndarray[numpy.float64], z: numpy.ndarray[numpy.float64]) -> tuple[numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64], numpy.ndarray[numpy.float64]]:
+    """
+    Express the points, given as separate arrays of coordinates, in the frame the pose is given in. Returns the arrays of the transformed coordinates
+    """
+
+def write_trace(filename: str) -> None:
+    """
+    Write the spans recorded so far to a Trace Event JSON file, loadable in Perfetto or chrome://tracing.
+    """
+
 AsphaltToneDark: AsphaltTone  # value = <AsphaltTone.AsphaltToneDark: 1>
 AsphaltToneDarker: AsphaltTone  # value = <AsphaltTone.AsphaltToneDarker: 2>
 AsphaltToneLight: AsphaltTone  # value = <AsphaltTone.AsphaltToneLight: 3>
@@ -203,7 +203,8 @@ class TrackModel(DynamicalModel):
     ID:
         Identifier of the agent this model belongs to
     path:
-        List of positions defining the track
+        Positions defining the track, either as a list or as an (N, 3) array.
+        An array is converted all at once, without creating a Position object for each point
     speed:
         Speed of the entity along the track
     tolerance:
@@ -219,7 +220,7 @@ class TrackModel(DynamicalModel):
     def __init__(
         self,
         ID: Identifier,
-        path: "list[Position] | None" = None,
+        path: "list[Position] | np.ndarray | None" = None,
         speed: float = 0,
         tolerance: float = 0,
         existing: bool = False,
@@ -227,7 +228,9 @@ class TrackModel(DynamicalModel):
     ):
         super().__init__(ID, control_input=np.array([1, 0, 1, 0, 1, 0]))
         self._internal_model = _TrackModel(
-            _TrackModel.Setup(existing=existing, active=active, path=path or [], speed=speed, tolerance=tolerance)
+            _TrackModel.Setup(
+                existing=existing, active=active, path=[] if path is None else path, speed=speed, tolerance=tolerance
+            )
         )
 
     def control_input_to_array(
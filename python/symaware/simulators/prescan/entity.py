@@ -1,5 +1,7 @@
+import types
 from abc import abstractmethod
 from dataclasses import dataclass, field
+from typing import TYPE_CHECKING
 
 import numpy as np
 from symaware.base import Entity as BaseEntity
@@ -10,6 +12,7 @@ from ._symaware_prescan import (
     Orientation,
     Position,
     SensorDetectability,
+    SensorFusion,
     _Entity,
     _Experiment,
     _WorldObject,
@@ -34,6 +37,9 @@ class Entity(BaseEntity):
     ----
     model:
         Dynamical model associated with the entity. Must be a subclass of :class:`.PybulletDynamicalModel`
+    sensor_fusion:
+        if provided, the detections of the AIR and BRS sensors of the entity are fused at each step,
+        and the resulting tracks made available in :attr:`sensor_fusion`
     """
 
     model: DynamicalModel = field(default_factory=NullDynamicalModel)
@@ -51,6 +57,7 @@ class Entity(BaseEntity):
         is_movable: bool = True,
         sensor_detectability: SensorDetectability = SensorDetectability.SensorDetectabilityDetectable,
         sensors: "tuple[Sensor] | Sensor" = tuple(),
+        sensor_fusion: "SensorFusion.Setup | None" = None,
     ):
         object.__setattr__(self, "id", id)
         object.__setattr__(self, "model", model)
@@ -71,6 +78,8 @@ class Entity(BaseEntity):
         assert isinstance(self.sensors, tuple), "sensors must be a tuple of sensors"
         for sensor in self.sensors:
             self._internal_entity.add_sensor(sensor._internal_sensor)  # pylint: disable=protected-access
+        if sensor_fusion is not None:
+            self._internal_entity.set_sensor_fusion(sensor_fusion)
 
     def apply_setup(
         self,
@@ -146,6 +155,22 @@ class Entity(BaseEntity):
         """State of the entity inside the Prescan simulation"""
         return self._internal_entity.state
 
+    @property
+    def sensor_fusion(self) -> SensorFusion:
+        """
+        Tracks obtained by fusing the detections of the sensors of the entity, in the world frame.
+        ``np.asarray(entity.sensor_fusion)`` is a (9, N) array with the id, last seen step, sources, x, y, vx, vy
+        and the standard deviations of x and y of each track.
+
+        Raises
+        ------
+        RuntimeError: if the entity has no sensor fusion
+        """
+        sensor_fusion = self._internal_entity.sensor_fusion
+        if sensor_fusion is None:
+            raise RuntimeError("The entity has no sensor fusion")
+        return sensor_fusion
+
     @property
     def is_initialised(self) -> bool:
         """Whether the entity has already been initialised inside the environment"""
@@ -213,2054 +238,710 @@ class Entity(BaseEntity):
 
 
 @dataclass(frozen=True, init=False)
-class ADACtargetyellowmercEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ADAC_target_yellow_merc
+class ExistingEntity(Entity):
+    """
+    Existing entity.
+    Used to load an entity from an experiment file without having to recreate it.
+    The object_name will be used to link the entity to the corresponding World object in the experiment file.
+    """
 
+    object_name: str = ""
+
+    def __init__(
+        self,
+        id: Identifier = -1,  # pylint: disable=redefined-builtin
+        model: DynamicalModel = NullDynamicalModel(),
+        object_name: str = "",
+        position: "Position | np.ndarray" = Position(),
+        orientation: "Orientation | np.ndarray" = Orientation(),
+        cog_offset: "Position | np.ndarray" = Position(),
+        is_collision_detectable: bool = True,
+        is_movable: bool = True,
+        sensor_detectability: SensorDetectability = SensorDetectability.SensorDetectabilityDetectable,
+        sensors: "tuple[Sensor] | Sensor" = tuple(),
+        sensor_fusion: "SensorFusion.Setup | None" = None,
+    ):
+        super().__init__(
+            id=id,
+            model=model,
+            position=position,
+            orientation=orientation,
+            cog_offset=cog_offset,
+            is_collision_detectable=is_collision_detectable,
+            is_movable=is_movable,
+            sensor_detectability=sensor_detectability,
+            sensors=sensors,
+            sensor_fusion=sensor_fusion,
+        )
+        if object_name == "":
+            raise AttributeError(
+                "object_name must contain the unique name of the WorldObject in the Prescan experiment"
+            )
+        object.__setattr__(self, "object_name", object_name)
 
-@dataclass(frozen=True, init=False)
-class ApartmentBuildingEntity(Entity):
     @property
     def object_type(self) -> ObjectType:
-        return ObjectType.ApartmentBuilding
+        return ObjectType.Existing
 
 
-@dataclass(frozen=True, init=False)
-class ArrowBoardTrailerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ArrowBoard_Trailer
+def entity_class_name(object_type: ObjectType) -> str:
+    """
+    Name of the :class:`Entity` subclass of the given object type,
+    i.e. the name of the object type without underscores followed by ``Entity``.
 
+    Args
+    ----
+    object_type:
+        Type of the entity
 
-@dataclass(frozen=True, init=False)
-class Ash10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Ash10y
+    Returns
+    -------
+        Name of the class, e.g. ``AudiA8SedanEntity`` for ``ObjectType.Audi_A8_Sedan``
+    """
+    return f"{object_type.name.replace('_', '')}Entity"
 
 
-@dataclass(frozen=True, init=False)
-class Ash20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Ash20y
+_object_types_by_class_name: "dict[str, ObjectType]" = {}
 
 
-@dataclass(frozen=True, init=False)
-class AudiA3Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Audi_A3
+def entity_object_types() -> "dict[str, ObjectType]":
+    """
+    Object type of each :class:`Entity` subclass created on demand by :func:`entity_class`, by class name.
+    :class:`ExistingEntity` is not included.
 
+    Returns
+    -------
+        Dictionary from the name of the class to its object type
+    """
+    if not _object_types_by_class_name:
+        for object_type in ObjectType.__members__.values():
+            if object_type != ObjectType.Existing:
+                _object_types_by_class_name[entity_class_name(object_type)] = object_type
+    return _object_types_by_class_name
 
-@dataclass(frozen=True, init=False)
-class AudiA8SedanEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Audi_A8_Sedan
 
+def entity_class(object_type: ObjectType) -> "type[Entity]":
+    """
+    :class:`Entity` subclass of the given object type.
+    The class is created the first time it is requested and then stored in the module,
+    so that it is the same class that is imported by name, e.g. ``AudiA8SedanEntity``.
 
-@dataclass(frozen=True, init=False)
-class AustrianPine10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.AustrianPine10y
+    Args
+    ----
+    object_type:
+        Type of the entity. Must not be ``ObjectType.Existing``, which is handled by :class:`ExistingEntity`
 
+    Returns
+    -------
+        Subclass of :class:`Entity` whose object_type is the given one
 
-@dataclass(frozen=True, init=False)
-class AustrianPine20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.AustrianPine20y
+    Raises
+    -----
+        ValueError: If the object type is ``ObjectType.Existing``
+    """
+    if object_type == ObjectType.Existing:
+        raise ValueError("Use ExistingEntity for entities already present in the experiment")
+    name = entity_class_name(object_type)
+    cls = globals().get(name)
+    if cls is None:
 
+        def body(namespace: dict):
+            namespace["__module__"] = __name__
+            namespace["__qualname__"] = name
+            namespace["__doc__"] = f"Entity of type ObjectType.{object_type.name}"
+            namespace["object_type"] = property(lambda self: object_type)
 
-@dataclass(frozen=True, init=False)
-class BEPoliceVolvoXC60Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BE_Police_Volvo_XC60
+        cls = dataclass(frozen=True, init=False)(types.new_class(name, (Entity,), exec_body=body))
+        globals()[name] = cls
+    return cls
 
 
-@dataclass(frozen=True, init=False)
-class BMWX5SUVEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BMW_X5_SUV
+def __getattr__(name: str) -> "type[Entity]":
+    # Creating the 287 entity classes when the module is imported takes most of the import time,
+    # so each one is only created when it is first accessed
+    object_type = entity_object_types().get(name)
+    if object_type is None:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    return entity_class(object_type)
 
 
-@dataclass(frozen=True, init=False)
-class BMWZ3ConvertibleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BMW_Z3_Convertible
+def __dir__() -> "list[str]":
+    return sorted(set(globals()) | set(entity_object_types()))
 
 
-@dataclass(frozen=True, init=False)
-class BalloonCarEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BalloonCar
+if TYPE_CHECKING:
+    # Declared for the type checkers only. At runtime the classes are created by __getattr__
 
+    class ADACtargetyellowmercEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BarrierFenceEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BarrierFence
+    class ApartmentBuildingEntity(Entity): ...
 
+    class ArrowBoardTrailerEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Birch10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Birch10y
+    class Ash10yEntity(Entity): ...
 
+    class Ash20yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Birch20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Birch20y
+    class AudiA3Entity(Entity): ...
 
+    class AudiA8SedanEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BlueSpruce10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BlueSpruce10y
+    class AustrianPine10yEntity(Entity): ...
 
+    class AustrianPine20yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BlueSpruce20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BlueSpruce20y
+    class BEPoliceVolvoXC60Entity(Entity): ...
 
+    class BMWX5SUVEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BottsDotsWhiteEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BottsDots_White
+    class BMWZ3ConvertibleEntity(Entity): ...
 
+    class BalloonCarEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BottsDotsYellowEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.BottsDots_Yellow
+    class BarrierFenceEntity(Entity): ...
 
+    class Birch10yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Boy100Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Boy_100
+    class Birch20yEntity(Entity): ...
 
+    class BlueSpruce10yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Boy150Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Boy_150
+    class BlueSpruce20yEntity(Entity): ...
 
+    class BottsDotsWhiteEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building00AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_00A
+    class BottsDotsYellowEntity(Entity): ...
 
+    class Boy100Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building01AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_01A
+    class Boy150Entity(Entity): ...
 
+    class Building00AEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building02AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_02A
+    class Building01AEntity(Entity): ...
 
+    class Building02AEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building03AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_03A
+    class Building03AEntity(Entity): ...
 
+    class Building04AEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building04AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_04A
+    class Building05AEntity(Entity): ...
 
+    class Building06AEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building05AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_05A
+    class Building07AEntity(Entity): ...
 
+    class Building08AEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building06AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_06A
+    class BusstopEntity(Entity): ...
 
+    class CAT725Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building07AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_07A
+    class CadillacEscaladeEntity(Entity): ...
 
+    class CarDealerEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Building08AEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Building_08A
+    class CarTrailerSmallEntity(Entity): ...
 
+    class CatsEyesREntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BusstopEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Busstop
+    class CatsEyesWEntity(Entity): ...
 
+    class CatsEyesWREntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CAT725Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CAT_725
+    class CatsEyesWYEntity(Entity): ...
 
+    class CatsEyesYEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CadillacEscaladeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cadillac_Escalade
+    class ChildLeaningEntity(Entity): ...
 
+    class ChildOverweightEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CarDealerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CarDealer
+    class ChildRegularEntity(Entity): ...
 
+    class ChildSittingEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CarTrailerSmallEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Car_Trailer_Small
+    class CinderBlockAEntity(Entity): ...
 
+    class CinderBlockBEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CatsEyesREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CatsEyesR
+    class CinderBlockCEntity(Entity): ...
 
+    class CitroenC3HatchbackEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CatsEyesWEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CatsEyesW
+    class ConstructionSignJPEntity(Entity): ...
 
+    class ContainerTrailerEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CatsEyesWREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CatsEyesWR
+    class CornerReflector138mmEntity(Entity): ...
 
+    class CornerReflector1768mmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CatsEyesWYEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CatsEyesWY
+    class CornerReflector4635mmEntity(Entity): ...
 
+    class CottonAEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CatsEyesYEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CatsEyesY
+    class CottonBEntity(Entity): ...
 
+    class CottonCEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ChildLeaningEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Child_Leaning
+    class DAF95XFEntity(Entity): ...
 
+    class DAFEuro6XFEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ChildOverweightEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Child_Overweight
+    class DeerEntity(Entity): ...
 
+    class Dogwood10yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ChildRegularEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Child_Regular
+    class Dogwood20yEntity(Entity): ...
 
+    class Dumpster2300LEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ChildSittingEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Child_Sitting
+    class DutchChurchEntity(Entity): ...
 
+    class EmptyLightNodeEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CinderBlockAEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CinderBlock_A
+    class FAWJiefangJ6MEntity(Entity): ...
 
+    class FShape150cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CinderBlockBEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CinderBlock_B
+    class FShape250cmEntity(Entity): ...
 
+    class FShape350cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CinderBlockCEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CinderBlock_C
+    class FemaleBendingEntity(Entity): ...
 
+    class FemaleLeaningEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CitroenC3HatchbackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Citroen_C3_Hatchback
+    class FemaleOverweightEntity(Entity): ...
 
+    class FemaleRegularEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ConstructionSignJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ConstructionSign_JP
+    class FemalewBuggyEntity(Entity): ...
 
+    class FemalewLongCoatEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ContainerTrailerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Container_Trailer
+    class FemalewRaincoatEntity(Entity): ...
 
+    class FemalewShoppingCartEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CornerReflector138mmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CornerReflector138mm
+    class FiatBravoHatchbackEntity(Entity): ...
 
+    class FireBrigadeEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CornerReflector1768mmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CornerReflector176_8mm
+    class FordFiestaHatchbackEntity(Entity): ...
 
+    class FordFocusStationwagonEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CornerReflector4635mmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.CornerReflector46_35mm
+    class FullTrailerEntity(Entity): ...
 
+    class GarageGroundFloorEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CottonAEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cotton_A
+    class GarageMidFloorEntity(Entity): ...
 
+    class GarageTopFloorEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CottonBEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cotton_B
+    class GasStationEntity(Entity): ...
 
+    class GenesisGV80Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CottonCEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cotton_C
+    class GuardrailReflectorRectREntity(Entity): ...
 
+    class GuardrailReflectorRectWEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class DAF95XFEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.DAF_95_XF
+    class GuardrailReflectorRectWREntity(Entity): ...
 
+    class GuardrailReflectorRoundREntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class DAFEuro6XFEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.DAF_Euro_6_XF
+    class GuardrailReflectorRoundWEntity(Entity): ...
 
+    class GuardrailReflectorRoundWREntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class DeerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Deer
+    class GuardrailReflectorRoundYEntity(Entity): ...
 
+    class GuidedSoftTargetEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Dogwood10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Dogwood10y
+    class HOWOT5GCementTruckEntity(Entity): ...
 
+    class HinoBlueRibbonEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Dogwood20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Dogwood20y
+    class HondaPanEuropeanMotorcycleEntity(Entity): ...
 
+    class HondaPanEuropeanMotorcycleWithDriverEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Dumpster2300LEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Dumpster_2300L
+    class HouseModernEntity(Entity): ...
 
+    class HouseOld1Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class DutchChurchEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.DutchChurch
+    class HouseOld2Entity(Entity): ...
 
+    class HouseOld3Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class EmptyLightNodeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Empty_Light_Node
+    class HouseOld4Entity(Entity): ...
 
+    class HouseOld5Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ExistingEntity(Entity):
-    """
-    Existing entity.
-    Used to load an entity from an experiment file without having to recreate it.
-    The object_name will be used to link the entity to the corresponding World object in the experiment file.
-    """
+    class HouseOld6Entity(Entity): ...
 
-    object_name: str = ""
-
-    def __init__(
-        self,
-        id: Identifier = -1,  # pylint: disable=redefined-builtin
-        model: DynamicalModel = NullDynamicalModel(),
-        object_name: str = "",
-        position: "Position | np.ndarray" = Position(),
-        orientation: "Orientation | np.ndarray" = Orientation(),
-        cog_offset: "Position | np.ndarray" = Position(),
-        is_collision_detectable: bool = True,
-        is_movable: bool = True,
-        sensor_detectability: SensorDetectability = SensorDetectability.SensorDetectabilityDetectable,
-        sensors: "tuple[Sensor] | Sensor" = tuple(),
-    ):
-        super().__init__(
-            id=id,
-            model=model,
-            position=position,
-            orientation=orientation,
-            cog_offset=cog_offset,
-            is_collision_detectable=is_collision_detectable,
-            is_movable=is_movable,
-            sensor_detectability=sensor_detectability,
-            sensors=sensors,
-        )
-        if object_name == "":
-            raise AttributeError(
-                "object_name must contain the unique name of the WorldObject in the Prescan experiment"
-            )
-        object.__setattr__(self, "object_name", object_name)
-
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Existing
-
-
-@dataclass(frozen=True, init=False)
-class FAWJiefangJ6MEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.FAW_Jiefang_J6M
-
-
-@dataclass(frozen=True, init=False)
-class FShape150cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.FShape150cm
-
-
-@dataclass(frozen=True, init=False)
-class FShape250cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.FShape250cm
-
-
-@dataclass(frozen=True, init=False)
-class FShape350cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.FShape350cm
-
-
-@dataclass(frozen=True, init=False)
-class FemaleBendingEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_Bending
-
-
-@dataclass(frozen=True, init=False)
-class FemaleLeaningEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_Leaning
-
-
-@dataclass(frozen=True, init=False)
-class FemaleOverweightEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_Overweight
-
-
-@dataclass(frozen=True, init=False)
-class FemaleRegularEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_Regular
-
-
-@dataclass(frozen=True, init=False)
-class FemalewBuggyEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_wBuggy
-
-
-@dataclass(frozen=True, init=False)
-class FemalewLongCoatEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_wLongCoat
-
-
-@dataclass(frozen=True, init=False)
-class FemalewRaincoatEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_wRaincoat
-
-
-@dataclass(frozen=True, init=False)
-class FemalewShoppingCartEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Female_wShoppingCart
-
-
-@dataclass(frozen=True, init=False)
-class FiatBravoHatchbackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Fiat_Bravo_Hatchback
-
-
-@dataclass(frozen=True, init=False)
-class FireBrigadeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.FireBrigade
-
-
-@dataclass(frozen=True, init=False)
-class FordFiestaHatchbackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Ford_Fiesta_Hatchback
-
-
-@dataclass(frozen=True, init=False)
-class FordFocusStationwagonEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Ford_Focus_Stationwagon
-
-
-@dataclass(frozen=True, init=False)
-class FullTrailerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Full_Trailer
-
-
-@dataclass(frozen=True, init=False)
-class GarageGroundFloorEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Garage_Ground_Floor
-
-
-@dataclass(frozen=True, init=False)
-class GarageMidFloorEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Garage_Mid_Floor
-
-
-@dataclass(frozen=True, init=False)
-class GarageTopFloorEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Garage_Top_Floor
-
-
-@dataclass(frozen=True, init=False)
-class GasStationEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GasStation
-
-
-@dataclass(frozen=True, init=False)
-class GenesisGV80Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Genesis_GV80
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRectREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RectR
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRectWEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RectW
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRectWREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RectWR
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRoundREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RoundR
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRoundWEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RoundW
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRoundWREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RoundWR
-
-
-@dataclass(frozen=True, init=False)
-class GuardrailReflectorRoundYEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuardrailReflector_RoundY
-
-
-@dataclass(frozen=True, init=False)
-class GuidedSoftTargetEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.GuidedSoftTarget
-
-
-@dataclass(frozen=True, init=False)
-class HOWOT5GCementTruckEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HOWO_T5G_Cement_Truck
-
-
-@dataclass(frozen=True, init=False)
-class HinoBlueRibbonEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Hino_Blue_Ribbon
-
-
-@dataclass(frozen=True, init=False)
-class HondaPanEuropeanMotorcycleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Honda_Pan_European_Motorcycle
-
-
-@dataclass(frozen=True, init=False)
-class HondaPanEuropeanMotorcycleWithDriverEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Honda_Pan_European_Motorcycle_With_Driver
-
-
-@dataclass(frozen=True, init=False)
-class HouseModernEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseModern
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld1Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld1
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld2Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld2
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld3Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld3
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld4Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld4
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld5Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld5
-
-
-@dataclass(frozen=True, init=False)
-class HouseOld6Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.HouseOld6
-
-
-@dataclass(frozen=True, init=False)
-class Houses1930sEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Houses1930s
-
-
-@dataclass(frozen=True, init=False)
-class HyundaiIoniq5Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Hyundai_Ioniq5
-
-
-@dataclass(frozen=True, init=False)
-class Hyundaii30NLineEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Hyundai_i30_NLine
-
-
-@dataclass(frozen=True, init=False)
-class IsuzuDMaxEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Isuzu_DMax
-
-
-@dataclass(frozen=True, init=False)
-class IsuzuGigaFireTruckEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Isuzu_Giga_Fire_Truck
-
-
-@dataclass(frozen=True, init=False)
-class JACHFCSeriesEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.JAC_HFC_Series
-
-
-@dataclass(frozen=True, init=False)
-class JapaneseMaple10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.JapaneseMaple10y
-
-
-@dataclass(frozen=True, init=False)
-class JapaneseMaple20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.JapaneseMaple20y
-
-
-@dataclass(frozen=True, init=False)
-class JobyAviationS4Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Joby_Aviation_S4
-
-
-@dataclass(frozen=True, init=False)
-class KiaEV6Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Kia_EV6
-
-
-@dataclass(frozen=True, init=False)
-class KiaEV6wRoofRackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Kia_EV6_wRoofRack
-
-
-@dataclass(frozen=True, init=False)
-class KiaEV6wRoofRackSiemensEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Kia_EV6_wRoofRack_Siemens
-
-
-@dataclass(frozen=True, init=False)
-class LexusGS450hFSportSedanEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Lexus_GS_450h_F_Sport_Sedan
-
-
-@dataclass(frozen=True, init=False)
-class LexusLS600hFSportEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Lexus_LS_600h_F_Sport
-
-
-@dataclass(frozen=True, init=False)
-class LightPostEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.LightPost
-
-
-@dataclass(frozen=True, init=False)
-class Lilac10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Lilac10y
-
-
-@dataclass(frozen=True, init=False)
-class Lilac20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Lilac20y
-
-
-@dataclass(frozen=True, init=False)
-class Magnolia10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Magnolia10y
-
-
-@dataclass(frozen=True, init=False)
-class Magnolia20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Magnolia20y
-
-
-@dataclass(frozen=True, init=False)
-class Male200Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_200
-
-
-@dataclass(frozen=True, init=False)
-class MaleAfricanEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_African
-
-
-@dataclass(frozen=True, init=False)
-class MaleBendingEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Bending
-
-
-@dataclass(frozen=True, init=False)
-class MaleBendingOverEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_BendingOver
-
-
-@dataclass(frozen=True, init=False)
-class MaleCyclingCyclistEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_CyclingCyclist
-
-
-@dataclass(frozen=True, init=False)
-class MaleFemaleHandInHandEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Female_HandInHand
-
-
-@dataclass(frozen=True, init=False)
-class MaleLargeShoulderSuitcaseEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_LargeShoulderSuitcase
-
-
-@dataclass(frozen=True, init=False)
-class MaleLeaningEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Leaning
-
-
-@dataclass(frozen=True, init=False)
-class MaleLeaningBackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_LeaningBack
-
-
-@dataclass(frozen=True, init=False)
-class MaleLyingDownEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_LyingDown
-
-
-@dataclass(frozen=True, init=False)
-class MaleOldWhiteWithStickEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Old_White_WithStick
-
-
-@dataclass(frozen=True, init=False)
-class MaleOldWhiteWithWalkerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Old_White_WithWalker
-
-
-@dataclass(frozen=True, init=False)
-class MaleOldWhiteWithWalkerWithWheelsEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Old_White_WithWalkerWithWheels
-
-
-@dataclass(frozen=True, init=False)
-class MaleOverweightEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Overweight
-
-
-@dataclass(frozen=True, init=False)
-class MaleRegularEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Regular
-
-
-@dataclass(frozen=True, init=False)
-class MaleShoppingBagEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_ShoppingBag
-
-
-@dataclass(frozen=True, init=False)
-class MaleSittingEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_Sitting
-
-
-@dataclass(frozen=True, init=False)
-class MalewBackpackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wBackpack
-
-
-@dataclass(frozen=True, init=False)
-class MalewBicycleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wBicycle
-
-
-@dataclass(frozen=True, init=False)
-class MalewLargeBackpackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wLargeBackpack
-
-
-@dataclass(frozen=True, init=False)
-class MalewLongCoatEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wLongCoat
-
-
-@dataclass(frozen=True, init=False)
-class MalewRaincoatEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wRaincoat
-
-
-@dataclass(frozen=True, init=False)
-class MalewSuitEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wSuit
-
-
-@dataclass(frozen=True, init=False)
-class MalewSuitcaseEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Male_wSuitcase
+    class Houses1930sEntity(Entity): ...
 
+    class HyundaiIoniq5Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Man250Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Man_250
-
-
-@dataclass(frozen=True, init=False)
-class ManAsianEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Man_Asian
-
-
-@dataclass(frozen=True, init=False)
-class MazdaRX8CoupeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Mazda_RX8_Coupe
-
-
-@dataclass(frozen=True, init=False)
-class MercedesBenzActros1851LS4x2Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.MercedesBenz_Actros_1851_LS_4x2
-
-
-@dataclass(frozen=True, init=False)
-class MercedesBenzActros1860LS4x2Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.MercedesBenz_Actros_1860_LS_4x2
-
-
-@dataclass(frozen=True, init=False)
-class MercedesBenzActros2541L6x2Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.MercedesBenz_Actros_2541_L_6x2
-
-
-@dataclass(frozen=True, init=False)
-class MitsubishiOutlanderPHEVEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Mitsubishi_Outlander_PHEV
-
-
-@dataclass(frozen=True, init=False)
-class MonumentEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Monument
-
-
-@dataclass(frozen=True, init=False)
-class NCAPAdultEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_Adult
-
-
-@dataclass(frozen=True, init=False)
-class NCAPChildEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_Child
-
-
-@dataclass(frozen=True, init=False)
-class NCAPCyclistEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_Cyclist
-
-
-@dataclass(frozen=True, init=False)
-class NCAPEBTAEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_EBTA
-
-
-@dataclass(frozen=True, init=False)
-class NCAPGVTEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_GVT
-
-
-@dataclass(frozen=True, init=False)
-class NCAPMotorcycleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_Motorcycle
-
-
-@dataclass(frozen=True, init=False)
-class NCAPScooterEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_Scooter
-
-
-@dataclass(frozen=True, init=False)
-class NCAPStreetLightEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NCAP_StreetLight
-
-
-@dataclass(frozen=True, init=False)
-class NLAmbulanceVolvoXC60Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.NL_Ambulance_Volvo_XC60
-
-
-@dataclass(frozen=True, init=False)
-class NissanAriyaEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Nissan_Ariya
-
-
-@dataclass(frozen=True, init=False)
-class NissanCabstarBoxtruckEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Nissan_Cabstar_Boxtruck
-
-
-@dataclass(frozen=True, init=False)
-class OfficeBrownFlatEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OfficeBrownFlat
-
-
-@dataclass(frozen=True, init=False)
-class OfficeBrownTall1Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OfficeBrownTall1
-
-
-@dataclass(frozen=True, init=False)
-class OfficeBrownTall2Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OfficeBrownTall2
-
-
-@dataclass(frozen=True, init=False)
-class OfficeGreenTallEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OfficeGreenTall
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1LightJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Light_JP
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1LightKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Light_KR
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1LightNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Light_NL
+    class Hyundaii30NLineEntity(Entity): ...
 
+    class IsuzuDMaxEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Overhang1LightUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Light_US
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1PostJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Post_JP
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1PostKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Post_KR
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1PostNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Post_NL
-
-
-@dataclass(frozen=True, init=False)
-class Overhang1PostUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang1Post_US
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2LightsJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Lights_JP
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2LightsKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Lights_KR
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2LightsNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Lights_NL
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2LightsUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Lights_US
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2PostJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Post_JP
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2PostKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Post_KR
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2PostNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Post_NL
-
-
-@dataclass(frozen=True, init=False)
-class Overhang2PostUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Overhang2Post_US
-
+    class IsuzuGigaFireTruckEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class OverhangDH2LightsUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OverhangDH2Lights_US
-
-
-@dataclass(frozen=True, init=False)
-class OverhangDHPostUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.OverhangDHPost_US
-
-
-@dataclass(frozen=True, init=False)
-class PalletEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Pallet
-
-
-@dataclass(frozen=True, init=False)
-class PedestrianSignalJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PedestrianSignal_JP
-
-
-@dataclass(frozen=True, init=False)
-class Peterbilt579Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Peterbilt_579
-
-
-@dataclass(frozen=True, init=False)
-class Peterbilt579TrailerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Peterbilt_579_Trailer
-
-
-@dataclass(frozen=True, init=False)
-class PlasticBarrier100cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PlasticBarrier100cm
-
-
-@dataclass(frozen=True, init=False)
-class PrismSignV305070Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSignV_30_50_70
-
-
-@dataclass(frozen=True, init=False)
-class PrismSignV51015Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSignV_5_10_15
-
-
-@dataclass(frozen=True, init=False)
-class PrismSignV80100110Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSignV_80_100_110
+    class JACHFCSeriesEntity(Entity): ...
 
+    class JapaneseMaple10yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class PrismSign305070Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSign_30_50_70
-
-
-@dataclass(frozen=True, init=False)
-class PrismSign51015Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSign_5_10_15
+    class JapaneseMaple20yEntity(Entity): ...
 
+    class JobyAviationS4Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class PrismSign80100110Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.PrismSign_80_100_110
-
-
-@dataclass(frozen=True, init=False)
-class Pylon01Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Pylon_01
+    class KiaEV6Entity(Entity): ...
 
+    class KiaEV6wRoofRackEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Pylon02Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Pylon_02
+    class KiaEV6wRoofRackSiemensEntity(Entity): ...
 
+    class LexusGS450hFSportSedanEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ReflectorSignEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ReflectorSign
+    class LexusLS600hFSportEntity(Entity): ...
 
+    class LightPostEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ReflectorSignSimpleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ReflectorSignSimple
+    class Lilac10yEntity(Entity): ...
 
+    class Lilac20yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RivianR1TEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Rivian_R1T
+    class Magnolia10yEntity(Entity): ...
 
+    class Magnolia20yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RivianR1TwCoverEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Rivian_R1T_wCover
+    class Male200Entity(Entity): ...
 
+    class MaleAfricanEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RoadClosedwLightsEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.RoadClosed_wLights
+    class MaleBendingEntity(Entity): ...
 
+    class MaleBendingOverEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RoadsideLightNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.RoadsideLight_NL
+    class MaleCyclingCyclistEntity(Entity): ...
 
+    class MaleFemaleHandInHandEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RoadsideMarkerEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.RoadsideMarker
+    class MaleLargeShoulderSuitcaseEntity(Entity): ...
 
+    class MaleLeaningEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RoadsidePostEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.RoadsidePost
+    class MaleLeaningBackEntity(Entity): ...
 
+    class MaleLyingDownEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RoadsidePostNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.RoadsidePost_NL
+    class MaleOldWhiteWithStickEntity(Entity): ...
 
+    class MaleOldWhiteWithWalkerEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Roewe550SSedanEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Roewe_550_S_Sedan
+    class MaleOldWhiteWithWalkerWithWheelsEntity(Entity): ...
 
+    class MaleOverweightEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class RowCropTractorEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Row_Crop_Tractor
+    class MaleRegularEntity(Entity): ...
 
+    class MaleShoppingBagEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SchoolEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.School
+    class MaleSittingEntity(Entity): ...
 
+    class MalewBackpackEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ScooterEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Scooter
+    class MalewBicycleEntity(Entity): ...
 
+    class MalewLargeBackpackEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ScooterwBoxEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Scooter_wBox
+    class MalewLongCoatEntity(Entity): ...
 
+    class MalewRaincoatEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Serviceberry10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Serviceberry10y
+    class MalewSuitEntity(Entity): ...
 
+    class MalewSuitcaseEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Serviceberry15yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Serviceberry15y
+    class Man250Entity(Entity): ...
 
+    class ManAsianEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Serviceberry5yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Serviceberry5y
+    class MazdaRX8CoupeEntity(Entity): ...
 
+    class MercedesBenzActros1851LS4x2Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ShoppingCartEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ShoppingCart
+    class MercedesBenzActros1860LS4x2Entity(Entity): ...
 
+    class MercedesBenzActros2541L6x2Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SiemenseRodEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Siemens_eRod
+    class MitsubishiOutlanderPHEVEntity(Entity): ...
 
+    class MonumentEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing20cmNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing20cm_NL
+    class NCAPAdultEntity(Entity): ...
 
+    class NCAPChildEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing30cmDHUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing30cmDH_US
+    class NCAPCyclistEntity(Entity): ...
 
+    class NCAPEBTAEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing30cmJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing30cm_JP
+    class NCAPGVTEntity(Entity): ...
 
+    class NCAPMotorcycleEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing30cmNLEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing30cm_NL
+    class NCAPScooterEntity(Entity): ...
 
+    class NCAPStreetLightEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing30cmUSEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing30cm_US
+    class NLAmbulanceVolvoXC60Entity(Entity): ...
 
+    class NissanAriyaEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing330cmKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing3_30cm_KR
+    class NissanCabstarBoxtruckEntity(Entity): ...
 
+    class OfficeBrownFlatEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SignalCasing430cmKREntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SignalCasing4_30cm_KR
+    class OfficeBrownTall1Entity(Entity): ...
 
+    class OfficeBrownTall2Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SkywellEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Skywell
+    class OfficeGreenTallEntity(Entity): ...
 
+    class Overhang1LightJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SpeedBump250cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SpeedBump250cm
+    class Overhang1LightKREntity(Entity): ...
 
+    class Overhang1LightNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SpeedBump350cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SpeedBump350cm
+    class Overhang1LightUSEntity(Entity): ...
 
+    class Overhang1PostJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SportsBikeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Sports_Bike
+    class Overhang1PostKREntity(Entity): ...
 
+    class Overhang1PostNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SportsBikewDriverEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Sports_Bike_wDriver
+    class Overhang1PostUSEntity(Entity): ...
 
+    class Overhang2LightsJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SpringPost46cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SpringPost46cm
+    class Overhang2LightsKREntity(Entity): ...
 
+    class Overhang2LightsNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SpringPost75cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SpringPost75cm
+    class Overhang2LightsUSEntity(Entity): ...
 
+    class Overhang2PostJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SpringPost95cmEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SpringPost95cm
+    class Overhang2PostKREntity(Entity): ...
 
+    class Overhang2PostNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SuzukiHustlerHybridEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Suzuki_Hustler_Hybrid
+    class Overhang2PostUSEntity(Entity): ...
 
+    class OverhangDH2LightsUSEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TerracedHousesEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TerracedHouses
+    class OverhangDHPostUSEntity(Entity): ...
 
+    class PalletEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TeslaModel3Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Tesla_Model_3
+    class PedestrianSignalJPEntity(Entity): ...
 
+    class Peterbilt579Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TireHorizontalEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Tire_Horizontal
+    class Peterbilt579TrailerEntity(Entity): ...
 
+    class PlasticBarrier100cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TireVerticalEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Tire_Vertical
+    class PrismSignV305070Entity(Entity): ...
 
+    class PrismSignV51015Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class Toddler050Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Toddler_050
+    class PrismSignV80100110Entity(Entity): ...
 
+    class PrismSign305070Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ToyotaPreviaMPVEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Toyota_Previa_MPV
+    class PrismSign51015Entity(Entity): ...
 
+    class PrismSign80100110Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ToyotaPriusSedanEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Toyota_Prius_Sedan
+    class Pylon01Entity(Entity): ...
 
+    class Pylon02Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ToyotaYarisHatchbackEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Toyota_Yaris_Hatchback
+    class ReflectorSignEntity(Entity): ...
 
+    class ReflectorSignSimpleEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TrashBin240LEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TrashBin_240L
+    class RivianR1TEntity(Entity): ...
 
+    class RivianR1TwCoverEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TrashCanRnd130LEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TrashCan_Rnd_130L
+    class RoadClosedwLightsEntity(Entity): ...
 
+    class RoadsideLightNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TrashCanSqr160LEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TrashCan_Sqr_160L
+    class RoadsideMarkerEntity(Entity): ...
 
+    class RoadsidePostEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TriangleParkingSpaceLockEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TriangleParkingSpaceLock
+    class RoadsidePostNLEntity(Entity): ...
 
+    class Roewe550SSedanEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TurkishHazel10yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TurkishHazel10y
+    class RowCropTractorEntity(Entity): ...
 
+    class SchoolEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TurkishHazel20yEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TurkishHazel20y
+    class ScooterEntity(Entity): ...
 
+    class ScooterwBoxEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class USPoliceVolvoXC60Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.US_Police_Volvo_XC60
+    class Serviceberry10yEntity(Entity): ...
 
+    class Serviceberry15yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignal30cmFLJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignal30cm_FL_JP
+    class Serviceberry5yEntity(Entity): ...
 
+    class ShoppingCartEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignal30cmFRJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignal30cm_FR_JP
+    class SiemenseRodEntity(Entity): ...
 
+    class SignalCasing20cmNLEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignal30cmFJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignal30cm_F_JP
+    class SignalCasing30cmDHUSEntity(Entity): ...
 
+    class SignalCasing30cmJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignal30cmLJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignal30cm_L_JP
+    class SignalCasing30cmNLEntity(Entity): ...
 
+    class SignalCasing30cmUSEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignal30cmRJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignal30cm_R_JP
+    class SignalCasing330cmKREntity(Entity): ...
 
+    class SignalCasing430cmKREntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignalGreen30cmJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignalGreen30cm_JP
+    class SkywellEntity(Entity): ...
 
+    class SpeedBump250cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignalOrange30cmJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignalOrange30cm_JP
+    class SpeedBump350cmEntity(Entity): ...
 
+    class SportsBikeEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VehicleSignalRed30cmJPEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.VehicleSignalRed30cm_JP
+    class SportsBikewDriverEntity(Entity): ...
 
+    class SpringPost46cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VolvoFH16Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Volvo_FH16
+    class SpringPost75cmEntity(Entity): ...
 
+    class SpringPost95cmEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class VolvoXC60Entity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Volvo_XC60
+    class SuzukiHustlerHybridEntity(Entity): ...
 
+    class TerracedHousesEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WarehouseEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Warehouse
+    class TeslaModel3Entity(Entity): ...
 
+    class TireHorizontalEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WheatAEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Wheat_A
+    class TireVerticalEntity(Entity): ...
 
+    class Toddler050Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WheatBEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Wheat_B
+    class ToyotaPreviaMPVEntity(Entity): ...
 
+    class ToyotaPriusSedanEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WheatCEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Wheat_C
+    class ToyotaYarisHatchbackEntity(Entity): ...
 
+    class TrashBin240LEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WheelieBin1100LEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.WheelieBin_1100L
+    class TrashCanRnd130LEntity(Entity): ...
 
+    class TrashCanSqr160LEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WindmillEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Windmill
+    class TriangleParkingSpaceLockEntity(Entity): ...
 
+    class TurkishHazel10yEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WulingHongguangEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Wuling_Hongguang
+    class TurkishHazel20yEntity(Entity): ...
 
+    class USPoliceVolvoXC60Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ChurchEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Church
+    class VehicleSignal30cmFLJPEntity(Entity): ...
 
+    class VehicleSignal30cmFRJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class FactoryEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Factory
+    class VehicleSignal30cmFJPEntity(Entity): ...
 
+    class VehicleSignal30cmLJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ConcreteGuardrailEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.ConcreteGuardrail
+    class VehicleSignal30cmRJPEntity(Entity): ...
 
+    class VehicleSignalGreen30cmJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class GuardrailEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Guardrail
+    class VehicleSignalOrange30cmJPEntity(Entity): ...
 
+    class VehicleSignalRed30cmJPEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class FenceEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Fence
+    class VolvoFH16Entity(Entity): ...
 
+    class VolvoXC60Entity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class LinePlacedRoadImperfectionEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.LinePlacedRoadImperfection
+    class WarehouseEntity(Entity): ...
 
+    class WheatAEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SoundAbsorbingWallEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.SoundAbsorbingWall
+    class WheatBEntity(Entity): ...
 
+    class WheatCEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class WallEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Wall
+    class WheelieBin1100LEntity(Entity): ...
 
+    class WindmillEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class HouseEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.House
+    class WulingHongguangEntity(Entity): ...
 
+    class ChurchEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class OfficeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Office
+    class FactoryEntity(Entity): ...
 
+    class ConcreteGuardrailEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class BoxEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Box
+    class GuardrailEntity(Entity): ...
 
+    class FenceEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CapsuleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Capsule
+    class LinePlacedRoadImperfectionEntity(Entity): ...
 
+    class SoundAbsorbingWallEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class ConeEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cone
+    class WallEntity(Entity): ...
 
+    class HouseEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class CylinderEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Cylinder
+    class OfficeEntity(Entity): ...
 
+    class BoxEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class SphereEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Sphere
+    class CapsuleEntity(Entity): ...
 
+    class ConeEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TripodEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.Tripod
+    class CylinderEntity(Entity): ...
 
+    class SphereEntity(Entity): ...
 
-@dataclass(frozen=True, init=False)
-class TrafficSignPoleEntity(Entity):
-    @property
-    def object_type(self) -> ObjectType:
-        return ObjectType.TrafficSignPole
+    class TripodEntity(Entity): ...
+
+    class TrafficSignPoleEntity(Entity): ...
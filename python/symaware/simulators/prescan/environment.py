@@ -8,9 +8,11 @@ from symaware.base.utils import get_logger, log
 from ._symaware_prescan import (
     LogLevel,
     Road,
+    RoadNetwork,
     SimulationSpeed,
     _Environment,
     _Simulation,
+    _SimulationObserver,
 )
 from .dynamical_model import DynamicalModel
 from .entity import Entity, ExistingEntity
@@ -171,6 +173,52 @@ class Environment(BaseEnvironment):
         """
         self._internal_simulation.set_log_level(log_level)
 
+    def stats(self) -> "dict[str, np.ndarray | list[str]]":
+        """
+        Timing statistics of each phase of each component of the simulation, in nanoseconds.
+        They are only collected while profiling is enabled with :func:`set_profiling_enabled`.
+        The result is columnar, with one row for each (entity, component, phase) triplet:
+
+        - entity: name of the entity, empty for the simulation itself and for standalone models
+        - component: `simulation`, `entity`, `model`, `model_<i>` or `<sensor type>_<id>`
+        - phase: `register`, `initialise`, `step`, `terminate`, `pre_step`, `post_step` or `update_state`
+        - count, min, mean, p50, p90, p99, max: statistics of the measured durations
+
+        Returns
+        -------
+        Dictionary mapping each column to its values
+        """
+        return self._internal_simulation.stats()
+
+    def reset_stats(self):
+        """
+        Remove all the timing statistics collected so far
+        """
+        self._internal_simulation.reset_stats()
+
+    def add_observer(self, observer: _SimulationObserver):
+        """
+        Add an observer that will be notified after each simulation step,
+        e.g. a :class:`HistoryExporter` streaming the history of the simulation to disk.
+
+        Args
+        ----
+        observer:
+            observer to add to the simulation
+        """
+        self._internal_simulation.add_observer(observer)
+
+    def remove_observer(self, observer: _SimulationObserver):
+        """
+        Remove an observer from the simulation
+
+        Args
+        ----
+        observer:
+            observer to remove from the simulation
+        """
+        self._internal_simulation.remove_observer(observer)
+
     def _set_on_pre_step(self, callback: "Callable[[], None] | None"):
         """
         Set a callback to be called as the first operation at each simulation step.
@@ -256,6 +304,14 @@ class Environment(BaseEnvironment):
         """
         self._internal_environment.import_open_drive_network(filename)
 
+    @property
+    def road_network(self) -> RoadNetwork:
+        """
+        Road network imported with :meth:`import_open_drive_network`,
+        used to locate points on the lanes and navigate the lane graph
+        """
+        return self._internal_environment.road_network
+
     def add_free_viewer(self):
         """
         Add a free camera to the environment, to ease visualization
@@ -5,7 +5,7 @@ from typing import TYPE_CHECKING
 
 import numpy as np
 
-from ._symaware_prescan import SensorType, _Sensor
+from ._symaware_prescan import PointCloudFilter, SensorNoise, SensorType, TrackTable, _Sensor
 
 if TYPE_CHECKING:
     from typing import Generator
@@ -25,7 +25,23 @@ class Sensor(ABC):
     existing: bool = False
     _internal_sensor: _Sensor = None  # type: ignore
 
-    def __init__(self, setup: "np.ndarray | None" = None, existing: bool = False):
+    def __init__(
+        self,
+        setup: "np.ndarray | None" = None,
+        existing: bool = False,
+        noise: "SensorNoise.Setup | None" = None,
+    ):
+        """
+        Args
+        ----
+        setup:
+            setup of the sensor
+        existing:
+            whether the sensor is already attached to the object of the entity
+        noise:
+            if provided, the :attr:`data` of an AIR, BRS or LMS sensor is corrupted at each step.
+            Each simulation is a new episode of the noise
+        """
         object.__setattr__(self, "existing", existing)
         internal_sensor = (
             _Sensor(self.sensor_type, self.existing)
@@ -33,12 +49,30 @@ class Sensor(ABC):
             else _Sensor(self.sensor_type, setup, self.existing)
         )
         object.__setattr__(self, "_internal_sensor", internal_sensor)
+        if noise is not None:
+            self._internal_sensor.set_sensor_noise(noise)
 
     @property
     def setup(self) -> np.ndarray:
         """Setup used in the creation of this sensor"""
         return np.array(self._internal_sensor.setup)
 
+    @property
+    def noise(self) -> "SensorNoise | None":
+        """Noise corrupting the data of the sensor, None if there is none"""
+        return self._internal_sensor.sensor_noise
+
+    def set_noise_episode(self, episode: int):
+        """
+        Select the episode of the noise of the next simulation, e.g. to reproduce one of a campaign.
+
+        Args
+        ----
+        episode:
+            index of the episode
+        """
+        self._internal_sensor.set_noise_episode(episode)
+
     @property
     @abstractmethod
     def sensor_type(self) -> SensorType:
@@ -58,10 +92,51 @@ class AirSensor(Sensor):
     Air sensor in the Prescan simulator.
     """
 
+    def __init__(
+        self,
+        setup: "np.ndarray | None" = None,
+        existing: bool = False,
+        track_table: "TrackTable.Setup | None" = None,
+        noise: "SensorNoise.Setup | None" = None,
+    ):
+        """
+        Args
+        ----
+        setup:
+            setup of the sensor
+        existing:
+            whether the sensor is already attached to the object of the entity
+        track_table:
+            if provided, the objects detected by the sensor are tracked in the world frame at each step,
+            and made available in :attr:`tracks`
+        noise:
+            if provided, the :attr:`data` of the sensor is corrupted at each step.
+            The tracks still see the exact detections
+        """
+        super().__init__(setup, existing, noise)
+        if track_table is not None:
+            self._internal_sensor.set_track_table(track_table)
+
     @property
     def sensor_type(self) -> SensorType:
         return SensorType.AIR
 
+    @property
+    def tracks(self) -> TrackTable:
+        """
+        Objects detected by the sensor, with their last position, velocity and heading in the world frame.
+        ``np.asarray(sensor.tracks)`` is a (9, N) array with the id, last seen step, x, y, z, vx, vy, vz and heading
+        of each object.
+
+        Raises
+        ------
+        RuntimeError: if the sensor has no track table
+        """
+        track_table = self._internal_sensor.track_table
+        if track_table is None:
+            raise RuntimeError("The sensor has no track table")
+        return track_table
+
     @property
     def data(self) -> np.ndarray:
         """
@@ -160,10 +235,66 @@ class LmsSensor(Sensor):
         z: float
         curvature: float
 
+    def __init__(
+        self,
+        setup: "np.ndarray | None" = None,
+        existing: bool = False,
+        point_cloud_filter: "PointCloudFilter.Setup | None" = None,
+        noise: "SensorNoise.Setup | None" = None,
+    ):
+        """
+        Args
+        ----
+        setup:
+            setup of the sensor
+        existing:
+            whether the sensor is already attached to the object of the entity
+        point_cloud_filter:
+            if provided, the points seen by the sensor are moved to the world frame, downsampled
+            and stripped of the ground at each step, and made available in :attr:`point_cloud`
+        noise:
+            if provided, the :attr:`data` of the sensor is corrupted at each step.
+            The point cloud filter still sees the exact points
+        """
+        super().__init__(setup, existing, noise)
+        if point_cloud_filter is not None:
+            self._internal_sensor.set_point_cloud_filter(point_cloud_filter)
+
     @property
     def sensor_type(self) -> SensorType:
         return SensorType.LMS
 
+    @property
+    def point_cloud(self) -> np.ndarray:
+        """
+        Points seen by the sensor in the last step, processed by the point cloud filter.
+        Structured as an (N, 3) array with the x, y and z coordinates of each point in the world frame.
+
+        Raises
+        ------
+        RuntimeError: if the sensor has no point cloud filter
+        """
+        return self._point_cloud_filter.points
+
+    @property
+    def ground_plane(self) -> np.ndarray:
+        """
+        Coefficients (a, b, c, d) of the ground plane ax + by + cz + d = 0 found in the last step,
+        with (a, b, c) the unit normal pointing upwards. NaN if no ground plane was found.
+
+        Raises
+        ------
+        RuntimeError: if the sensor has no point cloud filter
+        """
+        return self._point_cloud_filter.ground_plane
+
+    @property
+    def _point_cloud_filter(self) -> PointCloudFilter:
+        point_cloud_filter = self._internal_sensor.point_cloud_filter
+        if point_cloud_filter is None:
+            raise RuntimeError("The sensor has no point cloud filter")
+        return point_cloud_filter
+
     @property
     def data(self) -> np.ndarray:
         """
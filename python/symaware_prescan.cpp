@@ -5,12 +5,15 @@ namespace py = pybind11;
 PYBIND11_MODULE(_symaware_prescan, m) {
   init_type(m);
   init_data(m);
+  init_transform(m);
+  init_map(m);
   init_api(m);
   init_sensor(m);
   init_model(m);
   init_environment(m);
   init_road(m);
   init_entity(m);
+  init_observer(m);
   init_simulation(m);
 
   m.doc() = "Python binding for the symaware prescan library";
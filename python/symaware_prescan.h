@@ -1,13 +1,91 @@
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "symaware/util/exception.h"
 
 #define STRINGIFY(x) #x
 #define MACRO_STRINGIFY(x) STRINGIFY(x)
 #define REPR_LAMBDA(class_name) [](const class_name &o) { return (std::stringstream{} << o).str(); }
 
+/**
+ * Contiguous array of doubles.
+ * Numpy arrays of doubles that already are C-contiguous are read in place, anything else is converted once
+ */
+using double_array = pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast>;
+
+/** Indices as a 1D array */
+inline pybind11::array_t<std::int64_t> index_array(const std::vector<std::size_t> &indices) {
+  pybind11::array_t<std::int64_t> array(static_cast<pybind11::ssize_t>(indices.size()));
+  std::int64_t *const data = array.mutable_data();
+  for (std::size_t i = 0; i < indices.size(); ++i) data[i] = static_cast<std::int64_t>(indices[i]);
+  return array;
+}
+/** Pairs of indices as an (N, 2) array */
+inline pybind11::array_t<std::int64_t> index_pair_array(const std::vector<std::pair<std::size_t, std::size_t>> &pairs) {
+  pybind11::array_t<std::int64_t> array({static_cast<pybind11::ssize_t>(pairs.size()), pybind11::ssize_t{2}});
+  std::int64_t *const data = array.mutable_data();
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    data[2 * i] = static_cast<std::int64_t>(pairs[i].first);
+    data[2 * i + 1] = static_cast<std::int64_t>(pairs[i].second);
+  }
+  return array;
+}
+
+/** Number of doubles in the struct @p T, e.g. Position or Pose, which must be made of doubles only */
+template <class T>
+constexpr pybind11::ssize_t struct_width() {
+  static_assert(std::is_standard_layout<T>::value && std::is_trivially_copyable<T>::value &&
+                    sizeof(T) % sizeof(double) == 0,
+                "The struct must be made of doubles only");
+  return static_cast<pybind11::ssize_t>(sizeof(T) / sizeof(double));
+}
+/** Value of a struct made of doubles as a 1D array */
+template <class T>
+pybind11::array_t<double> struct_row(const T &value) {
+  return pybind11::array_t<double>(struct_width<T>(), reinterpret_cast<const double *>(&value));
+}
+/** Values of a struct made of doubles as an (N, W) array, copied at once without creating any Python object */
+template <class T>
+pybind11::array_t<double> struct_array(const std::vector<T> &values) {
+  pybind11::array_t<double> array({static_cast<pybind11::ssize_t>(values.size()), struct_width<T>()});
+  if (!values.empty()) std::memcpy(array.mutable_data(), values.data(), values.size() * sizeof(T));
+  return array;
+}
+/**
+ * Values of a struct made of W doubles from anything convertible to an (N, W) array of numbers,
+ * or from a 1D array with the structured dtype of @p T, copied at once without creating any Python object
+ */
+template <class T>
+std::vector<T> struct_vector(const pybind11::handle &array) {
+  std::vector<T> values;
+  if (pybind11::isinstance<pybind11::array_t<T>>(array)) {
+    const auto structs = pybind11::array_t<T, pybind11::array::c_style | pybind11::array::forcecast>::ensure(array);
+    if (!structs) throw pybind11::error_already_set();
+    if (structs.ndim() != 1) SYMAWARE_OUT_OF_RANGE_FMT("Expected a 1D array, got {} dimensions", structs.ndim());
+    values.resize(static_cast<std::size_t>(structs.shape(0)));
+    if (!values.empty()) std::memcpy(values.data(), structs.data(), values.size() * sizeof(T));
+    return values;
+  }
+  const auto numbers = pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast>::ensure(array);
+  if (!numbers) throw pybind11::error_already_set();
+  if (numbers.ndim() != 2 || numbers.shape(1) != struct_width<T>())
+    SYMAWARE_OUT_OF_RANGE_FMT("Expected an (N, {}) array", struct_width<T>());
+  values.resize(static_cast<std::size_t>(numbers.shape(0)));
+  if (!values.empty()) std::memcpy(values.data(), numbers.data(), values.size() * sizeof(T));
+  return values;
+}
+
 void init_type(pybind11::module_ &);
 void init_data(pybind11::module_ &);
+void init_transform(pybind11::module_ &);
 void init_sensor(pybind11::module_ &);
 void init_model(pybind11::module_ &);
 void init_road(pybind11::module_ &);
@@ -15,3 +93,5 @@ void init_simulation(pybind11::module_ &);
 void init_environment(pybind11::module_ &);
 void init_api(pybind11::module_ &);
 void init_entity(pybind11::module_ &);
+void init_observer(pybind11::module_ &);
+void init_map(pybind11::module_ &);
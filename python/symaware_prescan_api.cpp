@@ -145,7 +145,7 @@ void init_api(py::module_& m) {
       .def("window_settings", &prescan::api::viewer::Viewer::windowSettings);
 
   py::class_<prescan::api::types::WorldObject>(m, "_WorldObject")
-      .def("remove", prescan::api::types::WorldObject::remove)
+      .def("remove", &prescan::api::types::WorldObject::remove)
       .def_property(
           "position",
           [](const prescan::api::types::WorldObject& self) {
@@ -7,6 +7,14 @@
 namespace py = pybind11;
 
 void init_data(py::module_ &m) {
+  // Arrays of these dtypes share the memory layout of std::vector, so that they can be converted at once
+  PYBIND11_NUMPY_DTYPE(symaware::Position, x, y, z);
+  PYBIND11_NUMPY_DTYPE(symaware::Orientation, roll, pitch, yaw);
+  PYBIND11_NUMPY_DTYPE(symaware::Pose, position, orientation);
+  PYBIND11_NUMPY_DTYPE(symaware::Velocity, x, y, z);
+  PYBIND11_NUMPY_DTYPE(symaware::Acceleration, x, y, z);
+  PYBIND11_NUMPY_DTYPE(symaware::AngularVelocity, roll, pitch, yaw);
+
   py::class_<symaware::Position>(m, "Position")
       .def(py::init<>())
       .def(py::init<double, double, double>(), py::arg("x"), py::arg("y"), py::arg("z"))
@@ -21,15 +29,10 @@ void init_data(py::module_ &m) {
       .def_readwrite("x", &symaware::Position::x)
       .def_readwrite("y", &symaware::Position::y)
       .def_readwrite("z", &symaware::Position::z)
-      .def("__array__",
-           [](const symaware::Position &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({3}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.x;
-             view(1) = self.y;
-             view(2) = self.z;
-             return a;
-           })
+      .def("__array__", [](const symaware::Position &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::Position>(); },
+          "Structured numpy dtype of the Position, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::Position));
   py::class_<symaware::Orientation>(m, "Orientation")
       .def(py::init<>())
@@ -45,15 +48,10 @@ void init_data(py::module_ &m) {
       .def_readwrite("roll", &symaware::Orientation::roll)
       .def_readwrite("pitch", &symaware::Orientation::pitch)
       .def_readwrite("yaw", &symaware::Orientation::yaw)
-      .def("__array__",
-           [](const symaware::Orientation &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({3}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.roll;
-             view(1) = self.pitch;
-             view(2) = self.yaw;
-             return a;
-           })
+      .def("__array__", [](const symaware::Orientation &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::Orientation>(); },
+          "Structured numpy dtype of the Orientation, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::Orientation));
   py::class_<symaware::Pose>(m, "Pose")
       .def(py::init<>())
@@ -69,18 +67,10 @@ void init_data(py::module_ &m) {
            py::arg("array"))
       .def_readwrite("position", &symaware::Pose::position)
       .def_readwrite("orientation", &symaware::Pose::orientation)
-      .def("__array__",
-           [](const symaware::Pose &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({6}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.position.x;
-             view(1) = self.position.y;
-             view(2) = self.position.z;
-             view(3) = self.orientation.roll;
-             view(4) = self.orientation.pitch;
-             view(5) = self.orientation.yaw;
-             return a;
-           })
+      .def("__array__", [](const symaware::Pose &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::Pose>(); },
+          "Structured numpy dtype of the Pose, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::Pose));
   py::class_<symaware::Velocity>(m, "Velocity")
       .def(py::init<>())
@@ -96,15 +86,10 @@ void init_data(py::module_ &m) {
       .def_readwrite("x", &symaware::Velocity::x)
       .def_readwrite("y", &symaware::Velocity::y)
       .def_readwrite("z", &symaware::Velocity::z)
-      .def("__array__",
-           [](const symaware::Velocity &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({3}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.x;
-             view(1) = self.y;
-             view(2) = self.z;
-             return a;
-           })
+      .def("__array__", [](const symaware::Velocity &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::Velocity>(); },
+          "Structured numpy dtype of the Velocity, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::Velocity));
   py::class_<symaware::Acceleration>(m, "Acceleration")
       .def(py::init<>())
@@ -120,15 +105,10 @@ void init_data(py::module_ &m) {
       .def_readwrite("x", &symaware::Acceleration::x)
       .def_readwrite("y", &symaware::Acceleration::y)
       .def_readwrite("z", &symaware::Acceleration::z)
-      .def("__array__",
-           [](const symaware::Acceleration &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({3}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.x;
-             view(1) = self.y;
-             view(2) = self.z;
-             return a;
-           })
+      .def("__array__", [](const symaware::Acceleration &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::Acceleration>(); },
+          "Structured numpy dtype of the Acceleration, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::Acceleration));
   py::class_<symaware::AngularVelocity>(m, "AngularVelocity")
       .def(py::init<>())
@@ -144,14 +124,9 @@ void init_data(py::module_ &m) {
       .def_readwrite("roll", &symaware::AngularVelocity::roll)
       .def_readwrite("pitch", &symaware::AngularVelocity::pitch)
       .def_readwrite("yaw", &symaware::AngularVelocity::yaw)
-      .def("__array__",
-           [](const symaware::AngularVelocity &self) -> py::array_t<double> {
-             py::array_t a = py::array_t<double>({3}, {sizeof(double)});
-             auto view = a.mutable_unchecked<1>();
-             view(0) = self.roll;
-             view(1) = self.pitch;
-             view(2) = self.yaw;
-             return a;
-           })
+      .def("__array__", [](const symaware::AngularVelocity &self) { return struct_row(self); })
+      .def_property_readonly_static(
+          "dtype", [](const py::object &) { return py::dtype::of<symaware::AngularVelocity>(); },
+          "Structured numpy dtype of the AngularVelocity, to store many of them in a single array")
       .def("__repr__", REPR_LAMBDA(symaware::AngularVelocity));
 }
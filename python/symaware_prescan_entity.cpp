@@ -102,6 +102,10 @@ void init_entity(py::module_& m) {
            py::arg("entity_model") = static_cast<symaware::EntityModel*>(nullptr))
       .def("remove", &symaware::Entity::remove, "Remove the object from the experiment")
       .def("add_sensor", &symaware::Entity::addSensor, py::arg("sensor"))
+      .def("set_sensor_fusion", &symaware::Entity::setSensorFusion, py::arg("setup"),
+           "Fuse the detections of the AIR and BRS sensors of the entity at each step")
+      .def("clear_sensor_fusion", &symaware::Entity::clearSensorFusion,
+           "Stop fusing the detections of the sensors of the entity")
       .def("apply_setup", py::overload_cast<>(&symaware::Entity::applySetup))
       .def("apply_setup", py::overload_cast<symaware::Entity::Setup>(&symaware::Entity::applySetup), py::arg("setup"))
       .def("initialise_object", &symaware::Entity::initialiseObject, py::arg("experiment"), py::arg("object"))
@@ -116,5 +120,8 @@ void init_entity(py::module_& m) {
       .def_property_readonly("setup", &symaware::Entity::setup, "Get the current initial setup of the entity")
       .def_property_readonly("type", &symaware::Entity::type, "Get the type of the entity")
       .def_property_readonly("object", &symaware::Entity::object, "Get the worldobject wrapped by the entity")
+      .def_property_readonly("sensor_fusion", &symaware::Entity::sensorFusion,
+                             py::return_value_policy::reference_internal,
+                             "Fusion of the detections of the sensors of the entity, None if there is none")
       .def("__repr__", REPR_LAMBDA(symaware::Entity));
 }
@@ -1,6 +1,9 @@
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "symaware/prescan/entity.h"
 #include "symaware/prescan/environment.h"
@@ -32,10 +35,61 @@ void init_environment(py::module_ &m) {
            "Add an entity to the environment", py::arg("entity"))
       .def("add_entity", py::overload_cast<const std::string &, symaware::Entity &>(&symaware::Environment::addEntity),
            "Collect an existing entity from the experiment", py::arg("name"), py::arg("entity"))
+      .def("add_entities",
+           py::overload_cast<const std::vector<symaware::Entity *> &>(&symaware::Environment::addEntities),
+           "Add many entities to the environment at once", py::arg("entities"))
+      .def(
+          "add_entities",
+          [](symaware::Environment &self, py::array_t<int, py::array::c_style | py::array::forcecast> object_types,
+             const py::object &poses, const bool is_collision_detectable, const bool is_movable,
+             const prescan::api::types::SensorDetectability sensor_detectability) {
+            if (object_types.ndim() != 1)
+              SYMAWARE_OUT_OF_RANGE_FMT("Expected a 1D array of object types, got {} dimensions", object_types.ndim());
+            const std::vector<symaware::Pose> setup_poses = struct_vector<symaware::Pose>(poses);
+            if (static_cast<py::ssize_t>(setup_poses.size()) != object_types.shape(0))
+              SYMAWARE_OUT_OF_RANGE_FMT("Expected {} poses, got {}", object_types.shape(0), setup_poses.size());
+
+            const auto types = object_types.unchecked<1>();
+            std::vector<std::unique_ptr<symaware::Entity>> entities;
+            std::vector<symaware::Entity *> pointers;
+            entities.reserve(types.shape(0));
+            pointers.reserve(types.shape(0));
+            for (py::ssize_t i = 0; i < types.shape(0); ++i) {
+              if (types(i) < 0 || types(i) > static_cast<int>(symaware::ObjectType::TrafficSignPole) ||
+                  types(i) == static_cast<int>(symaware::ObjectType::Existing))
+                SYMAWARE_OUT_OF_RANGE_FMT("Invalid object type {} at index {}", types(i), i);
+              entities.emplace_back(std::make_unique<symaware::Entity>(
+                  static_cast<symaware::ObjectType>(types(i)),
+                  symaware::Entity::Setup{setup_poses[i].position, setup_poses[i].orientation,
+                                          symaware::Position{0, 0, 0}, is_collision_detectable, is_movable,
+                                          sensor_detectability},
+                  nullptr));
+              pointers.push_back(entities.back().get());
+            }
+            self.addEntities(pointers);
+
+            // The entities are owned by the returned tuple, which is kept alive by the environment
+            py::tuple result{entities.size()};
+            for (std::size_t i = 0; i < entities.size(); ++i)
+              result[i] = py::cast(entities[i].release(), py::return_value_policy::take_ownership);
+            return result;
+          },
+          "Create and add many entities to the environment at once, given their object types and their poses, "
+          "as an (N, 6) array of (x, y, z, roll, pitch, yaw) or an array with the Pose dtype",
+          py::arg("object_types"), py::arg("poses"), py::arg("is_collision_detectable") = true,
+          py::arg("is_movable") = true,
+          py::arg_v("sensor_detectability", prescan::api::types::SensorDetectability::SensorDetectabilityDetectable,
+                    "SensorDetectability.SensorDetectabilityDetectable"),
+          py::keep_alive<1, 0>())
       .def("remove_entity", py::overload_cast<symaware::Entity &>(&symaware::Environment::removeEntity),
            "Add an entity to the environment", py::arg("entity"))
       .def("remove_entity", py::overload_cast<const std::string &>(&symaware::Environment::removeEntity),
            "Add an entity to the environment", py::arg("name"))
+      .def("set_pooling", &symaware::Environment::setPooling,
+           "Enable or disable the pooling of the objects of removed entities.\n"
+           "The sensors and the model of a parked object stay in the experiment and are still simulated",
+           py::arg("pooling"))
+      .def("clear_pool", &symaware::Environment::clearPool, "Remove all the parked objects from the experiment")
       .def("add_road", &symaware::Environment::addRoad, "Add a road to the environment",
            py::arg_v("position", symaware::Position{true}, "Position(true)"))
       .def("add_free_viewer", &symaware::Environment::addFreeViewer, "Add a free viewer in the environment")
@@ -45,5 +99,11 @@ void init_environment(py::module_ &m) {
       .def("save_experiment", &symaware::Environment::saveExperiment, "Save the experiment to file",
            py::arg("filename"))
 
-      .def_property_readonly("experiment", &symaware::Environment::experiment, "Get the experiment of the environment");
+      .def_property_readonly("experiment", &symaware::Environment::experiment, "Get the experiment of the environment")
+      .def_property_readonly("pooling", &symaware::Environment::pooling,
+                             "Whether the objects of removed entities are parked to be reused")
+      .def_property_readonly("pooled_count", &symaware::Environment::pooledCount,
+                             "Number of parked objects waiting to be reused")
+      .def_property_readonly("road_network", &symaware::Environment::roadNetwork,
+                             "Get the road network imported in the environment");
 }
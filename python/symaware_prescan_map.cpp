@@ -0,0 +1,259 @@
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/frenet_transform.h"
+#include "symaware/map/reference_line.h"
+#include "symaware/map/road_network.h"
+#include "symaware/map/router.h"
+#include "symaware/map/spatial_hash.h"
+#include "symaware/prescan/data.h"
+#include "symaware_prescan.h"
+
+namespace py = pybind11;
+
+namespace {
+
+/** Samples of a reference line as an (N, 5) array with columns s, x, y, heading and curvature */
+py::array_t<double> samples_array(const symaware::ReferenceLine::Samples &samples) {
+  const auto n = static_cast<py::ssize_t>(samples.size());
+  py::array_t<double> array({n, static_cast<py::ssize_t>(5)});
+  auto view = array.mutable_unchecked<2>();
+  for (py::ssize_t i = 0; i < n; ++i) {
+    const auto j = static_cast<std::size_t>(i);
+    view(i, 0) = samples.s[j];
+    view(i, 1) = samples.x[j];
+    view(i, 2) = samples.y[j];
+    view(i, 3) = samples.heading[j];
+    view(i, 4) = samples.curvature[j];
+  }
+  return array;
+}
+
+/** Contiguous array the input is converted to, if needed */
+template <class T>
+using InputArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/** Frenet coordinates of an (N, 3) array of poses, as the tuple (s, d, heading_error, lane, road) */
+py::tuple to_frenet(const symaware::FrenetTransform &transform, const InputArray<double> &poses) {
+  if (poses.ndim() != 2 || poses.shape(1) != 3) throw py::value_error("poses must be an (N, 3) array");
+  const py::ssize_t n = poses.shape(0);
+  py::array_t<double> s(n), d(n), heading_error(n);
+  py::array_t<int> lane(n);
+  std::vector<std::size_t> roads(static_cast<std::size_t>(n));
+  {
+    py::gil_scoped_release release;
+    transform.toFrenet(poses.data(), static_cast<std::size_t>(n), s.mutable_data(), d.mutable_data(),
+                       heading_error.mutable_data(), lane.mutable_data(), roads.data());
+  }
+  // Poses that could not be transformed are marked by road -1
+  py::array_t<std::int64_t> road(n);
+  std::int64_t *const road_data = road.mutable_data();
+  for (std::size_t i = 0; i < roads.size(); ++i)
+    road_data[i] = roads[i] == symaware::FrenetTransform::npos ? -1 : static_cast<std::int64_t>(roads[i]);
+  return py::make_tuple(s, d, heading_error, lane, road);
+}
+
+/** Cartesian poses of the Frenet coordinates, as an (N, 3) array with columns x, y and heading */
+py::array_t<double> from_frenet(const symaware::FrenetTransform &transform, const InputArray<double> &s,
+                                const InputArray<double> &d, const std::optional<InputArray<std::int64_t>> &road) {
+  if (s.size() != d.size() || (road && road->size() != s.size()))
+    throw py::value_error("s, d and road must have the same size");
+  const auto n = static_cast<std::size_t>(s.size());
+  std::vector<std::size_t> roads(n, 0);
+  if (road) {
+    const std::int64_t *const road_data = road->data();
+    for (std::size_t i = 0; i < n; ++i) roads[i] = static_cast<std::size_t>(road_data[i]);
+  }
+  py::array_t<double> poses({static_cast<py::ssize_t>(n), static_cast<py::ssize_t>(3)});
+  transform.fromFrenet(roads.data(), s.data(), d.data(), n, poses.mutable_data());
+  return poses;
+}
+
+}  // namespace
+
+void init_map(py::module_ &m) {
+  py::class_<symaware::ReferenceLine>(m, "ReferenceLine")
+      .def(py::init<double, double, double>(), py::arg("x") = 0, py::arg("y") = 0, py::arg("heading") = 0)
+      .def("add_line", &symaware::ReferenceLine::addLine, "Chain a straight line", py::arg("length"))
+      .def("add_arc", &symaware::ReferenceLine::addArc, "Chain an arc", py::arg("length"), py::arg("curvature"))
+      .def("add_spiral", &symaware::ReferenceLine::addSpiral, "Chain a clothoid", py::arg("length"),
+           py::arg("curvature_start"), py::arg("curvature_end"))
+      .def("add_poly3", &symaware::ReferenceLine::addPoly3, "Chain a cubic polynomial", py::arg("length"),
+           py::arg("a"), py::arg("b"), py::arg("c"), py::arg("d"))
+      .def("add_param_poly3", &symaware::ReferenceLine::addParamPoly3, "Chain parametric cubic polynomials",
+           py::arg("length"), py::arg("u"), py::arg("v"), py::arg("normalized"))
+      .def("set_origin", &symaware::ReferenceLine::setOrigin, "Move the origin of the reference line", py::arg("x"),
+           py::arg("y"), py::arg("heading"))
+      .def(
+          "point",
+          [](const symaware::ReferenceLine &line, double s) {
+            const symaware::ReferenceLine::Point point = line.point(s);
+            return py::make_tuple(point.x, point.y, point.heading, point.curvature);
+          },
+          "Point of the reference line at the arc length s, as (x, y, heading, curvature)", py::arg("s"))
+      .def(
+          "sample",
+          [](const symaware::ReferenceLine &line,
+             const py::array_t<double, py::array::c_style | py::array::forcecast> &s) {
+            const double *const data = s.data();
+            return samples_array(line.sample(std::vector<double>(data, data + s.size())));
+          },
+          "Sample the reference line at the given arc lengths. Columns are s, x, y, heading and curvature",
+          py::arg("s"))
+      .def(
+          "sample_uniform",
+          [](const symaware::ReferenceLine &line, double step) { return samples_array(line.sampleUniform(step)); },
+          "Sample the reference line every step metres. Columns are s, x, y, heading and curvature", py::arg("step"))
+      .def("project", &symaware::ReferenceLine::project, "Project a point onto the reference line, returning (s, t)",
+           py::arg("x"), py::arg("y"), py::arg("s"))
+      .def_property_readonly("start", &symaware::ReferenceLine::start)
+      .def_property_readonly("end", &symaware::ReferenceLine::end)
+      .def_property_readonly("length", &symaware::ReferenceLine::length);
+
+  py::class_<symaware::RoadNetwork::LaneLocation>(m, "LaneLocation")
+      .def_readonly("road", &symaware::RoadNetwork::LaneLocation::road, "Index of the road")
+      .def_readonly("section", &symaware::RoadNetwork::LaneLocation::section, "Index of the lane section in the road")
+      .def_readonly("lane", &symaware::RoadNetwork::LaneLocation::lane, "Id of the lane")
+      .def_readonly("node", &symaware::RoadNetwork::LaneLocation::node, "Index of the lane in the lane graph")
+      .def_readonly("s", &symaware::RoadNetwork::LaneLocation::s, "Arc length along the reference line")
+      .def_readonly("t", &symaware::RoadNetwork::LaneLocation::t, "Lateral offset from the reference line")
+      .def("__repr__", REPR_LAMBDA(symaware::RoadNetwork::LaneLocation));
+
+  py::class_<symaware::RoadNetwork>(m, "RoadNetwork")
+      .def(py::init<double, double>(), py::arg("sample_step") = 1, py::arg("cell_size") = 8)
+      .def("import_open_drive_file", &symaware::RoadNetwork::importOpenDriveFile,
+           "Import the roads and junctions of an OpenDRIVE file", py::arg("filename"))
+      .def("import_open_drive", &symaware::RoadNetwork::importOpenDrive,
+           "Import the roads and junctions of an OpenDRIVE document", py::arg("content"))
+      .def("clear", &symaware::RoadNetwork::clear, "Remove all the roads and junctions")
+      .def("locate", py::overload_cast<double, double>(&symaware::RoadNetwork::locate, py::const_),
+           "Locate a point in the lanes of the network. Return None if the point is not on any lane", py::arg("x"),
+           py::arg("y"))
+      .def("locate_all", &symaware::RoadNetwork::locateAll, "Locate a point in all the lanes it lies on",
+           py::arg("x"), py::arg("y"))
+      .def(
+          "road_id", [](const symaware::RoadNetwork &network, std::size_t road) { return network.roads().at(road).id; },
+          "Id of the road with the given index", py::arg("road"))
+      .def(
+          "reference_line",
+          [](const symaware::RoadNetwork &network, std::size_t road) -> const symaware::ReferenceLine & {
+            return network.roads().at(road).reference_line;
+          },
+          py::return_value_policy::reference_internal, "Reference line of the road with the given index",
+          py::arg("road"))
+      .def("road_index", &symaware::RoadNetwork::roadIndex, "Index of the road with the given id", py::arg("id"))
+      .def(
+          "successors",
+          [](const symaware::RoadNetwork &network, std::size_t node) { return network.lanes().at(node).successors; },
+          "Lanes that can be entered at the end of the given one", py::arg("node"))
+      .def(
+          "predecessors",
+          [](const symaware::RoadNetwork &network, std::size_t node) { return network.lanes().at(node).predecessors; },
+          "Lanes the given one can be entered from", py::arg("node"))
+      .def_property_readonly("num_roads", [](const symaware::RoadNetwork &network) { return network.roads().size(); })
+      .def_property_readonly("num_lanes", [](const symaware::RoadNetwork &network) { return network.lanes().size(); })
+      .def("__repr__", REPR_LAMBDA(symaware::RoadNetwork));
+
+  py::class_<symaware::FrenetTransform>(m, "FrenetTransform")
+      .def(py::init<symaware::ReferenceLine, std::vector<double>, std::vector<double>, double, double>(),
+           py::arg("line"), py::arg("left_widths") = std::vector<double>{},
+           py::arg("right_widths") = std::vector<double>{}, py::arg("max_offset") = 50, py::arg("step") = 1)
+      .def(py::init<const symaware::RoadNetwork &>(), py::arg("network"), py::keep_alive<1, 2>())
+      .def("to_frenet", &to_frenet,
+           "Transform an (N, 3) array of poses x, y, heading into the arrays (s, d, heading_error, lane, road). "
+           "Poses that cannot be transformed get NaN coordinates and road -1",
+           py::arg("poses"))
+      .def("from_frenet", &from_frenet,
+           "Transform Frenet coordinates into an (N, 3) array of poses x, y, heading. "
+           "The road is only needed when transforming on a road network",
+           py::arg("s"), py::arg("d"), py::arg("road") = py::none())
+      .def_property("threads", &symaware::FrenetTransform::threads, &symaware::FrenetTransform::setThreads)
+      .def_property_readonly("max_offset", &symaware::FrenetTransform::max_offset);
+
+  py::class_<symaware::Router::Route>(m, "Route")
+      .def_readonly("lanes", &symaware::Router::Route::lanes, "Lanes traversed by the route, in the lane graph")
+      .def_property_readonly(
+          "waypoints",
+          [](const symaware::Router::Route &route) {
+            py::array_t<double> array({static_cast<py::ssize_t>(route.waypoints.size()), static_cast<py::ssize_t>(3)});
+            auto view = array.mutable_unchecked<2>();
+            for (py::ssize_t i = 0; i < view.shape(0); ++i) {
+              const symaware::Router::Waypoint &waypoint = route.waypoints[static_cast<std::size_t>(i)];
+              view(i, 0) = waypoint.x;
+              view(i, 1) = waypoint.y;
+              view(i, 2) = waypoint.z;
+            }
+            return array;
+          },
+          "Waypoints of the route as an (N, 3) array")
+      .def_property_readonly(
+          "path",
+          [](const symaware::Router::Route &route) {
+            std::vector<symaware::Position> path;
+            path.reserve(route.waypoints.size());
+            for (const symaware::Router::Waypoint &waypoint : route.waypoints)
+              path.emplace_back(waypoint.x, waypoint.y, waypoint.z);
+            return path;
+          },
+          "Waypoints of the route as positions, ready to be used as the path of a track model")
+      .def_readonly("length", &symaware::Router::Route::length, "Distance driven along the waypoints")
+      .def_readonly("lane_changes", &symaware::Router::Route::lane_changes, "Number of lane changes")
+      .def("__repr__", REPR_LAMBDA(symaware::Router::Route));
+
+  py::class_<symaware::Router>(m, "Router")
+      .def(py::init<const symaware::RoadNetwork &, double, double, double, std::size_t>(), py::arg("network"),
+           py::arg("lane_change_cost") = 20, py::arg("lane_change_length") = 20, py::arg("waypoint_step") = 2,
+           py::arg("cache_capacity") = 1024, py::keep_alive<1, 2>())
+      .def("route", py::overload_cast<double, double, double, double>(&symaware::Router::route),
+           "Shortest route between two points. Return None if there is no route", py::arg("from_x"),
+           py::arg("from_y"), py::arg("to_x"), py::arg("to_y"))
+      .def("route",
+           py::overload_cast<const symaware::RoadNetwork::LaneLocation &, const symaware::RoadNetwork::LaneLocation &>(
+               &symaware::Router::route),
+           "Shortest route between two locations. Return None if there is no route", py::arg("start"),
+           py::arg("destination"))
+      .def("clear_cache", &symaware::Router::clearCache, "Remove all the routes from the cache")
+      .def_property_readonly("cache_size", &symaware::Router::cache_size)
+      .def_property_readonly("cache_hits", &symaware::Router::cache_hits)
+      .def_property_readonly("cache_misses", &symaware::Router::cache_misses)
+      .def("__repr__", REPR_LAMBDA(symaware::Router));
+
+  py::class_<symaware::SpatialHash>(m, "SpatialHash")
+      .def(py::init<double>(), py::arg("cell_size") = 10)
+      .def(
+          "build",
+          [](symaware::SpatialHash &self, const InputArray<double> &x, const InputArray<double> &y) {
+            if (x.ndim() != 1 || y.ndim() != 1 || x.size() != y.size())
+              throw py::value_error("x and y must be 1D arrays with the same size");
+            self.build(x.data(), y.data(), static_cast<std::size_t>(x.size()));
+          },
+          "Replace the points in the grid with the ones with coordinates x and y", py::arg("x"), py::arg("y"))
+      .def("clear", &symaware::SpatialHash::clear, "Remove all the points from the grid")
+      .def(
+          "query_radius",
+          [](const symaware::SpatialHash &self, double x, double y, double radius) {
+            return index_array(self.queryRadius(x, y, radius));
+          },
+          "Indices of the points within radius from (x, y), sorted by increasing distance", py::arg("x"),
+          py::arg("y"), py::arg("radius"))
+      .def(
+          "query_nearest",
+          [](const symaware::SpatialHash &self, double x, double y, std::size_t k) {
+            return index_array(self.queryNearest(x, y, k));
+          },
+          "Indices of the k points closest to (x, y), sorted by increasing distance", py::arg("x"), py::arg("y"),
+          py::arg("k"))
+      .def(
+          "query_pairs",
+          [](const symaware::SpatialHash &self, double distance) {
+            return index_pair_array(self.queryPairs(distance));
+          },
+          "(N, 2) array of the indices of the pairs of points closer than distance", py::arg("distance"))
+      .def_property_readonly("cell_size", &symaware::SpatialHash::cell_size)
+      .def("__len__", &symaware::SpatialHash::size);
+}
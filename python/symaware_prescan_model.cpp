@@ -8,6 +8,19 @@
 
 namespace py = pybind11;
 
+namespace {
+/**
+ * Read-only numpy array viewing the @p size values at @p data, without copying them.
+ * The view is only valid as long as the buffer is, i.e. for the duration of the call it is passed to.
+ */
+py::array_t<double> readonlyView(const double* data, std::size_t size) {
+  py::array_t<double> view{{static_cast<py::ssize_t>(size)}, {static_cast<py::ssize_t>(sizeof(double))}, data,
+                           py::none()};
+  py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  return view;
+}
+}  // namespace
+
 class PyEntityModel : public symaware::EntityModel {
  public:
   using symaware::EntityModel::EntityModel;
@@ -15,11 +28,12 @@ class PyEntityModel : public symaware::EntityModel {
   void createIfNotExists(prescan::api::experiment::Experiment& experiment) override {
     PYBIND11_OVERRIDE_NAME(void, symaware::EntityModel, "create_if_not_exists", createIfNotExists, experiment);
   }
-  void setInput(const std::vector<double>& input) override {
-    PYBIND11_OVERRIDE_PURE_NAME(void, symaware::EntityModel, "set_input", setInput, input);
+  void setInput(const double* input, std::size_t size) override {
+    PYBIND11_OVERRIDE_PURE_NAME(void, symaware::EntityModel, "set_input", setInput, readonlyView(input, size));
   }
-  void updateInput(const std::vector<double>& input) override {
-    PYBIND11_OVERRIDE_PURE_NAME(void, symaware::EntityModel, "update_input", updateInput, input);
+  void updateInput(const double* input, std::size_t size) override {
+    PYBIND11_OVERRIDE_PURE_NAME(void, symaware::EntityModel, "update_input", updateInput,
+                                readonlyView(input, size));
   }
   void registerUnit(const prescan::api::experiment::Experiment& experiment,
                     prescan::sim::ISimulation* simulation) override {
@@ -49,8 +63,18 @@ void init_model(py::module_& m) {
            py::arg("entity"), "Link the model to the entity")
       .def("create_if_not_exists", &symaware::EntityModel::createIfNotExists, py::arg("experiment"),
            "Initialise the object of the model")
-      .def("set_input", &symaware::EntityModel::setInput, py::arg("input"), "Set the input of the model")
-      .def("update_input", &symaware::EntityModel::updateInput, py::arg("input"), "Update the input of the model")
+      .def(
+          "set_input",
+          [](symaware::EntityModel& model, const double_array& input) {
+            model.setInput(input.data(), static_cast<std::size_t>(input.size()));
+          },
+          py::arg("input"), "Set the input of the model")
+      .def(
+          "update_input",
+          [](symaware::EntityModel& model, const double_array& input) {
+            model.updateInput(input.data(), static_cast<std::size_t>(input.size()));
+          },
+          py::arg("input"), "Update the input of the model")
       .def("register_unit", &symaware::EntityModel::registerUnit, py::arg("experiment"), py::arg("simulation"),
            "Register the unit of the model")
       .def("initialise", &symaware::EntityModel::initialise, py::arg("simulation"),
@@ -69,9 +93,23 @@ void init_model(py::module_& m) {
       .def(py::init<>())
       .def(py::init<bool, bool, std::vector<symaware::Position>, double, double>(), py::arg("existing"),
            py::arg("active"), py::arg("path"), py::arg("speed"), py::arg("tolerance"))
+      .def(py::init([](bool existing, bool active, const py::array& path, double speed, double tolerance) {
+             return symaware::TrackModel::Setup{existing, active, struct_vector<symaware::Position>(path), speed,
+                                                tolerance};
+           }),
+           py::arg("existing"), py::arg("active"), py::arg("path"), py::arg("speed"), py::arg("tolerance"),
+           "Initialise with the path given as an (N, 3) array of positions or an array with the Position dtype")
+      .def(py::init<bool, bool, const symaware::Router::Route&, double, double>(), py::arg("existing"),
+           py::arg("active"), py::arg("route"), py::arg("speed"), py::arg("tolerance"))
       .def_readwrite("existing", &symaware::TrackModel::Setup::existing)
       .def_readwrite("active", &symaware::TrackModel::Setup::active)
       .def_readwrite("path", &symaware::TrackModel::Setup::path)
+      .def_property(
+          "path_array", [](const symaware::TrackModel::Setup& self) { return struct_array(self.path); },
+          [](symaware::TrackModel::Setup& self, const py::object& path) {
+            self.path = struct_vector<symaware::Position>(path);
+          },
+          "Path as an (N, 3) array of positions. Set it with an (N, 3) array or an array with the Position dtype")
       .def_readwrite("speed", &symaware::TrackModel::Setup::speed)
       .def_readwrite("tolerance", &symaware::TrackModel::Setup::tolerance);
 
@@ -111,22 +149,16 @@ void init_model(py::module_& m) {
       .def(py::init<const symaware::TrackModel::Setup&>(), py::arg("setup"))
       .def(
           "set_input",
-          [](symaware::TrackModel& model, const py::array_t<double>& input) {
+          [](symaware::TrackModel& model, const double_array& input) {
             if (input.size() != 6) throw std::invalid_argument("Input must have 6 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.setInput(input_vector);
+            model.setInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def(
           "update_input",
-          [](symaware::TrackModel& model, const py::array_t<double>& input) {
+          [](symaware::TrackModel& model, const double_array& input) {
             if (input.size() != 6) throw std::invalid_argument("Input must have 6 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.updateInput(input_vector);
+            model.updateInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def("set_input", py::overload_cast<symaware::TrackModel::Input>(&symaware::TrackModel::setInput),
@@ -135,35 +167,12 @@ void init_model(py::module_& m) {
            py::arg("input"))
       .def(
           "trajectory_poses",
-          [](const symaware::TrackModel& self, std::size_t num_segments) -> py::array_t<double> {
-            py::array_t a =
-                py::array_t<double>({num_segments, static_cast<std::size_t>(6)}, {6 * sizeof(double), sizeof(double)});
-            auto view = a.mutable_unchecked<2>();
-            const std::vector<symaware::Pose> poses = self.trajectoryPoses(num_segments);
-            for (std::size_t i = 0; i < poses.size(); i++) {
-              view(i, 0) = poses[i].position.x;
-              view(i, 1) = poses[i].position.y;
-              view(i, 2) = poses[i].position.z;
-              view(i, 3) = poses[i].orientation.roll;
-              view(i, 4) = poses[i].orientation.pitch;
-              view(i, 5) = poses[i].orientation.yaw;
-            }
-            return a;
+          [](const symaware::TrackModel& self, std::size_t num_segments) {
+            return struct_array(self.trajectoryPoses(num_segments));
           },
           py::arg("num_segments"))
       .def_property_readonly("trajectory_positions",
-                             [](const symaware::TrackModel& self) -> py::array_t<double> {
-                               py::array_t a =
-                                   py::array_t<double>({self.trajectoryPositions().size(), static_cast<std::size_t>(3)},
-                                                       {3 * sizeof(double), sizeof(double)});
-                               auto view = a.mutable_unchecked<2>();
-                               for (std::size_t i = 0; i < self.trajectoryPositions().size(); i++) {
-                                 view(i, 0) = self.trajectoryPositions()[i].x;
-                                 view(i, 1) = self.trajectoryPositions()[i].y;
-                                 view(i, 2) = self.trajectoryPositions()[i].z;
-                               }
-                               return a;
-                             })
+                             [](const symaware::TrackModel& self) { return struct_array(self.trajectoryPositions()); })
       .def("__repr__", REPR_LAMBDA(symaware::TrackModel));
 
   py::class_<symaware::AmesimDynamicalModel, symaware::EntityModel> amesimDynamicalModel =
@@ -213,22 +222,16 @@ void init_model(py::module_& m) {
            py::arg("setup"), py::arg("initial_input") = symaware::AmesimDynamicalModel::Input{false})
       .def(
           "set_input",
-          [](symaware::AmesimDynamicalModel& model, const py::array_t<double>& input) {
+          [](symaware::AmesimDynamicalModel& model, const double_array& input) {
             if (input.size() != 4) throw std::invalid_argument("Input must have 4 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.setInput(input_vector);
+            model.setInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def(
           "update_input",
-          [](symaware::AmesimDynamicalModel& model, const py::array_t<double>& input) {
+          [](symaware::AmesimDynamicalModel& model, const double_array& input) {
             if (input.size() != 4) throw std::invalid_argument("Input must have 4 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.updateInput(input_vector);
+            model.updateInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def("set_input",
@@ -307,22 +310,16 @@ void init_model(py::module_& m) {
            py::arg("setup"), py::arg("initial_input") = symaware::CustomDynamicalModel::Input{false})
       .def(
           "set_input",
-          [](symaware::CustomDynamicalModel& model, const py::array_t<double>& input) {
+          [](symaware::CustomDynamicalModel& model, const double_array& input) {
             if (input.size() != 15) throw std::invalid_argument("Input must have 15 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.setInput(input_vector);
+            model.setInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def(
           "update_input",
-          [](symaware::CustomDynamicalModel& model, const py::array_t<double>& input) {
+          [](symaware::CustomDynamicalModel& model, const double_array& input) {
             if (input.size() != 15) throw std::invalid_argument("Input must have 15 elements");
-            std::vector<double> input_vector;
-            input_vector.reserve(input.size());
-            for (int i = 0; i < input.size(); i++) input_vector.push_back(input.at(i));
-            model.updateInput(input_vector);
+            model.updateInput(input.data(), static_cast<std::size_t>(input.size()));
           },
           py::arg("input"))
       .def("set_input",
@@ -0,0 +1,162 @@
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+
+#include "symaware/prescan/broadphase.h"
+#include "symaware/prescan/entity.h"
+#include "symaware/prescan/history_exporter.h"
+#include "symaware/prescan/kpi_evaluator.h"
+#include "symaware/prescan/simulation_observer.h"
+#include "symaware/prescan/trigger_system.h"
+#include "symaware_prescan.h"
+
+namespace py = pybind11;
+
+void init_observer(py::module_ &m) {
+  py::class_<symaware::SimulationObserver>(m, "_SimulationObserver");
+
+  py::class_<symaware::HistoryExporter, symaware::SimulationObserver>(m, "HistoryExporter")
+      .def(py::init<std::string, std::size_t>(), py::arg("directory"), py::arg("flush_interval") = 100)
+      .def("flush", &symaware::HistoryExporter::flush, "Write all the rows accumulated so far to disk.")
+      .def_property_readonly("directory", &symaware::HistoryExporter::directory)
+      .def_property_readonly("flush_interval", &symaware::HistoryExporter::flush_interval)
+      .def_property_readonly("steps", &symaware::HistoryExporter::steps);
+
+  py::class_<symaware::Broadphase, symaware::SimulationObserver>(m, "Broadphase")
+      .def(py::init<double>(), py::arg("cell_size") = 10)
+      .def("update", &symaware::Broadphase::update, "Rebuild the index from the current state of the entities",
+           py::arg("environment"))
+      .def(
+          "query_radius",
+          [](const symaware::Broadphase &self, double x, double y, double radius) {
+            return index_array(self.queryRadius(x, y, radius));
+          },
+          "Indices of the entities within radius from (x, y), sorted by increasing distance", py::arg("x"),
+          py::arg("y"), py::arg("radius"))
+      .def(
+          "query_nearest",
+          [](const symaware::Broadphase &self, double x, double y, std::size_t k) {
+            return index_array(self.queryNearest(x, y, k));
+          },
+          "Indices of the k entities closest to (x, y), sorted by increasing distance", py::arg("x"), py::arg("y"),
+          py::arg("k"))
+      .def(
+          "query_pairs",
+          [](const symaware::Broadphase &self, double distance) {
+            return index_pair_array(self.queryPairs(distance));
+          },
+          "(N, 2) array of the indices of the pairs of entities closer than distance", py::arg("distance"))
+      .def_property_readonly("entities", &symaware::Broadphase::entities, py::return_value_policy::reference,
+                             "Entities in the index, by index")
+      .def_property_readonly(
+          "positions",
+          [](const symaware::Broadphase &self) {
+            py::array_t<double> array({static_cast<py::ssize_t>(self.x().size()), py::ssize_t{2}});
+            auto view = array.mutable_unchecked<2>();
+            for (py::ssize_t i = 0; i < view.shape(0); ++i) {
+              view(i, 0) = self.x()[static_cast<std::size_t>(i)];
+              view(i, 1) = self.y()[static_cast<std::size_t>(i)];
+            }
+            return array;
+          },
+          "(N, 2) array of the positions x, y of the entities in the index");
+
+  py::class_<symaware::KpiEvaluator::Summary>(m, "KpiSummary")
+      .def_readonly("steps", &symaware::KpiEvaluator::Summary::steps, "Number of steps evaluated")
+      .def_readonly("duration", &symaware::KpiEvaluator::Summary::duration, "Simulated time of the episode")
+      .def_readonly("min_distance", &symaware::KpiEvaluator::Summary::min_distance,
+                    "Minimum distance between the entities of a relevant pair")
+      .def_readonly("min_distance_time", &symaware::KpiEvaluator::Summary::min_distance_time,
+                    "Time the minimum distance was reached")
+      .def_readonly("min_ttc", &symaware::KpiEvaluator::Summary::min_ttc, "Minimum time to collision")
+      .def_readonly("min_ttc_time", &symaware::KpiEvaluator::Summary::min_ttc_time,
+                    "Time the minimum time to collision was reached")
+      .def_readonly("min_headway", &symaware::KpiEvaluator::Summary::min_headway, "Minimum time headway")
+      .def_readonly("min_headway_time", &symaware::KpiEvaluator::Summary::min_headway_time,
+                    "Time the minimum time headway was reached")
+      .def_readonly("first_ttc_violation", &symaware::KpiEvaluator::Summary::first_ttc_violation,
+                    "First time the time to collision was below the threshold")
+      .def_readonly("first_headway_violation", &symaware::KpiEvaluator::Summary::first_headway_violation,
+                    "First time the time headway was below the threshold")
+      .def_readonly("collisions", &symaware::KpiEvaluator::Summary::collisions,
+                    "Number of collisions started during the episode")
+      .def_readonly("first_collision", &symaware::KpiEvaluator::Summary::first_collision,
+                    "Time the first collision started")
+      .def_readonly("lane_departures", &symaware::KpiEvaluator::Summary::lane_departures,
+                    "Number of times an entity with a model has left the lanes")
+      .def_readonly("first_lane_departure", &symaware::KpiEvaluator::Summary::first_lane_departure,
+                    "Time of the first lane departure")
+      .def("__repr__", REPR_LAMBDA(symaware::KpiEvaluator::Summary));
+
+  py::class_<symaware::KpiEvaluator, symaware::SimulationObserver>(m, "KpiEvaluator")
+      .def(py::init([](double interaction_radius, double collision_distance, double ttc_threshold,
+                       double headway_threshold, double lane_width) {
+             return new symaware::KpiEvaluator(symaware::KpiEvaluator::Setup{
+                 interaction_radius, collision_distance, ttc_threshold, headway_threshold, lane_width});
+           }),
+           py::arg("interaction_radius") = 100, py::arg("collision_distance") = 2, py::arg("ttc_threshold") = 2,
+           py::arg("headway_threshold") = 1, py::arg("lane_width") = 3.5)
+      .def("evaluate", &symaware::KpiEvaluator::evaluate, "Evaluate the current state of the entities at time",
+           py::arg("environment"), py::arg("time"))
+      .def("add_ego", &symaware::KpiEvaluator::addEgo, "Restrict the relevant pairs to the ones involving the entity",
+           py::arg("entity"), py::keep_alive<1, 2>())
+      .def("clear_egos", &symaware::KpiEvaluator::clearEgos, "Consider all the pairs of entities relevant again")
+      .def("reset", &symaware::KpiEvaluator::reset, "Reset the summary of the current episode")
+      .def("clear_summaries", &symaware::KpiEvaluator::clearSummaries, "Remove the summaries of all the past episodes")
+      .def_property_readonly("interaction_radius",
+                             [](const symaware::KpiEvaluator &self) { return self.setup().interaction_radius; })
+      .def_property_readonly("collision_distance",
+                             [](const symaware::KpiEvaluator &self) { return self.setup().collision_distance; })
+      .def_property_readonly("ttc_threshold",
+                             [](const symaware::KpiEvaluator &self) { return self.setup().ttc_threshold; })
+      .def_property_readonly("headway_threshold",
+                             [](const symaware::KpiEvaluator &self) { return self.setup().headway_threshold; })
+      .def_property_readonly("lane_width", [](const symaware::KpiEvaluator &self) { return self.setup().lane_width; })
+      .def_property_readonly("summary", &symaware::KpiEvaluator::summary,
+                             "Summary of the current episode, or of the last one if the simulation has terminated")
+      .def_property_readonly("summaries", &symaware::KpiEvaluator::summaries,
+                             "Summaries of all the episodes terminated so far, in order");
+
+  py::enum_<symaware::TriggerSystem::Quantity>(m, "TriggerQuantity")
+      .value("X", symaware::TriggerSystem::Quantity::X, "X coordinate of the position")
+      .value("Y", symaware::TriggerSystem::Quantity::Y, "Y coordinate of the position")
+      .value("Z", symaware::TriggerSystem::Quantity::Z, "Z coordinate of the position")
+      .value("ROLL", symaware::TriggerSystem::Quantity::ROLL, "Roll of the orientation")
+      .value("PITCH", symaware::TriggerSystem::Quantity::PITCH, "Pitch of the orientation")
+      .value("YAW", symaware::TriggerSystem::Quantity::YAW, "Yaw of the orientation")
+      .value("VELOCITY", symaware::TriggerSystem::Quantity::VELOCITY, "Velocity")
+      .value("YAW_RATE", symaware::TriggerSystem::Quantity::YAW_RATE, "Yaw rate");
+  py::enum_<symaware::TriggerSystem::Comparison>(m, "TriggerComparison")
+      .value("BELOW", symaware::TriggerSystem::Comparison::BELOW,
+             "The trigger is active while the value is below the threshold")
+      .value("ABOVE", symaware::TriggerSystem::Comparison::ABOVE,
+             "The trigger is active while the value is above the threshold");
+
+  py::class_<symaware::TriggerSystem, symaware::SimulationObserver>(m, "TriggerSystem")
+      .def(py::init<>())
+      .def("add_state_trigger", &symaware::TriggerSystem::addStateTrigger,
+           "Add a trigger on a quantity of the state of the entity. Return the id of the trigger", py::arg("entity"),
+           py::arg("quantity"), py::arg("comparison"), py::arg("threshold"), py::arg("hysteresis"),
+           py::arg("callback"), py::keep_alive<1, 2>())
+      .def("add_distance_trigger", &symaware::TriggerSystem::addDistanceTrigger,
+           "Add a trigger on the distance between two entities. Return the id of the trigger", py::arg("first"),
+           py::arg("second"), py::arg("comparison"), py::arg("threshold"), py::arg("hysteresis"),
+           py::arg("callback"), py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+      .def("add_point_distance_trigger", &symaware::TriggerSystem::addPointDistanceTrigger,
+           "Add a trigger on the distance between the entity and the point (x, y). Return the id of the trigger",
+           py::arg("entity"), py::arg("x"), py::arg("y"), py::arg("comparison"), py::arg("threshold"),
+           py::arg("hysteresis"), py::arg("callback"), py::keep_alive<1, 2>())
+      .def("add_detection_trigger", &symaware::TriggerSystem::addDetectionTrigger,
+           "Add a trigger on the number of detections of the sensor. Return the id of the trigger", py::arg("sensor"),
+           py::arg("comparison"), py::arg("threshold"), py::arg("hysteresis"), py::arg("callback"),
+           py::keep_alive<1, 2>())
+      .def("clear", &symaware::TriggerSystem::clear,
+           "Remove all the triggers, releasing their callbacks and anything they reference")
+      .def("evaluate", &symaware::TriggerSystem::evaluate,
+           "Evaluate all the triggers at time, calling back the ones that changed state", py::arg("time"))
+      .def("active", &symaware::TriggerSystem::active, "Whether the trigger with the given id is active",
+           py::arg("id"))
+      .def("value", &symaware::TriggerSystem::value, "Value of the trigger with the given id at the last evaluation",
+           py::arg("id"))
+      .def("__len__", &symaware::TriggerSystem::size)
+      .def_property_readonly("steps", &symaware::TriggerSystem::steps);
+}
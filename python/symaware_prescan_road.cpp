@@ -1,6 +1,10 @@
-#include <iostream>
+#include <pybind11/stl.h>
+
+#include <sstream>
+#include <string>
 
 #include "symaware/prescan/road.h"
+#include "symaware/prescan/road_builder.h"
 #include "symaware_prescan.h"
 
 namespace py = pybind11;
@@ -41,6 +45,58 @@ void init_road(py::module_ &m) {
       .def("set_asphalt_type", &symaware::Road::setAsphaltType, "Set the asphalt type", py::arg("asphalt_type"))
       .def("set_asphalt_tone", &symaware::Road::setAsphaltTone, "Set the asphalt tone", py::arg("tone"))
       .def("set_position", &symaware::Road::setPosition, "Set the position of the road", py::arg("position"))
+      .def("frenet_transform", &symaware::Road::frenetTransform,
+           "Create a transform between Cartesian poses and Frenet coordinates along the road",
+           py::arg("max_offset") = 50)
+
+      .def_property_readonly("length", &symaware::Road::length, "Get the length of the road")
+      .def_property_readonly("reference_line", &symaware::Road::referenceLine,
+                             "Get the reference line of the road, evaluated without going through Prescan");
+
+  py::class_<symaware::RoadBuilder::Report>(m, "RoadBuildReport")
+      .def_readonly("roads", &symaware::RoadBuilder::Report::roads, "Number of roads built")
+      .def_readonly("sections", &symaware::RoadBuilder::Report::sections, "Number of sections added to the roads")
+      .def_readonly("lanes", &symaware::RoadBuilder::Report::lanes, "Number of lanes added to the roads")
+      .def_readonly("speed_limits", &symaware::RoadBuilder::Report::speed_limits,
+                    "Number of speed limit profiles set on the roads")
+      .def_readonly("parking_spaces", &symaware::RoadBuilder::Report::parking_spaces,
+                    "Number of parking spaces added to the roads")
+      .def_readonly("build_time", &symaware::RoadBuilder::Report::build_time,
+                    "Time spent reading the description and building the roads, in seconds")
+      .def("__repr__", REPR_LAMBDA(symaware::RoadBuilder::Report));
 
-      .def_property_readonly("length", &symaware::Road::length, "Get the length of the road");
+  py::class_<symaware::RoadBuilder>(m, "RoadBuilder")
+      .def(py::init<symaware::Environment &>(), py::arg("environment"), py::keep_alive<1, 2>())
+      .def(
+          "build_json",
+          [](symaware::RoadBuilder &self, const std::string &content) {
+            std::istringstream is{content};
+            py::gil_scoped_release release;
+            return self.buildJson(is);
+          },
+          "Build the roads described by a JSON document", py::arg("content"))
+      .def("build_json_file", &symaware::RoadBuilder::buildJsonFile, "Build the roads described by a JSON file",
+           py::arg("filename"), py::call_guard<py::gil_scoped_release>())
+      .def(
+          "build_binary",
+          [](symaware::RoadBuilder &self, const py::bytes &content) {
+            std::istringstream is{std::string{content}};
+            py::gil_scoped_release release;
+            return self.buildBinary(is);
+          },
+          "Build the roads described by a binary document", py::arg("content"))
+      .def("build_binary_file", &symaware::RoadBuilder::buildBinaryFile, "Build the roads described by a binary file",
+           py::arg("filename"), py::call_guard<py::gil_scoped_release>())
+      .def_static(
+          "json_to_binary",
+          [](const std::string &content) {
+            std::istringstream json{content};
+            std::ostringstream binary;
+            symaware::RoadBuilder::jsonToBinary(json, binary);
+            return py::bytes(binary.str());
+          },
+          "Convert a description of the roads from JSON to binary format", py::arg("content"))
+      .def_property_readonly(
+          "roads", [](const symaware::RoadBuilder &self) { return self.roads(); }, py::return_value_policy::copy,
+          "Copy of the roads built so far, in the order they were described");
 }
@@ -1,21 +1,283 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 
+#include "symaware/prescan/point_cloud_filter.h"
 #include "symaware/prescan/sensor.h"
+#include "symaware/prescan/sensor_fusion.h"
+#include "symaware/prescan/sensor_noise.h"
+#include "symaware/prescan/track_table.h"
+#include "symaware/util/exception.h"
 #include "symaware_prescan.h"
 
 namespace py = pybind11;
 
+namespace {
+
+/** Points left by the @p filter, as an (N, 3) array */
+py::array_t<double> filtered_points(const symaware::PointCloudFilter& filter) {
+  py::array_t<double> points({static_cast<py::ssize_t>(filter.size()), py::ssize_t{3}});
+  std::copy(filter.points().begin(), filter.points().end(), points.mutable_data());
+  return points;
+}
+
+py::array_t<double> ground_plane(const symaware::PointCloudFilter& filter) {
+  py::array_t<double> plane(4);
+  std::copy(filter.groundPlane().begin(), filter.groundPlane().end(), plane.mutable_data());
+  return plane;
+}
+
+using id_array = py::array_t<std::int32_t, py::array::c_style | py::array::forcecast>;
+
+/** Copy of a column of the track table */
+template <class T, const std::vector<T>& (symaware::TrackTable::*Column)() const>
+py::array_t<T> track_column(const symaware::TrackTable& table) {
+  const std::vector<T>& column = (table.*Column)();
+  return py::array_t<T>(static_cast<py::ssize_t>(column.size()), column.data());
+}
+
+/** All the tracks in a (9, N) array, with one row per quantity */
+py::array_t<double> track_array(const symaware::TrackTable& table) {
+  const std::size_t size = table.size();
+  py::array_t<double> tracks({py::ssize_t{9}, static_cast<py::ssize_t>(size)});
+  double* const data = tracks.mutable_data();
+  std::copy(table.ids().begin(), table.ids().end(), data);
+  std::copy(table.lastSeen().begin(), table.lastSeen().end(), data + size);
+  std::copy(table.x().begin(), table.x().end(), data + 2 * size);
+  std::copy(table.y().begin(), table.y().end(), data + 3 * size);
+  std::copy(table.z().begin(), table.z().end(), data + 4 * size);
+  std::copy(table.vx().begin(), table.vx().end(), data + 5 * size);
+  std::copy(table.vy().begin(), table.vy().end(), data + 6 * size);
+  std::copy(table.vz().begin(), table.vz().end(), data + 7 * size);
+  std::copy(table.heading().begin(), table.heading().end(), data + 8 * size);
+  return tracks;
+}
+
+/** All the fused tracks in a (9, N) array, with one row per quantity */
+py::array_t<double> fused_track_array(const symaware::SensorFusion& fusion) {
+  const std::size_t size = fusion.size();
+  py::array_t<double> tracks({py::ssize_t{9}, static_cast<py::ssize_t>(size)});
+  double* const data = tracks.mutable_data();
+  for (std::size_t i = 0; i < size; ++i) {
+    const symaware::SensorFusion::Track& track = fusion.tracks()[i];
+    data[i] = track.id;
+    data[size + i] = static_cast<double>(track.last_seen);
+    data[2 * size + i] = track.sources;
+    for (std::size_t j = 0; j < 4; ++j) data[(3 + j) * size + i] = track.state[j];
+    data[7 * size + i] = std::sqrt(track.covariance[0]);
+    data[8 * size + i] = std::sqrt(track.covariance[5]);
+  }
+  return tracks;
+}
+
+/** Covariances of the states of the fused tracks as an (N, 4, 4) array */
+py::array_t<double> fused_track_covariances(const symaware::SensorFusion& fusion) {
+  py::array_t<double> covariances({static_cast<py::ssize_t>(fusion.size()), py::ssize_t{4}, py::ssize_t{4}});
+  double* data = covariances.mutable_data();
+  for (const symaware::SensorFusion::Track& track : fusion.tracks())
+    data = std::copy(track.covariance.begin(), track.covariance.end(), data);
+  return covariances;
+}
+
+}  // namespace
+
 void init_sensor(py::module_& m) {
+  py::class_<symaware::PointCloudFilter> point_cloud_filter =
+      py::class_<symaware::PointCloudFilter>(m, "PointCloudFilter");
+
+  py::class_<symaware::PointCloudFilter::Setup>(point_cloud_filter, "Setup")
+      .def(py::init<double, double, std::size_t, double, std::uint32_t>(), py::arg("voxel_size") = 0.2,
+           py::arg("ground_threshold") = 0.1, py::arg("ground_iterations") = 64, py::arg("max_ground_slope") = 0.3,
+           py::arg("seed") = 0)
+      .def_readwrite("voxel_size", &symaware::PointCloudFilter::Setup::voxel_size)
+      .def_readwrite("ground_threshold", &symaware::PointCloudFilter::Setup::ground_threshold)
+      .def_readwrite("ground_iterations", &symaware::PointCloudFilter::Setup::ground_iterations)
+      .def_readwrite("max_ground_slope", &symaware::PointCloudFilter::Setup::max_ground_slope)
+      .def_readwrite("seed", &symaware::PointCloudFilter::Setup::seed)
+      .def("__repr__", REPR_LAMBDA(symaware::PointCloudFilter::Setup));
+
+  point_cloud_filter
+      .def(py::init<symaware::PointCloudFilter::Setup>(), py::arg("setup") = symaware::PointCloudFilter::Setup{})
+      .def(
+          "process",
+          [](symaware::PointCloudFilter& self, const symaware::Pose& pose, const double_array& x,
+             const double_array& y, const double_array& z) {
+            if (x.size() != y.size() || x.size() != z.size())
+              SYMAWARE_OUT_OF_RANGE_FMT("Coordinate arrays of different sizes: {}, {}, {}", x.size(), y.size(),
+                                        z.size());
+            self.process(pose, x.data(), y.data(), z.data(), static_cast<std::size_t>(x.size()));
+          },
+          py::arg("pose"), py::arg("x"), py::arg("y"), py::arg("z"),
+          "Process the points, given as separate arrays of coordinates in the frame of the pose of the sensor")
+      .def("clear", &symaware::PointCloudFilter::clear, "Forget the last cloud processed")
+      .def_property_readonly("setup", &symaware::PointCloudFilter::setup)
+      .def_property_readonly("points", &filtered_points, "Points left after the processing, as an (N, 3) array")
+      .def_property_readonly("input_size", &symaware::PointCloudFilter::inputSize,
+                             "Number of points of the last cloud processed")
+      .def_property_readonly("ground_size", &symaware::PointCloudFilter::groundSize,
+                             "Number of points removed as ground")
+      .def_property_readonly("ground_plane", &ground_plane,
+                             "Coefficients (a, b, c, d) of the ground plane ax + by + cz + d = 0, NaN if not found")
+      .def("__len__", &symaware::PointCloudFilter::size);
+
+  py::class_<symaware::TrackTable> track_table = py::class_<symaware::TrackTable>(m, "TrackTable");
+
+  py::class_<symaware::TrackTable::Setup>(track_table, "Setup")
+      .def(py::init<std::size_t>(), py::arg("max_age") = 10)
+      .def_readwrite("max_age", &symaware::TrackTable::Setup::max_age)
+      .def("__repr__", REPR_LAMBDA(symaware::TrackTable::Setup));
+
+  track_table.def(py::init<symaware::TrackTable::Setup>(), py::arg("setup") = symaware::TrackTable::Setup{})
+      .def(
+          "update",
+          [](symaware::TrackTable& self, double sample_time, const id_array& ids, const double_array& x,
+             const double_array& y, const double_array& z, const double_array& heading) {
+            if (ids.size() != x.size() || ids.size() != y.size() || ids.size() != z.size() ||
+                ids.size() != heading.size())
+              SYMAWARE_OUT_OF_RANGE_FMT("Arrays of different sizes: {}, {}, {}, {}, {}", ids.size(), x.size(),
+                                        y.size(), z.size(), heading.size());
+            self.update(sample_time, ids.data(), x.data(), y.data(), z.data(), heading.data(),
+                        static_cast<std::size_t>(ids.size()));
+          },
+          py::arg("sample_time"), py::arg("ids"), py::arg("x"), py::arg("y"), py::arg("z"), py::arg("heading"),
+          "Advance the table by one step, updating it with the objects detected in the step")
+      .def("clear", &symaware::TrackTable::clear, "Remove all the tracks")
+      .def("find", &symaware::TrackTable::find, py::arg("id"),
+           "Row of the track of the object with the given id, or -1 if the object is not tracked")
+      .def_property_readonly("setup", &symaware::TrackTable::setup)
+      .def_property_readonly("step", &symaware::TrackTable::step, "Index of the last step, -1 before the first one")
+      .def_property_readonly("ids", &track_column<std::int32_t, &symaware::TrackTable::ids>)
+      .def_property_readonly("last_seen", &track_column<std::int64_t, &symaware::TrackTable::lastSeen>)
+      .def_property_readonly("x", &track_column<double, &symaware::TrackTable::x>)
+      .def_property_readonly("y", &track_column<double, &symaware::TrackTable::y>)
+      .def_property_readonly("z", &track_column<double, &symaware::TrackTable::z>)
+      .def_property_readonly("vx", &track_column<double, &symaware::TrackTable::vx>)
+      .def_property_readonly("vy", &track_column<double, &symaware::TrackTable::vy>)
+      .def_property_readonly("vz", &track_column<double, &symaware::TrackTable::vz>)
+      .def_property_readonly("heading", &track_column<double, &symaware::TrackTable::heading>)
+      .def("__array__", &track_array,
+           "(9, N) array with the id, last seen step, x, y, z, vx, vy, vz and heading of each track")
+      .def("__len__", &symaware::TrackTable::size);
+
+  py::class_<symaware::SensorFusion> sensor_fusion = py::class_<symaware::SensorFusion>(m, "SensorFusion");
+
+  py::class_<symaware::SensorFusion::Setup>(sensor_fusion, "Setup")
+      .def(py::init<double, double, double, double, double, double, std::size_t>(), py::arg("position_noise") = 0.5,
+           py::arg("bearing_noise") = 0.01, py::arg("acceleration_noise") = 2, py::arg("initial_velocity_noise") = 10,
+           py::arg("position_gate") = 9.21, py::arg("bearing_gate") = 6.63, py::arg("max_age") = 10)
+      .def_readwrite("position_noise", &symaware::SensorFusion::Setup::position_noise)
+      .def_readwrite("bearing_noise", &symaware::SensorFusion::Setup::bearing_noise)
+      .def_readwrite("acceleration_noise", &symaware::SensorFusion::Setup::acceleration_noise)
+      .def_readwrite("initial_velocity_noise", &symaware::SensorFusion::Setup::initial_velocity_noise)
+      .def_readwrite("position_gate", &symaware::SensorFusion::Setup::position_gate)
+      .def_readwrite("bearing_gate", &symaware::SensorFusion::Setup::bearing_gate)
+      .def_readwrite("max_age", &symaware::SensorFusion::Setup::max_age)
+      .def("__repr__", REPR_LAMBDA(symaware::SensorFusion::Setup));
+
+  py::enum_<symaware::SensorFusion::Source>(sensor_fusion, "Source", py::arithmetic())
+      .value("POSITION", symaware::SensorFusion::Source::POSITION)
+      .value("BEARING", symaware::SensorFusion::Source::BEARING)
+      .export_values();
+
+  sensor_fusion
+      .def(py::init<symaware::SensorFusion::Setup>(), py::arg("setup") = symaware::SensorFusion::Setup{})
+      .def("predict", &symaware::SensorFusion::predict, py::arg("sample_time"),
+           "Start a new step, removing the old tracks and predicting the state of the others")
+      .def(
+          "update_positions",
+          [](symaware::SensorFusion& self, const id_array& ids, const double_array& x, const double_array& y) {
+            if (ids.size() != x.size() || ids.size() != y.size())
+              SYMAWARE_OUT_OF_RANGE_FMT("Arrays of different sizes: {}, {}, {}", ids.size(), x.size(), y.size());
+            self.updatePositions(ids.data(), x.data(), y.data(), static_cast<std::size_t>(ids.size()));
+          },
+          py::arg("ids"), py::arg("x"), py::arg("y"),
+          "Update the tracks with the positions of the objects in the world frame, negative ids being unknown")
+      .def(
+          "update_bearings",
+          [](symaware::SensorFusion& self, const symaware::Position& origin, const id_array& ids,
+             const double_array& bearing) {
+            if (ids.size() != bearing.size())
+              SYMAWARE_OUT_OF_RANGE_FMT("Arrays of different sizes: {}, {}", ids.size(), bearing.size());
+            self.updateBearings(origin, ids.data(), bearing.data(), static_cast<std::size_t>(ids.size()));
+          },
+          py::arg("origin"), py::arg("ids"), py::arg("bearing"),
+          "Update the tracks with the bearings of the objects seen from the origin, negative ids being unknown")
+      .def("clear", &symaware::SensorFusion::clear, "Remove all the tracks")
+      .def("find", &symaware::SensorFusion::find, py::arg("id"),
+           "Row of the track of the object with the given id, or -1 if the object is not tracked")
+      .def_property_readonly("setup", &symaware::SensorFusion::setup)
+      .def_property_readonly("step", &symaware::SensorFusion::step,
+                             "Index of the current step, -1 before the first one")
+      .def_property_readonly("covariances", &fused_track_covariances,
+                             "(N, 4, 4) array with the covariance of the x, y, vx and vy of each track")
+      .def("__array__", &fused_track_array,
+           "(9, N) array with the id, last seen step, sources, x, y, vx, vy and the standard deviations of x and y "
+           "of each track")
+      .def("__len__", &symaware::SensorFusion::size);
+
+  py::class_<symaware::SensorNoise> sensor_noise = py::class_<symaware::SensorNoise>(m, "SensorNoise");
+
+  py::enum_<symaware::SensorNoise::Distribution>(sensor_noise, "Distribution")
+      .value("GAUSSIAN", symaware::SensorNoise::Distribution::GAUSSIAN)
+      .value("LAPLACE", symaware::SensorNoise::Distribution::LAPLACE)
+      .export_values();
+
+  py::class_<symaware::SensorNoise::Setup>(sensor_noise, "Setup")
+      .def(py::init<std::vector<double>, symaware::SensorNoise::Distribution, std::vector<double>, double, double,
+                    std::vector<double>, std::vector<double>, std::size_t, std::size_t, std::uint64_t>(),
+           py::arg("noise") = std::vector<double>{},
+           py::arg("distribution") = symaware::SensorNoise::Distribution::GAUSSIAN,
+           py::arg("quantisation") = std::vector<double>{}, py::arg("dropout") = 0, py::arg("false_positives") = 0,
+           py::arg("false_positive_low") = std::vector<double>{},
+           py::arg("false_positive_high") = std::vector<double>{},
+           py::arg("latency") = 0, py::arg("latency_jitter") = 0, py::arg("seed") = 0)
+      .def_readwrite("noise", &symaware::SensorNoise::Setup::noise)
+      .def_readwrite("distribution", &symaware::SensorNoise::Setup::distribution)
+      .def_readwrite("quantisation", &symaware::SensorNoise::Setup::quantisation)
+      .def_readwrite("dropout", &symaware::SensorNoise::Setup::dropout)
+      .def_readwrite("false_positives", &symaware::SensorNoise::Setup::false_positives)
+      .def_readwrite("false_positive_low", &symaware::SensorNoise::Setup::false_positive_low)
+      .def_readwrite("false_positive_high", &symaware::SensorNoise::Setup::false_positive_high)
+      .def_readwrite("latency", &symaware::SensorNoise::Setup::latency)
+      .def_readwrite("latency_jitter", &symaware::SensorNoise::Setup::latency_jitter)
+      .def_readwrite("seed", &symaware::SensorNoise::Setup::seed)
+      .def("__repr__", REPR_LAMBDA(symaware::SensorNoise::Setup));
+
+  sensor_noise
+      .def(py::init<symaware::SensorNoise::Setup, std::size_t>(), py::arg("setup"), py::arg("width"))
+      .def("reset", &symaware::SensorNoise::reset, py::arg("episode"),
+           "Start the given episode, emptying the delay buffer")
+      .def(
+          "apply",
+          [](symaware::SensorNoise& self, const double_array& rows) {
+            const std::size_t width = self.width();
+            if (rows.size() % width != 0)
+              SYMAWARE_OUT_OF_RANGE_FMT("Array size {} is not a multiple of {}", rows.size(), width);
+            std::vector<double> values(rows.data(), rows.data() + rows.size());
+            self.beginStep();
+            values.resize(self.corrupt(values.data(), values.size() / width) * width);
+            self.addFalsePositives(values);
+            self.delay(values);
+            py::array_t<double> corrupted({values.size() / width, width});
+            std::copy(values.begin(), values.end(), corrupted.mutable_data());
+            return corrupted;
+          },
+          py::arg("rows"), "Start a new step and return the (N, width) array of the rows corrupted by all the stages")
+      .def_property_readonly("setup", &symaware::SensorNoise::setup)
+      .def_property_readonly("width", &symaware::SensorNoise::width)
+      .def_property_readonly("episode", &symaware::SensorNoise::episode)
+      .def_property_readonly("step", &symaware::SensorNoise::step,
+                             "Index of the current step in the episode, -1 before the first one");
+
   py::class_<symaware::Sensor>(m, "_Sensor")
       .def(py::init<symaware::SensorType, bool>(), py::arg("sensor_type"), py::arg("existing") = false)
-      .def(py::init([](symaware::SensorType sensor_type, py::array_t<double> setup, bool existing) {
-        std::vector<double> setup_vector;
-        setup_vector.reserve(setup.size());
-        for (int i = 0; i < setup.size(); i++) setup_vector.push_back(setup.at(i));
-        return symaware::Sensor{sensor_type, setup_vector, existing};
+      .def(py::init([](symaware::SensorType sensor_type, const double_array& setup, bool existing) {
+        return symaware::Sensor{sensor_type, std::vector<double>(setup.data(), setup.data() + setup.size()), existing};
       }))
       .def("create_sensor", &symaware::Sensor::createSensor, py::arg("object"), py::arg("id"))
       .def("register_unit", &symaware::Sensor::registerUnit, py::arg("object"), py::arg("experiment"),
@@ -23,7 +285,29 @@ void init_sensor(py::module_& m) {
       .def("initialise", &symaware::Sensor::initialise, py::arg("simulation"))
       .def("step", &symaware::Sensor::step, py::arg("simulation"))
       .def("terminate", &symaware::Sensor::terminate, py::arg("simulation"))
+      .def("set_point_cloud_filter", &symaware::Sensor::setPointCloudFilter, py::arg("setup"),
+           "Process the points seen by the LMS sensor at each step")
+      .def("clear_point_cloud_filter", &symaware::Sensor::clearPointCloudFilter,
+           "Stop processing the points seen by the sensor")
+      .def("set_track_table", &symaware::Sensor::setTrackTable, py::arg("setup"),
+           "Track the objects detected by the AIR sensor at each step")
+      .def("clear_track_table", &symaware::Sensor::clearTrackTable, "Stop tracking the objects detected by the sensor")
+      .def("set_sensor_noise", &symaware::Sensor::setSensorNoise, py::arg("setup"),
+           "Corrupt the state of the AIR, BRS or LMS sensor at each step")
+      .def("clear_sensor_noise", &symaware::Sensor::clearSensorNoise, "Stop corrupting the state of the sensor")
+      .def("set_noise_episode", &symaware::Sensor::setNoiseEpisode, py::arg("episode"),
+           "Select the episode of the noise of the next simulation")
 
+      .def_property_readonly("point_cloud_filter", &symaware::Sensor::pointCloudFilter,
+                             py::return_value_policy::reference_internal,
+                             "Filter processing the points seen by the sensor, None if there is none")
+      .def_property_readonly("track_table", &symaware::Sensor::trackTable, py::return_value_policy::reference_internal,
+                             "Table tracking the objects detected by the sensor, None if there is none")
+      .def_property_readonly("sensor_noise", &symaware::Sensor::sensorNoise,
+                             py::return_value_policy::reference_internal,
+                             "Noise corrupting the state of the sensor, None if there is none")
+      .def_property_readonly("detection_count", &symaware::Sensor::detectionCount,
+                             "Number of detections of the sensor in the last step, counting each point for LMS sensors")
       .def_property_readonly("sensor_type", &symaware::Sensor::sensor_type)
       .def_property_readonly("setup", &symaware::Sensor::setup)
       .def_property_readonly("state", &symaware::Sensor::state);
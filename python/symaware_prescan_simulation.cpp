@@ -1,12 +1,62 @@
+#include <fmt/format.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 
 #include <iostream>
 
 #include "symaware/prescan/simulation.h"
+#include "symaware/util/profiler.h"
+#include "symaware/util/trace.h"
 #include "symaware_prescan.h"
 namespace py = pybind11;
 
+namespace {
+
+template <class T, class F>
+py::array_t<T> stats_column(const std::vector<symaware::ProfileStats> &stats, F &&getter) {
+  py::array_t<T> column(static_cast<py::ssize_t>(stats.size()));
+  auto r = column.template mutable_unchecked<1>();
+  for (py::ssize_t i = 0; i < r.shape(0); i++) r(i) = getter(stats[i]);
+  return column;
+}
+
+py::dict stats_to_dict(const std::vector<symaware::ProfileStats> &stats) {
+  py::list entity, component, phase;
+  for (const symaware::ProfileStats &s : stats) {
+    entity.append(s.entity);
+    component.append(s.component);
+    phase.append(fmt::format("{}", s.phase));
+  }
+  py::dict dict;
+  dict["entity"] = entity;
+  dict["component"] = component;
+  dict["phase"] = phase;
+  dict["count"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.count; });
+  dict["min"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.min; });
+  dict["mean"] = stats_column<double>(stats, [](const symaware::ProfileStats &s) { return s.mean; });
+  dict["p50"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.p50; });
+  dict["p90"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.p90; });
+  dict["p99"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.p99; });
+  dict["max"] = stats_column<std::uint64_t>(stats, [](const symaware::ProfileStats &s) { return s.max; });
+  return dict;
+}
+
+}  // namespace
+
 void init_simulation(py::module_ &m) {
+  m.def("set_profiling_enabled", &symaware::Profiler::setEnabled, py::arg("enabled"),
+        "Enable or disable the collection of timing statistics for each phase of the simulation.");
+  m.def("is_profiling_enabled", &symaware::Profiler::enabled,
+        "Whether timing statistics are being collected for each phase of the simulation.");
+  m.def("set_tracing_enabled", &symaware::Tracer::setEnabled, py::arg("enabled"),
+        "Enable or disable the recording of the spans of the simulation lifecycle.");
+  m.def("is_tracing_enabled", &symaware::Tracer::enabled,
+        "Whether the spans of the simulation lifecycle are being recorded.");
+  m.def("write_trace", &symaware::Tracer::write, py::arg("filename"),
+        "Write the spans recorded so far to a Trace Event JSON file, loadable in Perfetto or chrome://tracing.");
+  m.def("clear_trace", &symaware::Tracer::clear,
+        "Remove the spans recorded so far. Tracing must be disabled when this is called.");
+
   py::class_<symaware::Simulation>(m, "_Simulation")
       .def(py::init<const symaware::Environment &>(), py::arg("environment"))
       .def("run", &symaware::Simulation::run, py::arg("seconds") = -1.0, "Run the simulation automatically.")
@@ -21,6 +71,14 @@ void init_simulation(py::module_ &m) {
            "Set a callback to be called as the first operation at each step.")
       .def("remove_on_post_step", &symaware::Simulation::removeOnPostStep,
            "Set a callback to be called as the last operation at each step.")
+      .def("add_observer", &symaware::Simulation::addObserver, py::arg("observer"), py::keep_alive<1, 2>(),
+           "Add an observer notified at each stage of the simulation.")
+      .def("remove_observer", &symaware::Simulation::removeObserver, py::arg("observer"),
+           "Remove an observer from the simulation.")
       .def("set_log_level", &symaware::Simulation::setLogLevel, py::arg("log_level"),
-           "Set the log level of the simulation logger.");
+           "Set the log level of the simulation logger.")
+      .def(
+          "stats", [](const symaware::Simulation &self) { return stats_to_dict(self.stats()); },
+          "Timing statistics of each phase of each component, in nanoseconds, as a dictionary of arrays.")
+      .def("reset_stats", &symaware::Simulation::resetStats, "Remove all the timing statistics collected so far.");
 }
@@ -0,0 +1,119 @@
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+
+#include "symaware/prescan/transform.h"
+#include "symaware/util/exception.h"
+#include "symaware_prescan.h"
+
+namespace py = pybind11;
+
+namespace {
+
+/** Number of rows of an (N, K) array of points, with K >= 3 */
+std::size_t num_points(const double_array& points) {
+  if (points.ndim() != 2 || points.shape(1) < 3)
+    SYMAWARE_OUT_OF_RANGE_FMT("Expected an (N, K) array with K >= 3, got {} dimensions", points.ndim());
+  return static_cast<std::size_t>(points.shape(0));
+}
+
+/** Check that the arrays of coordinates @p x, @p y and @p z have the same size. @return their size */
+std::size_t num_coordinates(const double_array& x, const double_array& y, const double_array& z) {
+  if (x.size() != y.size() || x.size() != z.size())
+    SYMAWARE_OUT_OF_RANGE_FMT("Coordinate arrays of different sizes: {}, {}, {}", x.size(), y.size(), z.size());
+  return static_cast<std::size_t>(x.size());
+}
+
+template <void (*Transform)(const symaware::Pose&, const double*, std::size_t, std::size_t, double*)>
+py::array_t<double> transform_rows(const symaware::Pose& pose, const double_array& points) {
+  const std::size_t size = num_points(points);
+  py::array_t<double> out({static_cast<py::ssize_t>(size), py::ssize_t{3}});
+  Transform(pose, points.data(), size, static_cast<std::size_t>(points.shape(1)), out.mutable_data());
+  return out;
+}
+
+template <void (*Transform)(const symaware::Pose&, const double*, const double*, const double*, std::size_t, double*,
+                            double*, double*)>
+std::tuple<py::array_t<double>, py::array_t<double>, py::array_t<double>> transform_coordinates(
+    const symaware::Pose& pose, const double_array& x, const double_array& y, const double_array& z) {
+  const std::size_t size = num_coordinates(x, y, z);
+  py::array_t<double> out_x(x.size()), out_y(x.size()), out_z(x.size());
+  Transform(pose, x.data(), y.data(), z.data(), size, out_x.mutable_data(), out_y.mutable_data(),
+            out_z.mutable_data());
+  return {out_x, out_y, out_z};
+}
+
+}  // namespace
+
+void init_transform(py::module_& m) {
+  py::class_<symaware::Quaternion>(m, "Quaternion")
+      .def(py::init([]() { return symaware::Quaternion{1, 0, 0, 0}; }), "Identity rotation")
+      .def(py::init([](double w, double x, double y, double z) { return symaware::Quaternion{w, x, y, z}; }),
+           py::arg("w"), py::arg("x"), py::arg("y"), py::arg("z"))
+      .def_readwrite("w", &symaware::Quaternion::w)
+      .def_readwrite("x", &symaware::Quaternion::x)
+      .def_readwrite("y", &symaware::Quaternion::y)
+      .def_readwrite("z", &symaware::Quaternion::z)
+      .def("__array__", [](const symaware::Quaternion& self) { return struct_row(self); })
+      .def("__repr__", REPR_LAMBDA(symaware::Quaternion));
+
+  m.def(
+       "rotation_matrix",
+       [](const symaware::Orientation& orientation) {
+         py::array_t<double> matrix({py::ssize_t{3}, py::ssize_t{3}});
+         const symaware::RotationMatrix rotation = symaware::rotationMatrix(orientation);
+         std::copy(rotation.begin(), rotation.end(), matrix.mutable_data());
+         return matrix;
+       },
+       py::arg("orientation"), "Rotation matrix of the orientation, R = Rz(yaw) Ry(pitch) Rx(roll)")
+      .def("quaternion", &symaware::quaternion, py::arg("orientation"), "Quaternion of the orientation")
+      .def(
+          "orientation",
+          [](const double_array& rotation) {
+            if (rotation.size() != 9) SYMAWARE_OUT_OF_RANGE_FMT("Expected 9 elements, got {}", rotation.size());
+            symaware::RotationMatrix matrix;
+            std::copy(rotation.data(), rotation.data() + 9, matrix.begin());
+            return symaware::orientation(matrix);
+          },
+          py::arg("rotation"), "Roll, pitch and yaw of a 3x3 rotation matrix")
+      .def("orientation", py::overload_cast<const symaware::Quaternion&>(&symaware::orientation),
+           py::arg("quaternion"), "Roll, pitch and yaw of a quaternion")
+      .def("compose", &symaware::compose, py::arg("parent"), py::arg("child"),
+           "Pose of the child, given relative to the parent, in the frame the parent is given in")
+      .def("inverse", &symaware::inverse, py::arg("pose"), "Pose of the parent frame in the frame of the pose")
+      .def("transform_point", &symaware::transformPoint, py::arg("pose"), py::arg("point"),
+           "Express a point given in the frame of the pose in the frame the pose is given in")
+      .def("inverse_transform_point", &symaware::inverseTransformPoint, py::arg("pose"), py::arg("point"),
+           "Express a point given in the frame the pose is given in in the frame of the pose")
+      .def("transform_points", &transform_rows<symaware::transformPoints>, py::arg("pose"), py::arg("points"),
+           "Express the points, an (N, K) array with the coordinates in the first 3 columns, "
+           "given in the frame of the pose in the frame the pose is given in. Returns an (N, 3) array")
+      .def("transform_points", &transform_coordinates<symaware::transformPoints>, py::arg("pose"), py::arg("x"),
+           py::arg("y"), py::arg("z"),
+           "Express the points, given as separate arrays of coordinates, "
+           "in the frame the pose is given in. Returns the arrays of the transformed coordinates")
+      .def("inverse_transform_points", &transform_rows<symaware::inverseTransformPoints>, py::arg("pose"),
+           py::arg("points"),
+           "Express the points, an (N, K) array with the coordinates in the first 3 columns, "
+           "given in the frame the pose is given in in the frame of the pose. Returns an (N, 3) array")
+      .def("inverse_transform_points", &transform_coordinates<symaware::inverseTransformPoints>, py::arg("pose"),
+           py::arg("x"), py::arg("y"), py::arg("z"),
+           "Express the points, given as separate arrays of coordinates, "
+           "in the frame of the pose. Returns the arrays of the transformed coordinates")
+      .def(
+          "polar_to_cartesian",
+          [](const double_array& range, const double_array& azimuth, const double_array& elevation) {
+            const std::size_t size = num_coordinates(range, azimuth, elevation);
+            py::array_t<double> x(range.size()), y(range.size()), z(range.size());
+            symaware::polarToCartesian(range.data(), azimuth.data(), elevation.data(), size, x.mutable_data(),
+                                       y.mutable_data(), z.mutable_data());
+            return std::make_tuple(x, y, z);
+          },
+          py::arg("range"), py::arg("azimuth"), py::arg("elevation"),
+          "Cartesian coordinates of points given by range, azimuth and elevation, e.g. the detections of an AIR "
+          "sensor. Returns the arrays of the X, Y and Z coordinates")
+      .def("avx2_transforms", &symaware::avx2Transforms, "Whether the batch transforms use the AVX2 kernels");
+}
@@ -1,8 +1,28 @@
+#include <pybind11/numpy.h>
+
+#include <cstdint>
+
+#include "symaware/prescan/object_catalog.h"
 #include "symaware/prescan/type.h"
 #include "symaware_prescan.h"
 
 namespace py = pybind11;
 
+namespace {
+/** Row of the numpy table of the object catalog. Enums are stored as their underlying value */
+struct ObjectCatalogRow {
+  std::int32_t type;
+  std::int32_t category;
+  double length;
+  double width;
+  double height;
+  double cog_x;
+  double cog_y;
+  double cog_z;
+  double mass;
+};
+}  // namespace
+
 void init_type(py::module_ &m) {
   py::enum_<symaware::Gear>(m, "Gear")
       .value("Forward", symaware::Gear::Forward, "Forward gear")
@@ -330,4 +350,48 @@ void init_type(py::module_ &m) {
       .value("Sphere", symaware::ObjectType::Sphere)
       .value("Tripod", symaware::ObjectType::Tripod)
       .value("TrafficSignPole", symaware::ObjectType::TrafficSignPole);
+
+  py::enum_<symaware::ObjectCategory>(m, "ObjectCategory")
+      .value("VEHICLE", symaware::ObjectCategory::VEHICLE, "Vehicles and trailers")
+      .value("PEDESTRIAN", symaware::ObjectCategory::PEDESTRIAN, "Pedestrians, cyclists and animals")
+      .value("STATIC", symaware::ObjectCategory::STATIC, "Buildings, road furniture and other static objects")
+      .value("FOLIAGE", symaware::ObjectCategory::FOLIAGE, "Trees and crops");
+  py::class_<symaware::ObjectInfo>(m, "ObjectInfo")
+      .def_readonly("type", &symaware::ObjectInfo::type, "Type of the object")
+      .def_readonly("category", &symaware::ObjectInfo::category, "Category of the object")
+      .def_readonly("length", &symaware::ObjectInfo::length, "Extent of the bounding box along the x axis [m]")
+      .def_readonly("width", &symaware::ObjectInfo::width, "Extent of the bounding box along the y axis [m]")
+      .def_readonly("height", &symaware::ObjectInfo::height, "Extent of the bounding box along the z axis [m]")
+      .def_readonly("cog_x", &symaware::ObjectInfo::cog_x, "X coordinate of the centre of gravity [m]")
+      .def_readonly("cog_y", &symaware::ObjectInfo::cog_y, "Y coordinate of the centre of gravity [m]")
+      .def_readonly("cog_z", &symaware::ObjectInfo::cog_z, "Z coordinate of the centre of gravity [m]")
+      .def_readonly("mass", &symaware::ObjectInfo::mass,
+                    "Mass [kg]. 0 if the object is anchored to the ground, NaN if unknown")
+      .def("__repr__", REPR_LAMBDA(symaware::ObjectInfo));
+  m.def(
+      "object_info", [](symaware::ObjectType type) { return symaware::objectInfo(type); }, py::arg("object_type"),
+      "Geometry and mass of the object type. Unknown values are NaN");
+
+  PYBIND11_NUMPY_DTYPE(ObjectCatalogRow, type, category, length, width, height, cog_x, cog_y, cog_z, mass);
+  m.def(
+      "object_catalog",
+      []() {
+        py::array_t<ObjectCatalogRow> table(static_cast<py::ssize_t>(symaware::object_catalog.size()));
+        auto rows = table.mutable_unchecked<1>();
+        for (py::ssize_t i = 0; i < rows.shape(0); ++i) {
+          const symaware::ObjectInfo &info = symaware::object_catalog[static_cast<std::size_t>(i)];
+          rows(i) = ObjectCatalogRow{static_cast<std::int32_t>(info.type),
+                                     static_cast<std::int32_t>(info.category),
+                                     info.length,
+                                     info.width,
+                                     info.height,
+                                     info.cog_x,
+                                     info.cog_y,
+                                     info.cog_z,
+                                     info.mass};
+        }
+        return table;
+      },
+      "Structured array with the geometry and mass of each object type, indexed by its value.\n"
+      "The fields are type, category, length, width, height, cog_x, cog_y, cog_z and mass. Unknown values are NaN");
 }
@@ -0,0 +1,108 @@
+"""
+Generate include/symaware/prescan/object_catalog.def from the Prescan object library.
+
+Each ObjectType listed in the current data file is created in an empty experiment,
+and its bounding box, centre of gravity and mass are read back from Prescan.
+The type and category columns are kept from the current file, as well as the values that hold by convention:
+0 size for objects placed along a line and 0 mass for objects anchored to the ground.
+Values Prescan does not report are written as NAN.
+
+Run it from the root of the repository on a machine with Prescan installed:
+
+    python script/object_catalog.py
+    python script/object_catalog.py --categories VEHICLE PEDESTRIAN  # only update some categories
+"""
+
+import argparse
+import math
+import os
+import re
+
+PRESCAN_DIR = "C:/Program Files/Simcenter Prescan/Prescan_2403"
+DEF_FILE = os.path.join(
+    os.path.dirname(os.path.realpath(__file__)), "..", "include", "symaware", "prescan", "object_catalog.def"
+)
+ROW = re.compile(r"^SYMAWARE_OBJECT\((.*)\)$")
+NAN = float("nan")
+
+
+def read_rows(path: str) -> "tuple[list[str], list[list[str]]]":
+    """Split the data file into its header and the fields of each row"""
+    header, rows = [], []
+    with open(path, "r") as file:
+        for line in file.read().splitlines():
+            match = ROW.match(line)
+            if match is None:
+                header.append(line)
+            else:
+                rows.append([field.strip() for field in match.group(1).split(",")])
+    return header, rows
+
+
+def measure(experiment, type_name: str) -> "tuple[float, ...]":
+    """
+    Length, width, height, centre of gravity and mass of an object of the given type, as reported by Prescan.
+    The centre of gravity is moved from the origin of the object to the centre of the bottom face of its bounding box.
+    """
+    obj = experiment.createObject(type_name)
+    box = obj.boundingBox
+    length, width, height = box.size.x, box.size.y, box.size.z
+    cog_x = obj.cogOffset.x - box.center.x
+    cog_y = obj.cogOffset.y - box.center.y
+    cog_z = obj.cogOffset.z - (box.center.z - height / 2)
+    mass = getattr(obj, "mass", NAN)
+    obj.remove()
+    return length, width, height, cog_x, cog_y, cog_z, mass
+
+
+def format_value(value: float) -> str:
+    if math.isnan(value):
+        return "NAN"
+    # Adding 0.0 turns -0.0 into 0.0
+    text = f"{round(value, 3) + 0.0:.3f}".rstrip("0")
+    return text + "0" if text.endswith(".") else text
+
+
+def write_rows(path: str, header: "list[str]", rows: "list[list[str]]"):
+    """Write the rows back with their columns aligned"""
+    widths = [max(len(row[i]) for row in rows) + 1 for i in range(len(rows[0]))]
+    with open(path, "w") as file:
+        file.write("\n".join(header[: header.index(" */") + 1]) + "\n")
+        for row in rows:
+            fields = [(field + ",").ljust(width) for field, width in zip(row[:-1], widths)] + [row[-1]]
+            file.write(f"SYMAWARE_OBJECT({' '.join(fields)})\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--categories", nargs="*", default=None, help="Only update the objects of these categories")
+    parser.add_argument("--output", default=DEF_FILE, help="Data file to update")
+    args = parser.parse_args()
+
+    os.add_dll_directory(f"{PRESCAN_DIR}/bin")
+    import prescan.api.experiment  # pylint: disable=import-outside-toplevel
+
+    header, rows = read_rows(args.output)
+    experiment = prescan.api.experiment.createExperiment()
+    for row in rows:
+        type_name, category = row[0], row[1]
+        if args.categories is not None and category not in args.categories:
+            continue
+        placement_dependent = all(value == "0.0" for value in row[2:5])
+        anchored = row[8] == "0.0"
+        try:
+            values = list(measure(experiment, type_name))
+        except RuntimeError as error:
+            print(f"Skipping {type_name}: {error}")
+            continue
+        if placement_dependent:
+            values[:6] = [0.0] * 6
+        if anchored:
+            values[6] = 0.0
+        row[2:] = [format_value(value) for value in values]
+        print(f"{type_name}: {', '.join(row[2:])}")
+    write_rows(args.output, header, rows)
+
+
+if __name__ == "__main__":
+    main()
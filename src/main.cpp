@@ -23,7 +23,9 @@
 
 using namespace std::chrono_literals;
 
+#ifndef M_PI
 #define M_PI 3.14159265358979323846
+#endif
 
 int main() {
   symaware::Environment env;
@@ -0,0 +1,288 @@
+#include "symaware/map/frenet_transform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <utility>
+
+#include "symaware/map/road_network.h"
+#include "symaware/util/constants.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Minimum number of poses handled by each thread, below which handing them to a thread costs more than it saves */
+constexpr std::size_t min_chunk_size = 256;
+
+/** Threads kept alive across the batches, running the tasks in the order they are pushed */
+class WorkerPool {
+ public:
+  explicit WorkerPool(const std::size_t size) : workers_{}, tasks_{}, mutex_{}, ready_{}, stop_{false} {
+    workers_.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) workers_.emplace_back([this]() { work(); });
+  }
+  ~WorkerPool() {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      stop_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread& worker : workers_) worker.join();
+  }
+
+  void push(std::function<void()> task) {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      tasks_.push(std::move(task));
+    }
+    ready_.notify_one();
+  }
+
+ private:
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        ready_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) return;
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> workers_;         ///< Threads running the tasks
+  std::queue<std::function<void()>> tasks_;  ///< Tasks waiting for a thread
+  std::mutex mutex_;                         ///< Guard of the tasks and the stop flag
+  std::condition_variable ready_;            ///< Signals a new task or the stop of the pool
+  bool stop_;                                ///< Whether the threads must return once the tasks are over
+};
+
+/** @return pool shared by all the transforms, with a thread for each hardware thread but the caller's one */
+WorkerPool& workerPool() {
+  static WorkerPool pool{std::max(2u, std::thread::hardware_concurrency()) - 1};
+  return pool;
+}
+
+/**
+ * Call @p f on consecutive chunks of [0, @p n), the first on the calling thread and the others on the worker pool.
+ * The first exception thrown by a chunk is rethrown on the calling thread, once all the chunks are over.
+ */
+template <class F>
+void parallelFor(const std::size_t n, std::size_t threads, F&& f) {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  threads = std::min(threads, (n + min_chunk_size - 1) / min_chunk_size);
+  if (threads <= 1) {
+    f(std::size_t{0}, n);
+    return;
+  }
+  const std::size_t chunk = (n + threads - 1) / threads;
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t pending = threads - 1;
+  std::exception_ptr error;
+  for (std::size_t i = 1; i < threads; ++i) {
+    workerPool().push([&, begin = i * chunk, end = std::min(n, (i + 1) * chunk)]() {
+      std::exception_ptr chunk_error;
+      try {
+        f(begin, end);
+      } catch (...) {
+        chunk_error = std::current_exception();
+      }
+      const std::lock_guard<std::mutex> lock{mutex};
+      if (chunk_error != nullptr && error == nullptr) error = chunk_error;
+      if (--pending == 0) done.notify_one();
+    });
+  }
+  std::exception_ptr caller_error;
+  try {
+    f(std::size_t{0}, chunk);
+  } catch (...) {
+    caller_error = std::current_exception();
+  }
+  std::unique_lock<std::mutex> lock{mutex};
+  done.wait(lock, [&pending]() { return pending == 0; });
+  if (caller_error != nullptr) std::rethrow_exception(caller_error);
+  if (error != nullptr) std::rethrow_exception(error);
+}
+
+/** @return @p angle wrapped in [-π, π] */
+double wrapAngle(const double angle) { return std::remainder(angle, 2 * pi); }
+
+}  // namespace
+
+FrenetTransform::FrenetTransform(ReferenceLine line, std::vector<double> left_widths,
+                                 std::vector<double> right_widths, const double max_offset, const double step)
+    : network_{nullptr},
+      line_{std::move(line)},
+      left_widths_{std::move(left_widths)},
+      right_widths_{std::move(right_widths)},
+      max_offset_{max_offset},
+      index_{},
+      threads_{0} {
+  if (line_.geometries().empty()) SYMAWARE_INVALID_ARGUMENT("line", "no geometries");
+  if (!(max_offset > 0)) SYMAWARE_INVALID_ARGUMENT("max_offset", max_offset);
+  if (!(step > 0)) SYMAWARE_INVALID_ARGUMENT("step", step);
+
+  const ReferenceLine::Samples samples = line_.sampleUniform(step);
+  // Offsets of the corridor on both sides of each sample.
+  // On the inner side of a curve, the corridor must stop before the centre of curvature,
+  // or consecutive quadrilaterals would fold over each other
+  const auto offsets = [&](const std::size_t k) {
+    const double radius = std::abs(samples.curvature[k]) > 0 ? 0.99 / std::abs(samples.curvature[k]) : max_offset;
+    return std::pair{samples.curvature[k] > 0 ? std::min(max_offset, radius) : max_offset,
+                     samples.curvature[k] < 0 ? std::min(max_offset, radius) : max_offset};
+  };
+  for (std::size_t k = 0; k + 1 < samples.size(); ++k) {
+    const auto [left, right] = offsets(k);
+    const auto [next_left, next_right] = offsets(k + 1);
+    const double normal_x = -std::sin(samples.heading[k]), normal_y = std::cos(samples.heading[k]);
+    const double next_normal_x = -std::sin(samples.heading[k + 1]), next_normal_y = std::cos(samples.heading[k + 1]);
+    index_.insert({{samples.x[k] + left * normal_x, samples.x[k + 1] + next_left * next_normal_x,
+                    samples.x[k + 1] - next_right * next_normal_x, samples.x[k] - right * normal_x},
+                   {samples.y[k] + left * normal_y, samples.y[k + 1] + next_left * next_normal_y,
+                    samples.y[k + 1] - next_right * next_normal_y, samples.y[k] - right * normal_y},
+                   k,
+                   samples.s[k],
+                   samples.s[k + 1]});
+  }
+  index_.build();
+}
+
+FrenetTransform::FrenetTransform(const RoadNetwork& network)
+    : network_{&network}, line_{}, left_widths_{}, right_widths_{}, max_offset_{0}, index_{}, threads_{0} {}
+
+int FrenetTransform::laneId(const double d) const {
+  const std::vector<double>& widths = d > 0 ? left_widths_ : right_widths_;
+  double boundary = 0;
+  for (std::size_t i = 0; i < widths.size(); ++i) {
+    boundary += widths[i];
+    if (std::abs(d) <= boundary) return d > 0 ? static_cast<int>(i + 1) : -static_cast<int>(i + 1);
+  }
+  return 0;
+}
+
+void FrenetTransform::toFrenetLine(const double* const poses, const std::size_t begin, const std::size_t end,
+                                   double* const s, double* const d, double* const heading_error, int* const lane,
+                                   std::size_t* const road) const {
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  for (std::size_t i = begin; i < end; ++i) {
+    const double x = poses[3 * i], y = poses[3 * i + 1], heading = poses[3 * i + 2];
+    std::optional<std::pair<double, double>> best;
+    index_.query(x, y, [&](const LaneIndex::Quad& quad) {
+      // Neighbouring stretches would converge to the same projection
+      if (best && best->first >= quad.s_start - (quad.s_end - quad.s_start) &&
+          best->first <= quad.s_end + (quad.s_end - quad.s_start))
+        return;
+      // Initial guess from the projection on the chord of the stretch
+      const double start_x = (quad.x[0] + quad.x[3]) / 2, start_y = (quad.y[0] + quad.y[3]) / 2;
+      const double chord_x = (quad.x[1] + quad.x[2]) / 2 - start_x, chord_y = (quad.y[1] + quad.y[2]) / 2 - start_y;
+      const double chord = chord_x * chord_x + chord_y * chord_y;
+      const double along = (x - start_x) * chord_x + (y - start_y) * chord_y;
+      const double ratio = chord > 0 ? std::clamp(along / chord, 0.0, 1.0) : 0;
+      const std::pair<double, double> projection =
+          line_.project(x, y, quad.s_start + ratio * (quad.s_end - quad.s_start));
+      if (!best || std::abs(projection.second) < std::abs(best->second)) best = projection;
+    });
+    if (!best || std::abs(best->second) > max_offset_) {
+      s[i] = d[i] = heading_error[i] = nan;
+      lane[i] = 0;
+      road[i] = npos;
+      continue;
+    }
+    s[i] = best->first;
+    d[i] = best->second;
+    lane[i] = laneId(d[i]);
+    road[i] = 0;
+    // Lanes on the left drive against the reference line
+    heading_error[i] = wrapAngle(heading - line_.point(s[i]).heading - (lane[i] > 0 ? pi : 0));
+  }
+}
+
+void FrenetTransform::toFrenetNetwork(const double* const poses, const std::size_t begin, const std::size_t end,
+                                      double* const s, double* const d, double* const heading_error, int* const lane,
+                                      std::size_t* const road) const {
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  for (std::size_t i = begin; i < end; ++i) {
+    const double heading = poses[3 * i + 2];
+    const std::optional<RoadNetwork::LaneLocation> location = network_->locate(poses[3 * i], poses[3 * i + 1]);
+    if (!location) {
+      s[i] = d[i] = heading_error[i] = nan;
+      lane[i] = 0;
+      road[i] = npos;
+      continue;
+    }
+    s[i] = location->s;
+    d[i] = location->t;
+    lane[i] = location->lane;
+    road[i] = location->road;
+    const double reference_heading = network_->roads()[location->road].reference_line.point(location->s).heading;
+    heading_error[i] = wrapAngle(heading - reference_heading - (location->lane > 0 ? pi : 0));
+  }
+}
+
+void FrenetTransform::toFrenet(const double* const poses, const std::size_t n, double* const s, double* const d,
+                               double* const heading_error, int* const lane, std::size_t* const road) const {
+  parallelFor(n, threads_, [&](const std::size_t begin, const std::size_t end) {
+    if (network_ == nullptr) {
+      toFrenetLine(poses, begin, end, s, d, heading_error, lane, road);
+    } else {
+      toFrenetNetwork(poses, begin, end, s, d, heading_error, lane, road);
+    }
+  });
+}
+
+FrenetTransform::Coordinates FrenetTransform::toFrenet(const std::vector<double>& poses) const {
+  if (poses.size() % 3 != 0) SYMAWARE_INVALID_ARGUMENT("poses", poses.size());
+  const std::size_t n = poses.size() / 3;
+  Coordinates coordinates{std::vector<double>(n), std::vector<double>(n), std::vector<double>(n),
+                          std::vector<int>(n), std::vector<std::size_t>(n)};
+  toFrenet(poses.data(), n, coordinates.s.data(), coordinates.d.data(), coordinates.heading_error.data(),
+           coordinates.lane.data(), coordinates.road.data());
+  return coordinates;
+}
+
+void FrenetTransform::fromFrenet(const std::size_t* const road, const double* const s, const double* const d,
+                                 const std::size_t n, double* const poses) const {
+  if (network_ != nullptr) {
+    for (std::size_t i = 0; i < n; ++i)
+      if (road[i] >= network_->roads().size())
+        SYMAWARE_OUT_OF_RANGE_FMT("Road index {} is out of range, the network has {} roads", road[i],
+                                  network_->roads().size());
+  }
+  parallelFor(n, threads_, [&](const std::size_t begin, const std::size_t end) {
+    std::vector<double> x(end - begin), y(end - begin), heading(end - begin), curvature(end - begin);
+    for (std::size_t i = begin; i < end;) {
+      // Sample the run of coordinates on the same road together
+      std::size_t j = i + 1;
+      if (network_ != nullptr) {
+        while (j < end && road[j] == road[i]) ++j;
+      } else {
+        j = end;
+      }
+      const ReferenceLine& line = network_ == nullptr ? line_ : network_->roads()[road[i]].reference_line;
+      line.sample(s + i, j - i, x.data() + (i - begin), y.data() + (i - begin), heading.data() + (i - begin),
+                  curvature.data() + (i - begin));
+      i = j;
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::size_t k = i - begin;
+      poses[3 * i] = x[k] - d[i] * std::sin(heading[k]);
+      poses[3 * i + 1] = y[k] + d[i] * std::cos(heading[k]);
+      poses[3 * i + 2] = heading[k];
+    }
+  });
+}
+
+}  // namespace symaware
@@ -0,0 +1,337 @@
+#include "symaware/map/json.h"
+
+#include <fmt/core.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Size of the chunks the document is read in */
+constexpr std::size_t chunk_size = 1 << 16;
+
+bool isSpace(const int c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+bool isDigit(const int c) { return c >= '0' && c <= '9'; }
+
+int hexValue(const int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void appendUtf8(std::string& out, const std::uint32_t code_point) {
+  if (code_point < 0x80) {
+    out.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
+std::string_view tokenName(const JsonReader::Token token) {
+  switch (token) {
+    case JsonReader::Token::BEGIN_OBJECT:
+      return "'{'";
+    case JsonReader::Token::END_OBJECT:
+      return "'}'";
+    case JsonReader::Token::BEGIN_ARRAY:
+      return "'['";
+    case JsonReader::Token::END_ARRAY:
+      return "']'";
+    case JsonReader::Token::KEY:
+      return "a key";
+    case JsonReader::Token::STRING:
+      return "a string";
+    case JsonReader::Token::NUMBER:
+      return "a number";
+    case JsonReader::Token::BOOLEAN:
+      return "a boolean";
+    case JsonReader::Token::NULL_VALUE:
+      return "null";
+    case JsonReader::Token::END:
+      return "the end of the document";
+    default:
+      return "an unknown token";
+  }
+}
+
+}  // namespace
+
+JsonReader::JsonReader(std::istream& is)
+    : is_{is},
+      buffer_(chunk_size),
+      pos_{0},
+      size_{0},
+      line_{1},
+      containers_{},
+      expect_value_{true},
+      allow_close_{false},
+      after_key_{false},
+      token_{Token::END},
+      string_{},
+      number_text_{},
+      number_{0},
+      boolean_{false} {}
+
+int JsonReader::refill() {
+  if (!is_) return EOF;
+  is_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  size_ = static_cast<std::size_t>(is_.gcount());
+  pos_ = 0;
+  if (size_ == 0) return EOF;
+  return static_cast<unsigned char>(buffer_[pos_]);
+}
+
+int JsonReader::get() {
+  const int c = peek();
+  if (c == EOF) return EOF;
+  ++pos_;
+  if (c == '\n') ++line_;
+  return c;
+}
+
+void JsonReader::skipSpaces() {
+  while (isSpace(peek())) get();
+}
+
+void JsonReader::error(const std::string_view message) const {
+  SYMAWARE_RUNTIME_ERROR_FMT("Malformed JSON at line {}: {}", line_, message);
+}
+
+JsonReader::Token JsonReader::next() {
+  skipSpaces();
+  if (containers_.empty() && !expect_value_) {
+    if (peek() != EOF) error("unexpected content after the root value");
+    return token_ = Token::END;
+  }
+  const bool in_object = !containers_.empty() && containers_.back() == '{';
+  const char closing = in_object ? '}' : ']';
+
+  if (!expect_value_) {
+    // After a value inside a container, either a comma or the end of the container
+    const int c = get();
+    if (c == ',') {
+      expect_value_ = true;
+      allow_close_ = false;
+      skipSpaces();
+    } else if (c == closing) {
+      containers_.pop_back();
+      return token_ = in_object ? Token::END_OBJECT : Token::END_ARRAY;
+    } else {
+      error(fmt::format("expected ',' or '{}'", closing));
+    }
+  }
+
+  const int c = peek();
+  if (allow_close_ && c == closing) {
+    get();
+    containers_.pop_back();
+    expect_value_ = false;
+    allow_close_ = false;
+    return token_ = in_object ? Token::END_OBJECT : Token::END_ARRAY;
+  }
+  allow_close_ = false;
+  if (in_object && !after_key_) {
+    if (c != '"') error("expected a key");
+    get();
+    readStringContent();
+    skipSpaces();
+    if (get() != ':') error("expected ':' after the key");
+    after_key_ = true;
+    return token_ = Token::KEY;
+  }
+
+  after_key_ = false;
+  expect_value_ = false;
+  switch (c) {
+    case '{':
+    case '[':
+      get();
+      containers_.push_back(static_cast<char>(c));
+      expect_value_ = true;
+      allow_close_ = true;
+      return token_ = c == '{' ? Token::BEGIN_OBJECT : Token::BEGIN_ARRAY;
+    case '"':
+      get();
+      readStringContent();
+      return token_ = Token::STRING;
+    case 't':
+      readLiteral("true");
+      boolean_ = true;
+      return token_ = Token::BOOLEAN;
+    case 'f':
+      readLiteral("false");
+      boolean_ = false;
+      return token_ = Token::BOOLEAN;
+    case 'n':
+      readLiteral("null");
+      return token_ = Token::NULL_VALUE;
+    case EOF:
+      error("unexpected end of the document");
+    default:
+      if (c != '-' && !isDigit(c)) error("expected a value");
+      readNumberContent();
+      return token_ = Token::NUMBER;
+  }
+}
+
+void JsonReader::expect(const Token token) {
+  if (next() != token) error(fmt::format("expected {}, found {}", tokenName(token), tokenName(token_)));
+}
+
+void JsonReader::skipValue() {
+  std::size_t depth = 0;
+  do {
+    switch (next()) {
+      case Token::BEGIN_OBJECT:
+      case Token::BEGIN_ARRAY:
+        ++depth;
+        break;
+      case Token::END_OBJECT:
+      case Token::END_ARRAY:
+        if (depth == 0) error("expected a value");
+        --depth;
+        break;
+      case Token::KEY:
+        break;
+      case Token::END:
+        error("unexpected end of the document");
+      default:
+        break;
+    }
+  } while (depth > 0 || token_ == Token::KEY);
+}
+
+double JsonReader::readNumber() {
+  expect(Token::NUMBER);
+  return number_;
+}
+
+const std::string& JsonReader::readString() {
+  expect(Token::STRING);
+  return string_;
+}
+
+bool JsonReader::readBoolean() {
+  expect(Token::BOOLEAN);
+  return boolean_;
+}
+
+void JsonReader::readStringContent() {
+  string_.clear();
+  while (true) {
+    const int c = get();
+    if (c == EOF) error("unterminated string");
+    if (c == '"') return;
+    if (c < 0x20) error("control character in string");
+    if (c != '\\') {
+      string_.push_back(static_cast<char>(c));
+      continue;
+    }
+    switch (get()) {
+      case '"':
+        string_.push_back('"');
+        break;
+      case '\\':
+        string_.push_back('\\');
+        break;
+      case '/':
+        string_.push_back('/');
+        break;
+      case 'b':
+        string_.push_back('\b');
+        break;
+      case 'f':
+        string_.push_back('\f');
+        break;
+      case 'n':
+        string_.push_back('\n');
+        break;
+      case 'r':
+        string_.push_back('\r');
+        break;
+      case 't':
+        string_.push_back('\t');
+        break;
+      case 'u': {
+        const auto readCodeUnit = [this]() {
+          std::uint32_t code_unit = 0;
+          for (int i = 0; i < 4; ++i) {
+            const int digit = hexValue(get());
+            if (digit < 0) error("invalid unicode escape");
+            code_unit = code_unit * 16 + static_cast<std::uint32_t>(digit);
+          }
+          return code_unit;
+        };
+        std::uint32_t code_point = readCodeUnit();
+        // Characters outside the basic multilingual plane are escaped as surrogate pairs
+        if (code_point >= 0xD800 && code_point < 0xDC00) {
+          if (get() != '\\' || get() != 'u') error("unpaired surrogate in unicode escape");
+          const std::uint32_t low = readCodeUnit();
+          if (low < 0xDC00 || low >= 0xE000) error("unpaired surrogate in unicode escape");
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+        } else if (code_point >= 0xDC00 && code_point < 0xE000) {
+          error("unpaired surrogate in unicode escape");
+        }
+        appendUtf8(string_, code_point);
+        break;
+      }
+      default:
+        error("invalid escape sequence in string");
+    }
+  }
+}
+
+void JsonReader::readNumberContent() {
+  // Validate the grammar of the number while collecting it, since from_chars accepts a larger set of inputs
+  std::string& number = number_text_;
+  number.clear();
+  const auto digits = [&]() {
+    if (!isDigit(peek())) error("expected a digit in number");
+    while (isDigit(peek())) number.push_back(static_cast<char>(get()));
+  };
+  if (peek() == '-') number.push_back(static_cast<char>(get()));
+  if (peek() == '0') {
+    number.push_back(static_cast<char>(get()));
+  } else {
+    digits();
+  }
+  if (peek() == '.') {
+    number.push_back(static_cast<char>(get()));
+    digits();
+  }
+  if (peek() == 'e' || peek() == 'E') {
+    number.push_back(static_cast<char>(get()));
+    if (peek() == '+' || peek() == '-') number.push_back(static_cast<char>(get()));
+    digits();
+  }
+  // Unlike strtod, from_chars does not depend on the locale, e.g. on its decimal separator
+  const char* const end = number.data() + number.size();
+  const auto [ptr, ec] = std::from_chars(number.data(), end, number_);
+  if (ec != std::errc{} || ptr != end) error("number out of range");
+}
+
+void JsonReader::readLiteral(const std::string_view literal) {
+  for (const char c : literal)
+    if (get() != c) error(fmt::format("expected '{}'", literal));
+}
+
+}  // namespace symaware
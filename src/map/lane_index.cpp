@@ -0,0 +1,71 @@
+#include "symaware/map/lane_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+bool LaneIndex::Quad::contains(const double px, const double py) const {
+  // The point is inside a convex polygon if it lies on the same side of all the edges
+  bool has_positive = false, has_negative = false;
+  for (std::size_t i = 0; i < 4; ++i) {
+    const std::size_t j = (i + 1) % 4;
+    const double cross = (x[j] - x[i]) * (py - y[i]) - (y[j] - y[i]) * (px - x[i]);
+    has_positive |= cross > 0;
+    has_negative |= cross < 0;
+    if (has_positive && has_negative) return false;
+  }
+  return true;
+}
+
+LaneIndex::LaneIndex(const double cell_size) : cell_size_{cell_size} {
+  if (!(cell_size > 0)) SYMAWARE_INVALID_ARGUMENT("cell_size", cell_size);
+}
+
+std::uint64_t LaneIndex::cellKey(const double x, const double y) const {
+  return cellKey(static_cast<std::int64_t>(std::floor(x / cell_size_)),
+                 static_cast<std::int64_t>(std::floor(y / cell_size_)));
+}
+
+void LaneIndex::insert(const Quad& quad) {
+  const auto index = static_cast<std::uint32_t>(quads_.size());
+  quads_.push_back(quad);
+  const auto [min_x, max_x] = std::minmax_element(quad.x.begin(), quad.x.end());
+  const auto [min_y, max_y] = std::minmax_element(quad.y.begin(), quad.y.end());
+  const auto i_min = static_cast<std::int64_t>(std::floor(*min_x / cell_size_));
+  const auto i_max = static_cast<std::int64_t>(std::floor(*max_x / cell_size_));
+  const auto j_min = static_cast<std::int64_t>(std::floor(*min_y / cell_size_));
+  const auto j_max = static_cast<std::int64_t>(std::floor(*max_y / cell_size_));
+  for (std::int64_t i = i_min; i <= i_max; ++i)
+    for (std::int64_t j = j_min; j <= j_max; ++j) pending_.emplace_back(cellKey(i, j), index);
+}
+
+void LaneIndex::build() {
+  for (const auto& [cell, range] : cells_)
+    for (std::uint32_t i = range.first; i < range.second; ++i) pending_.emplace_back(cell, entries_[i]);
+  std::sort(pending_.begin(), pending_.end());
+  entries_.clear();
+  entries_.reserve(pending_.size());
+  cells_.clear();
+  for (std::size_t i = 0; i < pending_.size();) {
+    const std::uint64_t cell = pending_[i].first;
+    const auto first = static_cast<std::uint32_t>(entries_.size());
+    for (; i < pending_.size() && pending_[i].first == cell; ++i) entries_.push_back(pending_[i].second);
+    cells_.emplace(cell, std::pair{first, static_cast<std::uint32_t>(entries_.size())});
+  }
+  pending_.clear();
+  pending_.shrink_to_fit();
+}
+
+void LaneIndex::clear() {
+  quads_.clear();
+  pending_.clear();
+  entries_.clear();
+  cells_.clear();
+}
+
+}  // namespace symaware
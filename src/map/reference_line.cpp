@@ -0,0 +1,423 @@
+#include "symaware/map/reference_line.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "symaware/util/constants.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Nodes and weights of the 8 points Gauss-Legendre quadrature on [-1, 1] */
+constexpr std::array<double, 4> gauss_nodes{0.1834346424956498, 0.5255324099163290, 0.7966664774136267,
+                                            0.9602898564975363};
+constexpr std::array<double, 4> gauss_weights{0.3626837833783620, 0.3137066458778873, 0.2223810344533745,
+                                              0.1012285362903763};
+/** Samples of the arc length table of a cubic polynomial geometry */
+constexpr std::size_t arc_length_samples = 64;
+/** Beyond this argument, the phase of the Fresnel integrals of a spiral is too large to be evaluated accurately */
+constexpr double max_fresnel_argument = 1e3;
+
+/** Integrate @p f over [@p a, @p b] with the 8 points Gauss-Legendre quadrature */
+template <class F>
+double integrate(F&& f, const double a, const double b) {
+  const double half = (b - a) / 2, mid = (a + b) / 2;
+  double sum = 0;
+  for (std::size_t i = 0; i < gauss_nodes.size(); ++i)
+    sum += gauss_weights[i] * (f(mid - half * gauss_nodes[i]) + f(mid + half * gauss_nodes[i]));
+  return sum * half;
+}
+
+/** Displacement along a clothoid starting with @p heading and curvature @p k0, changing by @p rate per metre */
+std::pair<double, double> integrateClothoid(const double heading, const double k0, const double rate,
+                                            const double ds) {
+  // Split the clothoid in panels where the heading changes little, so that the quadrature stays exact
+  const double max_turn = std::abs(k0) * ds + std::abs(rate) * ds * ds / 2;
+  const auto panels = static_cast<std::size_t>(std::ceil(max_turn / 0.5)) + 1;
+  const double step = ds / static_cast<double>(panels);
+  const auto theta = [&](const double u) { return heading + k0 * u + rate * u * u / 2; };
+  double dx = 0, dy = 0;
+  for (std::size_t i = 0; i < panels; ++i) {
+    const double a = step * static_cast<double>(i), b = a + step;
+    dx += integrate([&](const double u) { return std::cos(theta(u)); }, a, b);
+    dy += integrate([&](const double u) { return std::sin(theta(u)); }, a, b);
+  }
+  return {dx, dy};
+}
+
+double polynomial(const double a, const double b, const double c, const double d, const double u) {
+  return a + u * (b + u * (c + u * d));
+}
+double polynomialDerivative(const double b, const double c, const double d, const double u) {
+  return b + u * (2 * c + u * 3 * d);
+}
+
+/** Arc length element of the cubic polynomial geometry @p geometry at the parameter @p u */
+double poly3ArcLengthElement(const ReferenceLine::Geometry& geometry, const double u) {
+  const double dv = polynomialDerivative(geometry.parameters[1], geometry.parameters[2], geometry.parameters[3], u);
+  return std::sqrt(1 + dv * dv);
+}
+
+}  // namespace
+
+std::pair<double, double> fresnel(const double x) {
+  constexpr double eps = 1e-16;
+  constexpr std::size_t max_iterations = 100;
+  const double ax = std::abs(x);
+  double c, s;
+  if (ax < 1e-150) {
+    c = ax;
+    s = 0;
+  } else if (ax <= 1.5) {
+    // Power series, alternating between the terms of C and S
+    double sum = 0, sum_s = 0, sum_c = ax, sign = 1, term = ax, n = 3;
+    const double fact = pi / 2 * ax * ax;
+    bool odd = true;
+    for (std::size_t k = 1; k <= max_iterations; ++k) {
+      term *= fact / static_cast<double>(k);
+      sum += sign * term / n;
+      const double test = std::abs(sum) * eps;
+      if (odd) {
+        sign = -sign;
+        sum_s = sum;
+        sum = sum_c;
+      } else {
+        sum_c = sum;
+        sum = sum_s;
+      }
+      if (term < test) break;
+      odd = !odd;
+      n += 2;
+    }
+    c = sum_c;
+    s = sum_s;
+  } else {
+    // Continued fraction of the complementary error function, evaluated with the modified Lentz's method
+    const double pix2 = pi * ax * ax;
+    std::complex<double> b{1, -pix2};
+    std::complex<double> cc{1e300, 0};
+    std::complex<double> d = 1.0 / b;
+    std::complex<double> h = d;
+    double n = -1;
+    for (std::size_t k = 2; k <= max_iterations; ++k) {
+      n += 2;
+      const double a = -n * (n + 1);
+      b += 4.0;
+      d = 1.0 / (a * d + b);
+      cc = b + a / cc;
+      const std::complex<double> del = cc * d;
+      h *= del;
+      if (std::abs(del.real() - 1) + std::abs(del.imag()) < eps) break;
+    }
+    h *= std::complex<double>{ax, -ax};
+    const std::complex<double> cs =
+        std::complex<double>{0.5, 0.5} * (1.0 - std::complex<double>{std::cos(pix2 / 2), std::sin(pix2 / 2)} * h);
+    c = cs.real();
+    s = cs.imag();
+  }
+  return x < 0 ? std::pair{-c, -s} : std::pair{c, s};
+}
+
+ReferenceLine::Geometry ReferenceLine::Geometry::line(const double s, const double x, const double y,
+                                                      const double heading, const double length) {
+  return {GeometryType::Line, s, x, y, heading, length, {}, false};
+}
+ReferenceLine::Geometry ReferenceLine::Geometry::arc(const double s, const double x, const double y,
+                                                     const double heading, const double length,
+                                                     const double curvature) {
+  return {GeometryType::Arc, s, x, y, heading, length, {curvature}, false};
+}
+ReferenceLine::Geometry ReferenceLine::Geometry::spiral(const double s, const double x, const double y,
+                                                        const double heading, const double length,
+                                                        const double curvature_start, const double curvature_end) {
+  return {GeometryType::Spiral, s, x, y, heading, length, {curvature_start, curvature_end}, false};
+}
+ReferenceLine::Geometry ReferenceLine::Geometry::poly3(const double s, const double x, const double y,
+                                                       const double heading, const double length, const double a,
+                                                       const double b, const double c, const double d) {
+  return {GeometryType::Poly3, s, x, y, heading, length, {a, b, c, d}, false};
+}
+ReferenceLine::Geometry ReferenceLine::Geometry::paramPoly3(const double s, const double x, const double y,
+                                                            const double heading, const double length,
+                                                            const std::array<double, 4>& u,
+                                                            const std::array<double, 4>& v, const bool normalized) {
+  return {GeometryType::ParamPoly3,
+          s,
+          x,
+          y,
+          heading,
+          length,
+          {u[0], u[1], u[2], u[3], v[0], v[1], v[2], v[3]},
+          normalized};
+}
+
+ReferenceLine::ReferenceLine(const double x, const double y, const double heading)
+    : origin_x_{x}, origin_y_{y}, origin_heading_{heading}, geometries_{}, arc_length_tables_{} {}
+
+void ReferenceLine::addGeometry(const Geometry& geometry) {
+  if (!(geometry.length > 0)) SYMAWARE_INVALID_ARGUMENT("geometry.length", geometry.length);
+  if (!geometries_.empty() && geometry.s < end() - 1e-6) SYMAWARE_INVALID_ARGUMENT("geometry.s", geometry.s);
+  geometries_.push_back(geometry);
+  arc_length_tables_.emplace_back();
+  if (geometry.type != GeometryType::Poly3) return;
+
+  // Sample the arc length along u until it covers the whole geometry. Since ds >= du, u never exceeds the length
+  ArcLengthTable& table = arc_length_tables_.back();
+  const double step = geometry.length / static_cast<double>(arc_length_samples);
+  const auto element = [&geometry](const double u) { return poly3ArcLengthElement(geometry, u); };
+  table.u.push_back(0);
+  table.s.push_back(0);
+  while (table.s.back() < geometry.length && table.u.size() <= arc_length_samples) {
+    const double u = table.u.back();
+    table.u.push_back(u + step);
+    table.s.push_back(table.s.back() + integrate(element, u, u + step));
+  }
+}
+
+ReferenceLine& ReferenceLine::addLine(const double length) {
+  const Point start = chainStart();
+  addGeometry(Geometry::line(end(), start.x, start.y, start.heading, length));
+  return *this;
+}
+ReferenceLine& ReferenceLine::addArc(const double length, const double curvature) {
+  const Point start = chainStart();
+  addGeometry(Geometry::arc(end(), start.x, start.y, start.heading, length, curvature));
+  return *this;
+}
+ReferenceLine& ReferenceLine::addSpiral(const double length, const double curvature_start,
+                                        const double curvature_end) {
+  const Point start = chainStart();
+  addGeometry(Geometry::spiral(end(), start.x, start.y, start.heading, length, curvature_start, curvature_end));
+  return *this;
+}
+ReferenceLine& ReferenceLine::addPoly3(const double length, const double a, const double b, const double c,
+                                       const double d) {
+  const Point start = chainStart();
+  addGeometry(Geometry::poly3(end(), start.x, start.y, start.heading, length, a, b, c, d));
+  return *this;
+}
+ReferenceLine& ReferenceLine::addParamPoly3(const double length, const std::array<double, 4>& u,
+                                            const std::array<double, 4>& v, const bool normalized) {
+  const Point start = chainStart();
+  addGeometry(Geometry::paramPoly3(end(), start.x, start.y, start.heading, length, u, v, normalized));
+  return *this;
+}
+
+void ReferenceLine::setOrigin(const double x, const double y, const double heading) {
+  const double rotation = heading - origin_heading_;
+  const double cos_r = std::cos(rotation), sin_r = std::sin(rotation);
+  for (Geometry& geometry : geometries_) {
+    const double dx = geometry.x - origin_x_, dy = geometry.y - origin_y_;
+    geometry.x = x + dx * cos_r - dy * sin_r;
+    geometry.y = y + dx * sin_r + dy * cos_r;
+    geometry.heading += rotation;
+  }
+  origin_x_ = x;
+  origin_y_ = y;
+  origin_heading_ = heading;
+}
+
+double ReferenceLine::length() const {
+  double length = 0;
+  for (const Geometry& geometry : geometries_) length += geometry.length;
+  return length;
+}
+
+std::size_t ReferenceLine::geometryIndex(const double s) const {
+  const auto it = std::upper_bound(geometries_.begin(), geometries_.end(), s,
+                                   [](const double value, const Geometry& geometry) { return value < geometry.s; });
+  return it == geometries_.begin() ? 0 : static_cast<std::size_t>(it - geometries_.begin()) - 1;
+}
+
+ReferenceLine::Point ReferenceLine::chainStart() const {
+  return geometries_.empty() ? Point{origin_x_, origin_y_, origin_heading_, 0} : point(end());
+}
+
+ReferenceLine::Point ReferenceLine::point(const double s) const {
+  if (geometries_.empty()) SYMAWARE_RUNTIME_ERROR("The reference line has no geometries");
+  Point point{};
+  sampleGeometry(geometryIndex(s), &s, 1, &point.x, &point.y, &point.heading, &point.curvature);
+  return point;
+}
+
+void ReferenceLine::sample(const double* const s, const std::size_t n, double* const x, double* const y,
+                           double* const heading, double* const curvature) const {
+  if (n == 0) return;
+  if (geometries_.empty()) SYMAWARE_RUNTIME_ERROR("The reference line has no geometries");
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  for (std::size_t i = 0; i < n;) {
+    // Collect the run of arc lengths that fall in the same geometry
+    const std::size_t index = geometryIndex(s[i]);
+    const double lower = index == 0 ? -infinity : geometries_[index].s;
+    const double upper = index + 1 == geometries_.size() ? infinity : geometries_[index + 1].s;
+    std::size_t j = i + 1;
+    while (j < n && s[j] >= lower && s[j] < upper) ++j;
+    sampleGeometry(index, s + i, j - i, x + i, y + i, heading + i, curvature + i);
+    i = j;
+  }
+}
+
+ReferenceLine::Samples ReferenceLine::sample(std::vector<double> s) const {
+  Samples samples{std::move(s), {}, {}, {}, {}};
+  const std::size_t n = samples.size();
+  samples.x.resize(n);
+  samples.y.resize(n);
+  samples.heading.resize(n);
+  samples.curvature.resize(n);
+  sample(samples.s.data(), n, samples.x.data(), samples.y.data(), samples.heading.data(), samples.curvature.data());
+  return samples;
+}
+
+ReferenceLine::Samples ReferenceLine::sampleUniform(const double step) const {
+  if (!(step > 0)) SYMAWARE_INVALID_ARGUMENT("step", step);
+  const double first = start(), last = end();
+  const auto steps = static_cast<std::size_t>(std::floor((last - first) / step));
+  std::vector<double> s;
+  s.reserve(steps + 2);
+  for (std::size_t i = 0; i <= steps; ++i) s.push_back(first + step * static_cast<double>(i));
+  if (last - s.back() > 1e-9) s.push_back(last);
+  return sample(std::move(s));
+}
+
+void ReferenceLine::sampleGeometry(const std::size_t index, const double* const s, const std::size_t n,
+                                   double* const x, double* const y, double* const heading,
+                                   double* const curvature) const {
+  const Geometry& g = geometries_[index];
+  const double cos_h = std::cos(g.heading), sin_h = std::sin(g.heading);
+  const auto local = [&g](const double value) { return std::clamp(value - g.s, 0.0, g.length); };
+  switch (g.type) {
+    case GeometryType::Line:
+      for (std::size_t i = 0; i < n; ++i) {
+        const double ds = local(s[i]);
+        x[i] = g.x + ds * cos_h;
+        y[i] = g.y + ds * sin_h;
+        heading[i] = g.heading;
+        curvature[i] = 0;
+      }
+      return;
+    case GeometryType::Arc: {
+      const double k = g.parameters[0];
+      if (std::abs(k) < 1e-12) {
+        for (std::size_t i = 0; i < n; ++i) {
+          const double ds = local(s[i]);
+          x[i] = g.x + ds * cos_h;
+          y[i] = g.y + ds * sin_h;
+          heading[i] = g.heading;
+          curvature[i] = k;
+        }
+        return;
+      }
+      const double radius = 1 / k;
+      for (std::size_t i = 0; i < n; ++i) {
+        const double h = g.heading + k * local(s[i]);
+        x[i] = g.x + (std::sin(h) - sin_h) * radius;
+        y[i] = g.y - (std::cos(h) - cos_h) * radius;
+        heading[i] = h;
+        curvature[i] = k;
+      }
+      return;
+    }
+    case GeometryType::Spiral: {
+      const double k0 = g.parameters[0], rate = (g.parameters[1] - g.parameters[0]) / g.length;
+      const double sigma = std::sqrt(std::abs(rate) / pi);
+      const double t0 = rate == 0 ? 0 : sigma * k0 / rate, t_end = rate == 0 ? 0 : sigma * (g.length + k0 / rate);
+      const bool use_fresnel =
+          rate != 0 && std::abs(t0) <= max_fresnel_argument && std::abs(t_end) <= max_fresnel_argument;
+      // The clothoid is a scaled and rotated Fresnel spiral, starting at the parameter t0
+      const double sign = rate > 0 ? 1 : -1;
+      const double phi = use_fresnel ? g.heading - k0 * k0 / (2 * rate) : 0;
+      const double cos_phi = std::cos(phi) / sigma, sin_phi = std::sin(phi) / sigma;
+      const auto [c0, s0] = use_fresnel ? fresnel(t0) : std::pair{0.0, 0.0};
+      for (std::size_t i = 0; i < n; ++i) {
+        const double ds = local(s[i]);
+        heading[i] = g.heading + k0 * ds + rate * ds * ds / 2;
+        curvature[i] = k0 + rate * ds;
+        if (use_fresnel) {
+          const auto [c1, s1] = fresnel(sigma * (ds + k0 / rate));
+          const double dc = c1 - c0, dsf = sign * (s1 - s0);
+          x[i] = g.x + cos_phi * dc - sin_phi * dsf;
+          y[i] = g.y + sin_phi * dc + cos_phi * dsf;
+        } else {
+          const auto [dx, dy] = integrateClothoid(g.heading, k0, rate, ds);
+          x[i] = g.x + dx;
+          y[i] = g.y + dy;
+        }
+      }
+      return;
+    }
+    case GeometryType::Poly3: {
+      const ArcLengthTable& table = arc_length_tables_[index];
+      const std::array<double, 8>& k = g.parameters;
+      const auto element = [&g](const double u) { return poly3ArcLengthElement(g, u); };
+      std::size_t j = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        const double ds = local(s[i]);
+        // Sorted arc lengths move through the table monotonically, so the last interval is a good first guess
+        if (ds < table.s[j] || ds >= table.s[j + 1]) {
+          const auto it = std::upper_bound(table.s.begin(), table.s.end(), ds);
+          j = std::clamp<std::size_t>(static_cast<std::size_t>(it - table.s.begin()), 1, table.s.size() - 1) - 1;
+        }
+        // Invert the arc length table, then refine u with Newton's method
+        double u = table.u[j] + (ds - table.s[j]) / (table.s[j + 1] - table.s[j]) * (table.u[j + 1] - table.u[j]);
+        for (int iteration = 0; iteration < 3; ++iteration)
+          u -= (table.s[j] + integrate(element, table.u[j], u) - ds) / element(u);
+        const double v = polynomial(k[0], k[1], k[2], k[3], u), dv = polynomialDerivative(k[1], k[2], k[3], u);
+        const double ddv = 2 * k[2] + 6 * k[3] * u;
+        x[i] = g.x + u * cos_h - v * sin_h;
+        y[i] = g.y + u * sin_h + v * cos_h;
+        heading[i] = g.heading + std::atan(dv);
+        curvature[i] = ddv / std::pow(1 + dv * dv, 1.5);
+      }
+      return;
+    }
+    case GeometryType::ParamPoly3: {
+      const std::array<double, 8>& k = g.parameters;
+      const double scale = g.normalized ? 1 / g.length : 1;
+      for (std::size_t i = 0; i < n; ++i) {
+        const double p = local(s[i]) * scale;
+        const double u = polynomial(k[0], k[1], k[2], k[3], p), v = polynomial(k[4], k[5], k[6], k[7], p);
+        const double du = polynomialDerivative(k[1], k[2], k[3], p), dv = polynomialDerivative(k[5], k[6], k[7], p);
+        const double ddu = 2 * k[2] + 6 * k[3] * p, ddv = 2 * k[6] + 6 * k[7] * p;
+        const double speed_squared = du * du + dv * dv;
+        x[i] = g.x + u * cos_h - v * sin_h;
+        y[i] = g.y + u * sin_h + v * cos_h;
+        heading[i] = g.heading + std::atan2(dv, du);
+        curvature[i] = speed_squared == 0 ? 0 : (du * ddv - dv * ddu) / std::pow(speed_squared, 1.5);
+      }
+      return;
+    }
+  }
+  SYMAWARE_UNREACHABLE();
+}
+
+std::pair<double, double> ReferenceLine::project(const double x, const double y, double s) const {
+  const double s_min = start(), s_max = end();
+  s = std::clamp(s, s_min, s_max);
+  double t = 0;
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    const Point p = point(s);
+    const double dx = x - p.x, dy = y - p.y;
+    const double cos_h = std::cos(p.heading), sin_h = std::sin(p.heading);
+    const double along = dx * cos_h + dy * sin_h;
+    t = -dx * sin_h + dy * cos_h;
+    // Moving along the line by ds moves the projection of a point at offset t by ds * (1 - curvature * t)
+    const double scale = 1 - p.curvature * t;
+    const double next = std::clamp(s + (scale > 0.1 ? along / scale : along), s_min, s_max);
+    const bool converged = std::abs(next - s) < 1e-9;
+    s = next;
+    if (converged) break;
+  }
+  const Point p = point(s);
+  return {s, -(x - p.x) * std::sin(p.heading) + (y - p.y) * std::cos(p.heading)};
+}
+
+}  // namespace symaware
@@ -0,0 +1,479 @@
+#include "symaware/map/road_network.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/xml.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** @return value of the required attribute @p name of the @p node */
+const std::string& requiredAttribute(const XmlNode& node, const std::string_view name) {
+  const std::string* const value = node.attribute(name);
+  if (value == nullptr) SYMAWARE_RUNTIME_ERROR_FMT("Missing attribute '{}' in OpenDRIVE element '{}'", name, node.name);
+  return *value;
+}
+/** @return value of the attribute @p name of the @p node, or @p fallback if the attribute is missing */
+std::string attribute(const XmlNode& node, const std::string_view name, const std::string& fallback = "") {
+  const std::string* const value = node.attribute(name);
+  return value == nullptr ? fallback : *value;
+}
+double toNumber(const XmlNode& node, const std::string_view name, const std::string& value) {
+  // Unlike strtod, from_chars does not depend on the locale, but it rejects the leading '+' allowed by OpenDRIVE
+  const char* first = value.data();
+  const char* const last = value.data() + value.size();
+  if (value.size() > 1 && value[0] == '+' && value[1] != '-') ++first;
+  double number = 0;
+  const auto [end, error] = std::from_chars(first, last, number);
+  if (value.empty() || error != std::errc{} || end != last)
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid number '{}' for attribute '{}' in OpenDRIVE element '{}'", value, name,
+                               node.name);
+  return number;
+}
+/** @return numeric value of the required attribute @p name of the @p node */
+double number(const XmlNode& node, const std::string_view name) {
+  return toNumber(node, name, requiredAttribute(node, name));
+}
+int integer(const XmlNode& node, const std::string_view name) {
+  const double value = number(node, name);
+  if (value != std::floor(value))
+    SYMAWARE_RUNTIME_ERROR_FMT("Attribute '{}' of '{}' is not an integer", name, node.name);
+  return static_cast<int>(value);
+}
+
+RoadNetwork::ContactPoint parseContactPoint(const XmlNode& node) {
+  const std::string value = attribute(node, "contactPoint", "start");
+  if (value == "start") return RoadNetwork::ContactPoint::Start;
+  if (value == "end") return RoadNetwork::ContactPoint::End;
+  SYMAWARE_RUNTIME_ERROR_FMT("Invalid contact point '{}' in OpenDRIVE element '{}'", value, node.name);
+}
+
+RoadNetwork::Link parseLink(const XmlNode* const node) {
+  RoadNetwork::Link link;
+  if (node == nullptr) return link;
+  const std::string& type = requiredAttribute(*node, "elementType");
+  if (type == "road") {
+    link.element_type = RoadNetwork::Link::ElementType::Road;
+    link.contact_point = parseContactPoint(*node);
+  } else if (type == "junction") {
+    link.element_type = RoadNetwork::Link::ElementType::Junction;
+  } else {
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid element type '{}' in OpenDRIVE link", type);
+  }
+  link.element_id = requiredAttribute(*node, "elementId");
+  return link;
+}
+
+/** Parse all the children of @p parent named @p name as polynomials, starting from the attribute @p start */
+std::vector<RoadNetwork::CubicPolynomial> parsePolynomials(const XmlNode* const parent, const std::string_view name,
+                                                           const std::string_view start) {
+  std::vector<RoadNetwork::CubicPolynomial> polynomials;
+  if (parent == nullptr) return polynomials;
+  for (const XmlNode& node : parent->children) {
+    if (node.name != name) continue;
+    polynomials.push_back({number(node, start), number(node, "a"), number(node, "b"), number(node, "c"),
+                           number(node, "d")});
+  }
+  std::stable_sort(polynomials.begin(), polynomials.end(),
+                   [](const RoadNetwork::CubicPolynomial& lhs, const RoadNetwork::CubicPolynomial& rhs) {
+                     return lhs.s < rhs.s;
+                   });
+  return polynomials;
+}
+
+ReferenceLine::Geometry parseGeometry(const XmlNode& node) {
+  const double s = number(node, "s"), x = number(node, "x"), y = number(node, "y"), heading = number(node, "hdg");
+  const double length = number(node, "length");
+  for (const XmlNode& shape : node.children) {
+    if (shape.name == "line") return ReferenceLine::Geometry::line(s, x, y, heading, length);
+    if (shape.name == "arc")
+      return ReferenceLine::Geometry::arc(s, x, y, heading, length, number(shape, "curvature"));
+    if (shape.name == "spiral")
+      return ReferenceLine::Geometry::spiral(s, x, y, heading, length, number(shape, "curvStart"),
+                                             number(shape, "curvEnd"));
+    if (shape.name == "poly3")
+      return ReferenceLine::Geometry::poly3(s, x, y, heading, length, number(shape, "a"), number(shape, "b"),
+                                            number(shape, "c"), number(shape, "d"));
+    if (shape.name == "paramPoly3")
+      return ReferenceLine::Geometry::paramPoly3(
+          s, x, y, heading, length,
+          {number(shape, "aU"), number(shape, "bU"), number(shape, "cU"), number(shape, "dU")},
+          {number(shape, "aV"), number(shape, "bV"), number(shape, "cV"), number(shape, "dV")},
+          attribute(shape, "pRange", "normalized") == "normalized");
+  }
+  SYMAWARE_RUNTIME_ERROR_FMT("Unsupported geometry at s = {} in OpenDRIVE plan view", s);
+}
+
+std::vector<RoadNetwork::Lane> parseLanes(const XmlNode* const side) {
+  std::vector<RoadNetwork::Lane> lanes;
+  if (side == nullptr) return lanes;
+  for (const XmlNode& node : side->children) {
+    if (node.name != "lane") continue;
+    RoadNetwork::Lane lane{integer(node, "id"), attribute(node, "type", "none"),
+                           parsePolynomials(&node, "width", "sOffset"), std::nullopt, std::nullopt};
+    if (const XmlNode* const link = node.child("link"); link != nullptr) {
+      if (const XmlNode* const predecessor = link->child("predecessor"); predecessor != nullptr)
+        lane.predecessor = integer(*predecessor, "id");
+      if (const XmlNode* const successor = link->child("successor"); successor != nullptr)
+        lane.successor = integer(*successor, "id");
+    }
+    lanes.push_back(std::move(lane));
+  }
+  std::sort(lanes.begin(), lanes.end(), [](const RoadNetwork::Lane& lhs, const RoadNetwork::Lane& rhs) {
+    return std::abs(lhs.id) < std::abs(rhs.id);
+  });
+  return lanes;
+}
+
+RoadNetwork::Road parseRoad(const XmlNode& node) {
+  RoadNetwork::Road road;
+  road.id = requiredAttribute(node, "id");
+  road.name = attribute(node, "name");
+  road.length = number(node, "length");
+  road.junction = attribute(node, "junction", "-1");
+  if (const XmlNode* const link = node.child("link"); link != nullptr) {
+    road.predecessor = parseLink(link->child("predecessor"));
+    road.successor = parseLink(link->child("successor"));
+  }
+
+  const XmlNode* const plan_view = node.child("planView");
+  if (plan_view == nullptr) SYMAWARE_RUNTIME_ERROR_FMT("Road '{}' has no plan view", road.id);
+  for (const XmlNode& geometry : plan_view->children)
+    if (geometry.name == "geometry") road.reference_line.addGeometry(parseGeometry(geometry));
+  if (road.reference_line.geometries().empty()) SYMAWARE_RUNTIME_ERROR_FMT("Road '{}' has no geometries", road.id);
+
+  road.elevations = parsePolynomials(node.child("elevationProfile"), "elevation", "s");
+  const XmlNode* const lanes = node.child("lanes");
+  if (lanes == nullptr) return road;
+  road.lane_offsets = parsePolynomials(lanes, "laneOffset", "s");
+  for (const XmlNode& section : lanes->children) {
+    if (section.name != "laneSection") continue;
+    road.sections.push_back(
+        {number(section, "s"), road.length, parseLanes(section.child("left")), parseLanes(section.child("right"))});
+  }
+  std::stable_sort(road.sections.begin(), road.sections.end(),
+                   [](const RoadNetwork::LaneSection& lhs, const RoadNetwork::LaneSection& rhs) {
+                     return lhs.s < rhs.s;
+                   });
+  for (std::size_t i = 0; i + 1 < road.sections.size(); ++i) road.sections[i].s_end = road.sections[i + 1].s;
+  return road;
+}
+
+RoadNetwork::Junction parseJunction(const XmlNode& node) {
+  RoadNetwork::Junction junction{requiredAttribute(node, "id"), attribute(node, "name"), {}};
+  for (const XmlNode& child : node.children) {
+    if (child.name != "connection") continue;
+    RoadNetwork::Connection connection{attribute(child, "id"), requiredAttribute(child, "incomingRoad"),
+                                       requiredAttribute(child, "connectingRoad"), parseContactPoint(child), {}};
+    for (const XmlNode& lane_link : child.children)
+      if (lane_link.name == "laneLink")
+        connection.lane_links.emplace_back(integer(lane_link, "from"), integer(lane_link, "to"));
+    junction.connections.push_back(std::move(connection));
+  }
+  return junction;
+}
+
+/** @return value of the piecewise polynomial @p polynomials at the arc length @p s */
+double evaluate(const std::vector<RoadNetwork::CubicPolynomial>& polynomials, const double s) {
+  if (polynomials.empty()) return 0;
+  const auto it = std::upper_bound(
+      polynomials.begin(), polynomials.end(), s,
+      [](const double value, const RoadNetwork::CubicPolynomial& polynomial) { return value < polynomial.s; });
+  return it == polynomials.begin() ? polynomials.front()(s) : (*(it - 1))(s);
+}
+
+}  // namespace
+
+const RoadNetwork::Lane* RoadNetwork::LaneSection::lane(const int id) const {
+  if (id == 0) return nullptr;
+  const std::vector<Lane>& lanes = id > 0 ? left : right;
+  for (const Lane& lane : lanes)
+    if (lane.id == id) return &lane;
+  return nullptr;
+}
+
+std::size_t RoadNetwork::Road::section(const double s) const {
+  const auto it = std::upper_bound(sections.begin(), sections.end(), s,
+                                   [](const double value, const LaneSection& section) { return value < section.s; });
+  return it == sections.begin() ? 0 : static_cast<std::size_t>(it - sections.begin()) - 1;
+}
+double RoadNetwork::Road::elevation(const double s) const { return evaluate(elevations, s); }
+double RoadNetwork::Road::laneOffset(const double s) const { return evaluate(lane_offsets, s); }
+
+RoadNetwork::RoadNetwork(const double sample_step, const double cell_size)
+    : sample_step_{sample_step}, roads_{}, junctions_{}, lanes_{}, road_indices_{}, index_{cell_size} {
+  if (!(sample_step > 0)) SYMAWARE_INVALID_ARGUMENT("sample_step", sample_step);
+}
+
+void RoadNetwork::importOpenDriveFile(const std::string& filename) {
+  std::ifstream file{filename, std::ios::binary};
+  if (!file) SYMAWARE_RUNTIME_ERROR_FMT("Cannot open OpenDRIVE file '{}'", filename);
+  std::stringstream content;
+  content << file.rdbuf();
+  importOpenDrive(content.str());
+}
+
+void RoadNetwork::importOpenDrive(const std::string_view content) {
+  parse(parseXml(content));
+  buildLaneGraph();
+  buildIndex();
+}
+
+void RoadNetwork::clear() {
+  roads_.clear();
+  junctions_.clear();
+  lanes_.clear();
+  road_indices_.clear();
+  index_.clear();
+}
+
+void RoadNetwork::parse(const XmlNode& root) {
+  if (root.name != "OpenDRIVE") SYMAWARE_RUNTIME_ERROR_FMT("Expected an OpenDRIVE document, found '{}'", root.name);
+  // Parse everything before touching the network, so that a malformed document leaves it unchanged
+  std::vector<Road> roads;
+  std::vector<Junction> junctions;
+  for (const XmlNode& node : root.children) {
+    if (node.name == "road") {
+      roads.push_back(parseRoad(node));
+    } else if (node.name == "junction") {
+      junctions.push_back(parseJunction(node));
+    }
+  }
+  std::unordered_map<std::string, std::size_t> road_indices = road_indices_;
+  for (std::size_t i = 0; i < roads.size(); ++i)
+    if (!road_indices.emplace(roads[i].id, roads_.size() + i).second)
+      SYMAWARE_RUNTIME_ERROR_FMT("Duplicate road '{}' in the road network", roads[i].id);
+
+  road_indices_ = std::move(road_indices);
+  std::move(roads.begin(), roads.end(), std::back_inserter(roads_));
+  std::move(junctions.begin(), junctions.end(), std::back_inserter(junctions_));
+}
+
+void RoadNetwork::buildLaneGraph() {
+  lanes_.clear();
+  for (std::size_t r = 0; r < roads_.size(); ++r) {
+    for (std::size_t k = 0; k < roads_[r].sections.size(); ++k) {
+      for (std::vector<Lane>* const side : {&roads_[r].sections[k].left, &roads_[r].sections[k].right}) {
+        for (Lane& lane : *side) {
+          lane.node = lanes_.size();
+          lanes_.push_back({r, k, lane.id, {}, {}, npos, npos});
+        }
+      }
+    }
+  }
+
+  for (LaneNode& node : lanes_) {
+    // Lanes on the right drive along the reference line, so their left is towards the centre
+    const int left = node.lane < 0 ? node.lane + 1 : node.lane - 1;
+    const int right = node.lane < 0 ? node.lane - 1 : node.lane + 1;
+    if (left != 0) node.left = laneNode(node.road, node.section, left);
+    node.right = laneNode(node.road, node.section, right);
+  }
+
+  const auto add_edge = [this](const std::size_t from, const std::size_t to) {
+    std::vector<std::size_t>& successors = lanes_[from].successors;
+    if (std::find(successors.begin(), successors.end(), to) != successors.end()) return;
+    successors.push_back(to);
+    lanes_[to].predecessors.push_back(from);
+  };
+  // Connect the lane a, touching the lane b with the given ends, in the directions traffic can flow
+  const auto connect = [this, &add_edge](const std::size_t a, const bool a_at_end, const std::size_t b,
+                                         const bool b_at_end) {
+    if (a == npos || b == npos) return;
+    const bool a_forward = lanes_[a].lane < 0, b_forward = lanes_[b].lane < 0;
+    if (a_forward == a_at_end && b_forward != b_at_end) add_edge(a, b);
+    if (b_forward == b_at_end && a_forward != a_at_end) add_edge(b, a);
+  };
+  const auto linked_section = [this](const std::size_t road, const ContactPoint contact_point) {
+    return contact_point == ContactPoint::Start ? 0 : roads_[road].sections.size() - 1;
+  };
+
+  for (std::size_t r = 0; r < roads_.size(); ++r) {
+    const Road& road = roads_[r];
+    const std::size_t num_sections = road.sections.size();
+    for (std::size_t k = 0; k < num_sections; ++k) {
+      for (const std::vector<Lane>* const side : {&road.sections[k].left, &road.sections[k].right}) {
+        for (const Lane& lane : *side) {
+          if (lane.successor && k + 1 < num_sections) {
+            connect(lane.node, true, laneNode(r, k + 1, *lane.successor), false);
+          } else if (lane.successor && road.successor.element_type == Link::ElementType::Road) {
+            const std::size_t other = roadIndex(road.successor.element_id);
+            if (other != npos && !roads_[other].sections.empty())
+              connect(lane.node, true,
+                      laneNode(other, linked_section(other, road.successor.contact_point), *lane.successor),
+                      road.successor.contact_point == ContactPoint::End);
+          }
+          if (lane.predecessor && k > 0) {
+            connect(lane.node, false, laneNode(r, k - 1, *lane.predecessor), true);
+          } else if (lane.predecessor && road.predecessor.element_type == Link::ElementType::Road) {
+            const std::size_t other = roadIndex(road.predecessor.element_id);
+            if (other != npos && !roads_[other].sections.empty())
+              connect(lane.node, false,
+                      laneNode(other, linked_section(other, road.predecessor.contact_point), *lane.predecessor),
+                      road.predecessor.contact_point == ContactPoint::End);
+          }
+        }
+      }
+    }
+  }
+
+  for (const Junction& junction : junctions_) {
+    for (const Connection& connection : junction.connections) {
+      const std::size_t incoming = roadIndex(connection.incoming_road);
+      const std::size_t connecting = roadIndex(connection.connecting_road);
+      if (incoming == npos || connecting == npos) continue;
+      if (roads_[incoming].sections.empty() || roads_[connecting].sections.empty()) continue;
+      const auto is_junction = [&junction](const Link& link) {
+        return link.element_type == Link::ElementType::Junction && link.element_id == junction.id;
+      };
+      bool incoming_at_end;
+      if (is_junction(roads_[incoming].successor)) {
+        incoming_at_end = true;
+      } else if (is_junction(roads_[incoming].predecessor)) {
+        incoming_at_end = false;
+      } else {
+        continue;
+      }
+      const std::size_t incoming_section = incoming_at_end ? roads_[incoming].sections.size() - 1 : 0;
+      const std::size_t connecting_section = linked_section(connecting, connection.contact_point);
+      for (const auto& [from, to] : connection.lane_links)
+        connect(laneNode(incoming, incoming_section, from), incoming_at_end,
+                laneNode(connecting, connecting_section, to), connection.contact_point == ContactPoint::End);
+    }
+  }
+}
+
+void RoadNetwork::buildIndex() {
+  index_.clear();
+  std::vector<double> previous, current;
+  for (std::size_t r = 0; r < roads_.size(); ++r) {
+    const Road& road = roads_[r];
+    for (std::size_t k = 0; k < road.sections.size(); ++k) {
+      const LaneSection& section = road.sections[k];
+      const double s_start = std::max(section.s, road.reference_line.start());
+      const double s_end = std::min(section.s_end, road.reference_line.end());
+      if (!(s_end > s_start)) continue;
+      const auto steps = static_cast<std::size_t>(std::ceil((s_end - s_start) / sample_step_));
+      const std::size_t num_lanes = section.left.size() + section.right.size();
+
+      // Corners of the boundaries of all the lanes at the current sample, innermost first, left lanes first
+      const auto sample = [&](const double s, std::vector<double>& corners) {
+        corners.clear();
+        const ReferenceLine::Point point = road.reference_line.point(s);
+        const double normal_x = -std::sin(point.heading), normal_y = std::cos(point.heading);
+        for (const Lane& lane : section.left) {
+          const auto [inner, outer] = laneBoundaries(r, k, lane.id, s);
+          corners.insert(corners.end(), {point.x + inner * normal_x, point.y + inner * normal_y,
+                                         point.x + outer * normal_x, point.y + outer * normal_y, outer - inner});
+        }
+        for (const Lane& lane : section.right) {
+          const auto [inner, outer] = laneBoundaries(r, k, lane.id, s);
+          corners.insert(corners.end(), {point.x + inner * normal_x, point.y + inner * normal_y,
+                                         point.x + outer * normal_x, point.y + outer * normal_y, inner - outer});
+        }
+      };
+
+      double s_previous = s_start;
+      sample(s_previous, previous);
+      for (std::size_t step = 1; step <= steps; ++step) {
+        const double s = step == steps ? s_end : s_start + (s_end - s_start) * static_cast<double>(step) / steps;
+        sample(s, current);
+        for (std::size_t i = 0; i < num_lanes; ++i) {
+          const double* const a = &previous[5 * i];
+          const double* const b = &current[5 * i];
+          if (a[4] <= 1e-9 && b[4] <= 1e-9) continue;
+          const Lane& lane = i < section.left.size() ? section.left[i] : section.right[i - section.left.size()];
+          index_.insert({{a[0], a[2], b[2], b[0]}, {a[1], a[3], b[3], b[1]}, lane.node, s_previous, s});
+        }
+        std::swap(previous, current);
+        s_previous = s;
+      }
+    }
+  }
+  index_.build();
+}
+
+std::pair<double, double> RoadNetwork::laneBoundaries(const std::size_t road, const std::size_t section,
+                                                      const int lane, const double s) const {
+  const Road& r = roads_.at(road);
+  const LaneSection& lane_section = r.sections.at(section);
+  const double ds = s - lane_section.s;
+  const double sign = lane > 0 ? 1 : -1;
+  double inner = r.laneOffset(s);
+  for (const Lane& l : lane > 0 ? lane_section.left : lane_section.right) {
+    const double width = l.widths.empty() ? 0 : std::max(0.0, evaluate(l.widths, ds));
+    if (l.id == lane) return {inner, inner + sign * width};
+    inner += sign * width;
+  }
+  SYMAWARE_OUT_OF_RANGE_FMT("Lane {} does not exist in section {} of road '{}'", lane, section, r.id);
+}
+
+std::size_t RoadNetwork::roadIndex(const std::string& id) const {
+  const auto it = road_indices_.find(id);
+  return it == road_indices_.end() ? npos : it->second;
+}
+
+std::size_t RoadNetwork::laneNode(const std::size_t road, const std::size_t section, const int lane) const {
+  if (road >= roads_.size() || section >= roads_[road].sections.size()) return npos;
+  const Lane* const l = roads_[road].sections[section].lane(lane);
+  return l == nullptr ? npos : l->node;
+}
+
+RoadNetwork::LaneLocation RoadNetwork::locate(const LaneIndex::Quad& quad, const double x, const double y) const {
+  const LaneNode& node = lanes_[quad.lane];
+  const auto [s, t] = roads_[node.road].reference_line.project(x, y, (quad.s_start + quad.s_end) / 2);
+  return {node.road, node.section, node.lane, quad.lane, s, t};
+}
+
+std::optional<RoadNetwork::LaneLocation> RoadNetwork::locate(const double x, const double y) const {
+  std::optional<LaneLocation> best;
+  double best_offset = 0;
+  index_.query(x, y, [&](const LaneIndex::Quad& quad) {
+    if (best && best->node == quad.lane) return;
+    const LaneLocation location = locate(quad, x, y);
+    const auto [inner, outer] = laneBoundaries(location.road, location.section, location.lane, location.s);
+    // Distance from the centre of the lane, relative to its half width
+    const double offset = std::abs(2 * location.t - inner - outer) / std::max(std::abs(outer - inner), 1e-9);
+    if (!best || offset < best_offset) {
+      best = location;
+      best_offset = offset;
+    }
+  });
+  return best;
+}
+
+std::vector<RoadNetwork::LaneLocation> RoadNetwork::locateAll(const double x, const double y) const {
+  std::vector<LaneLocation> locations;
+  index_.query(x, y, [&](const LaneIndex::Quad& quad) {
+    const bool seen = std::any_of(locations.begin(), locations.end(),
+                                  [&quad](const LaneLocation& location) { return location.node == quad.lane; });
+    if (!seen) locations.push_back(locate(quad, x, y));
+  });
+  return locations;
+}
+
+std::ostream& operator<<(std::ostream& os, const RoadNetwork::LaneLocation& location) {
+  return os << "LaneLocation: (road: " << location.road << ", section: " << location.section
+            << ", lane: " << location.lane << ", s: " << location.s << ", t: " << location.t << ")";
+}
+std::ostream& operator<<(std::ostream& os, const RoadNetwork& network) {
+  return os << "RoadNetwork: (roads: " << network.roads().size() << ", junctions: " << network.junctions().size()
+            << ", lanes: " << network.lanes().size() << ")";
+}
+
+}  // namespace symaware
@@ -0,0 +1,245 @@
+#include "symaware/map/router.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+Router::Router(const RoadNetwork& network, const double lane_change_cost, const double lane_change_length,
+               const double waypoint_step, const std::size_t cache_capacity)
+    : network_{network},
+      lane_change_cost_{lane_change_cost},
+      lane_change_length_{lane_change_length},
+      waypoint_step_{waypoint_step},
+      centres_(network.lanes().size()),
+      cache_capacity_{cache_capacity},
+      cache_{},
+      cache_entries_{},
+      cache_hits_{0},
+      cache_misses_{0} {
+  if (!(lane_change_cost >= 0)) SYMAWARE_INVALID_ARGUMENT("lane_change_cost", lane_change_cost);
+  if (!(lane_change_length >= 0)) SYMAWARE_INVALID_ARGUMENT("lane_change_length", lane_change_length);
+  if (!(waypoint_step > 0)) SYMAWARE_INVALID_ARGUMENT("waypoint_step", waypoint_step);
+
+  for (std::size_t i = 0; i < network.lanes().size(); ++i) {
+    const RoadNetwork::LaneNode& node = network.lanes()[i];
+    const RoadNetwork::Road& road = network.roads()[node.road];
+    const RoadNetwork::LaneSection& section = road.sections[node.section];
+    if (section.lane(node.lane)->type != "driving") continue;
+    const double s_start = std::max(section.s, road.reference_line.start());
+    const double s_end = std::min(section.s_end, road.reference_line.end());
+    if (!(s_end > s_start)) continue;
+
+    const auto steps = static_cast<std::size_t>(std::ceil((s_end - s_start) / waypoint_step));
+    std::vector<Sample>& centre = centres_[i];
+    centre.reserve(steps + 1);
+    for (std::size_t step = 0; step <= steps; ++step) {
+      // Lanes on the right drive along the reference line, the ones on the left against it
+      const std::size_t k = node.lane < 0 ? step : steps - step;
+      const double s = k == steps ? s_end : s_start + (s_end - s_start) * static_cast<double>(k) / steps;
+      const ReferenceLine::Point point = road.reference_line.point(s);
+      const auto [inner, outer] = network.laneBoundaries(node.road, node.section, node.lane, s);
+      const double t = (inner + outer) / 2;
+      centre.push_back({s, point.x - t * std::sin(point.heading), point.y + t * std::cos(point.heading),
+                        road.elevation(s), 0});
+      if (step > 0) {
+        const Sample& previous = centre[step - 1];
+        centre.back().distance = previous.distance + std::hypot(centre.back().x - previous.x,
+                                                                centre.back().y - previous.y,
+                                                                centre.back().z - previous.z);
+      }
+    }
+  }
+}
+
+double Router::progress(const std::size_t node, const double s) const {
+  const std::vector<Sample>& centre = centres_[node];
+  const bool forward = network_.lanes()[node].lane < 0;
+  const auto it = std::partition_point(centre.begin(), centre.end(), [forward, s](const Sample& sample) {
+    return forward ? sample.s < s : sample.s > s;
+  });
+  if (it == centre.begin()) return 0;
+  if (it == centre.end()) return centre.back().distance;
+  const Sample& previous = *(it - 1);
+  return previous.distance + (it->distance - previous.distance) * (s - previous.s) / (it->s - previous.s);
+}
+
+Router::Sample Router::interpolate(const std::size_t node, const double distance) const {
+  const std::vector<Sample>& centre = centres_[node];
+  const auto it = std::partition_point(centre.begin(), centre.end(),
+                                       [distance](const Sample& sample) { return sample.distance < distance; });
+  if (it == centre.begin()) return centre.front();
+  if (it == centre.end()) return centre.back();
+  const Sample& previous = *(it - 1);
+  const double ratio = (distance - previous.distance) / (it->distance - previous.distance);
+  const auto lerp = [ratio](const double a, const double b) { return a + (b - a) * ratio; };
+  return {lerp(previous.s, it->s), lerp(previous.x, it->x), lerp(previous.y, it->y), lerp(previous.z, it->z),
+          distance};
+}
+
+std::vector<std::size_t> Router::search(const RoadNetwork::LaneLocation& from,
+                                        const RoadNetwork::LaneLocation& to) const {
+  // A state is a lane, entered either at its start or, for the lanes of the start section, at the start of the route.
+  // The latter are reached by lane changes from the start, and keep its progress along the section
+  const std::size_t goal = 2 * centres_.size();
+  const auto entry = [&](const std::size_t state) { return state % 2 == 1 ? progress(state / 2, from.s) : 0.0; };
+  const double goal_progress = progress(to.node, to.s);
+  const Sample goal_point = interpolate(to.node, goal_progress);
+  const auto heuristic = [&](const std::size_t state) {
+    if (state == goal) return 0.0;
+    const Sample point = interpolate(state / 2, entry(state));
+    return std::hypot(point.x - goal_point.x, point.y - goal_point.y, point.z - goal_point.z);
+  };
+
+  std::unordered_map<std::size_t, std::pair<double, std::size_t>> labels;  // Cost and parent of each state
+  std::vector<bool> closed(goal + 1, false);
+  using Item = std::pair<double, std::size_t>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<>> open;
+  const auto relax = [&](const std::size_t state, const double cost, const std::size_t parent) {
+    if (closed[state]) return;
+    const auto it = labels.find(state);
+    if (it != labels.end() && it->second.first <= cost) return;
+    labels[state] = {cost, parent};
+    open.emplace(cost + heuristic(state), state);
+  };
+
+  const std::size_t start = 2 * from.node + 1;
+  relax(start, 0, RoadNetwork::npos);
+  while (!open.empty()) {
+    const std::size_t state = open.top().second;
+    open.pop();
+    if (closed[state]) continue;
+    closed[state] = true;
+    if (state == goal) break;
+
+    const std::size_t node = state / 2;
+    const double cost = labels[state].first;
+    const double progress = entry(state);
+    if (node == to.node && goal_progress >= progress - 1e-9) relax(goal, cost + goal_progress - progress, state);
+    const RoadNetwork::LaneNode& lane = network_.lanes()[node];
+    for (const std::size_t successor : lane.successors)
+      if (routable(successor)) relax(2 * successor, cost + centres_[node].back().distance - progress, state);
+    for (const std::size_t adjacent : {lane.left, lane.right})
+      if (adjacent != RoadNetwork::npos && routable(adjacent))
+        relax(2 * adjacent + state % 2, cost + lane_change_cost_, state);
+  }
+  if (!closed[goal]) return {};
+
+  std::vector<std::size_t> lanes;
+  for (std::size_t state = labels[goal].second; state != RoadNetwork::npos; state = labels[state].second)
+    lanes.push_back(state / 2);
+  std::reverse(lanes.begin(), lanes.end());
+  return lanes;
+}
+
+Router::Route Router::makeRoute(std::vector<std::size_t> lanes, const RoadNetwork::LaneLocation& from,
+                                const RoadNetwork::LaneLocation& to) const {
+  Route route{std::move(lanes), {}, 0, 0};
+  const auto emit = [&route](const Sample& sample) {
+    if (!route.waypoints.empty()) {
+      const Waypoint& last = route.waypoints.back();
+      const double distance = std::hypot(sample.x - last.x, sample.y - last.y, sample.z - last.z);
+      if (distance < 1e-9) return;
+      route.length += distance;
+    }
+    route.waypoints.push_back({sample.x, sample.y, sample.z});
+  };
+
+  double entry = progress(route.lanes.front(), from.s);
+  for (std::size_t i = 0; i < route.lanes.size(); ++i) {
+    const std::size_t node = route.lanes[i];
+    const std::vector<Sample>& centre = centres_[node];
+    const bool last = i + 1 == route.lanes.size();
+    // Lane changes only happen between lanes of the same lane section, right where the lane was entered
+    const bool lane_change = !last && network_.lanes()[route.lanes[i + 1]].road == network_.lanes()[node].road &&
+                             network_.lanes()[route.lanes[i + 1]].section == network_.lanes()[node].section;
+    double exit = centre.back().distance;
+    if (last) {
+      exit = progress(node, to.s);
+      entry = std::min(entry, exit);
+    } else if (lane_change) {
+      exit = entry;
+    }
+
+    const Sample start = interpolate(node, entry);
+    emit(start);
+    const auto it = std::partition_point(centre.begin(), centre.end(),
+                                         [entry](const Sample& sample) { return sample.distance <= entry; });
+    for (auto sample = it; sample != centre.end() && sample->distance < exit; ++sample) emit(*sample);
+    emit(interpolate(node, exit));
+
+    if (lane_change) {
+      const std::size_t next = route.lanes[i + 1];
+      entry = std::min(progress(next, start.s) + lane_change_length_, centres_[next].back().distance);
+      ++route.lane_changes;
+    } else {
+      entry = 0;
+    }
+  }
+  return route;
+}
+
+std::optional<Router::Route> Router::route(const RoadNetwork::LaneLocation& from,
+                                           const RoadNetwork::LaneLocation& to) {
+  if (from.node >= centres_.size() || !routable(from.node)) return {};
+  if (to.node >= centres_.size() || !routable(to.node)) return {};
+
+  // The same lanes give the same sequence, unless the destination is right ahead of the start in its lane section
+  const RoadNetwork::LaneNode& from_lane = network_.lanes()[from.node];
+  const RoadNetwork::LaneNode& to_lane = network_.lanes()[to.node];
+  const bool ahead = from_lane.road == to_lane.road && from_lane.section == to_lane.section &&
+                     progress(to.node, to.s) >= progress(to.node, from.s);
+  const std::uint64_t key = (static_cast<std::uint64_t>(from.node) << 33) |
+                            (static_cast<std::uint64_t>(to.node) << 1) | static_cast<std::uint64_t>(ahead);
+
+  std::vector<std::size_t> lanes;
+  if (const auto it = cache_entries_.find(key); it != cache_entries_.end()) {
+    ++cache_hits_;
+    cache_.splice(cache_.begin(), cache_, it->second);
+    lanes = it->second->second;
+  } else {
+    ++cache_misses_;
+    lanes = search(from, to);
+    if (cache_capacity_ > 0) {
+      cache_.emplace_front(key, lanes);
+      cache_entries_.emplace(key, cache_.begin());
+      if (cache_.size() > cache_capacity_) {
+        cache_entries_.erase(cache_.back().first);
+        cache_.pop_back();
+      }
+    }
+  }
+  if (lanes.empty()) return {};
+  return makeRoute(std::move(lanes), from, to);
+}
+
+std::optional<Router::Route> Router::route(const double from_x, const double from_y, const double to_x,
+                                           const double to_y) {
+  const std::optional<RoadNetwork::LaneLocation> from = network_.locate(from_x, from_y);
+  if (!from) return {};
+  const std::optional<RoadNetwork::LaneLocation> to = network_.locate(to_x, to_y);
+  if (!to) return {};
+  return route(*from, *to);
+}
+
+void Router::clearCache() {
+  cache_.clear();
+  cache_entries_.clear();
+}
+
+std::ostream& operator<<(std::ostream& os, const Router::Route& route) {
+  return os << "Route: (lanes: " << route.lanes.size() << ", waypoints: " << route.waypoints.size()
+            << ", length: " << route.length << ", lane_changes: " << route.lane_changes << ")";
+}
+std::ostream& operator<<(std::ostream& os, const Router& router) {
+  return os << "Router: (lane_change_cost: " << router.lane_change_cost()
+            << ", lane_change_length: " << router.lane_change_length() << ", waypoint_step: " << router.waypoint_step()
+            << ", cache: " << router.cache_size() << "/" << router.cache_capacity() << ")";
+}
+
+}  // namespace symaware
@@ -0,0 +1,132 @@
+#include "symaware/map/spatial_hash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+SpatialHash::SpatialHash(const double cell_size)
+    : cell_size_{cell_size}, bucket_mask_{0}, bucket_start_(2, 0), points_{} {
+  if (!(cell_size > 0)) SYMAWARE_INVALID_ARGUMENT("cell_size", cell_size);
+}
+
+void SpatialHash::build(const std::vector<double>& x, const std::vector<double>& y) {
+  if (x.size() != y.size()) SYMAWARE_INVALID_ARGUMENT_EXPECTED("y.size()", y.size(), x.size());
+  build(x.data(), y.data(), x.size());
+}
+
+void SpatialHash::build(const double* const x, const double* const y, const std::size_t count) {
+  if (count > std::numeric_limits<std::uint32_t>::max()) SYMAWARE_INVALID_ARGUMENT("count", count);
+  std::size_t buckets = 1;
+  while (buckets < count) buckets <<= 1;
+  bucket_mask_ = buckets - 1;
+
+  // Counting sort of the points by bucket. The cells are computed again in the second pass, as it is cheap
+  bucket_start_.assign(buckets + 1, 0);
+  for (std::size_t k = 0; k < count; ++k) {
+    if (!std::isfinite(x[k]) || !std::isfinite(y[k]))
+      SYMAWARE_RUNTIME_ERROR_FMT("Point {} has non finite coordinates ({}, {})", k, x[k], y[k]);
+    ++bucket_start_[bucketOf(cellOf(x[k]), cellOf(y[k])) + 1];
+  }
+  for (std::size_t b = 0; b < buckets; ++b) bucket_start_[b + 1] += bucket_start_[b];
+  points_.resize(count);
+  for (std::size_t k = 0; k < count; ++k) {
+    const std::int64_t i = cellOf(x[k]), j = cellOf(y[k]);
+    points_[bucket_start_[bucketOf(i, j)]++] = Point{x[k], y[k], i, j, static_cast<std::uint32_t>(k)};
+  }
+  // Each start has been moved to the start of the following bucket while placing the points
+  for (std::size_t b = buckets; b > 0; --b) bucket_start_[b] = bucket_start_[b - 1];
+  bucket_start_[0] = 0;
+}
+
+void SpatialHash::clear() {
+  bucket_mask_ = 0;
+  bucket_start_.assign(2, 0);
+  points_.clear();
+}
+
+std::vector<std::size_t> SpatialHash::queryRadius(const double x, const double y, const double radius) const {
+  std::vector<std::pair<double, std::size_t>> found;
+  forEachInRadius(x, y, radius, [&found](const std::size_t index, const double squared_distance) {
+    found.emplace_back(squared_distance, index);
+  });
+  std::sort(found.begin(), found.end());
+  std::vector<std::size_t> indices;
+  indices.reserve(found.size());
+  for (const auto& [squared_distance, index] : found) indices.push_back(index);
+  return indices;
+}
+
+std::vector<std::size_t> SpatialHash::queryNearest(const double x, const double y, std::size_t k) const {
+  k = std::min(k, points_.size());
+  if (k == 0) return {};
+
+  // Max heap of the closest points found so far
+  std::vector<std::pair<double, std::size_t>> best;
+  best.reserve(k);
+  const auto consider = [&best, k, x, y](const Point& point) {
+    const double squared_distance = (point.x - x) * (point.x - x) + (point.y - y) * (point.y - y);
+    const std::pair<double, std::size_t> candidate{squared_distance, point.index};
+    if (best.size() < k) {
+      best.push_back(candidate);
+      std::push_heap(best.begin(), best.end());
+    } else if (candidate < best.front()) {
+      std::pop_heap(best.begin(), best.end());
+      best.back() = candidate;
+      std::push_heap(best.begin(), best.end());
+    }
+  };
+
+  // Visit rings of cells of increasing radius around the query point
+  const std::int64_t i0 = cellOf(x), j0 = cellOf(y);
+  std::size_t visited_cells = 0;
+  for (std::int64_t r = 0;; ++r) {
+    // When the points are sparse compared to the cells, scanning all the points is cheaper
+    visited_cells += r == 0 ? 1 : static_cast<std::size_t>(8 * r);
+    if (visited_cells > 2 * points_.size()) {
+      best.clear();
+      for (const Point& point : points_) consider(point);
+      break;
+    }
+    if (r == 0) {
+      forEachInCell(i0, j0, consider);
+    } else {
+      for (std::int64_t i = i0 - r; i <= i0 + r; ++i) {
+        forEachInCell(i, j0 - r, consider);
+        forEachInCell(i, j0 + r, consider);
+      }
+      for (std::int64_t j = j0 - r + 1; j < j0 + r; ++j) {
+        forEachInCell(i0 - r, j, consider);
+        forEachInCell(i0 + r, j, consider);
+      }
+    }
+    // Points in the cells beyond ring r are at least r cells away from the query point
+    const double bound = static_cast<double>(r) * cell_size_;
+    if (best.size() == k && best.front().first <= bound * bound) break;
+  }
+
+  std::sort_heap(best.begin(), best.end());
+  std::vector<std::size_t> indices;
+  indices.reserve(best.size());
+  for (const auto& [squared_distance, index] : best) indices.push_back(index);
+  return indices;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> SpatialHash::queryPairs(const double distance) const {
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+  for (const Point& point : points_) {
+    const auto first = static_cast<std::size_t>(point.index);
+    forEachInRadius(point.x, point.y, distance, [&pairs, first](const std::size_t second, double) {
+      if (first < second) pairs.emplace_back(first, second);
+    });
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+}  // namespace symaware
@@ -0,0 +1,203 @@
+#include "symaware/map/xml.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+bool isSpace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+bool isNameChar(const char c) { return !isSpace(c) && c != '=' && c != '>' && c != '/' && c != '<' && c != '\0'; }
+
+void appendUtf8(std::string& out, const std::uint32_t code_point) {
+  if (code_point < 0x80) {
+    out.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
+/** Recursive descent parser over the content of the document */
+class XmlParser {
+ public:
+  explicit XmlParser(const std::string_view content) : content_{content}, pos_{0} {}
+
+  XmlNode parseDocument() {
+    skipMisc();
+    if (!startsWith("<")) error("expected the root element");
+    XmlNode root = parseElement();
+    skipMisc();
+    if (pos_ != content_.size()) error("unexpected content after the root element");
+    return root;
+  }
+
+ private:
+  [[noreturn]] void error(const std::string_view message) const {
+    const auto line = std::count(content_.begin(), content_.begin() + static_cast<std::ptrdiff_t>(pos_), '\n') + 1;
+    SYMAWARE_RUNTIME_ERROR_FMT("Malformed XML at line {}: {}", line, message);
+  }
+
+  bool startsWith(const std::string_view prefix) const { return content_.substr(pos_, prefix.size()) == prefix; }
+  void skipSpaces() {
+    while (pos_ < content_.size() && isSpace(content_[pos_])) ++pos_;
+  }
+  /** Skip everything up to and including the @p terminator */
+  void skipPast(const std::string_view terminator) {
+    const std::size_t end = content_.find(terminator, pos_);
+    if (end == std::string_view::npos) error(fmt::format("missing '{}'", terminator));
+    pos_ = end + terminator.size();
+  }
+  /** Skip spaces, comments, processing instructions and document type declarations */
+  void skipMisc() {
+    while (true) {
+      skipSpaces();
+      if (startsWith("<?")) {
+        skipPast("?>");
+      } else if (startsWith("<!--")) {
+        skipPast("-->");
+      } else if (startsWith("<!DOCTYPE")) {
+        skipPast(">");
+      } else {
+        return;
+      }
+    }
+  }
+
+  std::string_view parseName() {
+    const std::size_t start = pos_;
+    while (pos_ < content_.size() && isNameChar(content_[pos_])) ++pos_;
+    if (pos_ == start) error("expected a name");
+    return content_.substr(start, pos_ - start);
+  }
+
+  /** Append the text up to the @p terminator to @p out, resolving the character references */
+  void parseText(std::string& out, const char terminator) {
+    while (pos_ < content_.size() && content_[pos_] != terminator) {
+      if (content_[pos_] != '&') {
+        out.push_back(content_[pos_++]);
+        continue;
+      }
+      const std::size_t end = content_.find(';', pos_);
+      if (end == std::string_view::npos) error("unterminated character reference");
+      const std::string_view reference = content_.substr(pos_ + 1, end - pos_ - 1);
+      if (reference == "lt") {
+        out.push_back('<');
+      } else if (reference == "gt") {
+        out.push_back('>');
+      } else if (reference == "amp") {
+        out.push_back('&');
+      } else if (reference == "quot") {
+        out.push_back('"');
+      } else if (reference == "apos") {
+        out.push_back('\'');
+      } else if (reference.size() > 1 && reference[0] == '#') {
+        const bool is_hex = reference[1] == 'x' || reference[1] == 'X';
+        const std::string digits{reference.substr(is_hex ? 2 : 1)};
+        char* digits_end = nullptr;
+        const unsigned long code_point = std::strtoul(digits.c_str(), &digits_end, is_hex ? 16 : 10);
+        if (digits.empty() || *digits_end != '\0' || code_point > 0x10FFFF) error("invalid character reference");
+        appendUtf8(out, static_cast<std::uint32_t>(code_point));
+      } else {
+        error(fmt::format("unknown entity '&{};'", reference));
+      }
+      pos_ = end + 1;
+    }
+  }
+
+  XmlNode parseElement() {
+    ++pos_;  // '<'
+    XmlNode node;
+    node.name = parseName();
+    while (true) {
+      skipSpaces();
+      if (pos_ >= content_.size()) error(fmt::format("unterminated element '{}'", node.name));
+      if (startsWith("/>")) {
+        pos_ += 2;
+        return node;
+      }
+      if (content_[pos_] == '>') {
+        ++pos_;
+        break;
+      }
+      std::string name{parseName()};
+      skipSpaces();
+      if (pos_ >= content_.size() || content_[pos_] != '=') error("expected '=' after the attribute name");
+      ++pos_;
+      skipSpaces();
+      if (pos_ >= content_.size() || (content_[pos_] != '"' && content_[pos_] != '\'')) error("expected a quote");
+      const char quote = content_[pos_++];
+      std::string value;
+      parseText(value, quote);
+      if (pos_ >= content_.size()) error("unterminated attribute value");
+      ++pos_;
+      node.attributes.emplace_back(std::move(name), std::move(value));
+    }
+
+    while (true) {
+      if (pos_ >= content_.size()) error(fmt::format("unterminated element '{}'", node.name));
+      if (startsWith("</")) {
+        pos_ += 2;
+        if (parseName() != node.name) error(fmt::format("mismatched closing tag for '{}'", node.name));
+        skipSpaces();
+        if (pos_ >= content_.size() || content_[pos_] != '>') error("expected '>'");
+        ++pos_;
+        return node;
+      }
+      if (startsWith("<!--")) {
+        skipPast("-->");
+      } else if (startsWith("<![CDATA[")) {
+        pos_ += 9;
+        const std::size_t end = content_.find("]]>", pos_);
+        if (end == std::string_view::npos) error("unterminated CDATA section");
+        node.text.append(content_.substr(pos_, end - pos_));
+        pos_ = end + 3;
+      } else if (startsWith("<?")) {
+        skipPast("?>");
+      } else if (content_[pos_] == '<') {
+        node.children.push_back(parseElement());
+      } else {
+        parseText(node.text, '<');
+      }
+    }
+  }
+
+  std::string_view content_;  ///< Content of the document
+  std::size_t pos_;           ///< Current position in the content
+};
+
+}  // namespace
+
+const std::string* XmlNode::attribute(const std::string_view name) const {
+  for (const auto& [key, value] : attributes)
+    if (key == name) return &value;
+  return nullptr;
+}
+
+const XmlNode* XmlNode::child(const std::string_view name) const {
+  for (const XmlNode& node : children)
+    if (node.name == name) return &node;
+  return nullptr;
+}
+
+XmlNode parseXml(const std::string_view content) { return XmlParser{content}.parseDocument(); }
+
+}  // namespace symaware
@@ -0,0 +1,28 @@
+#include "symaware/prescan/broadphase.h"
+
+#include <cmath>
+
+#include "symaware/prescan/entity.h"
+
+namespace symaware {
+
+Broadphase::Broadphase(const double cell_size) : index_{cell_size}, entities_{}, x_{}, y_{} {}
+
+void Broadphase::initialise(const Environment& environment, prescan::sim::ISimulation*) { update(environment); }
+void Broadphase::step(const Environment& environment, prescan::sim::ISimulation*) { update(environment); }
+
+void Broadphase::update(const Environment& environment) {
+  entities_.clear();
+  x_.clear();
+  y_.clear();
+  for (const auto& [name, entity] : environment.entities()) {
+    const Entity::State state = entity->state();
+    if (!std::isfinite(state.position.x) || !std::isfinite(state.position.y)) continue;
+    entities_.push_back(entity);
+    x_.push_back(state.position.x);
+    y_.push_back(state.position.y);
+  }
+  index_.build(x_, y_);
+}
+
+}  // namespace symaware
@@ -1,13 +1,23 @@
 #include "symaware/prescan/entity.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <ostream>
 #include <stdexcept>
 
 #include "symaware/util/exception.h"
+#include "symaware/util/trace.h"
 
 namespace symaware {
 
+namespace {
+
+constexpr double parking_depth = -1000;  ///< Height at which parked objects are kept, out of sight below the ground
+
+}  // namespace
+
 Entity::Setup::Setup(Position position, Orientation orientation, Position cog_offset, bool is_collision_detectable,
                      bool is_movable, prescan::api::types::SensorDetectability sensor_detectability)
     : position{position},
@@ -38,7 +48,16 @@ Entity::State::State(bool zero_init)
 Entity::Entity(const ObjectType type, EntityModel& model) : Entity{type, Setup{}, &model} {}
 Entity::Entity(const ObjectType type, Setup setup, EntityModel& model) : Entity{type, std::move(setup), &model} {}
 Entity::Entity(const ObjectType type, Setup setup, EntityModel* const model)
-    : type_{type}, setup_{std::move(setup)}, model_{model}, object_{}, state_{nullptr}, sensor_count_{}, sensors_{} {
+    : type_{type},
+      setup_{std::move(setup)},
+      model_{model},
+      object_{},
+      has_object_{false},
+      state_{nullptr},
+      sensor_count_{},
+      sensors_{},
+      sensor_fusion_{},
+      profile_{} {
   for (int i = 0; i < sizeof(sensor_count_) / sizeof(int); ++i) sensor_count_[i] = 0;
 }
 
@@ -50,9 +69,31 @@ void Entity::addSensor(Sensor& sensor) {
   }
 }
 
+void Entity::setSensorFusion(const SensorFusion::Setup& setup) { sensor_fusion_.emplace(setup); }
+void Entity::clearSensorFusion() { sensor_fusion_.reset(); }
+
 void Entity::remove() {
   object_.remove();
+  detachObject();
+}
+
+ParkedObject Entity::park() {
+  ParkedObject parked{object_, object_.pose(), model_ == nullptr ? 0 : model_->id(), {}};
+  std::copy(std::begin(sensor_count_), std::end(sensor_count_), std::begin(parked.sensor_count));
+  object_.setMovable(false);
+  object_.setCollisionDetectable(false);
+  object_.setSensorDetectability(prescan::api::types::SensorDetectability::SensorDetectabilityInvisible);
+  object_.pose().position().setZ(parking_depth);
+  detachObject();
+  return parked;
+}
+
+void Entity::detachObject() {
   object_ = prescan::api::types::WorldObject{};
+  has_object_ = false;
+  state_ = nullptr;
+  std::fill(std::begin(sensor_count_), std::end(sensor_count_), 0);
+  for (Sensor* const sensor : sensors_) sensor->detach();
 }
 
 void Entity::applySetup() { updateObject(); }
@@ -64,6 +105,7 @@ void Entity::applySetup(Setup setup) {
 void Entity::initialiseObject(prescan::api::experiment::Experiment& experiment,
                               const prescan::api::types::WorldObject object) {
   object_ = object;
+  has_object_ = true;
   if (type_ != ObjectType::Existing) updateObject();
   if (model_ != nullptr) {
     model_->linkEntity(object_);
@@ -75,6 +117,26 @@ void Entity::initialiseObject(prescan::api::experiment::Experiment& experiment,
   }
 }
 
+void Entity::reuseObject(prescan::api::experiment::Experiment& experiment, const ParkedObject& parked) {
+  object_ = parked.object;
+  has_object_ = true;
+  object_.pose() = parked.pose;
+  updateObject();
+  if (model_ != nullptr) {
+    model_->linkEntity(object_);
+    if (model_->id() != parked.model_id) model_->createIfNotExists(experiment);
+  }
+  for (Sensor* const sensor : sensors_) {
+    const int type = to_underlying(sensor->sensor_type());
+    const int id = sensor_count_[type]++;
+    if (id < parked.sensor_count[type]) sensor->reuseSensor(object_, id);
+    else sensor->createSensor(object_, id);
+  }
+  // Sensors of the object left unused keep their ids, so new ones are appended after them
+  for (std::size_t i = 0; i < std::size(sensor_count_); ++i)
+    sensor_count_[i] = std::max(sensor_count_[i], parked.sensor_count[i]);
+}
+
 Entity::State Entity::state() const {
   if (state_ == nullptr) return State{false};
   return State{Position{state_->selfSensorOutput().PositionX, state_->selfSensorOutput().PositionY,
@@ -85,6 +147,8 @@ Entity::State Entity::state() const {
 }
 
 bool Entity::is_initialised() const {
+  // Querying an unbound object throws, which is expensive when checking many new entities
+  if (!has_object_) return false;
   try {
     return object_.handle() != nullptr;
   } catch (const std::runtime_error& e) {
@@ -96,34 +160,78 @@ void Entity::updateObject() {
   object_.setMovable(setup_.is_movable);
   object_.setSensorDetectability(setup_.sensor_detectability);
   object_.setCollisionDetectable(setup_.is_collision_detectable);
-  if (!std::isnan(setup_.cog_offset.x)) object_.cogOffset().setX(setup_.cog_offset.x);
-  if (!std::isnan(setup_.cog_offset.y)) object_.cogOffset().setY(setup_.cog_offset.y);
-  if (!std::isnan(setup_.cog_offset.z)) object_.cogOffset().setZ(setup_.cog_offset.z);
-  if (!std::isnan(setup_.orientation.roll)) object_.pose().orientation().setRoll(setup_.orientation.roll);
-  if (!std::isnan(setup_.orientation.pitch)) object_.pose().orientation().setPitch(setup_.orientation.pitch);
-  if (!std::isnan(setup_.orientation.yaw)) object_.pose().orientation().setYaw(setup_.orientation.yaw);
-  if (!std::isnan(setup_.position.x)) object_.pose().position().setX(setup_.position.x);
-  if (!std::isnan(setup_.position.y)) object_.pose().position().setY(setup_.position.y);
-  if (!std::isnan(setup_.position.z)) object_.pose().position().setZ(setup_.position.z);
+  // Fully specified vectors are set with a single call, the others component by component
+  const Position& cog = setup_.cog_offset;
+  if (!std::isnan(cog.x) && !std::isnan(cog.y) && !std::isnan(cog.z)) {
+    object_.cogOffset().setXYZ(cog.x, cog.y, cog.z);
+  } else {
+    if (!std::isnan(cog.x)) object_.cogOffset().setX(cog.x);
+    if (!std::isnan(cog.y)) object_.cogOffset().setY(cog.y);
+    if (!std::isnan(cog.z)) object_.cogOffset().setZ(cog.z);
+  }
+  const Orientation& orientation = setup_.orientation;
+  if (!std::isnan(orientation.roll) && !std::isnan(orientation.pitch) && !std::isnan(orientation.yaw)) {
+    object_.pose().orientation().setRPY(orientation.roll, orientation.pitch, orientation.yaw);
+  } else {
+    if (!std::isnan(orientation.roll)) object_.pose().orientation().setRoll(orientation.roll);
+    if (!std::isnan(orientation.pitch)) object_.pose().orientation().setPitch(orientation.pitch);
+    if (!std::isnan(orientation.yaw)) object_.pose().orientation().setYaw(orientation.yaw);
+  }
+  const Position& position = setup_.position;
+  if (!std::isnan(position.x) && !std::isnan(position.y) && !std::isnan(position.z)) {
+    object_.pose().position().setXYZ(position.x, position.y, position.z);
+  } else {
+    if (!std::isnan(position.x)) object_.pose().position().setX(position.x);
+    if (!std::isnan(position.y)) object_.pose().position().setY(position.y);
+    if (!std::isnan(position.z)) object_.pose().position().setZ(position.z);
+  }
 }
 
 void Entity::registerUnit(const prescan::api::experiment::Experiment& experiment,
                           prescan::sim::ISimulation* const simulation) {
+  ScopedTimer timer{profile_, ProfilePhase::REGISTER};
   // TODO: a flag may be needed if registering the SelfSensorUnit is expensive over objects that will not be used
   state_ = prescan::sim::registerUnit<prescan::sim::SelfSensorUnit>(simulation, object_);
-  if (model_ != nullptr) model_->registerUnit(experiment, simulation);
+  if (model_ != nullptr) {
+    ScopedTimer model_timer{model_->profile(), ProfilePhase::REGISTER};
+    model_->registerUnit(experiment, simulation);
+  }
   for (Sensor* const sensor : sensors_) sensor->registerUnit(object_, experiment, simulation);
 }
 void Entity::initialise(prescan::sim::ISimulation* const simulation) {
-  if (model_ != nullptr) model_->initialise(simulation);
+  ScopedTimer timer{profile_, ProfilePhase::INITIALISE};
+  if (model_ != nullptr) {
+    ScopedTimer model_timer{model_->profile(), ProfilePhase::INITIALISE};
+    model_->initialise(simulation);
+  }
   for (Sensor* const sensor : sensors_) sensor->initialise(simulation);
+  if (sensor_fusion_.has_value()) sensor_fusion_->clear();
 }
 void Entity::step(prescan::sim::ISimulation* const simulation) {
-  if (model_ != nullptr) model_->step(simulation);
+  SYMAWARE_TRACE_SCOPE("Entity::step");
+  ScopedTimer timer{profile_, ProfilePhase::STEP};
+  if (model_ != nullptr) {
+    ScopedTimer model_timer{model_->profile(), ProfilePhase::STEP};
+    model_->step(simulation);
+  }
   for (Sensor* const sensor : sensors_) sensor->step(simulation);
+  if (sensor_fusion_.has_value()) fuseDetections(simulation->getSampleTime());
+}
+void Entity::fuseDetections(const double sample_time) {
+  if (state_ == nullptr) return;
+  SYMAWARE_TRACE_SCOPE("Entity::fuseDetections");
+  const prescan::sim::SelfSensorData& object = state_->selfSensorOutput();
+  const Pose object_pose{object.PositionX,       object.PositionY,        object.PositionZ,
+                         object.OrientationRoll, object.OrientationPitch, object.OrientationYaw};
+  sensor_fusion_->predict(sample_time);
+  for (Sensor* const sensor : sensors_) sensor->fuseDetections(object_pose, *sensor_fusion_);
 }
 void Entity::terminate(prescan::sim::ISimulation* const simulation) {
-  if (model_ != nullptr) model_->terminate(simulation);
+  ScopedTimer timer{profile_, ProfilePhase::TERMINATE};
+  if (model_ != nullptr) {
+    ScopedTimer model_timer{model_->profile(), ProfilePhase::TERMINATE};
+    model_->terminate(simulation);
+  }
   for (Sensor* const sensor : sensors_) sensor->terminate(simulation);
   state_ = nullptr;
 }
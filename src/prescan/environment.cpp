@@ -1,8 +1,13 @@
 #include "symaware/prescan/environment.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <prescan/api/Opendrive.hpp>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "symaware/prescan/entity.h"
 #include "symaware/prescan/model/entity_model.h"
@@ -11,9 +16,9 @@
 
 namespace symaware {
 
-Environment::Environment() : experiment_{prescan::api::experiment::createExperiment()} {}
+Environment::Environment() : experiment_{prescan::api::experiment::createExperiment()}, pooling_{false} {}
 Environment::Environment(const std::string& filename)
-    : experiment_{prescan::api::experiment::loadExperimentFromFile(filename)} {}
+    : experiment_{prescan::api::experiment::loadExperimentFromFile(filename)}, pooling_{false} {}
 
 Environment& Environment::setWeather(const WeatherType weather_type, const double fog_visibility) {
   prescan::api::types::Weather weather{experiment_.weather()};
@@ -89,7 +94,8 @@ Environment& Environment::addEntity(Entity& entity) {
 
   if (entity.type() == ObjectType::Existing)
     SYMAWARE_RUNTIME_ERROR("Existing entities cannot be created. Use the addEntity(std::string, Entity) method");
-  entity.initialiseObject(experiment_, experiment_.createObject(to_string(entity.type())));
+  if (!reuseParkedObject(entity))
+    entity.initialiseObject(experiment_, experiment_.createObject(to_string(entity.type())));
   entities_[entity.name()] = &entity;
   return *this;
 }
@@ -102,22 +108,98 @@ Environment& Environment::addEntity(const std::string& name, Entity& entity) {
   return *this;
 }
 
+Environment& Environment::addEntities(Entity* const* const entities, const std::size_t count) {
+  std::vector<Entity*> pending;
+  pending.reserve(count);
+  std::unordered_set<const Entity*> seen;
+  seen.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    // The same entity may appear more than once, but it must be created only once
+    if (entities[i]->is_initialised() || !seen.insert(entities[i]).second) continue;
+    if (entities[i]->type() == ObjectType::Existing)
+      SYMAWARE_RUNTIME_ERROR("Existing entities cannot be created. Use the addEntity(std::string, Entity) method");
+    pending.push_back(entities[i]);
+  }
+  std::stable_sort(pending.begin(), pending.end(), [](const Entity* const lhs, const Entity* const rhs) {
+    return to_underlying(lhs->type()) < to_underlying(rhs->type());
+  });
+
+  entities_.reserve(entities_.size() + pending.size());
+  std::string type_name;
+  for (std::size_t i = 0; i < pending.size(); ++i) {
+    Entity& entity = *pending[i];
+    if (i == 0 || entity.type() != pending[i - 1]->type()) type_name = to_string(entity.type());
+    if (!reuseParkedObject(entity)) entity.initialiseObject(experiment_, experiment_.createObject(type_name));
+    entities_[entity.name()] = &entity;
+  }
+  return *this;
+}
+
 Environment& Environment::removeEntity(Entity& entity) {
   if (!entity.is_initialised()) return *this;         // The entity was never initialised
   if (!entities_.erase(entity.name())) return *this;  // The entity was not found in the environment
-  entity.remove();
+  if (pooling_ && entity.type() != ObjectType::Existing) {
+    pool_[entity.type()].push_back(entity.park());
+  } else {
+    entity.remove();
+  }
   return *this;
 }
 Environment& Environment::removeEntity(const std::string& name) {
+  const auto it = entities_.find(name);
+  if (pooling_ && it != entities_.end()) return removeEntity(*it->second);
   entities_.erase(name);
   experiment_.getObjectByName<prescan::api::types::WorldObject>(name).remove();
   return *this;
 }
 
+Environment& Environment::setPooling(const bool pooling) {
+  pooling_ = pooling;
+  if (!pooling_) clearPool();
+  return *this;
+}
+
+Environment& Environment::clearPool() {
+  for (auto& [type, parked_objects] : pool_) {
+    for (ParkedObject& parked : parked_objects) parked.object.remove();
+  }
+  pool_.clear();
+  return *this;
+}
+
+std::size_t Environment::pooledCount() const {
+  std::size_t count = 0;
+  for (const auto& [type, parked_objects] : pool_) count += parked_objects.size();
+  return count;
+}
+
+bool Environment::reuseParkedObject(Entity& entity) {
+  const auto it = pool_.find(entity.type());
+  if (it == pool_.end()) return false;
+  std::vector<ParkedObject>& parked_objects = it->second;
+  const std::uint64_t model_id = entity.model() == nullptr ? 0 : entity.model()->id();
+  // Prefer an object parked with the same model, then one without any model to avoid attaching two to it
+  auto parked = std::find_if(parked_objects.rbegin(), parked_objects.rend(),
+                             [model_id](const ParkedObject& parked) { return parked.model_id == model_id; });
+  if (parked == parked_objects.rend())
+    parked = std::find_if(parked_objects.rbegin(), parked_objects.rend(),
+                          [](const ParkedObject& parked) { return parked.model_id == 0; });
+  if (parked == parked_objects.rend()) return false;
+
+  entity.reuseObject(experiment_, *parked);
+  std::swap(*parked, parked_objects.back());
+  parked_objects.pop_back();
+  return true;
+}
+
 Road Environment::addRoad(const Position& position) { return Road{*this}.setPosition(position); }
 
 Environment& Environment::importOpenDriveNetwork(const std::string& filename) {
+  // Parse the file first, so that neither the experiment nor the road network change if it is not valid
+  RoadNetwork road_network{road_network_};
+  road_network.importOpenDriveFile(filename);
   prescan::api::opendrive::importOpenDriveFile(experiment_, filename);
+  road_network_ = std::move(road_network);
   return *this;
 }
 
@@ -0,0 +1,144 @@
+#include "symaware/prescan/history_exporter.h"
+
+#include <utility>
+
+#include "symaware/prescan/entity.h"
+#include "symaware/prescan/sensor.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr std::size_t air_row_size = 6;
+constexpr std::size_t brs_row_size = 5;
+
+void appendKey(ArrowStreamWriter& writer, const std::int64_t step, const double time, const std::string& entity) {
+  writer.column(0).append(step);
+  writer.column(1).append(time);
+  writer.column(2).append(entity);
+}
+
+}  // namespace
+
+HistoryExporter::HistoryExporter(std::string directory, const std::size_t flush_interval)
+    : directory_{std::move(directory)},
+      flush_interval_{flush_interval},
+      steps_{0},
+      entity_states_{nullptr},
+      air_detections_{nullptr},
+      brs_boxes_{nullptr} {
+  if (flush_interval_ == 0) SYMAWARE_INVALID_ARGUMENT("flush_interval", flush_interval_);
+}
+
+void HistoryExporter::initialise(const Environment&, prescan::sim::ISimulation*) {
+  steps_ = 0;
+  entity_states_ = std::make_unique<ArrowStreamWriter>(
+      directory_ + "/entity_states.arrows",
+      std::vector<ArrowField>{{"step", ArrowType::INT64},
+                              {"time", ArrowType::FLOAT64},
+                              {"entity", ArrowType::UTF8},
+                              {"x", ArrowType::FLOAT64},
+                              {"y", ArrowType::FLOAT64},
+                              {"z", ArrowType::FLOAT64},
+                              {"roll", ArrowType::FLOAT64},
+                              {"pitch", ArrowType::FLOAT64},
+                              {"yaw", ArrowType::FLOAT64},
+                              {"velocity", ArrowType::FLOAT64},
+                              {"yaw_rate", ArrowType::FLOAT64}});
+  air_detections_ = std::make_unique<ArrowStreamWriter>(
+      directory_ + "/air_detections.arrows",
+      std::vector<ArrowField>{{"step", ArrowType::INT64},
+                              {"time", ArrowType::FLOAT64},
+                              {"entity", ArrowType::UTF8},
+                              {"sensor", ArrowType::INT32},
+                              {"range", ArrowType::FLOAT64},
+                              {"azimuth", ArrowType::FLOAT64},
+                              {"elevation", ArrowType::FLOAT64},
+                              {"object_id", ArrowType::INT32},
+                              {"velocity", ArrowType::FLOAT64},
+                              {"heading", ArrowType::FLOAT64}});
+  brs_boxes_ = std::make_unique<ArrowStreamWriter>(directory_ + "/brs_boxes.arrows",
+                                                   std::vector<ArrowField>{{"step", ArrowType::INT64},
+                                                                           {"time", ArrowType::FLOAT64},
+                                                                           {"entity", ArrowType::UTF8},
+                                                                           {"sensor", ArrowType::INT32},
+                                                                           {"object_id", ArrowType::INT32},
+                                                                           {"left", ArrowType::FLOAT64},
+                                                                           {"right", ArrowType::FLOAT64},
+                                                                           {"bottom", ArrowType::FLOAT64},
+                                                                           {"top", ArrowType::FLOAT64}});
+}
+
+void HistoryExporter::step(const Environment& environment, prescan::sim::ISimulation* simulation) {
+  SYMAWARE_ASSERT(entity_states_ != nullptr, "HistoryExporter must be initialised before stepping");
+  // Observers run after the simulation has stepped, so the state is the one at the end of the step
+  const double time = static_cast<double>(steps_ + 1) * simulation->getSampleTime();
+  for (const auto& [name, entity] : environment.entities()) exportEntity(name, *entity, time);
+  steps_++;
+  if (steps_ % static_cast<std::int64_t>(flush_interval_) == 0) flush();
+}
+
+void HistoryExporter::terminate(const Environment&, prescan::sim::ISimulation*) {
+  // Closing the writers flushes the remaining rows and writes the end-of-stream markers
+  entity_states_.reset();
+  air_detections_.reset();
+  brs_boxes_.reset();
+}
+
+void HistoryExporter::flush() {
+  if (entity_states_ == nullptr) return;
+  entity_states_->flush();
+  air_detections_->flush();
+  brs_boxes_->flush();
+}
+
+void HistoryExporter::exportEntity(const std::string& name, const Entity& entity, const double time) {
+  const Entity::State state = entity.state();
+  appendKey(*entity_states_, steps_, time, name);
+  entity_states_->column(3).append(state.position.x);
+  entity_states_->column(4).append(state.position.y);
+  entity_states_->column(5).append(state.position.z);
+  entity_states_->column(6).append(state.orientation.roll);
+  entity_states_->column(7).append(state.orientation.pitch);
+  entity_states_->column(8).append(state.orientation.yaw);
+  entity_states_->column(9).append(state.velocity);
+  entity_states_->column(10).append(state.yaw_rate);
+
+  for (Sensor* const sensor : entity.sensors()) {
+    const auto sensor_id = static_cast<std::int32_t>(sensor->id());
+    switch (sensor->sensor_type()) {
+      case SensorType::AIR: {
+        const std::vector<double>& detections = sensor->state();
+        for (std::size_t i = 0; i + air_row_size <= detections.size(); i += air_row_size) {
+          appendKey(*air_detections_, steps_, time, name);
+          air_detections_->column(3).append(sensor_id);
+          air_detections_->column(4).append(detections[i]);
+          air_detections_->column(5).append(detections[i + 1]);
+          air_detections_->column(6).append(detections[i + 2]);
+          air_detections_->column(7).append(static_cast<std::int32_t>(detections[i + 3]));
+          air_detections_->column(8).append(detections[i + 4]);
+          air_detections_->column(9).append(detections[i + 5]);
+        }
+        break;
+      }
+      case SensorType::BRS: {
+        const std::vector<double>& boxes = sensor->state();
+        for (std::size_t i = 0; i + brs_row_size <= boxes.size(); i += brs_row_size) {
+          appendKey(*brs_boxes_, steps_, time, name);
+          brs_boxes_->column(3).append(sensor_id);
+          brs_boxes_->column(4).append(static_cast<std::int32_t>(boxes[i]));
+          brs_boxes_->column(5).append(boxes[i + 1]);
+          brs_boxes_->column(6).append(boxes[i + 2]);
+          brs_boxes_->column(7).append(boxes[i + 3]);
+          brs_boxes_->column(8).append(boxes[i + 4]);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+}  // namespace symaware
@@ -0,0 +1,210 @@
+#include "symaware/prescan/kpi_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <ostream>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+KpiEvaluator::Summary emptySummary() {
+  return KpiEvaluator::Summary{0, 0, infinity, nan, infinity, nan, infinity, nan, nan, nan, 0, nan, 0, nan};
+}
+
+/** Update the @p minimum reached at @p min_time with the @p value at @p time */
+void updateMinimum(const double value, const double time, double& minimum, double& min_time) {
+  if (value >= minimum) return;
+  minimum = value;
+  min_time = time;
+}
+
+/** Record the first time an event happened, if it has not happened before */
+void updateFirst(const double time, double& first) {
+  if (std::isnan(first)) first = time;
+}
+
+/** Check the parameters of the evaluation are valid. @return the @p setup itself */
+const KpiEvaluator::Setup& validated(const KpiEvaluator::Setup& setup) {
+  if (!(setup.interaction_radius > 0)) SYMAWARE_INVALID_ARGUMENT("interaction_radius", setup.interaction_radius);
+  if (!(setup.collision_distance >= 0)) SYMAWARE_INVALID_ARGUMENT("collision_distance", setup.collision_distance);
+  if (!(setup.ttc_threshold >= 0)) SYMAWARE_INVALID_ARGUMENT("ttc_threshold", setup.ttc_threshold);
+  if (!(setup.headway_threshold >= 0)) SYMAWARE_INVALID_ARGUMENT("headway_threshold", setup.headway_threshold);
+  if (!(setup.lane_width >= 0)) SYMAWARE_INVALID_ARGUMENT("lane_width", setup.lane_width);
+  return setup;
+}
+
+/** Speed of an entity, 0 if it is not simulated by any model */
+double speedOf(const Entity::State& state) { return std::isfinite(state.velocity) ? state.velocity : 0; }
+/** Heading of an entity, 0 if it is not known */
+double headingOf(const Entity::State& state) {
+  return std::isfinite(state.orientation.yaw) ? state.orientation.yaw : 0;
+}
+
+}  // namespace
+
+KpiEvaluator::Setup::Setup(const double interaction_radius, const double collision_distance,
+                           const double ttc_threshold, const double headway_threshold, const double lane_width)
+    : interaction_radius{interaction_radius},
+      collision_distance{collision_distance},
+      ttc_threshold{ttc_threshold},
+      headway_threshold{headway_threshold},
+      lane_width{lane_width} {}
+
+KpiEvaluator::KpiEvaluator(Setup setup)
+    : setup_{validated(setup)},
+      summary_{emptySummary()},
+      summaries_{},
+      egos_{},
+      index_{setup_.interaction_radius},
+      entities_{},
+      states_{},
+      x_{},
+      y_{},
+      colliding_{},
+      previous_colliding_{},
+      on_lane_{} {}
+
+void KpiEvaluator::initialise(const Environment&, prescan::sim::ISimulation*) { reset(); }
+
+void KpiEvaluator::step(const Environment& environment, prescan::sim::ISimulation* simulation) {
+  // Observers run after the simulation has stepped, so the state is the one at the end of the step
+  evaluate(environment, static_cast<double>(summary_.steps + 1) * simulation->getSampleTime());
+}
+
+void KpiEvaluator::terminate(const Environment&, prescan::sim::ISimulation*) { summaries_.push_back(summary_); }
+
+void KpiEvaluator::evaluate(const Environment& environment, const double time) {
+  entities_.clear();
+  states_.clear();
+  x_.clear();
+  y_.clear();
+  for (const auto& [name, entity] : environment.entities()) {
+    const Entity::State state = entity->state();
+    if (!std::isfinite(state.position.x) || !std::isfinite(state.position.y)) continue;
+    entities_.push_back(entity);
+    states_.push_back(state);
+    x_.push_back(state.position.x);
+    y_.push_back(state.position.y);
+  }
+  index_.build(x_, y_);
+
+  for (std::size_t a = 0; a < entities_.size(); ++a) {
+    if (!egos_.empty() && egos_.count(entities_[a]) == 0) continue;
+    index_.forEachInRadius(x_[a], y_[a], setup_.interaction_radius, [&](const std::size_t b, double) {
+      if (b == a) return;
+      // Each pair must be evaluated once: skip it when it is going to be found from the other entity as well
+      if ((egos_.empty() || egos_.count(entities_[b]) > 0) && b < a) return;
+      evaluatePair(a, b, time);
+    });
+  }
+
+  // A collision starts when a pair that was not colliding in the previous step is colliding now
+  std::sort(colliding_.begin(), colliding_.end());
+  for (const EntityPair& pair : colliding_) {
+    if (std::binary_search(previous_colliding_.begin(), previous_colliding_.end(), pair)) continue;
+    summary_.collisions++;
+    updateFirst(time, summary_.first_collision);
+  }
+  std::swap(colliding_, previous_colliding_);
+  colliding_.clear();
+
+  evaluateLanes(environment, time);
+  summary_.steps++;
+  summary_.duration = time;
+}
+
+void KpiEvaluator::evaluatePair(const std::size_t a, const std::size_t b, const double time) {
+  const double rx = x_[b] - x_[a], ry = y_[b] - y_[a];
+  const double distance = std::hypot(rx, ry);
+  updateMinimum(distance, time, summary_.min_distance, summary_.min_distance_time);
+  if (distance < setup_.collision_distance) {
+    const bool ordered = std::less<const Entity*>{}(entities_[a], entities_[b]);
+    colliding_.emplace_back(ordered ? entities_[a] : entities_[b], ordered ? entities_[b] : entities_[a]);
+  }
+
+  // Time to collision, with the relative velocity projected on the line joining the entities
+  const double speed_a = speedOf(states_[a]), heading_a = headingOf(states_[a]);
+  const double speed_b = speedOf(states_[b]), heading_b = headingOf(states_[b]);
+  const double wx = speed_b * std::cos(heading_b) - speed_a * std::cos(heading_a);
+  const double wy = speed_b * std::sin(heading_b) - speed_a * std::sin(heading_a);
+  double ttc = infinity;
+  if (distance < setup_.collision_distance) {
+    ttc = 0;
+  } else {
+    const double closing_speed = -(rx * wx + ry * wy) / distance;
+    if (closing_speed > 0) ttc = (distance - setup_.collision_distance) / closing_speed;
+  }
+  if (ttc < infinity) updateMinimum(ttc, time, summary_.min_ttc, summary_.min_ttc_time);
+  if (ttc < setup_.ttc_threshold) updateFirst(time, summary_.first_ttc_violation);
+
+  const double min_headway = std::min(headway(a, b), headway(b, a));
+  if (min_headway < infinity) updateMinimum(min_headway, time, summary_.min_headway, summary_.min_headway_time);
+  if (min_headway < setup_.headway_threshold) updateFirst(time, summary_.first_headway_violation);
+}
+
+double KpiEvaluator::headway(const std::size_t follower, const std::size_t leader) const {
+  const double speed = speedOf(states_[follower]);
+  if (!(speed > 0)) return infinity;
+  const double heading = headingOf(states_[follower]);
+  const double rx = x_[leader] - x_[follower], ry = y_[leader] - y_[follower];
+  // Position of the leader in the frame of the follower
+  const double longitudinal = rx * std::cos(heading) + ry * std::sin(heading);
+  const double lateral = -rx * std::sin(heading) + ry * std::cos(heading);
+  if (!(longitudinal > 0) || std::abs(lateral) > setup_.lane_width / 2) return infinity;
+  return std::max(longitudinal - setup_.collision_distance, 0.0) / speed;
+}
+
+void KpiEvaluator::evaluateLanes(const Environment& environment, const double time) {
+  const RoadNetwork& network = environment.roadNetwork();
+  if (network.roads().empty()) return;
+  for (std::size_t k = 0; k < entities_.size(); ++k) {
+    if (entities_[k]->model() == nullptr) continue;
+    const bool on_lane = network.locate(x_[k], y_[k]).has_value();
+    const auto [it, inserted] = on_lane_.try_emplace(entities_[k], on_lane);
+    if (inserted) continue;
+    if (it->second && !on_lane) {
+      summary_.lane_departures++;
+      updateFirst(time, summary_.first_lane_departure);
+    }
+    it->second = on_lane;
+  }
+}
+
+void KpiEvaluator::addEgo(const Entity& entity) { egos_.insert(&entity); }
+void KpiEvaluator::clearEgos() { egos_.clear(); }
+
+void KpiEvaluator::reset() {
+  summary_ = emptySummary();
+  colliding_.clear();
+  previous_colliding_.clear();
+  on_lane_.clear();
+}
+
+void KpiEvaluator::clearSummaries() { summaries_.clear(); }
+
+std::ostream& operator<<(std::ostream& os, const KpiEvaluator::Setup& setup) {
+  return os << "KpiEvaluator::Setup: (interaction_radius: " << setup.interaction_radius
+            << ", collision_distance: " << setup.collision_distance << ", ttc_threshold: " << setup.ttc_threshold
+            << ", headway_threshold: " << setup.headway_threshold << ", lane_width: " << setup.lane_width << ")";
+}
+std::ostream& operator<<(std::ostream& os, const KpiEvaluator::Summary& summary) {
+  return os << "KpiEvaluator::Summary: (steps: " << summary.steps << ", duration: " << summary.duration
+            << ", min_distance: " << summary.min_distance << ", min_distance_time: " << summary.min_distance_time
+            << ", min_ttc: " << summary.min_ttc << ", min_ttc_time: " << summary.min_ttc_time
+            << ", min_headway: " << summary.min_headway << ", min_headway_time: " << summary.min_headway_time
+            << ", first_ttc_violation: " << summary.first_ttc_violation
+            << ", first_headway_violation: " << summary.first_headway_violation
+            << ", collisions: " << summary.collisions << ", first_collision: " << summary.first_collision
+            << ", lane_departures: " << summary.lane_departures
+            << ", first_lane_departure: " << summary.first_lane_departure << ")";
+}
+
+}  // namespace symaware
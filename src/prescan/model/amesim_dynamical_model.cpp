@@ -37,16 +37,16 @@ void AmesimDynamicalModel::createIfNotExists(prescan::api::experiment::Experimen
   dynamics.setInitialVelocity(initial_velocity_);
 }
 
-void AmesimDynamicalModel::setInput(const std::vector<double>& input) {
-  if (input.size() != 4) {
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for AmesimDynamicalModel: expected 4, got {}", input.size());
+void AmesimDynamicalModel::setInput(const double* const input, const std::size_t size) {
+  if (size != 4) {
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for AmesimDynamicalModel: expected 4, got {}", size);
   }
   input_ = Input{input[0], input[1], input[2], static_cast<Gear>(static_cast<int>(input[3]))};
 }
 
-void AmesimDynamicalModel::updateInput(const std::vector<double>& input) {
-  if (input.size() != 4) {
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for AmesimDynamicalModel: expected 4, got {}", input.size());
+void AmesimDynamicalModel::updateInput(const double* const input, const std::size_t size) {
+  if (size != 4) {
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for AmesimDynamicalModel: expected 4, got {}", size);
   }
   if (!std::isnan(input[0])) input_.throttle = input[0];
   if (!std::isnan(input[1])) input_.brake = input[1];
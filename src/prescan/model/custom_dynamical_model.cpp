@@ -29,9 +29,9 @@ CustomDynamicalModel::CustomDynamicalModel(Input initial_input) : CustomDynamica
 CustomDynamicalModel::CustomDynamicalModel(const Setup& setup, Input initial_input)
     : EntityModel{setup.existing, setup.active}, input_{std::move(initial_input)} {}
 
-void CustomDynamicalModel::setInput(const std::vector<double>& input) {
-  if (input.size() != 15) {
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for CustomDynamicalModel: expected 4, got {}", input.size());
+void CustomDynamicalModel::setInput(const double* const input, const std::size_t size) {
+  if (size != 15) {
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for CustomDynamicalModel: expected 15, got {}", size);
   }
   input_ = Input{{input[0], input[1], input[2]},
                  {input[3], input[4], input[5]},
@@ -40,9 +40,9 @@ void CustomDynamicalModel::setInput(const std::vector<double>& input) {
                  {input[12], input[13], input[14]}};
 }
 
-void CustomDynamicalModel::updateInput(const std::vector<double>& input) {
-  if (input.size() != 15) {
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for CustomDynamicalModel: expected 4, got {}", input.size());
+void CustomDynamicalModel::updateInput(const double* const input, const std::size_t size) {
+  if (size != 15) {
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for CustomDynamicalModel: expected 15, got {}", size);
   }
   if (!std::isnan(input[0])) input_.position.x = input[0];
   if (!std::isnan(input[1])) input_.position.y = input[1];
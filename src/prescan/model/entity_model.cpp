@@ -2,13 +2,16 @@
 
 #include <fmt/core.h>
 
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <prescan/api/Vehicledynamics.hpp>
 #include <prescan/api/types/WorldObject.hpp>
 #include <prescan/api/vehicledynamics/AmesimPreconfiguredDynamics.hpp>
 
 #include "symaware/prescan/entity.h"
 #include "symaware/util/exception.h"
+#include "symaware/util/trace.h"
 
 #define ENSURE_OBJECT_NOT_NULL(object, message)                        \
   do {                                                                 \
@@ -21,8 +24,34 @@
 
 namespace symaware {
 
+namespace {
+
+std::uint64_t nextId() {
+  static std::atomic<std::uint64_t> next_id{1};
+  return next_id++;
+}
+
+}  // namespace
+
 EntityModel::EntityModel(const bool existing, const bool active)
-    : existing_{existing}, active_{active}, state_{nullptr} {}
+    : id_{nextId()}, existing_{existing}, active_{active}, state_{nullptr}, object_{}, profile_{} {}
+
+EntityModel::EntityModel(const EntityModel& other)
+    : id_{nextId()},
+      existing_{other.existing_},
+      active_{other.active_},
+      state_{other.state_},
+      object_{other.object_},
+      profile_{other.profile_} {}
+
+EntityModel& EntityModel::operator=(const EntityModel& other) {
+  existing_ = other.existing_;
+  active_ = other.active_;
+  state_ = other.state_;
+  object_ = other.object_;
+  profile_ = other.profile_;
+  return *this;
+}
 
 void EntityModel::linkEntity(const prescan::api::types::WorldObject& object) {
   ENSURE_OBJECT_NOT_NULL(object, "Object is null");
@@ -50,12 +79,14 @@ void EntityModel::initialise(prescan::sim::ISimulation* simulation) {
   if (!active_) return;
   if (state_ == nullptr) SYMAWARE_RUNTIME_ERROR("EntityModel has not been registered to a state");
   state_->stateActuatorInput();
+  SYMAWARE_TRACE_SCOPE("EntityModel::updateState");
   updateState();
 }
 
 void EntityModel::step(prescan::sim::ISimulation* simulation) {
   if (!active_) return;
   if (state_ == nullptr) SYMAWARE_RUNTIME_ERROR("EntityModel has not been registered to a state");
+  SYMAWARE_TRACE_SCOPE("EntityModel::updateState");
   updateState();
 }
 
@@ -1,36 +1,75 @@
 #include "symaware/prescan/model/simulation_model.h"
 
+#include <algorithm>
 #include <iostream>
 #include <prescan/api/Experiment.hpp>
 #include <prescan/sim/Simulation.hpp>
 #include <stdexcept>
 
+#include "symaware/util/trace.h"
+
 namespace symaware {
 
 SimulationModel::SimulationModel(const Environment& environment)
-    : environment_{environment}, on_pre_step_{nullptr}, on_post_step_{nullptr} {};
+    : environment_{environment}, on_pre_step_{nullptr}, on_post_step_{nullptr}, observers_{}, profile_{} {};
 
 void SimulationModel::registerSimulationUnits(const prescan::api::experiment::Experiment& experiment,
                                               prescan::sim::ISimulation* simulation) {
+  ScopedTimer timer{profile_, ProfilePhase::REGISTER};
   for (const auto& [name, entity] : environment_.entities()) entity->registerUnit(experiment, simulation);
-  for (EntityModel* const model : environment_.models()) model->registerUnit(experiment, simulation);
+  for (EntityModel* const model : environment_.models()) {
+    ScopedTimer model_timer{model->profile(), ProfilePhase::REGISTER};
+    model->registerUnit(experiment, simulation);
+  }
 };
 
 void SimulationModel::initialize(prescan::sim::ISimulation* simulation) {
+  ScopedTimer timer{profile_, ProfilePhase::INITIALISE};
   for (const auto& [name, entity] : environment_.entities()) entity->initialise(simulation);
-  for (EntityModel* const model : environment_.models()) model->initialise(simulation);
+  for (EntityModel* const model : environment_.models()) {
+    ScopedTimer model_timer{model->profile(), ProfilePhase::INITIALISE};
+    model->initialise(simulation);
+  }
+  for (SimulationObserver* const observer : observers_) observer->initialise(environment_, simulation);
 };
 
 void SimulationModel::step(prescan::sim::ISimulation* simulation) {
-  if (on_pre_step_ != nullptr) on_pre_step_();
+  ScopedTimer timer{profile_, ProfilePhase::STEP};
+  if (on_pre_step_ != nullptr) {
+    SYMAWARE_TRACE_SCOPE("SimulationModel::on_pre_step");
+    ScopedTimer callback_timer{profile_, ProfilePhase::PRE_STEP};
+    on_pre_step_();
+  }
   for (const auto& [name, entity] : environment_.entities()) entity->step(simulation);
-  for (EntityModel* const model : environment_.models()) model->step(simulation);
-  if (on_post_step_ != nullptr) on_post_step_();
+  for (EntityModel* const model : environment_.models()) {
+    ScopedTimer model_timer{model->profile(), ProfilePhase::STEP};
+    model->step(simulation);
+  }
+  for (SimulationObserver* const observer : observers_) observer->step(environment_, simulation);
+  if (on_post_step_ != nullptr) {
+    SYMAWARE_TRACE_SCOPE("SimulationModel::on_post_step");
+    ScopedTimer callback_timer{profile_, ProfilePhase::POST_STEP};
+    on_post_step_();
+  }
 };
 
 void SimulationModel::terminate(prescan::sim::ISimulation* simulation) {
+  ScopedTimer timer{profile_, ProfilePhase::TERMINATE};
   for (const auto& [name, entity] : environment_.entities()) entity->terminate(simulation);
-  for (EntityModel* const model : environment_.models()) model->terminate(simulation);
+  for (EntityModel* const model : environment_.models()) {
+    ScopedTimer model_timer{model->profile(), ProfilePhase::TERMINATE};
+    model->terminate(simulation);
+  }
+  for (SimulationObserver* const observer : observers_) observer->terminate(environment_, simulation);
 };
 
+void SimulationModel::addObserver(SimulationObserver& observer) {
+  if (std::find(observers_.begin(), observers_.end(), &observer) != observers_.end()) return;
+  observers_.push_back(&observer);
+}
+
+void SimulationModel::removeObserver(SimulationObserver& observer) {
+  observers_.erase(std::remove(observers_.begin(), observers_.end(), &observer), observers_.end());
+}
+
 }  // namespace symaware
@@ -6,6 +6,13 @@
 
 namespace symaware {
 
+TrackModel::Setup::Setup(const bool existing, const bool active, const Router::Route& route, const double speed,
+                         const double tolerance)
+    : existing{existing}, active{active}, path{}, speed{speed}, tolerance{tolerance} {
+  path.reserve(route.waypoints.size());
+  for (const Router::Waypoint& waypoint : route.waypoints) path.emplace_back(waypoint.x, waypoint.y, waypoint.z);
+}
+
 TrackModel::Input::Input()
     : velocity_multiplier{1},
       velocity_offset{0},
@@ -61,15 +68,15 @@ void TrackModel::createIfNotExists(prescan::api::experiment::Experiment& experim
   prescan::api::trajectory::createTrajectory(object_, path, speed_profile);
 }
 
-void TrackModel::setInput(const std::vector<double>& input) {
-  if (input.size() != 6)
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for TrackModel: expected 6, got {}", input.size());
+void TrackModel::setInput(const double* const input, const std::size_t size) {
+  if (size != 6)
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for TrackModel: expected 6, got {}", size);
   input_ = Input{input[0], input[1], input[2], input[3], input[4], input[5]};
 }
 
-void TrackModel::updateInput(const std::vector<double>& input) {
-  if (input.size() != 6)
-    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for TrackModel: expected 6, got {}", input.size());
+void TrackModel::updateInput(const double* const input, const std::size_t size) {
+  if (size != 6)
+    SYMAWARE_RUNTIME_ERROR_FMT("Invalid input size for TrackModel: expected 6, got {}", size);
   if (!std::isnan(input[0])) input_.velocity_multiplier = input[0];
   if (!std::isnan(input[1])) input_.velocity_offset = input[1];
   if (!std::isnan(input[2])) input_.acceleration_multiplier = input[2];
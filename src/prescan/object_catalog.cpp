@@ -0,0 +1,41 @@
+#include "symaware/prescan/object_catalog.h"
+
+#include <ostream>
+
+namespace symaware {
+
+namespace {
+
+/** @return true if each entry of the object catalog is at the index of its type */
+constexpr bool isSorted() {
+  for (std::size_t i = 0; i < object_catalog.size(); ++i) {
+    if (static_cast<std::size_t>(to_underlying(object_catalog[i].type)) != i) return false;
+  }
+  return true;
+}
+static_assert(isSorted(), "object_catalog.def must list all the ObjectTypes, in the order of the enum");
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, const ObjectCategory category) {
+  switch (category) {
+    case ObjectCategory::VEHICLE:
+      return os << "VEHICLE";
+    case ObjectCategory::PEDESTRIAN:
+      return os << "PEDESTRIAN";
+    case ObjectCategory::STATIC:
+      return os << "STATIC";
+    case ObjectCategory::FOLIAGE:
+      return os << "FOLIAGE";
+    default:
+      return os << "Unknown";
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const ObjectInfo& info) {
+  return os << "ObjectInfo: (type: " << info.type << ", category: " << info.category << ", length: " << info.length
+            << ", width: " << info.width << ", height: " << info.height << ", cog: (" << info.cog_x << ", "
+            << info.cog_y << ", " << info.cog_z << "), mass: " << info.mass << ")";
+}
+
+}  // namespace symaware
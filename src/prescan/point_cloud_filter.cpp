@@ -0,0 +1,181 @@
+#include "symaware/prescan/point_cloud_filter.h"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <random>
+
+#include "symaware/prescan/transform.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Smallest power of two that is at least twice @p size, so that the open addressing table is at most half full */
+std::size_t tableSize(const std::size_t size) {
+  std::size_t capacity = 16;
+  while (capacity < 2 * size) capacity <<= 1;
+  return capacity;
+}
+
+std::size_t voxelHash(const std::int64_t i, const std::int64_t j, const std::int64_t k) {
+  return static_cast<std::size_t>((static_cast<std::uint64_t>(i) * 73856093u) ^
+                                  (static_cast<std::uint64_t>(j) * 19349663u) ^
+                                  (static_cast<std::uint64_t>(k) * 83492791u));
+}
+
+}  // namespace
+
+PointCloudFilter::Setup::Setup(const double voxel_size, const double ground_threshold,
+                               const std::size_t ground_iterations, const double max_ground_slope,
+                               const std::uint32_t seed)
+    : voxel_size{voxel_size},
+      ground_threshold{ground_threshold},
+      ground_iterations{ground_iterations},
+      max_ground_slope{max_ground_slope},
+      seed{seed} {}
+
+PointCloudFilter::PointCloudFilter(Setup setup)
+    : setup_{setup},
+      input_size_{0},
+      ground_size_{0},
+      ground_plane_{},
+      x_{},
+      y_{},
+      z_{},
+      voxels_{},
+      slots_{},
+      points_{} {
+  if (!(setup_.voxel_size >= 0)) SYMAWARE_INVALID_ARGUMENT("voxel_size", setup_.voxel_size);
+  if (!(setup_.ground_threshold >= 0)) SYMAWARE_INVALID_ARGUMENT("ground_threshold", setup_.ground_threshold);
+  if (!(setup_.max_ground_slope >= 0)) SYMAWARE_INVALID_ARGUMENT("max_ground_slope", setup_.max_ground_slope);
+  clear();
+}
+
+void PointCloudFilter::clear() {
+  input_size_ = 0;
+  ground_size_ = 0;
+  ground_plane_.fill(std::numeric_limits<double>::quiet_NaN());
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  points_.clear();
+}
+
+void PointCloudFilter::process(const Pose& pose, const double* const x, const double* const y, const double* const z,
+                               const std::size_t size) {
+  input_size_ = size;
+  x_.resize(size);
+  y_.resize(size);
+  z_.resize(size);
+  transformPoints(pose, x, y, z, size, x_.data(), y_.data(), z_.data());
+  downsample();
+  removeGround();
+}
+
+void PointCloudFilter::downsample() {
+  const std::size_t size = x_.size();
+  std::size_t count = 0;
+  if (setup_.voxel_size == 0) {
+    // Only drop the points that cannot be placed in the world
+    for (std::size_t p = 0; p < size; ++p) {
+      if (!std::isfinite(x_[p]) || !std::isfinite(y_[p]) || !std::isfinite(z_[p])) continue;
+      x_[count] = x_[p];
+      y_[count] = y_[p];
+      z_[count] = z_[p];
+      ++count;
+    }
+  } else {
+    const double inv_voxel_size = 1 / setup_.voxel_size;
+    const std::size_t mask = tableSize(size) - 1;
+    voxels_.clear();
+    slots_.assign(mask + 1, 0);
+    for (std::size_t p = 0; p < size; ++p) {
+      if (!std::isfinite(x_[p]) || !std::isfinite(y_[p]) || !std::isfinite(z_[p])) continue;
+      const auto i = static_cast<std::int64_t>(std::floor(x_[p] * inv_voxel_size));
+      const auto j = static_cast<std::int64_t>(std::floor(y_[p] * inv_voxel_size));
+      const auto k = static_cast<std::int64_t>(std::floor(z_[p] * inv_voxel_size));
+      std::size_t slot = voxelHash(i, j, k) & mask;
+      // Linear probing until the voxel or an empty slot is found
+      while (slots_[slot] != 0) {
+        const Voxel& voxel = voxels_[slots_[slot] - 1];
+        if (voxel.i == i && voxel.j == j && voxel.k == k) break;
+        slot = (slot + 1) & mask;
+      }
+      if (slots_[slot] == 0) {
+        voxels_.push_back(Voxel{i, j, k, 0, 0, 0, 0});
+        slots_[slot] = static_cast<std::uint32_t>(voxels_.size());
+      }
+      Voxel& voxel = voxels_[slots_[slot] - 1];
+      voxel.x += x_[p];
+      voxel.y += y_[p];
+      voxel.z += z_[p];
+      ++voxel.count;
+    }
+    for (const Voxel& voxel : voxels_) {
+      x_[count] = voxel.x / voxel.count;
+      y_[count] = voxel.y / voxel.count;
+      z_[count] = voxel.z / voxel.count;
+      ++count;
+    }
+  }
+  x_.resize(count);
+  y_.resize(count);
+  z_.resize(count);
+}
+
+void PointCloudFilter::removeGround() {
+  const std::size_t size = x_.size();
+  ground_size_ = 0;
+  ground_plane_.fill(std::numeric_limits<double>::quiet_NaN());
+
+  if (setup_.ground_threshold > 0 && size >= 3) {
+    const double min_normal_z = std::cos(setup_.max_ground_slope);
+    std::mt19937 rng{setup_.seed};
+    std::uniform_int_distribution<std::size_t> index{0, size - 1};
+    for (std::size_t iteration = 0; iteration < setup_.ground_iterations && ground_size_ < size; ++iteration) {
+      const std::size_t a = index(rng), b = index(rng), c = index(rng);
+      if (a == b || a == c || b == c) continue;
+      const double ux = x_[b] - x_[a], uy = y_[b] - y_[a], uz = z_[b] - z_[a];
+      const double vx = x_[c] - x_[a], vy = y_[c] - y_[a], vz = z_[c] - z_[a];
+      double nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+      const double norm = std::sqrt(nx * nx + ny * ny + nz * nz);
+      // Collinear samples do not define a plane
+      if (norm < std::numeric_limits<double>::epsilon()) continue;
+      const double sign = nz < 0 ? -1 : 1;
+      nx *= sign / norm;
+      ny *= sign / norm;
+      nz *= sign / norm;
+      if (nz < min_normal_z) continue;
+      const double d = -(nx * x_[a] + ny * y_[a] + nz * z_[a]);
+      std::size_t inliers = 0;
+      for (std::size_t p = 0; p < size; ++p) {
+        inliers += std::abs(nx * x_[p] + ny * y_[p] + nz * z_[p] + d) <= setup_.ground_threshold;
+      }
+      if (inliers > ground_size_) {
+        ground_size_ = inliers;
+        ground_plane_ = {nx, ny, nz, d};
+      }
+    }
+  }
+
+  points_.clear();
+  points_.reserve((size - ground_size_) * 3);
+  const auto& [nx, ny, nz, d] = ground_plane_;
+  for (std::size_t p = 0; p < size; ++p) {
+    // Comparisons with the NaN plane are false, so all the points are kept if no ground plane was found
+    if (std::abs(nx * x_[p] + ny * y_[p] + nz * z_[p] + d) <= setup_.ground_threshold) continue;
+    points_.push_back(x_[p]);
+    points_.push_back(y_[p]);
+    points_.push_back(z_[p]);
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const PointCloudFilter::Setup& setup) {
+  return os << "PointCloudFilter::Setup: (voxel_size: " << setup.voxel_size
+            << ", ground_threshold: " << setup.ground_threshold << ", ground_iterations: " << setup.ground_iterations
+            << ", max_ground_slope: " << setup.max_ground_slope << ", seed: " << setup.seed << ")";
+}
+
+}  // namespace symaware
@@ -5,6 +5,14 @@ namespace symaware {
 Road::Road(Environment& environment)
     : Road{const_cast<prescan::api::experiment::Experiment&>(environment.experiment())} {}
 Road::Road(prescan::api::experiment::Experiment& experiment) : Road{prescan::api::roads::createRoad(experiment)} {}
-Road::Road(prescan::api::roads::types::Road road) : road_(std::move(road)) {}
+Road::Road(prescan::api::roads::types::Road road)
+    : road_(std::move(road)),
+      reference_line_{road_.pose().position().x(), road_.pose().position().y(), road_.pose().orientation().yaw()},
+      left_lane_widths_{},
+      right_lane_widths_{} {}
+
+FrenetTransform Road::frenetTransform(const double max_offset) const {
+  return FrenetTransform{reference_line_, left_lane_widths_, right_lane_widths_, max_offset};
+}
 
 }  // namespace symaware
@@ -0,0 +1,484 @@
+#include "symaware/prescan/road_builder.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#include "symaware/map/json.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+using prescan::api::roads::types::LaneType;
+using prescan::api::roads::types::ParameterRange;
+using prescan::api::roads::types::RoadSideType;
+using prescan::api::roads::types::TrafficSide;
+
+constexpr char magic[] = {'S', 'Y', 'M', 'R'};
+constexpr std::uint32_t version = 1;
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+/** Tag of a record of the description */
+enum class Tag : std::uint8_t {
+  ROAD = 0x01,
+  POSITION = 0x02,
+  TRAFFIC_SIDE = 0x03,
+  STRAIGHT = 0x10,
+  ARC = 0x11,
+  SPIRAL = 0x12,
+  POLY3 = 0x13,
+  PARAM_POLY3 = 0x14,
+  LANE = 0x20,
+  SPEED_LIMIT = 0x30,
+  PARKING_SPACE = 0x40,
+};
+
+/** Element of the description, shared by both formats */
+struct Record {
+  Tag tag;
+  std::array<std::uint8_t, 2> enums;  ///< Enumerations of the record
+  std::array<double, 9> numbers;      ///< Numbers of the record
+};
+
+/** @return number of enumerations and numbers of the records with the given @p tag, or {-1, -1} if unknown */
+std::pair<int, int> layout(const Tag tag) {
+  switch (tag) {
+    case Tag::ROAD:
+      return {0, 0};
+    case Tag::POSITION:
+      return {0, 3};
+    case Tag::TRAFFIC_SIDE:
+      return {1, 0};
+    case Tag::STRAIGHT:
+      return {0, 1};
+    case Tag::ARC:
+      return {0, 2};
+    case Tag::SPIRAL:
+      return {0, 3};
+    case Tag::POLY3:
+      return {0, 5};
+    case Tag::PARAM_POLY3:
+      return {1, 9};
+    case Tag::LANE:
+      return {2, 3};
+    case Tag::SPEED_LIMIT:
+      return {0, 3};
+    case Tag::PARKING_SPACE:
+      return {1, 5};
+    default:
+      return {-1, -1};
+  }
+}
+
+/** Parser of the JSON format, emitting each record as soon as it is complete */
+template <class Emit>
+class JsonParser {
+ public:
+  JsonParser(std::istream& is, Emit& emit) : reader_{is}, emit_{emit} {}
+
+  void parse() {
+    reader_.expect(JsonReader::Token::BEGIN_OBJECT);
+    while (reader_.next() == JsonReader::Token::KEY) {
+      if (reader_.string() != "roads") unknownKey();
+      reader_.expect(JsonReader::Token::BEGIN_ARRAY);
+      while (reader_.next() == JsonReader::Token::BEGIN_OBJECT) parseRoad();
+      checkArrayEnd();
+    }
+    reader_.expect(JsonReader::Token::END);
+  }
+
+ private:
+  [[noreturn]] void unknownKey() const { reader_.error(fmt::format("unknown key '{}'", reader_.string())); }
+  /** Check the array of objects just read ends where the last object did */
+  void checkArrayEnd() const {
+    if (reader_.token() != JsonReader::Token::END_ARRAY) reader_.error("expected an object or ']'");
+  }
+  /** Read the elements of an array of objects, calling @p parse_object after the start of each one */
+  template <class F>
+  void parseArray(F&& parse_object) {
+    reader_.expect(JsonReader::Token::BEGIN_ARRAY);
+    while (reader_.next() == JsonReader::Token::BEGIN_OBJECT) parse_object();
+    checkArrayEnd();
+  }
+  template <std::size_t N>
+  void readNumbers(double* const numbers) {
+    reader_.expect(JsonReader::Token::BEGIN_ARRAY);
+    for (std::size_t i = 0; i < N; ++i) numbers[i] = reader_.readNumber();
+    reader_.expect(JsonReader::Token::END_ARRAY);
+  }
+  /** @return index of the value of the next string among the @p options */
+  std::uint8_t readOption(const std::initializer_list<std::string_view> options) {
+    const std::string& value = reader_.readString();
+    std::uint8_t index = 0;
+    for (const std::string_view option : options) {
+      if (value == option) return index;
+      ++index;
+    }
+    reader_.error(fmt::format("invalid value '{}'", value));
+  }
+  /** Read a number that may be null, which stands for @p null_value */
+  double readNumberOr(const double null_value) {
+    if (reader_.next() == JsonReader::Token::NULL_VALUE) return null_value;
+    if (reader_.token() != JsonReader::Token::NUMBER) reader_.error("expected a number");
+    return reader_.number();
+  }
+  void require(const double value, const std::string_view key) const {
+    if (std::isnan(value)) reader_.error(fmt::format("missing key '{}'", key));
+  }
+
+  void parseRoad() {
+    emit_(Record{Tag::ROAD, {}, {}});
+    while (reader_.next() == JsonReader::Token::KEY) {
+      const std::string& key = reader_.string();
+      if (key == "position") {
+        Record record{Tag::POSITION, {}, {}};
+        readNumbers<3>(record.numbers.data());
+        emit_(record);
+      } else if (key == "traffic_side") {
+        emit_(Record{Tag::TRAFFIC_SIDE, {readOption({"left", "right"})}, {}});
+      } else if (key == "sections") {
+        parseArray([this]() { parseSection(); });
+      } else if (key == "lanes") {
+        parseArray([this]() { parseLane(); });
+      } else if (key == "speed_limits") {
+        parseArray([this]() { parseSpeedLimit(); });
+      } else if (key == "parking_spaces") {
+        parseArray([this]() { parseParkingSpace(); });
+      } else {
+        unknownKey();
+      }
+    }
+  }
+
+  void parseSection() {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    std::string type;
+    double length = nan, curvature = nan, start_curvature = nan, end_curvature = nan;
+    double a = 0, b = 0, c = 0, d = 0;
+    std::array<double, 8> uv{};
+    std::uint8_t normalized = 1;
+    while (reader_.next() == JsonReader::Token::KEY) {
+      const std::string& key = reader_.string();
+      if (key == "type") {
+        type = reader_.readString();
+      } else if (key == "length") {
+        length = reader_.readNumber();
+      } else if (key == "curvature") {
+        curvature = reader_.readNumber();
+      } else if (key == "start_curvature") {
+        start_curvature = reader_.readNumber();
+      } else if (key == "end_curvature") {
+        end_curvature = reader_.readNumber();
+      } else if (key == "a") {
+        a = reader_.readNumber();
+      } else if (key == "b") {
+        b = reader_.readNumber();
+      } else if (key == "c") {
+        c = reader_.readNumber();
+      } else if (key == "d") {
+        d = reader_.readNumber();
+      } else if (key == "u") {
+        readNumbers<4>(uv.data());
+      } else if (key == "v") {
+        readNumbers<4>(uv.data() + 4);
+      } else if (key == "normalized") {
+        normalized = reader_.readBoolean() ? 1 : 0;
+      } else {
+        unknownKey();
+      }
+    }
+    require(length, "length");
+    if (type == "straight") {
+      emit_(Record{Tag::STRAIGHT, {}, {length}});
+    } else if (type == "arc") {
+      require(curvature, "curvature");
+      emit_(Record{Tag::ARC, {}, {length, curvature}});
+    } else if (type == "spiral") {
+      require(start_curvature, "start_curvature");
+      require(end_curvature, "end_curvature");
+      emit_(Record{Tag::SPIRAL, {}, {length, start_curvature, end_curvature}});
+    } else if (type == "poly3") {
+      emit_(Record{Tag::POLY3, {}, {length, a, b, c, d}});
+    } else if (type == "param_poly3") {
+      emit_(Record{Tag::PARAM_POLY3, {normalized},
+                   {length, uv[0], uv[1], uv[2], uv[3], uv[4], uv[5], uv[6], uv[7]}});
+    } else {
+      reader_.error(fmt::format("invalid section type '{}'", type));
+    }
+  }
+
+  void parseLane() {
+    Record record{Tag::LANE, {1, 0}, {std::numeric_limits<double>::quiet_NaN(), 0, inf}};
+    while (reader_.next() == JsonReader::Token::KEY) {
+      const std::string& key = reader_.string();
+      if (key == "side") {
+        record.enums[0] = readOption({"left", "right"});
+      } else if (key == "type") {
+        record.enums[1] = readOption({"driving", "biking", "sidewalk"});
+      } else if (key == "width") {
+        record.numbers[0] = reader_.readNumber();
+      } else if (key == "start") {
+        record.numbers[1] = reader_.readNumber();
+      } else if (key == "end") {
+        record.numbers[2] = readNumberOr(inf);
+      } else {
+        unknownKey();
+      }
+    }
+    require(record.numbers[0], "width");
+    emit_(record);
+  }
+
+  void parseSpeedLimit() {
+    Record record{Tag::SPEED_LIMIT, {}, {std::numeric_limits<double>::quiet_NaN(), 0, inf}};
+    while (reader_.next() == JsonReader::Token::KEY) {
+      const std::string& key = reader_.string();
+      if (key == "value") {
+        record.numbers[0] = reader_.readNumber();
+      } else if (key == "start") {
+        record.numbers[1] = reader_.readNumber();
+      } else if (key == "end") {
+        record.numbers[2] = readNumberOr(inf);
+      } else {
+        unknownKey();
+      }
+    }
+    require(record.numbers[0], "value");
+    emit_(record);
+  }
+
+  void parseParkingSpace() {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    Record record{Tag::PARKING_SPACE, {0}, {nan, nan, 0, 0, 0}};
+    while (reader_.next() == JsonReader::Token::KEY) {
+      const std::string& key = reader_.string();
+      if (key == "side") {
+        record.enums[0] = readOption({"left", "right"});
+      } else if (key == "length") {
+        record.numbers[0] = reader_.readNumber();
+      } else if (key == "width") {
+        record.numbers[1] = reader_.readNumber();
+      } else if (key == "yaw") {
+        record.numbers[2] = reader_.readNumber();
+      } else if (key == "side_offset") {
+        record.numbers[3] = reader_.readNumber();
+      } else if (key == "offset") {
+        record.numbers[4] = reader_.readNumber();
+      } else {
+        unknownKey();
+      }
+    }
+    require(record.numbers[0], "length");
+    require(record.numbers[1], "width");
+    emit_(record);
+  }
+
+  JsonReader reader_;  ///< Reader of the document
+  Emit& emit_;         ///< Callback receiving the records
+};
+
+/** Parse the binary format, emitting each record as soon as it is read */
+template <class Emit>
+void parseBinary(std::istream& is, Emit& emit) {
+  std::size_t offset = 0;
+  const auto error = [&offset](const std::string_view message) {
+    SYMAWARE_RUNTIME_ERROR_FMT("Malformed road description at byte {}: {}", offset, message);
+  };
+  std::array<unsigned char, 8 * 9> buffer;
+  const auto read = [&](const std::size_t size) {
+    if (!is.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size)))
+      error("unexpected end of the description");
+    offset += size;
+  };
+  const auto decode = [&buffer](const std::size_t pos, const std::size_t size) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) value |= static_cast<std::uint64_t>(buffer[pos + i]) << (8 * i);
+    return value;
+  };
+
+  read(sizeof(magic) + sizeof(version));
+  if (std::memcmp(buffer.data(), magic, sizeof(magic)) != 0) error("missing magic");
+  if (decode(sizeof(magic), sizeof(version)) != version)
+    error(fmt::format("unsupported version {}", decode(sizeof(magic), sizeof(version))));
+
+  Record record{};
+  for (int tag = is.get(); tag != EOF; tag = is.get()) {
+    record.tag = static_cast<Tag>(tag);
+    const auto [num_enums, num_numbers] = layout(record.tag);
+    if (num_enums < 0) error(fmt::format("unknown record tag {:#04x}", tag));
+    ++offset;
+    read(static_cast<std::size_t>(num_enums) + 8 * static_cast<std::size_t>(num_numbers));
+    for (int i = 0; i < num_enums; ++i) record.enums[i] = buffer[i];
+    for (int i = 0; i < num_numbers; ++i) {
+      const std::uint64_t bits = decode(num_enums + 8 * i, 8);
+      std::memcpy(&record.numbers[i], &bits, sizeof(double));
+    }
+    emit(record);
+  }
+}
+
+void writeBinary(std::ostream& os, const Record& record) {
+  const auto [num_enums, num_numbers] = layout(record.tag);
+  if (num_enums < 0) SYMAWARE_INVALID_ARGUMENT("record.tag", static_cast<int>(record.tag));
+  // Bound the loops by the size of the record as well, so the writes provably stay within the buffer
+  const std::size_t enums = std::min(static_cast<std::size_t>(num_enums), record.enums.size());
+  const std::size_t numbers = std::min(static_cast<std::size_t>(num_numbers), record.numbers.size());
+  std::array<char, 1 + 2 + 8 * 9> buffer;
+  std::size_t size = 0;
+  buffer[size++] = static_cast<char>(record.tag);
+  for (std::size_t i = 0; i < enums; ++i) buffer[size++] = static_cast<char>(record.enums[i]);
+  for (std::size_t i = 0; i < numbers; ++i) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &record.numbers[i], sizeof(double));
+    for (int byte = 0; byte < 8; ++byte) buffer[size++] = static_cast<char>((bits >> (8 * byte)) & 0xFF);
+  }
+  os.write(buffer.data(), static_cast<std::streamsize>(size));
+}
+
+template <class T>
+T enumeration(const std::uint8_t value, const std::initializer_list<T> options) {
+  if (value >= options.size()) SYMAWARE_RUNTIME_ERROR_FMT("Invalid enumeration value {} in road description", value);
+  return options.begin()[value];
+}
+
+/** Apply the records to the roads of the experiment */
+class Applier {
+ public:
+  Applier(prescan::api::experiment::Experiment& experiment, std::vector<Road>& roads)
+      : experiment_{experiment}, roads_{roads}, report_{0, 0, 0, 0, 0, 0} {}
+
+  void operator()(const Record& record) {
+    if (record.tag == Tag::ROAD) {
+      roads_.emplace_back(experiment_);
+      ++report_.roads;
+      return;
+    }
+    if (report_.roads == 0) SYMAWARE_RUNTIME_ERROR("Road description has an element before the first road");
+    Road& road = roads_.back();
+    const std::array<double, 9>& n = record.numbers;
+    switch (record.tag) {
+      case Tag::POSITION:
+        road.setPosition(Position{n[0], n[1], n[2]});
+        break;
+      case Tag::TRAFFIC_SIDE:
+        road.setTrafficSide(enumeration(record.enums[0], {TrafficSide::TrafficSideTypeLeftHandTraffic,
+                                                          TrafficSide::TrafficSideTypeRightHandTraffic}));
+        break;
+      case Tag::STRAIGHT:
+        road.addStraightSection(n[0]);
+        ++report_.sections;
+        break;
+      case Tag::ARC:
+        road.addCurveSection(n[0], n[1]);
+        ++report_.sections;
+        break;
+      case Tag::SPIRAL:
+        road.addSpiralSection(n[0], n[1], n[2]);
+        ++report_.sections;
+        break;
+      case Tag::POLY3:
+        road.addCubicPolynomialSection(n[0], n[1], n[2], n[3], n[4]);
+        ++report_.sections;
+        break;
+      case Tag::PARAM_POLY3:
+        road.addParametricCubicPolynomialSection(
+            n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8],
+            enumeration(record.enums[0],
+                        {ParameterRange::ParamPolyRangeTypeArcLength, ParameterRange::ParamPolyRangeTypeNormalized}));
+        ++report_.sections;
+        break;
+      case Tag::LANE:
+        road.addLane(enumeration(record.enums[0], {RoadSideType::RoadSideTypeLeft, RoadSideType::RoadSideTypeRight}),
+                     n[0],
+                     enumeration(record.enums[1],
+                                 {LaneType::LaneTypeDriving, LaneType::LaneTypeBiking, LaneType::LaneTypeSideWalk}),
+                     n[1], n[2]);
+        ++report_.lanes;
+        break;
+      case Tag::SPEED_LIMIT:
+        road.setSpeedLimitProfile(n[0], n[1], n[2]);
+        ++report_.speed_limits;
+        break;
+      case Tag::PARKING_SPACE:
+        road.addParkingSpace(
+            n[0], n[1], n[2],
+            enumeration(record.enums[0], {RoadSideType::RoadSideTypeLeft, RoadSideType::RoadSideTypeRight}), n[3],
+            n[4]);
+        ++report_.parking_spaces;
+        break;
+      default:
+        break;
+    }
+  }
+
+  const RoadBuilder::Report& report() const { return report_; }
+
+ private:
+  prescan::api::experiment::Experiment& experiment_;  ///< Experiment the roads are added to
+  std::vector<Road>& roads_;                          ///< Roads built so far
+  RoadBuilder::Report report_;                        ///< Summary of what has been built
+};
+
+/** Run @p parse with an @ref Applier, timing the whole build */
+template <class F>
+RoadBuilder::Report build(prescan::api::experiment::Experiment& experiment, std::vector<Road>& roads, F&& parse) {
+  const auto start = std::chrono::steady_clock::now();
+  Applier applier{experiment, roads};
+  parse(applier);
+  RoadBuilder::Report report = applier.report();
+  report.build_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return report;
+}
+
+}  // namespace
+
+RoadBuilder::RoadBuilder(Environment& environment)
+    : RoadBuilder{environment.experiment()} {}
+RoadBuilder::RoadBuilder(prescan::api::experiment::Experiment& experiment) : experiment_{experiment}, roads_{} {}
+
+RoadBuilder::Report RoadBuilder::buildJson(std::istream& is) {
+  return build(experiment_, roads_, [&is](Applier& applier) { JsonParser<Applier>{is, applier}.parse(); });
+}
+
+RoadBuilder::Report RoadBuilder::buildJsonFile(const std::string& filename) {
+  std::ifstream file{filename};
+  if (!file) SYMAWARE_RUNTIME_ERROR_FMT("Could not open the road description file {}", filename);
+  return buildJson(file);
+}
+
+RoadBuilder::Report RoadBuilder::buildBinary(std::istream& is) {
+  return build(experiment_, roads_, [&is](Applier& applier) { parseBinary(is, applier); });
+}
+
+RoadBuilder::Report RoadBuilder::buildBinaryFile(const std::string& filename) {
+  std::ifstream file{filename, std::ios::binary};
+  if (!file) SYMAWARE_RUNTIME_ERROR_FMT("Could not open the road description file {}", filename);
+  return buildBinary(file);
+}
+
+void RoadBuilder::jsonToBinary(std::istream& json, std::ostream& binary) {
+  binary.write(magic, sizeof(magic));
+  for (int byte = 0; byte < 4; ++byte) binary.put(static_cast<char>((version >> (8 * byte)) & 0xFF));
+  const auto write = [&binary](const Record& record) { writeBinary(binary, record); };
+  JsonParser<decltype(write)>{json, write}.parse();
+}
+
+std::ostream& operator<<(std::ostream& os, const RoadBuilder::Report& report) {
+  return os << "RoadBuilder::Report: (roads: " << report.roads << ", sections: " << report.sections
+            << ", lanes: " << report.lanes << ", speed_limits: " << report.speed_limits
+            << ", parking_spaces: " << report.parking_spaces << ", build_time: " << report.build_time << ")";
+}
+
+}  // namespace symaware
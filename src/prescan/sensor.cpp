@@ -1,5 +1,7 @@
 #include "symaware/prescan/sensor.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <prescan/api/Air.hpp>
 #include <prescan/api/Brs.hpp>
@@ -13,7 +15,10 @@
 #include <prescan/sim/LmsSensorUnit.hpp>
 #include <prescan/sim/SelfSensorUnit.hpp>
 
+#include "symaware/prescan/transform.h"
+#include "symaware/util/constants.h"
 #include "symaware/util/exception.h"
+#include "symaware/util/trace.h"
 
 #define CREATE_SENSOR(namespace, sensor_type, object)              \
   std::make_unique<prescan::api::namespace ::sensor_type##Sensor>( \
@@ -39,6 +44,7 @@
 namespace symaware {
 
 namespace {
+
 template <class T>
 inline T double_to_enum(const double value) {
   return static_cast<T>(static_cast<int>(value));
@@ -53,7 +59,18 @@ Sensor::Sensor(const SensorType sensor_type, std::vector<double> setup, const bo
       sensor_type_{sensor_type},
       setup_{std::move(setup)},
       image_{nullptr, 0, 0, prescan::api::camera::ImageFormat::CameraSensorImageFormatBGRU8},
-      sensor_unit_{nullptr} {
+      sensor_unit_{nullptr},
+      profile_{},
+      point_cloud_filter_{},
+      track_table_{},
+      sensor_noise_{},
+      state_corrupted_{false},
+      object_unit_{nullptr},
+      mount_pose_{true},
+      scratch_{},
+      detection_ids_{},
+      fov_horizontal_{std::numeric_limits<double>::quiet_NaN()},
+      resolution_x_{std::numeric_limits<double>::quiet_NaN()} {
   switch (sensor_type_) {
     case SensorType::AIR:
     case SensorType::BRS:
@@ -222,26 +239,47 @@ inline void Sensor::applySetup(prescan::api::types::SensorBase* const sensor) {
 }
 
 void Sensor::createSensor(const prescan::api::types::WorldObject& object, const int id) {
+  initialiseSensor(object, id, existing_);
+}
+void Sensor::reuseSensor(const prescan::api::types::WorldObject& object, const int id) {
+  initialiseSensor(object, id, true);
+}
+void Sensor::detach() {
+  id_ = -1;
+  sensor_unit_ = nullptr;
+  object_unit_ = nullptr;
+  state_.clear();
+}
+
+void Sensor::initialiseSensor(const prescan::api::types::WorldObject& object, const int id, const bool attached) {
   if (id_ != -1) SYMAWARE_RUNTIME_ERROR("Sensor already initialised");
   id_ = id;
   std::unique_ptr<prescan::api::types::SensorBase> sensor;
   switch (sensor_type_) {
     case SensorType::AIR:
-      sensor = INITIALISE_SENSOR(existing_, air, Air, object, id);
+      sensor = INITIALISE_SENSOR(attached, air, Air, object, id);
       break;
     case SensorType::BRS:
-      sensor = INITIALISE_SENSOR(existing_, brs, Brs, object, id);
+      sensor = INITIALISE_SENSOR(attached, brs, Brs, object, id);
       break;
     case SensorType::CAMERA:
-      sensor = INITIALISE_SENSOR(existing_, camera, Camera, object, id);
+      sensor = INITIALISE_SENSOR(attached, camera, Camera, object, id);
       break;
     case SensorType::LMS:
-      sensor = INITIALISE_SENSOR(existing_, lms, Lms, object, id);
+      sensor = INITIALISE_SENSOR(attached, lms, Lms, object, id);
       break;
     default:
       SYMAWARE_RUNTIME_ERROR_FMT("Sensor {} not yet implemented", sensor_type_);
   }
   applySetup(sensor.get());
+  const prescan::api::types::Pose& pose = sensor->pose();
+  mount_pose_ = Pose{pose.position().x(),    pose.position().y(),     pose.position().z(),
+                     pose.orientation().roll(), pose.orientation().pitch(), pose.orientation().yaw()};
+  if (sensor_type_ == SensorType::BRS) {
+    const auto* const brs = static_cast<const prescan::api::brs::BrsSensor*>(sensor.get());
+    fov_horizontal_ = brs->fovHorizontal();
+    resolution_x_ = static_cast<double>(brs->resolutionX());
+  }
 }
 
 void Sensor::registerUnit(const prescan::api::types::WorldObject& object,
@@ -263,16 +301,227 @@ void Sensor::registerUnit(const prescan::api::types::WorldObject& object,
     default:
       break;
   }
+  if (point_cloud_filter_.has_value() || track_table_.has_value())
+    object_unit_ = prescan::sim::registerUnit<prescan::sim::SelfSensorUnit>(simulation, object);
+}
+void Sensor::initialise(prescan::sim::ISimulation* simulation) {
+  state_.clear();
+  state_corrupted_ = false;
+  if (sensor_noise_.has_value()) {
+    sensor_noise_->reset(sensor_noise_->episode());
+    sensor_noise_->beginStep();
+  }
+  if (point_cloud_filter_.has_value()) point_cloud_filter_->clear();
+  if (track_table_.has_value()) track_table_->clear();
+}
+void Sensor::step(prescan::sim::ISimulation* simulation) {
+  state_.clear();
+  state_corrupted_ = false;
+  if (point_cloud_filter_.has_value()) filterPointCloud();
+  if (track_table_.has_value()) trackDetections(simulation->getSampleTime());
+  // The delay buffer of the noise needs the state of every step
+  if (sensor_noise_.has_value()) {
+    sensor_noise_->beginStep();
+    state();
+  }
 }
-void Sensor::initialise(prescan::sim::ISimulation* simulation) { state_.clear(); }
-void Sensor::step(prescan::sim::ISimulation* simulation) { state_.clear(); }
 void Sensor::terminate(prescan::sim::ISimulation* simulation) {
   state_.clear();
+  state_corrupted_ = false;
+  if (sensor_noise_.has_value()) sensor_noise_->reset(sensor_noise_->episode() + 1);
   sensor_unit_ = nullptr;
+  object_unit_ = nullptr;
+}
+
+void Sensor::setPointCloudFilter(const PointCloudFilter::Setup& setup) {
+  if (sensor_type_ != SensorType::LMS)
+    SYMAWARE_RUNTIME_ERROR_FMT("Sensor {} does not produce a point cloud", sensor_type_);
+  point_cloud_filter_.emplace(setup);
+}
+void Sensor::clearPointCloudFilter() {
+  point_cloud_filter_.reset();
+  if (!track_table_.has_value()) object_unit_ = nullptr;
+}
+void Sensor::setTrackTable(const TrackTable::Setup& setup) {
+  if (sensor_type_ != SensorType::AIR) SYMAWARE_RUNTIME_ERROR_FMT("Sensor {} does not track objects", sensor_type_);
+  track_table_.emplace(setup);
+}
+void Sensor::clearTrackTable() {
+  track_table_.reset();
+  if (!point_cloud_filter_.has_value()) object_unit_ = nullptr;
+}
+
+void Sensor::setSensorNoise(const SensorNoise::Setup& setup) {
+  switch (sensor_type_) {
+    case SensorType::AIR:
+      sensor_noise_.emplace(setup, 6);
+      break;
+    case SensorType::BRS:
+      sensor_noise_.emplace(setup, 5);
+      break;
+    case SensorType::LMS:
+      sensor_noise_.emplace(setup, 4);
+      break;
+    default:
+      SYMAWARE_RUNTIME_ERROR_FMT("Sensor {} does not support noise", sensor_type_);
+  }
+  // Set during a simulation, the noise starts from the current step
+  if (sensor_unit_ != nullptr) sensor_noise_->beginStep();
+}
+void Sensor::clearSensorNoise() { sensor_noise_.reset(); }
+void Sensor::setNoiseEpisode(const std::uint64_t episode) {
+  if (sensor_noise_.has_value()) sensor_noise_->reset(episode);
+}
+
+void Sensor::corruptState() {
+  if (sensor_unit_ == nullptr) return;
+  SYMAWARE_TRACE_SCOPE("Sensor::corruptState");
+  state_corrupted_ = true;
+  SensorNoise& noise = sensor_noise_.value();
+  const std::size_t width = noise.width();
+  if (sensor_type_ != SensorType::LMS) {
+    state_.resize(noise.corrupt(state_.data(), state_.size() / width) * width);
+    noise.addFalsePositives(state_);
+  } else {
+    // Each line is corrupted on its own, then moved down over the points dropped before it, closed by its NaN
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    const auto& lines = static_cast<const prescan::sim::LmsSensorUnit*>(sensor_unit_)->linesOutput();
+    std::size_t read = 0, write = 0, first = 0;
+    for (const auto& line : lines) {
+      const std::size_t kept = noise.corrupt(state_.data() + read, line.size(), first);
+      std::copy_n(state_.data() + read, kept * width, state_.data() + write);
+      write += kept * width;
+      state_[write++] = nan;
+      read += line.size() * width + 1;
+      first += line.size();
+    }
+    state_.resize(write);
+    // The false points form a line of their own
+    if (noise.addFalsePositives(state_) > 0) state_.push_back(nan);
+  }
+  noise.delay(state_);
+}
+
+Pose Sensor::worldPose() const {
+  const prescan::sim::SelfSensorData& object = object_unit_->selfSensorOutput();
+  const Pose object_pose{object.PositionX,       object.PositionY,        object.PositionZ,
+                         object.OrientationRoll, object.OrientationPitch, object.OrientationYaw};
+  return compose(object_pose, mount_pose_);
+}
+
+void Sensor::filterPointCloud() {
+  if (sensor_unit_ == nullptr || object_unit_ == nullptr) return;
+  SYMAWARE_TRACE_SCOPE("Sensor::filterPointCloud");
+  ScopedTimer timer{profile_, ProfilePhase::UPDATE_STATE};
+  const auto& lines = static_cast<const prescan::sim::LmsSensorUnit*>(sensor_unit_)->linesOutput();
+  std::size_t size = 0;
+  for (const auto& line : lines) size += line.size();
+  scratch_.resize(size * 3);
+  double* const x = scratch_.data();
+  double* const y = x + size;
+  double* const z = y + size;
+  std::size_t i = 0;
+  for (const auto& line : lines) {
+    for (const auto& point : line) {
+      x[i] = point.X;
+      y[i] = point.Y;
+      z[i] = point.Z;
+      ++i;
+    }
+  }
+  point_cloud_filter_->process(worldPose(), x, y, z, size);
+}
+
+std::size_t Sensor::worldDetections(const Pose& pose) {
+  const auto& detections = static_cast<const prescan::sim::AirSensorUnit*>(sensor_unit_)->airSensorOutput();
+  const std::size_t size = detections.size();
+  // Range, azimuth, elevation and heading of the detections, then their X, Y and Z in the frame of the sensor
+  scratch_.resize(size * 7);
+  double* const range = scratch_.data();
+  double* const azimuth = range + size;
+  double* const elevation = azimuth + size;
+  double* const heading = elevation + size;
+  double* const x = heading + size;
+  double* const y = x + size;
+  double* const z = y + size;
+  detection_ids_.resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    range[i] = detections[i]->Range;
+    azimuth[i] = detections[i]->Azimuth;
+    elevation[i] = detections[i]->Elevation;
+    heading[i] = detections[i]->Heading;
+    detection_ids_[i] = detections[i]->ID;
+  }
+  polarToCartesian(range, azimuth, elevation, size, x, y, z);
+  transformPoints(pose, x, y, z, size, x, y, z);
+  for (std::size_t i = 0; i < size; ++i) heading[i] = std::remainder(heading[i] + pose.orientation.yaw, 2 * pi);
+  return size;
+}
+
+void Sensor::trackDetections(const double sample_time) {
+  if (sensor_unit_ == nullptr || object_unit_ == nullptr) return;
+  SYMAWARE_TRACE_SCOPE("Sensor::trackDetections");
+  ScopedTimer timer{profile_, ProfilePhase::UPDATE_STATE};
+  const std::size_t size = worldDetections(worldPose());
+  const double* const heading = scratch_.data() + size * 3;
+  const double* const x = heading + size;
+  const double* const y = x + size;
+  const double* const z = y + size;
+  track_table_->update(sample_time, detection_ids_.data(), x, y, z, heading, size);
+}
+
+void Sensor::fuseDetections(const Pose& object_pose, SensorFusion& fusion) {
+  if (sensor_unit_ == nullptr) return;
+  if (sensor_type_ != SensorType::AIR && sensor_type_ != SensorType::BRS) return;
+  SYMAWARE_TRACE_SCOPE("Sensor::fuseDetections");
+  ScopedTimer timer{profile_, ProfilePhase::UPDATE_STATE};
+  const Pose pose = compose(object_pose, mount_pose_);
+  if (sensor_type_ == SensorType::AIR) {
+    const std::size_t size = worldDetections(pose);
+    const double* const x = scratch_.data() + size * 4;
+    fusion.updatePositions(detection_ids_.data(), x, x + size, size);
+    return;
+  }
+  const auto& detections = static_cast<const prescan::sim::BrsSensorUnit*>(sensor_unit_)->brsSensorOutput();
+  const std::size_t size = detections.size();
+  scratch_.resize(size);
+  detection_ids_.resize(size);
+  // The horizontal pixel u of a direction (1, t, 0) in the frame of the sensor is (1 - t / tan(fov / 2)) / 2
+  const double tan_half_fov = std::tan(fov_horizontal_ / 2);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double u = (detections[i]->Left + detections[i]->Right) / (2 * resolution_x_);
+    const Position direction = transformPoint(pose, Position{1, (1 - 2 * u) * tan_half_fov, 0});
+    scratch_[i] = std::atan2(direction.y - pose.position.y, direction.x - pose.position.x);
+    detection_ids_[i] = detections[i]->ObjectID;
+  }
+  fusion.updateBearings(pose.position, detection_ids_.data(), scratch_.data(), size);
+}
+
+std::size_t Sensor::detectionCount() const {
+  if (sensor_unit_ == nullptr) return 0;
+  switch (sensor_type_) {
+    case SensorType::AIR:
+      return static_cast<const prescan::sim::AirSensorUnit*>(sensor_unit_)->airSensorOutput().size();
+    case SensorType::BRS:
+      return static_cast<const prescan::sim::BrsSensorUnit*>(sensor_unit_)->brsSensorOutput().size();
+    case SensorType::LMS: {
+      std::size_t points = 0;
+      for (const auto& line : static_cast<const prescan::sim::LmsSensorUnit*>(sensor_unit_)->linesOutput())
+        points += line.size();
+      return points;
+    }
+    default:
+      return 0;
+  }
 }
 
 const std::vector<double>& Sensor::state() {
-  if (state_.empty()) updateState<prescan::sim::Unit>();
+  if (state_.empty() && !state_corrupted_) {
+    SYMAWARE_TRACE_SCOPE("Sensor::updateState");
+    ScopedTimer timer{profile_, ProfilePhase::UPDATE_STATE};
+    updateState<prescan::sim::Unit>();
+    if (sensor_noise_.has_value()) corruptState();
+  }
   return state_;
 }
 
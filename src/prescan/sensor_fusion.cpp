@@ -0,0 +1,286 @@
+#include "symaware/prescan/sensor_fusion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+#include "symaware/util/constants.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+SensorFusion::Setup::Setup(const double position_noise, const double bearing_noise, const double acceleration_noise,
+                           const double initial_velocity_noise, const double position_gate, const double bearing_gate,
+                           const std::size_t max_age)
+    : position_noise{position_noise},
+      bearing_noise{bearing_noise},
+      acceleration_noise{acceleration_noise},
+      initial_velocity_noise{initial_velocity_noise},
+      position_gate{position_gate},
+      bearing_gate{bearing_gate},
+      max_age{max_age} {}
+
+SensorFusion::SensorFusion(Setup setup)
+    : setup_{setup},
+      step_{-1},
+      tracks_{},
+      rows_{},
+      candidates_{},
+      associations_{},
+      assigned_{},
+      associated_{},
+      expected_{} {
+  if (!(setup_.position_noise > 0)) SYMAWARE_INVALID_ARGUMENT("position_noise", setup_.position_noise);
+  if (!(setup_.bearing_noise > 0)) SYMAWARE_INVALID_ARGUMENT("bearing_noise", setup_.bearing_noise);
+  if (!(setup_.acceleration_noise > 0)) SYMAWARE_INVALID_ARGUMENT("acceleration_noise", setup_.acceleration_noise);
+  if (!(setup_.initial_velocity_noise > 0))
+    SYMAWARE_INVALID_ARGUMENT("initial_velocity_noise", setup_.initial_velocity_noise);
+  if (!(setup_.position_gate >= 0)) SYMAWARE_INVALID_ARGUMENT("position_gate", setup_.position_gate);
+  if (!(setup_.bearing_gate >= 0)) SYMAWARE_INVALID_ARGUMENT("bearing_gate", setup_.bearing_gate);
+}
+
+void SensorFusion::predict(const double sample_time) {
+  ++step_;
+  const auto max_age = static_cast<std::int64_t>(setup_.max_age);
+  for (std::size_t row = 0; row < tracks_.size();) {
+    if (step_ - tracks_[row].last_seen <= max_age) {
+      ++row;
+      continue;
+    }
+    if (tracks_[row].id >= 0) rows_.erase(tracks_[row].id);
+    if (row != tracks_.size() - 1) {
+      tracks_[row] = tracks_.back();
+      if (tracks_[row].id >= 0) rows_[tracks_[row].id] = row;
+    }
+    tracks_.pop_back();
+  }
+
+  // Constant velocity model, driven by a white acceleration
+  const double dt = sample_time;
+  const double q = setup_.acceleration_noise * setup_.acceleration_noise;
+  const double q_pp = q * dt * dt * dt * dt / 4;
+  const double q_pv = q * dt * dt * dt / 2;
+  const double q_vv = q * dt * dt;
+  for (Track& track : tracks_) {
+    track.sources = 0;
+    std::array<double, 4>& s = track.state;
+    s[0] += dt * s[2];
+    s[1] += dt * s[3];
+    // P = F P F^T + Q, where F adds dt times the velocity rows (columns) to the position ones
+    std::array<double, 16>& p = track.covariance;
+    for (std::size_t c = 0; c < 4; ++c) {
+      p[0 * 4 + c] += dt * p[2 * 4 + c];
+      p[1 * 4 + c] += dt * p[3 * 4 + c];
+    }
+    for (std::size_t r = 0; r < 4; ++r) {
+      p[r * 4 + 0] += dt * p[r * 4 + 2];
+      p[r * 4 + 1] += dt * p[r * 4 + 3];
+    }
+    p[0 * 4 + 0] += q_pp;
+    p[1 * 4 + 1] += q_pp;
+    p[0 * 4 + 2] += q_pv;
+    p[2 * 4 + 0] += q_pv;
+    p[1 * 4 + 3] += q_pv;
+    p[3 * 4 + 1] += q_pv;
+    p[2 * 4 + 2] += q_vv;
+    p[3 * 4 + 3] += q_vv;
+  }
+}
+
+void SensorFusion::updatePositions(const std::int32_t* const ids, const double* const x, const double* const y,
+                                   const std::size_t size) {
+  assigned_.assign(tracks_.size(), false);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (ids[i] < 0) continue;
+    const std::ptrdiff_t row = find(ids[i]);
+    if (row < 0) {
+      addTrack(ids[i], x[i], y[i]);
+      continue;
+    }
+    updatePosition(static_cast<std::size_t>(row), x[i], y[i]);
+    if (static_cast<std::size_t>(row) < assigned_.size()) assigned_[row] = true;
+  }
+  const std::vector<std::size_t>& rows =
+      associate(ids, size, setup_.position_gate,
+                [this, x, y](const std::size_t i, const std::size_t row) { return positionDistance(row, x[i], y[i]); });
+  const std::size_t tracked = assigned_.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    if (ids[i] >= 0) continue;
+    if (rows[i] < tracked) updatePosition(rows[i], x[i], y[i]);
+    else addTrack(-1, x[i], y[i]);
+  }
+}
+
+void SensorFusion::updateBearings(const Position& origin, const std::int32_t* const ids, const double* const bearing,
+                                  const std::size_t size) {
+  const double ox = origin.x;
+  const double oy = origin.y;
+  assigned_.assign(tracks_.size(), false);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (ids[i] < 0) continue;
+    const std::ptrdiff_t row = find(ids[i]);
+    if (row < 0) continue;
+    updateBearing(static_cast<std::size_t>(row), ox, oy, bearing[i]);
+    assigned_[row] = true;
+  }
+  expectBearings(ox, oy);
+  const std::vector<std::size_t>& rows =
+      associate(ids, size, setup_.bearing_gate, [this, bearing](const std::size_t i, const std::size_t row) {
+        double innovation = bearing[i] - expected_[row * 2];
+        if (std::abs(innovation) > pi) innovation = std::remainder(innovation, 2 * pi);
+        return innovation * innovation / expected_[row * 2 + 1];
+      });
+  for (std::size_t i = 0; i < size; ++i) {
+    if (ids[i] < 0 && rows[i] < tracks_.size()) updateBearing(rows[i], ox, oy, bearing[i]);
+  }
+}
+
+template <class Distance>
+const std::vector<std::size_t>& SensorFusion::associate(const std::int32_t* const ids, const std::size_t size,
+                                                        const double gate, Distance distance) {
+  const std::size_t tracked = assigned_.size();
+  associations_.assign(size, tracks_.size());
+  candidates_.clear();
+  for (std::size_t i = 0; i < size; ++i) {
+    if (ids[i] >= 0) continue;
+    for (std::size_t row = 0; row < tracked; ++row) {
+      if (assigned_[row]) continue;
+      const double d = distance(i, row);
+      if (d <= gate) candidates_.emplace_back(d, i, row);
+    }
+  }
+  // Global nearest neighbour, taking the closest pairs first
+  std::sort(candidates_.begin(), candidates_.end());
+  associated_.assign(size, false);
+  for (const auto& [d, i, row] : candidates_) {
+    if (associated_[i] || assigned_[row]) continue;
+    associated_[i] = true;
+    assigned_[row] = true;
+    associations_[i] = row;
+  }
+  return associations_;
+}
+
+void SensorFusion::addTrack(const std::int32_t id, const double x, const double y) {
+  const double p = setup_.position_noise * setup_.position_noise;
+  const double v = setup_.initial_velocity_noise * setup_.initial_velocity_noise;
+  Track& track = tracks_.emplace_back();
+  track.id = id;
+  track.last_seen = step_;
+  track.sources = POSITION;
+  track.state = {x, y, 0, 0};
+  track.covariance = {p, 0, 0, 0, 0, p, 0, 0, 0, 0, v, 0, 0, 0, 0, v};
+  if (id >= 0) rows_[id] = tracks_.size() - 1;
+}
+
+void SensorFusion::updatePosition(const std::size_t row, const double x, const double y) {
+  Track& track = tracks_[row];
+  std::array<double, 4>& s = track.state;
+  std::array<double, 16>& p = track.covariance;
+  const double r = setup_.position_noise * setup_.position_noise;
+  // S = H P H^T + R, with H selecting the position
+  const double s00 = p[0] + r;
+  const double s01 = p[1];
+  const double s11 = p[5] + r;
+  const double det = s00 * s11 - s01 * s01;
+  const double i00 = s11 / det;
+  const double i01 = -s01 / det;
+  const double i11 = s00 / det;
+  // K = P H^T S^-1
+  std::array<double, 8> k;
+  for (std::size_t j = 0; j < 4; ++j) {
+    k[j * 2 + 0] = p[j * 4 + 0] * i00 + p[j * 4 + 1] * i01;
+    k[j * 2 + 1] = p[j * 4 + 0] * i01 + p[j * 4 + 1] * i11;
+  }
+  const double ex = x - s[0];
+  const double ey = y - s[1];
+  for (std::size_t j = 0; j < 4; ++j) s[j] += k[j * 2 + 0] * ex + k[j * 2 + 1] * ey;
+  // P = P - K H P, where H P are the position rows of P
+  const std::array<double, 8> hp{p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]};
+  for (std::size_t j = 0; j < 4; ++j) {
+    for (std::size_t c = 0; c < 4; ++c) p[j * 4 + c] -= k[j * 2 + 0] * hp[c] + k[j * 2 + 1] * hp[4 + c];
+  }
+  track.last_seen = step_;
+  track.sources |= POSITION;
+}
+
+void SensorFusion::updateBearing(const std::size_t row, const double ox, const double oy, const double bearing) {
+  Track& track = tracks_[row];
+  std::array<double, 4>& s = track.state;
+  std::array<double, 16>& p = track.covariance;
+  const double dx = s[0] - ox;
+  const double dy = s[1] - oy;
+  const double r2 = dx * dx + dy * dy;
+  // The bearing of a track on top of the sensor is undefined
+  if (!(r2 > 0)) return;
+  // H = [-dy / r2, dx / r2, 0, 0] linearises the bearing around the predicted position
+  const double h0 = -dy / r2;
+  const double h1 = dx / r2;
+  std::array<double, 4> ph;
+  for (std::size_t j = 0; j < 4; ++j) ph[j] = p[j * 4 + 0] * h0 + p[j * 4 + 1] * h1;
+  const double innovation_covariance = h0 * ph[0] + h1 * ph[1] + setup_.bearing_noise * setup_.bearing_noise;
+  const double innovation = std::remainder(bearing - std::atan2(dy, dx), 2 * pi);
+  for (std::size_t j = 0; j < 4; ++j) s[j] += ph[j] / innovation_covariance * innovation;
+  // P = P - P H^T H P / S, P being symmetric
+  for (std::size_t j = 0; j < 4; ++j) {
+    for (std::size_t c = 0; c < 4; ++c) p[j * 4 + c] -= ph[j] * ph[c] / innovation_covariance;
+  }
+  track.last_seen = step_;
+  track.sources |= BEARING;
+}
+
+double SensorFusion::positionDistance(const std::size_t row, const double x, const double y) const {
+  const Track& track = tracks_[row];
+  const std::array<double, 16>& p = track.covariance;
+  const double r = setup_.position_noise * setup_.position_noise;
+  const double s00 = p[0] + r;
+  const double s01 = p[1];
+  const double s11 = p[5] + r;
+  const double ex = x - track.state[0];
+  const double ey = y - track.state[1];
+  return (s11 * ex * ex - 2 * s01 * ex * ey + s00 * ey * ey) / (s00 * s11 - s01 * s01);
+}
+
+void SensorFusion::expectBearings(const double ox, const double oy) {
+  expected_.resize(tracks_.size() * 2);
+  const double r = setup_.bearing_noise * setup_.bearing_noise;
+  for (std::size_t row = 0; row < tracks_.size(); ++row) {
+    const Track& track = tracks_[row];
+    const std::array<double, 16>& p = track.covariance;
+    const double dx = track.state[0] - ox;
+    const double dy = track.state[1] - oy;
+    const double r2 = dx * dx + dy * dy;
+    const double h0 = -dy / r2;
+    const double h1 = dx / r2;
+    // A track on top of the sensor gets a NaN bearing, which is never within the gate
+    expected_[row * 2] = r2 > 0 ? std::atan2(dy, dx) : std::numeric_limits<double>::quiet_NaN();
+    expected_[row * 2 + 1] = h0 * h0 * p[0] + 2 * h0 * h1 * p[1] + h1 * h1 * p[5] + r;
+  }
+}
+
+void SensorFusion::clear() {
+  step_ = -1;
+  tracks_.clear();
+  rows_.clear();
+}
+
+std::ptrdiff_t SensorFusion::find(const std::int32_t id) const {
+  const auto it = rows_.find(id);
+  return it == rows_.end() ? -1 : static_cast<std::ptrdiff_t>(it->second);
+}
+
+std::ostream& operator<<(std::ostream& os, const SensorFusion::Setup& setup) {
+  return os << "SensorFusion::Setup: (position_noise: " << setup.position_noise
+            << ", bearing_noise: " << setup.bearing_noise << ", acceleration_noise: " << setup.acceleration_noise
+            << ", initial_velocity_noise: " << setup.initial_velocity_noise
+            << ", position_gate: " << setup.position_gate << ", bearing_gate: " << setup.bearing_gate
+            << ", max_age: " << setup.max_age << ")";
+}
+std::ostream& operator<<(std::ostream& os, const SensorFusion::Track& track) {
+  return os << "SensorFusion::Track: (id: " << track.id << ", last_seen: " << track.last_seen
+            << ", sources: " << track.sources << ", x: " << track.state[0] << ", y: " << track.state[1]
+            << ", vx: " << track.state[2] << ", vy: " << track.state[3] << ")";
+}
+
+}  // namespace symaware
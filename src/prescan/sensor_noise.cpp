@@ -0,0 +1,218 @@
+#include "symaware/prescan/sensor_noise.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <utility>
+
+#include "symaware/util/constants.h"
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+constexpr std::uint64_t golden_gamma = 0x9E3779B97F4A7C15ULL;
+
+/** Random numbers used by each stage, so that enabling a stage does not change the numbers of the others */
+enum Stream : std::uint64_t {
+  NOISE = 0,
+  DROPOUT = 1,
+  FALSE_POSITIVE_COUNT = 2,
+  FALSE_POSITIVE_VALUES = 3,
+  LATENCY = 4,
+};
+
+/** SplitMix64 finaliser, mixing all the bits of @p z */
+inline std::uint64_t mix(std::uint64_t z) {
+  z += golden_gamma;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+/** @return the @p counter -th number of the stream with the given @p key, uniform in (0, 1) */
+inline double uniform(const std::uint64_t key, const std::uint64_t counter) {
+  return (static_cast<double>(mix(key + counter * golden_gamma) >> 11) + 0.5) * 0x1.0p-53;
+}
+
+void checkColumns(const char* const name, const std::vector<double>& values, const std::size_t width) {
+  if (!values.empty() && values.size() != width) SYMAWARE_INVALID_ARGUMENT_EXPECTED(name, values.size(), width);
+  for (const double value : values) {
+    if (!(value >= 0)) SYMAWARE_INVALID_ARGUMENT(name, value);
+  }
+}
+
+std::ostream& printColumns(std::ostream& os, const std::vector<double>& values) {
+  os << "[";
+  for (std::size_t i = 0; i < values.size(); ++i) os << (i == 0 ? "" : ", ") << values[i];
+  return os << "]";
+}
+
+}  // namespace
+
+SensorNoise::Setup::Setup(std::vector<double> noise, const Distribution distribution,
+                          std::vector<double> quantisation, const double dropout, const double false_positives,
+                          std::vector<double> false_positive_low, std::vector<double> false_positive_high,
+                          const std::size_t latency, const std::size_t latency_jitter, const std::uint64_t seed)
+    : noise{std::move(noise)},
+      distribution{distribution},
+      quantisation{std::move(quantisation)},
+      dropout{dropout},
+      false_positives{false_positives},
+      false_positive_low{std::move(false_positive_low)},
+      false_positive_high{std::move(false_positive_high)},
+      latency{latency},
+      latency_jitter{latency_jitter},
+      seed{seed} {}
+
+SensorNoise::SensorNoise(Setup setup, const std::size_t width)
+    : setup_{std::move(setup)},
+      width_{width},
+      episode_{0},
+      step_{-1},
+      samples_{},
+      buffer_(setup_.latency + setup_.latency_jitter + 1) {
+  checkColumns("noise", setup_.noise, width_);
+  checkColumns("quantisation", setup_.quantisation, width_);
+  if (!(setup_.dropout >= 0 && setup_.dropout <= 1)) SYMAWARE_INVALID_ARGUMENT("dropout", setup_.dropout);
+  if (!(setup_.false_positives >= 0)) SYMAWARE_INVALID_ARGUMENT("false_positives", setup_.false_positives);
+  if (setup_.false_positives > 0) {
+    if (setup_.false_positive_low.size() != width_)
+      SYMAWARE_INVALID_ARGUMENT_EXPECTED("false_positive_low", setup_.false_positive_low.size(), width_);
+    if (setup_.false_positive_high.size() != width_)
+      SYMAWARE_INVALID_ARGUMENT_EXPECTED("false_positive_high", setup_.false_positive_high.size(), width_);
+  }
+}
+
+void SensorNoise::reset(const std::uint64_t episode) {
+  episode_ = episode;
+  step_ = -1;
+  for (std::vector<double>& rows : buffer_) rows.clear();
+}
+
+void SensorNoise::beginStep() { ++step_; }
+
+std::uint64_t SensorNoise::key(const std::uint64_t stream) const {
+  std::uint64_t key = mix(setup_.seed);
+  key = mix(key ^ episode_);
+  key = mix(key ^ static_cast<std::uint64_t>(step_));
+  return mix(key ^ stream);
+}
+
+std::size_t SensorNoise::corrupt(double* const rows, const std::size_t size, const std::size_t first) {
+  const std::size_t values = size * width_;
+  if (!setup_.noise.empty()) {
+    // The numbers only depend on their counter, so each loop is a batch of independent hashes
+    const std::uint64_t noise_key = key(NOISE);
+    const std::uint64_t offset = first * width_;
+    samples_.resize(values);
+    if (setup_.distribution == Distribution::GAUSSIAN) {
+      // Box-Muller transform, whose pair of outputs goes to the values 2k and 2k + 1 of the step
+      const auto pair = [noise_key](const std::uint64_t k, double& radius, double& angle) {
+        radius = std::sqrt(-2 * std::log(uniform(noise_key, 2 * k)));
+        angle = 2 * pi * uniform(noise_key, 2 * k + 1);
+      };
+      double radius, angle;
+      std::size_t i = 0;
+      if (values > 0 && offset % 2 == 1) {
+        pair(offset / 2, radius, angle);
+        samples_[i++] = radius * std::sin(angle);
+      }
+      for (; i + 1 < values; i += 2) {
+        pair((offset + i) / 2, radius, angle);
+        samples_[i] = radius * std::cos(angle);
+        samples_[i + 1] = radius * std::sin(angle);
+      }
+      if (i < values) {
+        pair((offset + i) / 2, radius, angle);
+        samples_[i] = radius * std::cos(angle);
+      }
+    } else {
+      for (std::size_t i = 0; i < values; ++i) {
+        const double u = uniform(noise_key, offset + i);
+        samples_[i] = u < 0.5 ? std::log(2 * u) : -std::log(2 - 2 * u);
+      }
+    }
+    for (std::size_t r = 0; r < size; ++r) {
+      for (std::size_t j = 0; j < width_; ++j) rows[r * width_ + j] += setup_.noise[j] * samples_[r * width_ + j];
+    }
+  }
+  for (std::size_t j = 0; j < setup_.quantisation.size(); ++j) {
+    const double step = setup_.quantisation[j];
+    if (step == 0) continue;
+    for (std::size_t r = 0; r < size; ++r) rows[r * width_ + j] = step * std::nearbyint(rows[r * width_ + j] / step);
+  }
+  if (setup_.dropout == 0) return size;
+
+  const std::uint64_t dropout_key = key(DROPOUT);
+  std::size_t kept = 0;
+  for (std::size_t r = 0; r < size; ++r) {
+    if (uniform(dropout_key, first + r) < setup_.dropout) continue;
+    if (kept != r) std::copy_n(rows + r * width_, width_, rows + kept * width_);
+    ++kept;
+  }
+  return kept;
+}
+
+std::size_t SensorNoise::addFalsePositives(std::vector<double>& rows) {
+  if (setup_.false_positives == 0) return 0;
+  // Poisson number of false detections, by inversion of the cumulative distribution
+  const double rate = setup_.false_positives;
+  const double u = uniform(key(FALSE_POSITIVE_COUNT), 0);
+  const double max_count = rate + 10 * std::sqrt(rate) + 10;
+  double probability = std::exp(-rate);
+  double cumulative = probability;
+  std::size_t count = 0;
+  while (u > cumulative && count < max_count) {
+    ++count;
+    probability *= rate / static_cast<double>(count);
+    cumulative += probability;
+  }
+
+  const std::uint64_t values_key = key(FALSE_POSITIVE_VALUES);
+  const std::size_t start = rows.size();
+  rows.resize(start + count * width_);
+  for (std::size_t i = 0; i < count * width_; ++i) {
+    const std::size_t j = i % width_;
+    const double low = setup_.false_positive_low[j];
+    rows[start + i] = low + (setup_.false_positive_high[j] - low) * uniform(values_key, i);
+  }
+  return count;
+}
+
+void SensorNoise::delay(std::vector<double>& rows) {
+  const std::size_t size = buffer_.size();
+  if (size == 1) return;
+  if (step_ < 0) SYMAWARE_RUNTIME_ERROR("SensorNoise::beginStep must be called before delaying the rows");
+  const auto step = static_cast<std::size_t>(step_);
+  std::size_t latency = setup_.latency;
+  if (setup_.latency_jitter > 0)
+    latency += static_cast<std::size_t>(uniform(key(LATENCY), 0) * static_cast<double>(setup_.latency_jitter + 1));
+  // The rows of the step take the place of the oldest ones, whose memory is reused for the output
+  buffer_[step % size].swap(rows);
+  if (step < latency) rows.clear();
+  else rows = buffer_[(step - latency) % size];
+}
+
+std::ostream& operator<<(std::ostream& os, const SensorNoise::Distribution distribution) {
+  switch (distribution) {
+    case SensorNoise::Distribution::GAUSSIAN:
+      return os << "GAUSSIAN";
+    case SensorNoise::Distribution::LAPLACE:
+      return os << "LAPLACE";
+    default:
+      return os << "Unknown";
+  }
+}
+std::ostream& operator<<(std::ostream& os, const SensorNoise::Setup& setup) {
+  os << "SensorNoise::Setup: (noise: ";
+  printColumns(os, setup.noise) << ", distribution: " << setup.distribution << ", quantisation: ";
+  printColumns(os, setup.quantisation) << ", dropout: " << setup.dropout
+                                       << ", false_positives: " << setup.false_positives << ", false_positive_low: ";
+  printColumns(os, setup.false_positive_low) << ", false_positive_high: ";
+  printColumns(os, setup.false_positive_high) << ", latency: " << setup.latency
+                                              << ", latency_jitter: " << setup.latency_jitter
+                                              << ", seed: " << setup.seed << ")";
+  return os;
+}
+
+}  // namespace symaware
@@ -3,8 +3,10 @@
 #include <prescan/sim/ManualSimulation.hpp>
 #include <prescan/sim/Simulation.hpp>
 
+#include "symaware/prescan/entity.h"
 #include "symaware/prescan/experiment_guard.h"
 #include "symaware/util/exception.h"
+#include "symaware/util/trace.h"
 
 namespace symaware {
 
@@ -21,6 +23,7 @@ void Simulation::run(double seconds) {
 }
 
 void Simulation::initialise() {
+  SYMAWARE_TRACE_SCOPE("Simulation::initialise");
   if (is_initialised_) SYMAWARE_RUNTIME_ERROR("Simulation is already initialised.");
   ExperimentGuard guard{const_cast<prescan::api::experiment::Experiment&>(environment_.experiment())};
   simulation_.setSimulationPath(guard.dirpath());
@@ -29,11 +32,13 @@ void Simulation::initialise() {
 }
 
 void Simulation::step() {
+  SYMAWARE_TRACE_SCOPE("Simulation::step");
   SYMAWARE_ASSERT(is_initialised_, "Simulation must be initialised before stepping");
   simulation_.step();
 }
 
 void Simulation::terminate() {
+  SYMAWARE_TRACE_SCOPE("Simulation::terminate");
   if (!is_initialised_) SYMAWARE_RUNTIME_ERROR("Simulation was never initialised.");
   simulation_.terminate();
   is_initialised_ = false;
@@ -43,4 +48,28 @@ void Simulation::setLogLevel(const prescan::sim::ISimulationLogger::LogLevel log
   simulation_.setLogLevel(log_level);
 }
 
+std::vector<ProfileStats> Simulation::stats() const {
+  std::vector<ProfileStats> stats;
+  appendProfileStats(stats, "", "simulation", model_.profile());
+  for (const auto& [name, entity] : environment_.entities()) {
+    appendProfileStats(stats, name, "entity", entity->profile());
+    if (entity->model() != nullptr) appendProfileStats(stats, name, "model", entity->model()->profile());
+    for (const Sensor* const sensor : entity->sensors())
+      appendProfileStats(stats, name, fmt::format("{}_{}", sensor->sensor_type(), sensor->id()), sensor->profile());
+  }
+  for (std::size_t i = 0; i < environment_.models().size(); i++)
+    appendProfileStats(stats, "", fmt::format("model_{}", i), environment_.models()[i]->profile());
+  return stats;
+}
+
+void Simulation::resetStats() {
+  model_.profile().reset();
+  for (const auto& [name, entity] : environment_.entities()) {
+    entity->profile().reset();
+    if (entity->model() != nullptr) entity->model()->profile().reset();
+    for (Sensor* const sensor : entity->sensors()) sensor->profile().reset();
+  }
+  for (EntityModel* const model : environment_.models()) model->profile().reset();
+}
+
 }  // namespace symaware
@@ -0,0 +1,113 @@
+#include "symaware/prescan/track_table.h"
+
+#include <limits>
+#include <ostream>
+
+namespace symaware {
+
+TrackTable::Setup::Setup(const std::size_t max_age) : max_age{max_age} {}
+
+TrackTable::TrackTable(Setup setup)
+    : setup_{setup},
+      step_{-1},
+      rows_{},
+      ids_{},
+      last_seen_{},
+      x_{},
+      y_{},
+      z_{},
+      vx_{},
+      vy_{},
+      vz_{},
+      heading_{} {}
+
+void TrackTable::update(const double sample_time, const std::int32_t* const ids, const double* const x,
+                        const double* const y, const double* const z, const double* const heading,
+                        const std::size_t size) {
+  ++step_;
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto [it, inserted] = rows_.try_emplace(ids[i], ids_.size());
+    const std::size_t row = it->second;
+    if (inserted) {
+      constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+      ids_.push_back(ids[i]);
+      last_seen_.push_back(step_);
+      x_.push_back(x[i]);
+      y_.push_back(y[i]);
+      z_.push_back(z[i]);
+      vx_.push_back(nan);
+      vy_.push_back(nan);
+      vz_.push_back(nan);
+      heading_.push_back(heading[i]);
+      continue;
+    }
+    // An object detected twice in the same step only keeps its last position
+    if (last_seen_[row] != step_) {
+      const double dt = static_cast<double>(step_ - last_seen_[row]) * sample_time;
+      vx_[row] = (x[i] - x_[row]) / dt;
+      vy_[row] = (y[i] - y_[row]) / dt;
+      vz_[row] = (z[i] - z_[row]) / dt;
+    }
+    last_seen_[row] = step_;
+    x_[row] = x[i];
+    y_[row] = y[i];
+    z_[row] = z[i];
+    heading_[row] = heading[i];
+  }
+  const auto max_age = static_cast<std::int64_t>(setup_.max_age);
+  for (std::size_t row = 0; row < ids_.size();) {
+    if (step_ - last_seen_[row] > max_age) remove(row);
+    else ++row;
+  }
+}
+
+void TrackTable::remove(const std::size_t row) {
+  const std::size_t last = ids_.size() - 1;
+  rows_.erase(ids_[row]);
+  if (row != last) {
+    rows_[ids_[last]] = row;
+    ids_[row] = ids_[last];
+    last_seen_[row] = last_seen_[last];
+    x_[row] = x_[last];
+    y_[row] = y_[last];
+    z_[row] = z_[last];
+    vx_[row] = vx_[last];
+    vy_[row] = vy_[last];
+    vz_[row] = vz_[last];
+    heading_[row] = heading_[last];
+  }
+  ids_.pop_back();
+  last_seen_.pop_back();
+  x_.pop_back();
+  y_.pop_back();
+  z_.pop_back();
+  vx_.pop_back();
+  vy_.pop_back();
+  vz_.pop_back();
+  heading_.pop_back();
+}
+
+void TrackTable::clear() {
+  step_ = -1;
+  rows_.clear();
+  ids_.clear();
+  last_seen_.clear();
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  vx_.clear();
+  vy_.clear();
+  vz_.clear();
+  heading_.clear();
+}
+
+std::ptrdiff_t TrackTable::find(const std::int32_t id) const {
+  const auto it = rows_.find(id);
+  return it == rows_.end() ? -1 : static_cast<std::ptrdiff_t>(it->second);
+}
+
+std::ostream& operator<<(std::ostream& os, const TrackTable::Setup& setup) {
+  return os << "TrackTable::Setup: (max_age: " << setup.max_age << ")";
+}
+
+}  // namespace symaware
@@ -0,0 +1,199 @@
+#include "symaware/prescan/transform.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Number of points copied to separate arrays of coordinates at a time by the strided transforms */
+constexpr std::size_t block_size = 256;
+
+/** Rotation followed by a translation */
+struct Affine {
+  RotationMatrix r;
+  std::array<double, 3> t;
+};
+
+Affine affineOf(const Pose& pose) {
+  return Affine{rotationMatrix(pose.orientation), {pose.position.x, pose.position.y, pose.position.z}};
+}
+Affine inverseAffineOf(const Pose& pose) {
+  const RotationMatrix r = rotationMatrix(pose.orientation);
+  const RotationMatrix rt{r[0], r[3], r[6], r[1], r[4], r[7], r[2], r[5], r[8]};
+  const double x = pose.position.x, y = pose.position.y, z = pose.position.z;
+  return Affine{rt,
+                {-(rt[0] * x + rt[1] * y + rt[2] * z), -(rt[3] * x + rt[4] * y + rt[5] * z),
+                 -(rt[6] * x + rt[7] * y + rt[8] * z)}};
+}
+
+RotationMatrix multiply(const RotationMatrix& a, const RotationMatrix& b) {
+  RotationMatrix m{};
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      m[3 * i + j] = a[3 * i] * b[j] + a[3 * i + 1] * b[3 + j] + a[3 * i + 2] * b[6 + j];
+    }
+  }
+  return m;
+}
+
+/** Apply the affine transform @p a to the points, stored as separate arrays of coordinates */
+void apply(const Affine& a, const double* const x, const double* const y, const double* const z,
+           const std::size_t size, double* const out_x, double* const out_y, double* const out_z) {
+  std::size_t i = 0;
+#ifdef __AVX2__
+  const __m256d r0 = _mm256_set1_pd(a.r[0]), r1 = _mm256_set1_pd(a.r[1]), r2 = _mm256_set1_pd(a.r[2]);
+  const __m256d r3 = _mm256_set1_pd(a.r[3]), r4 = _mm256_set1_pd(a.r[4]), r5 = _mm256_set1_pd(a.r[5]);
+  const __m256d r6 = _mm256_set1_pd(a.r[6]), r7 = _mm256_set1_pd(a.r[7]), r8 = _mm256_set1_pd(a.r[8]);
+  const __m256d tx = _mm256_set1_pd(a.t[0]), ty = _mm256_set1_pd(a.t[1]), tz = _mm256_set1_pd(a.t[2]);
+  for (; i + 4 <= size; i += 4) {
+    // All the coordinates are loaded before storing any, so that the points can be transformed in place
+    const __m256d px = _mm256_loadu_pd(x + i), py = _mm256_loadu_pd(y + i), pz = _mm256_loadu_pd(z + i);
+    _mm256_storeu_pd(out_x + i, _mm256_fmadd_pd(r0, px, _mm256_fmadd_pd(r1, py, _mm256_fmadd_pd(r2, pz, tx))));
+    _mm256_storeu_pd(out_y + i, _mm256_fmadd_pd(r3, px, _mm256_fmadd_pd(r4, py, _mm256_fmadd_pd(r5, pz, ty))));
+    _mm256_storeu_pd(out_z + i, _mm256_fmadd_pd(r6, px, _mm256_fmadd_pd(r7, py, _mm256_fmadd_pd(r8, pz, tz))));
+  }
+#endif
+  for (; i < size; ++i) {
+    const double px = x[i], py = y[i], pz = z[i];
+    out_x[i] = a.r[0] * px + a.r[1] * py + a.r[2] * pz + a.t[0];
+    out_y[i] = a.r[3] * px + a.r[4] * py + a.r[5] * pz + a.t[1];
+    out_z[i] = a.r[6] * px + a.r[7] * py + a.r[8] * pz + a.t[2];
+  }
+}
+
+/** Apply the affine transform @p a to the strided points, one block at a time */
+void applyStrided(const Affine& a, const double* const points, const std::size_t size, const std::size_t stride,
+                  double* const out) {
+  if (stride < 3) SYMAWARE_INVALID_ARGUMENT("stride", stride);
+  double x[block_size], y[block_size], z[block_size];
+  for (std::size_t start = 0; start < size; start += block_size) {
+    const std::size_t count = std::min(block_size, size - start);
+    const double* const block = points + start * stride;
+    for (std::size_t i = 0; i < count; ++i) {
+      x[i] = block[i * stride];
+      y[i] = block[i * stride + 1];
+      z[i] = block[i * stride + 2];
+    }
+    apply(a, x, y, z, count, x, y, z);
+    double* const block_out = out + start * 3;
+    for (std::size_t i = 0; i < count; ++i) {
+      block_out[3 * i] = x[i];
+      block_out[3 * i + 1] = y[i];
+      block_out[3 * i + 2] = z[i];
+    }
+  }
+}
+
+}  // namespace
+
+bool avx2Transforms() {
+#ifdef __AVX2__
+  return true;
+#else
+  return false;
+#endif
+}
+
+RotationMatrix rotationMatrix(const Orientation& orientation) {
+  const double cr = std::cos(orientation.roll), sr = std::sin(orientation.roll);
+  const double cp = std::cos(orientation.pitch), sp = std::sin(orientation.pitch);
+  const double cy = std::cos(orientation.yaw), sy = std::sin(orientation.yaw);
+  return RotationMatrix{cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr,
+                        sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr,
+                        -sp,     cp * sr,                cp * cr};
+}
+
+Quaternion quaternion(const Orientation& orientation) {
+  const double cr = std::cos(orientation.roll / 2), sr = std::sin(orientation.roll / 2);
+  const double cp = std::cos(orientation.pitch / 2), sp = std::sin(orientation.pitch / 2);
+  const double cy = std::cos(orientation.yaw / 2), sy = std::sin(orientation.yaw / 2);
+  const Quaternion q{cr * cp * cy + sr * sp * sy, sr * cp * cy - cr * sp * sy, cr * sp * cy + sr * cp * sy,
+                     cr * cp * sy - sr * sp * cy};
+  // q and -q represent the same rotation
+  return q.w < 0 ? Quaternion{-q.w, -q.x, -q.y, -q.z} : q;
+}
+
+Orientation orientation(const RotationMatrix& rotation) {
+  const double sp = std::clamp(-rotation[6], -1.0, 1.0);
+  // With the pitch at +-pi/2 only the difference between roll and yaw is defined, so the roll is taken to be 0
+  if (std::abs(sp) > 1 - 1e-12) return Orientation{0, std::asin(sp), std::atan2(-rotation[1], rotation[4])};
+  return Orientation{std::atan2(rotation[7], rotation[8]), std::asin(sp), std::atan2(rotation[3], rotation[0])};
+}
+
+Orientation orientation(const Quaternion& q) {
+  const double xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const double xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  const double wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+  return orientation(RotationMatrix{1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy),
+                                    2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx),
+                                    2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)});
+}
+
+Pose compose(const Pose& parent, const Pose& child) {
+  Pose pose;
+  pose.position = transformPoint(parent, child.position);
+  pose.orientation = orientation(multiply(rotationMatrix(parent.orientation), rotationMatrix(child.orientation)));
+  return pose;
+}
+
+Pose inverse(const Pose& pose) {
+  const Affine a = inverseAffineOf(pose);
+  Pose inverted;
+  inverted.position = Position{a.t[0], a.t[1], a.t[2]};
+  inverted.orientation = orientation(a.r);
+  return inverted;
+}
+
+Position transformPoint(const Pose& pose, const Position& point) {
+  Position out;
+  apply(affineOf(pose), &point.x, &point.y, &point.z, 1, &out.x, &out.y, &out.z);
+  return out;
+}
+Position inverseTransformPoint(const Pose& pose, const Position& point) {
+  Position out;
+  apply(inverseAffineOf(pose), &point.x, &point.y, &point.z, 1, &out.x, &out.y, &out.z);
+  return out;
+}
+
+void transformPoints(const Pose& pose, const double* const x, const double* const y, const double* const z,
+                     const std::size_t size, double* const out_x, double* const out_y, double* const out_z) {
+  apply(affineOf(pose), x, y, z, size, out_x, out_y, out_z);
+}
+void inverseTransformPoints(const Pose& pose, const double* const x, const double* const y, const double* const z,
+                            const std::size_t size, double* const out_x, double* const out_y, double* const out_z) {
+  apply(inverseAffineOf(pose), x, y, z, size, out_x, out_y, out_z);
+}
+void transformPoints(const Pose& pose, const double* const points, const std::size_t size, const std::size_t stride,
+                     double* const out) {
+  applyStrided(affineOf(pose), points, size, stride, out);
+}
+void inverseTransformPoints(const Pose& pose, const double* const points, const std::size_t size,
+                            const std::size_t stride, double* const out) {
+  applyStrided(inverseAffineOf(pose), points, size, stride, out);
+}
+
+void polarToCartesian(const double* const range, const double* const azimuth, const double* const elevation,
+                      const std::size_t size, double* const out_x, double* const out_y, double* const out_z) {
+  for (std::size_t i = 0; i < size; ++i) {
+    const double r = range[i], a = azimuth[i], e = elevation[i];
+    out_x[i] = r * std::cos(e) * std::cos(a);
+    out_y[i] = r * std::cos(e) * std::sin(a);
+    out_z[i] = r * std::sin(e);
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const Quaternion& quaternion) {
+  return os << "Quaternion: (w: " << quaternion.w << ", x: " << quaternion.x << ", y: " << quaternion.y
+            << ", z: " << quaternion.z << ")";
+}
+
+}  // namespace symaware
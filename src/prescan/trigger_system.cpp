@@ -0,0 +1,169 @@
+#include "symaware/prescan/trigger_system.h"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+double quantityOf(const Entity::State& state, const TriggerSystem::Quantity quantity) {
+  switch (quantity) {
+    case TriggerSystem::Quantity::X:
+      return state.position.x;
+    case TriggerSystem::Quantity::Y:
+      return state.position.y;
+    case TriggerSystem::Quantity::Z:
+      return state.position.z;
+    case TriggerSystem::Quantity::ROLL:
+      return state.orientation.roll;
+    case TriggerSystem::Quantity::PITCH:
+      return state.orientation.pitch;
+    case TriggerSystem::Quantity::YAW:
+      return state.orientation.yaw;
+    case TriggerSystem::Quantity::VELOCITY:
+      return state.velocity;
+    case TriggerSystem::Quantity::YAW_RATE:
+      return state.yaw_rate;
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+}  // namespace
+
+TriggerSystem::TriggerSystem() : triggers_{}, steps_{0} {}
+
+void TriggerSystem::initialise(const Environment&, prescan::sim::ISimulation*) {
+  steps_ = 0;
+  for (Trigger& trigger : triggers_) {
+    trigger.active = false;
+    trigger.value = nan;
+  }
+}
+
+void TriggerSystem::step(const Environment&, prescan::sim::ISimulation* simulation) {
+  // Observers run after the simulation has stepped, so the state is the one at the end of the step
+  evaluate(static_cast<double>(steps_ + 1) * simulation->getSampleTime());
+  steps_++;
+}
+
+std::size_t TriggerSystem::addStateTrigger(const Entity& entity, const Quantity quantity, const Comparison comparison,
+                                           const double threshold, const double hysteresis, Callback callback) {
+  return add(Trigger{Kind::STATE, &entity, nullptr, nullptr, quantity, 0, 0, comparison, threshold, hysteresis,
+                     std::move(callback), false, nan});
+}
+std::size_t TriggerSystem::addDistanceTrigger(const Entity& first, const Entity& second, const Comparison comparison,
+                                              const double threshold, const double hysteresis, Callback callback) {
+  return add(Trigger{Kind::DISTANCE, &first, &second, nullptr, Quantity::X, 0, 0, comparison, threshold, hysteresis,
+                     std::move(callback), false, nan});
+}
+std::size_t TriggerSystem::addPointDistanceTrigger(const Entity& entity, const double x, const double y,
+                                                   const Comparison comparison, const double threshold,
+                                                   const double hysteresis, Callback callback) {
+  return add(Trigger{Kind::POINT_DISTANCE, &entity, nullptr, nullptr, Quantity::X, x, y, comparison, threshold,
+                     hysteresis, std::move(callback), false, nan});
+}
+std::size_t TriggerSystem::addDetectionTrigger(const Sensor& sensor, const Comparison comparison,
+                                               const double threshold, const double hysteresis, Callback callback) {
+  return add(Trigger{Kind::DETECTIONS, nullptr, nullptr, &sensor, Quantity::X, 0, 0, comparison, threshold,
+                     hysteresis, std::move(callback), false, nan});
+}
+
+std::size_t TriggerSystem::add(Trigger trigger) {
+  if (!(trigger.hysteresis >= 0)) SYMAWARE_INVALID_ARGUMENT("hysteresis", trigger.hysteresis);
+  triggers_.push_back(std::move(trigger));
+  return triggers_.size() - 1;
+}
+
+void TriggerSystem::clear() { triggers_.clear(); }
+
+void TriggerSystem::evaluate(const double time) {
+  for (std::size_t id = 0; id < triggers_.size(); ++id) {
+    Trigger& trigger = triggers_[id];
+    const double value = valueOf(trigger);
+    trigger.value = value;
+    // Comparisons with NaN are false, so a trigger keeps its state while its value is unknown
+    const bool active =
+        trigger.comparison == Comparison::BELOW
+            ? (trigger.active ? !(value > trigger.threshold + trigger.hysteresis) : value < trigger.threshold)
+            : (trigger.active ? !(value < trigger.threshold - trigger.hysteresis) : value > trigger.threshold);
+    if (active == trigger.active) continue;
+    trigger.active = active;
+    if (!trigger.callback) continue;
+    // The callback may add or remove triggers, invalidating the reference to this one
+    const Callback callback = trigger.callback;
+    callback(id, active, time);
+  }
+}
+
+double TriggerSystem::valueOf(const Trigger& trigger) {
+  switch (trigger.kind) {
+    case Kind::STATE:
+      return quantityOf(trigger.first->state(), trigger.quantity);
+    case Kind::DISTANCE: {
+      const Entity::State first = trigger.first->state(), second = trigger.second->state();
+      return std::hypot(second.position.x - first.position.x, second.position.y - first.position.y);
+    }
+    case Kind::POINT_DISTANCE: {
+      const Entity::State state = trigger.first->state();
+      return std::hypot(trigger.x - state.position.x, trigger.y - state.position.y);
+    }
+    case Kind::DETECTIONS:
+      return static_cast<double>(trigger.sensor->detectionCount());
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+bool TriggerSystem::active(const std::size_t id) const {
+  if (id >= triggers_.size())
+    SYMAWARE_OUT_OF_RANGE_FMT("Trigger {} does not exist, there are {} triggers", id, triggers_.size());
+  return triggers_[id].active;
+}
+double TriggerSystem::value(const std::size_t id) const {
+  if (id >= triggers_.size())
+    SYMAWARE_OUT_OF_RANGE_FMT("Trigger {} does not exist, there are {} triggers", id, triggers_.size());
+  return triggers_[id].value;
+}
+
+std::ostream& operator<<(std::ostream& os, const TriggerSystem::Quantity quantity) {
+  switch (quantity) {
+    case TriggerSystem::Quantity::X:
+      return os << "X";
+    case TriggerSystem::Quantity::Y:
+      return os << "Y";
+    case TriggerSystem::Quantity::Z:
+      return os << "Z";
+    case TriggerSystem::Quantity::ROLL:
+      return os << "ROLL";
+    case TriggerSystem::Quantity::PITCH:
+      return os << "PITCH";
+    case TriggerSystem::Quantity::YAW:
+      return os << "YAW";
+    case TriggerSystem::Quantity::VELOCITY:
+      return os << "VELOCITY";
+    case TriggerSystem::Quantity::YAW_RATE:
+      return os << "YAW_RATE";
+    default:
+      return os << "Unknown";
+  }
+}
+std::ostream& operator<<(std::ostream& os, const TriggerSystem::Comparison comparison) {
+  switch (comparison) {
+    case TriggerSystem::Comparison::BELOW:
+      return os << "BELOW";
+    case TriggerSystem::Comparison::ABOVE:
+      return os << "ABOVE";
+    default:
+      return os << "Unknown";
+  }
+}
+
+}  // namespace symaware
@@ -0,0 +1,359 @@
+#include "symaware/util/arrow_writer.h"
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+constexpr std::uint32_t continuation_marker = 0xFFFFFFFF;
+constexpr std::size_t body_alignment = 8;
+
+// Subset of the Arrow flatbuffer schema (format/Message.fbs, format/Schema.fbs)
+constexpr std::int16_t metadata_version_v5 = 4;
+constexpr std::uint8_t message_header_schema = 1;
+constexpr std::uint8_t message_header_record_batch = 3;
+constexpr std::uint8_t type_int = 2;
+constexpr std::uint8_t type_floating_point = 3;
+constexpr std::uint8_t type_utf8 = 5;
+constexpr std::int16_t precision_double = 2;
+
+/** FieldNode and Buffer structs of the RecordBatch table. Both are made of two int64 */
+struct Int64Pair {
+  std::int64_t first;
+  std::int64_t second;
+};
+
+/**
+ * @brief Minimal flatbuffer builder.
+ *
+ * The buffer is built back to front, as the reference implementation does,
+ * so that each offset can be computed as soon as the object it refers to has been written.
+ * Offsets are stored as the distance from the end of the buffer.
+ * @note Assumes a little endian host, which is what the flatbuffer format uses.
+ */
+class FlatBufferBuilder {
+ public:
+  using Offset = std::uint32_t;
+
+  FlatBufferBuilder() : buffer_{}, min_align_{1}, table_start_{0}, fields_{} { buffer_.reserve(512); }
+
+  Offset size() const { return static_cast<Offset>(buffer_.size()); }
+
+  Offset createString(const std::string& value) {
+    align(sizeof(Offset), value.size() + 1);
+    pad(1);
+    prepend(value.data(), value.size());
+    push(static_cast<std::uint32_t>(value.size()));
+    return size();
+  }
+  Offset createVector(const std::vector<Offset>& offsets) {
+    align(sizeof(Offset), offsets.size() * sizeof(Offset));
+    for (auto it = offsets.rbegin(); it != offsets.rend(); ++it) pushOffset(*it);
+    push(static_cast<std::uint32_t>(offsets.size()));
+    return size();
+  }
+  Offset createVector(const std::vector<Int64Pair>& structs) {
+    align(sizeof(Offset), structs.size() * sizeof(Int64Pair));
+    align(alignof(std::int64_t), structs.size() * sizeof(Int64Pair));
+    prepend(reinterpret_cast<const char*>(structs.data()), structs.size() * sizeof(Int64Pair));
+    push(static_cast<std::uint32_t>(structs.size()));
+    return size();
+  }
+
+  void startTable() {
+    table_start_ = size();
+    fields_.clear();
+  }
+  template <class T>
+  void addField(const std::uint16_t id, const T value) {
+    push(value);
+    fields_.emplace_back(id, size());
+  }
+  void addOffset(const std::uint16_t id, const Offset offset) {
+    pushOffset(offset);
+    fields_.emplace_back(id, size());
+  }
+  Offset endTable() {
+    push(std::int32_t{0});
+    const Offset table = size();
+    std::uint16_t num_fields = 0;
+    for (const auto& [id, position] : fields_) num_fields = std::max(num_fields, static_cast<std::uint16_t>(id + 1));
+    std::vector<std::uint16_t> vtable(num_fields + 2, 0);
+    vtable[0] = static_cast<std::uint16_t>(vtable.size() * sizeof(std::uint16_t));
+    vtable[1] = static_cast<std::uint16_t>(table - table_start_);
+    for (const auto& [id, position] : fields_) vtable[id + 2] = static_cast<std::uint16_t>(table - position);
+    for (auto it = vtable.rbegin(); it != vtable.rend(); ++it) push(*it);
+    const auto vtable_offset = static_cast<std::int32_t>(size() - table);
+    const auto* const bytes = reinterpret_cast<const char*>(&vtable_offset);
+    std::reverse_copy(bytes, bytes + sizeof(vtable_offset), buffer_.begin() + table - sizeof(vtable_offset));
+    return table;
+  }
+
+  /**
+   * @brief Write the offset to the @p root table and return the finished buffer.
+   *
+   * The size of the buffer is a multiple of 8, as required by the Arrow IPC format.
+   * @param root root table of the buffer
+   * @return finished buffer
+   */
+  std::vector<char> finish(const Offset root) {
+    min_align_ = std::max(min_align_, body_alignment);
+    align(min_align_, sizeof(Offset));
+    pushOffset(root);
+    return std::vector<char>{buffer_.rbegin(), buffer_.rend()};
+  }
+
+ private:
+  // The buffer is stored reversed, so prepending a value means appending its reversed bytes
+  void prepend(const char* data, const std::size_t size) {
+    buffer_.insert(buffer_.end(), std::reverse_iterator<const char*>{data + size},
+                   std::reverse_iterator<const char*>{data});
+  }
+  void pad(const std::size_t size) { buffer_.insert(buffer_.end(), size, 0); }
+  void align(const std::size_t alignment, const std::size_t additional = 0) {
+    min_align_ = std::max(min_align_, alignment);
+    pad((alignment - ((buffer_.size() + additional) % alignment)) % alignment);
+  }
+  template <class T>
+  void push(const T value) {
+    align(sizeof(T));
+    prepend(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  void pushOffset(const Offset offset) {
+    align(sizeof(Offset));
+    push(static_cast<std::uint32_t>(size() + sizeof(Offset) - offset));
+  }
+
+  std::vector<char> buffer_;
+  std::size_t min_align_;
+  Offset table_start_;
+  std::vector<std::pair<std::uint16_t, Offset>> fields_;
+};
+
+std::size_t padding(const std::size_t size) { return (body_alignment - size % body_alignment) % body_alignment; }
+
+FlatBufferBuilder::Offset createType(FlatBufferBuilder& builder, const ArrowType type) {
+  builder.startTable();
+  switch (type) {
+    case ArrowType::INT32:
+    case ArrowType::INT64:
+      builder.addField<std::int32_t>(0, type == ArrowType::INT32 ? 32 : 64);
+      builder.addField<std::uint8_t>(1, 1);
+      break;
+    case ArrowType::FLOAT64:
+      builder.addField(0, precision_double);
+      break;
+    case ArrowType::UTF8:
+      break;
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+  return builder.endTable();
+}
+
+std::uint8_t typeId(const ArrowType type) {
+  switch (type) {
+    case ArrowType::INT32:
+    case ArrowType::INT64:
+      return type_int;
+    case ArrowType::FLOAT64:
+      return type_floating_point;
+    case ArrowType::UTF8:
+      return type_utf8;
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+std::vector<char> createMessage(FlatBufferBuilder& builder, const std::uint8_t header_type,
+                                const FlatBufferBuilder::Offset header, const std::int64_t body_length) {
+  builder.startTable();
+  builder.addField(3, body_length);
+  builder.addOffset(2, header);
+  builder.addField(0, metadata_version_v5);
+  builder.addField(1, header_type);
+  return builder.finish(builder.endTable());
+}
+
+}  // namespace
+
+ArrowColumn::ArrowColumn(ArrowField field) : field_{std::move(field)}, size_{0}, data_{}, offsets_{} {
+  if (field_.type == ArrowType::UTF8) offsets_.push_back(0);
+}
+
+template <class T>
+void ArrowColumn::appendPrimitive(const T value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  data_.insert(data_.end(), bytes, bytes + sizeof(T));
+  size_++;
+}
+
+void ArrowColumn::append(const std::int32_t value) {
+  SYMAWARE_ASSERT(field_.type == ArrowType::INT32, "Column type mismatch");
+  appendPrimitive(value);
+}
+void ArrowColumn::append(const std::int64_t value) {
+  SYMAWARE_ASSERT(field_.type == ArrowType::INT64, "Column type mismatch");
+  appendPrimitive(value);
+}
+void ArrowColumn::append(const double value) {
+  SYMAWARE_ASSERT(field_.type == ArrowType::FLOAT64, "Column type mismatch");
+  appendPrimitive(value);
+}
+void ArrowColumn::append(const std::string& value) {
+  SYMAWARE_ASSERT(field_.type == ArrowType::UTF8, "Column type mismatch");
+  data_.insert(data_.end(), value.begin(), value.end());
+  offsets_.push_back(static_cast<std::int32_t>(data_.size()));
+  size_++;
+}
+
+void ArrowColumn::reserve(const std::size_t size) {
+  switch (field_.type) {
+    case ArrowType::INT32:
+      data_.reserve(data_.size() + size * sizeof(std::int32_t));
+      break;
+    case ArrowType::INT64:
+      data_.reserve(data_.size() + size * sizeof(std::int64_t));
+      break;
+    case ArrowType::FLOAT64:
+      data_.reserve(data_.size() + size * sizeof(double));
+      break;
+    case ArrowType::UTF8:
+      offsets_.reserve(offsets_.size() + size);
+      break;
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+void ArrowColumn::clear() {
+  size_ = 0;
+  data_.clear();
+  if (field_.type == ArrowType::UTF8) offsets_.resize(1);
+}
+
+ArrowStreamWriter::ArrowStreamWriter(const std::string& filename, std::vector<ArrowField> fields)
+    : stream_{filename, std::ios::binary | std::ios::trunc}, columns_{}, num_batches_{0} {
+  if (!stream_.is_open()) SYMAWARE_RUNTIME_ERROR_FMT("Could not open file {}", filename);
+  columns_.reserve(fields.size());
+  for (ArrowField& field : fields) columns_.emplace_back(std::move(field));
+
+  FlatBufferBuilder builder;
+  std::vector<FlatBufferBuilder::Offset> field_offsets;
+  field_offsets.reserve(columns_.size());
+  for (const ArrowColumn& column : columns_) {
+    const FlatBufferBuilder::Offset name = builder.createString(column.name());
+    const FlatBufferBuilder::Offset type = createType(builder, column.type());
+    const FlatBufferBuilder::Offset children = builder.createVector(std::vector<FlatBufferBuilder::Offset>{});
+    builder.startTable();
+    builder.addOffset(0, name);
+    builder.addOffset(3, type);
+    builder.addOffset(5, children);
+    builder.addField<std::uint8_t>(1, 0);
+    builder.addField(2, typeId(column.type()));
+    field_offsets.push_back(builder.endTable());
+  }
+  const FlatBufferBuilder::Offset fields_vector = builder.createVector(field_offsets);
+  builder.startTable();
+  builder.addOffset(1, fields_vector);
+  builder.addField<std::int16_t>(0, 0);  // Little endian
+  const FlatBufferBuilder::Offset schema = builder.endTable();
+  writeMessage(createMessage(builder, message_header_schema, schema, 0));
+}
+
+ArrowStreamWriter::~ArrowStreamWriter() {
+  try {
+    close();
+  } catch (const std::runtime_error&) {
+    // The columns have different lengths: drop the partial rows, but still terminate the stream
+    for (ArrowColumn& column : columns_) column.clear();
+    close();
+  }
+}
+
+void ArrowStreamWriter::flush() {
+  if (!stream_.is_open()) SYMAWARE_RUNTIME_ERROR("Cannot flush a closed stream");
+  const std::size_t length = num_rows();
+  if (length == 0) return;
+
+  std::vector<Int64Pair> nodes;
+  std::vector<Int64Pair> buffers;
+  nodes.reserve(columns_.size());
+  buffers.reserve(3 * columns_.size());
+  std::int64_t body_length = 0;
+  const auto add_buffer = [&buffers, &body_length](const std::size_t size) {
+    buffers.push_back({body_length, static_cast<std::int64_t>(size)});
+    body_length += static_cast<std::int64_t>(size + padding(size));
+  };
+  for (const ArrowColumn& column : columns_) {
+    if (column.size() != length)
+      SYMAWARE_RUNTIME_ERROR_FMT("Column {} has {} rows, expected {}", column.name(), column.size(), length);
+    nodes.push_back({static_cast<std::int64_t>(length), 0});
+    add_buffer(0);  // No validity bitmap, all values are valid
+    if (column.type() == ArrowType::UTF8) add_buffer(column.offsets().size() * sizeof(std::int32_t));
+    add_buffer(column.data().size());
+  }
+
+  FlatBufferBuilder builder;
+  const FlatBufferBuilder::Offset buffers_vector = builder.createVector(buffers);
+  const FlatBufferBuilder::Offset nodes_vector = builder.createVector(nodes);
+  builder.startTable();
+  builder.addField(0, static_cast<std::int64_t>(length));
+  builder.addOffset(1, nodes_vector);
+  builder.addOffset(2, buffers_vector);
+  const FlatBufferBuilder::Offset record_batch = builder.endTable();
+  writeMessage(createMessage(builder, message_header_record_batch, record_batch, body_length));
+
+  for (ArrowColumn& column : columns_) {
+    if (column.type() == ArrowType::UTF8)
+      writeBuffer(reinterpret_cast<const char*>(column.offsets().data()),
+                  column.offsets().size() * sizeof(std::int32_t));
+    writeBuffer(column.data().data(), column.data().size());
+    column.clear();
+  }
+  stream_.flush();
+  num_batches_++;
+}
+
+void ArrowStreamWriter::close() {
+  if (!stream_.is_open()) return;
+  flush();
+  const std::uint32_t end_of_stream[2] = {continuation_marker, 0};
+  stream_.write(reinterpret_cast<const char*>(end_of_stream), sizeof(end_of_stream));
+  stream_.close();
+}
+
+void ArrowStreamWriter::writeMessage(const std::vector<char>& metadata) {
+  const auto metadata_size = static_cast<std::int32_t>(metadata.size() + padding(metadata.size()));
+  stream_.write(reinterpret_cast<const char*>(&continuation_marker), sizeof(continuation_marker));
+  stream_.write(reinterpret_cast<const char*>(&metadata_size), sizeof(metadata_size));
+  writeBuffer(metadata.data(), metadata.size());
+}
+
+void ArrowStreamWriter::writeBuffer(const char* const data, const std::size_t size) {
+  static constexpr char zeros[body_alignment] = {};
+  stream_.write(data, static_cast<std::streamsize>(size));
+  stream_.write(zeros, static_cast<std::streamsize>(padding(size)));
+}
+
+std::ostream& operator<<(std::ostream& os, const ArrowType type) {
+  switch (type) {
+    case ArrowType::INT32:
+      return os << "int32";
+    case ArrowType::INT64:
+      return os << "int64";
+    case ArrowType::FLOAT64:
+      return os << "float64";
+    case ArrowType::UTF8:
+      return os << "utf8";
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+}  // namespace symaware
@@ -0,0 +1,56 @@
+#include "symaware/util/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(num_buckets, 0), count_{0}, sum_{0}, min_{std::numeric_limits<std::uint64_t>::max()}, max_{0} {}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  for (std::size_t i = 0; i < num_buckets; i++) counts_[i] += other.counts_[i];
+  count_ += other.count_;
+  sum_ += other.sum_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::reset() {
+  std::fill(counts_.begin(), counts_.end(), 0);
+  count_ = 0;
+  sum_ = 0;
+  min_ = std::numeric_limits<std::uint64_t>::max();
+  max_ = 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(const double percentile) const {
+  if (percentile < 0 || percentile > 100) SYMAWARE_OUT_OF_RANGE_FMT("Percentile {} is not in [0, 100]", percentile);
+  if (count_ == 0) return 0;
+  const auto rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_))));
+  std::uint64_t cumulative = 0;
+  for (std::size_t i = 0; i < num_buckets; i++) {
+    cumulative += counts_[i];
+    if (cumulative >= rank) return std::min(bucketUpperBound(i), max_);
+  }
+  return max_;
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(const std::size_t index) {
+  if (index < sub_buckets) return index;
+  const std::size_t shift = index / sub_buckets - 1;
+  const std::uint64_t sub_bucket = index % sub_buckets;
+  return ((sub_buckets + sub_bucket + 1) << shift) - 1;
+}
+
+std::ostream& operator<<(std::ostream& os, const LatencyHistogram& histogram) {
+  return os << "LatencyHistogram: (count: " << histogram.count() << ", min: " << histogram.min()
+            << ", mean: " << histogram.mean() << ", p50: " << histogram.percentile(50)
+            << ", p99: " << histogram.percentile(99) << ", max: " << histogram.max() << ")";
+}
+
+}  // namespace symaware
@@ -0,0 +1,80 @@
+#include "symaware/util/profiler.h"
+
+#include <ostream>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+PhaseProfile::PhaseProfile(const PhaseProfile& other) { *this = other; }
+
+PhaseProfile& PhaseProfile::operator=(const PhaseProfile& other) {
+  if (this == &other) return *this;
+  for (std::size_t i = 0; i < num_phases; i++) {
+    histograms_[i] =
+        other.histograms_[i] == nullptr ? nullptr : std::make_unique<LatencyHistogram>(*other.histograms_[i]);
+  }
+  return *this;
+}
+
+void PhaseProfile::record(const ProfilePhase phase, const std::uint64_t duration) {
+  std::unique_ptr<LatencyHistogram>& histogram = histograms_[static_cast<std::size_t>(phase)];
+  if (histogram == nullptr) histogram = std::make_unique<LatencyHistogram>();
+  histogram->record(duration);
+}
+
+void PhaseProfile::reset() {
+  for (std::unique_ptr<LatencyHistogram>& histogram : histograms_) histogram.reset();
+}
+
+ProfileStats::ProfileStats(std::string entity, std::string component, const ProfilePhase phase,
+                           const LatencyHistogram& histogram)
+    : entity{std::move(entity)},
+      component{std::move(component)},
+      phase{phase},
+      count{histogram.count()},
+      min{histogram.min()},
+      mean{histogram.mean()},
+      p50{histogram.percentile(50)},
+      p90{histogram.percentile(90)},
+      p99{histogram.percentile(99)},
+      max{histogram.max()} {}
+
+void appendProfileStats(std::vector<ProfileStats>& stats, const std::string& entity, const std::string& component,
+                        const PhaseProfile& profile) {
+  for (std::size_t i = 0; i < PhaseProfile::num_phases; i++) {
+    const auto phase = static_cast<ProfilePhase>(i);
+    const LatencyHistogram* const histogram = profile.histogram(phase);
+    if (histogram != nullptr) stats.emplace_back(entity, component, phase, *histogram);
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const ProfilePhase phase) {
+  switch (phase) {
+    case ProfilePhase::REGISTER:
+      return os << "register";
+    case ProfilePhase::INITIALISE:
+      return os << "initialise";
+    case ProfilePhase::STEP:
+      return os << "step";
+    case ProfilePhase::TERMINATE:
+      return os << "terminate";
+    case ProfilePhase::PRE_STEP:
+      return os << "pre_step";
+    case ProfilePhase::POST_STEP:
+      return os << "post_step";
+    case ProfilePhase::UPDATE_STATE:
+      return os << "update_state";
+    default:
+      SYMAWARE_UNREACHABLE();
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const ProfileStats& stats) {
+  return os << "ProfileStats: (entity: " << stats.entity << ", component: " << stats.component
+            << ", phase: " << stats.phase << ", count: " << stats.count << ", min: " << stats.min
+            << ", mean: " << stats.mean << ", p50: " << stats.p50 << ", p90: " << stats.p90 << ", p99: " << stats.p99
+            << ", max: " << stats.max << ")";
+}
+
+}  // namespace symaware
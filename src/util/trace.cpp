@@ -0,0 +1,134 @@
+#include "symaware/util/trace.h"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "symaware/util/exception.h"
+
+namespace symaware {
+
+namespace {
+
+/** Fixed size block of events. Written by a single thread, can be read concurrently */
+struct TraceChunk {
+  static constexpr std::size_t capacity = 4096;
+  std::array<TraceEvent, capacity> events;
+  std::atomic<std::size_t> size{0};        ///< Number of events published in the chunk
+  std::atomic<TraceChunk*> next{nullptr};  ///< Next chunk, if this one is full
+};
+
+/** Buffer of the events recorded by a single thread */
+class ThreadTraceBuffer {
+ public:
+  explicit ThreadTraceBuffer(const std::size_t thread_id)
+      : thread_id_{thread_id}, head_{std::make_unique<TraceChunk>()}, tail_{head_.get()} {}
+  ~ThreadTraceBuffer() { clear(); }
+
+  ThreadTraceBuffer(const ThreadTraceBuffer&) = delete;
+  ThreadTraceBuffer& operator=(const ThreadTraceBuffer&) = delete;
+
+  void append(const TraceEvent& event) {
+    std::size_t size = tail_->size.load(std::memory_order_relaxed);
+    if (size == TraceChunk::capacity) {
+      TraceChunk* const chunk = new TraceChunk{};
+      tail_->next.store(chunk, std::memory_order_release);
+      tail_ = chunk;
+      size = 0;
+    }
+    tail_->events[size] = event;
+    tail_->size.store(size + 1, std::memory_order_release);
+  }
+
+  template <class F>
+  void forEach(F&& callback) const {
+    for (const TraceChunk* chunk = head_.get(); chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire)) {
+      const std::size_t size = chunk->size.load(std::memory_order_acquire);
+      for (std::size_t i = 0; i < size; i++) callback(chunk->events[i]);
+    }
+  }
+
+  void clear() {
+    TraceChunk* chunk = head_->next.exchange(nullptr);
+    while (chunk != nullptr) {
+      TraceChunk* const next = chunk->next.load();
+      delete chunk;
+      chunk = next;
+    }
+    head_->size.store(0);
+    tail_ = head_.get();
+  }
+
+  std::size_t thread_id() const { return thread_id_; }
+
+ private:
+  std::size_t thread_id_;             ///< Small sequential identifier of the thread
+  std::unique_ptr<TraceChunk> head_;  ///< First chunk of the buffer
+  TraceChunk* tail_;                  ///< Chunk new events are appended to. Only accessed by the owning thread
+};
+
+/** Buffers of all the threads that have recorded at least one event. They outlive the threads */
+struct TraceRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers;
+};
+
+TraceRegistry& registry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+ThreadTraceBuffer& threadBuffer() {
+  thread_local ThreadTraceBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    TraceRegistry& traces = registry();
+    const std::lock_guard<std::mutex> lock{traces.mutex};
+    traces.buffers.emplace_back(std::make_unique<ThreadTraceBuffer>(traces.buffers.size()));
+    buffer = traces.buffers.back().get();
+  }
+  return *buffer;
+}
+
+void writeEscaped(std::ofstream& file, const char* str) {
+  for (; *str != '\0'; str++) {
+    if (*str == '"' || *str == '\\') file << '\\';
+    file << *str;
+  }
+}
+
+}  // namespace
+
+void Tracer::record(const TraceEvent& event) { threadBuffer().append(event); }
+
+void Tracer::write(const std::string& filename) {
+  std::ofstream file{filename};
+  if (!file.is_open()) SYMAWARE_RUNTIME_ERROR_FMT("Could not open file {}", filename);
+  file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  TraceRegistry& traces = registry();
+  const std::lock_guard<std::mutex> lock{traces.mutex};
+  for (const std::unique_ptr<ThreadTraceBuffer>& buffer : traces.buffers) {
+    buffer->forEach([&file, &first, &buffer](const TraceEvent& event) {
+      file << (first ? "\n" : ",\n") << "{\"name\":\"";
+      writeEscaped(file, event.name);
+      // Trace Event timestamps are expressed in microseconds
+      file << fmt::format("\",\"cat\":\"symaware\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+                          static_cast<double>(event.start) / 1000.0, static_cast<double>(event.duration) / 1000.0,
+                          buffer->thread_id());
+      first = false;
+    });
+  }
+  file << "\n]}\n";
+}
+
+void Tracer::clear() {
+  TraceRegistry& traces = registry();
+  const std::lock_guard<std::mutex> lock{traces.mutex};
+  for (const std::unique_ptr<ThreadTraceBuffer>& buffer : traces.buffers) buffer->clear();
+}
+
+}  // namespace symaware
@@ -0,0 +1,85 @@
+/**
+ * @file test_object_catalog.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the static object catalog
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include "symaware/prescan/object_catalog.h"
+
+using symaware::ObjectCategory;
+using symaware::objectInfo;
+using symaware::ObjectType;
+using symaware::object_catalog;
+using symaware::to_underlying;
+
+namespace {
+/** @return true if the @p value is unknown or at least @p min */
+bool unknownOrAtLeast(const double value, const double min) { return std::isnan(value) || value >= min; }
+}  // namespace
+
+static_assert(objectInfo(ObjectType::Audi_A8_Sedan).category == ObjectCategory::VEHICLE);
+static_assert(objectInfo(ObjectType::Male_Regular).category == ObjectCategory::PEDESTRIAN);
+
+TEST(TestObjectCatalog, Indexed) {
+  for (std::size_t i = 0; i < object_catalog.size(); ++i)
+    EXPECT_EQ(to_underlying(object_catalog[i].type), static_cast<int>(i));
+  EXPECT_EQ(object_catalog.back().type, ObjectType::TrafficSignPole);
+}
+
+TEST(TestObjectCatalog, Valid) {
+  for (const auto& info : object_catalog) {
+    EXPECT_TRUE(unknownOrAtLeast(info.length, 0)) << info;
+    EXPECT_TRUE(unknownOrAtLeast(info.width, 0)) << info;
+    EXPECT_TRUE(unknownOrAtLeast(info.height, 0)) << info;
+    EXPECT_TRUE(unknownOrAtLeast(info.mass, 0)) << info;
+    EXPECT_TRUE(unknownOrAtLeast(info.cog_z, 0)) << info;
+    // A known centre of gravity lies within a known bounding box
+    if (!std::isnan(info.cog_x) && !std::isnan(info.length)) {
+      EXPECT_LE(std::abs(info.cog_x), info.length / 2) << info;
+    }
+    if (!std::isnan(info.cog_y) && !std::isnan(info.width)) {
+      EXPECT_LE(std::abs(info.cog_y), info.width / 2) << info;
+    }
+    if (!std::isnan(info.cog_z) && !std::isnan(info.height)) {
+      EXPECT_LE(info.cog_z, info.height) << info;
+    }
+  }
+}
+
+TEST(TestObjectCatalog, Categories) {
+  for (const auto& info : object_catalog) {
+    if (info.category == ObjectCategory::VEHICLE || info.category == ObjectCategory::PEDESTRIAN) {
+      // Objects that move by themselves are never anchored nor placed along a line
+      EXPECT_NE(info.length, 0) << info;
+      EXPECT_NE(info.mass, 0) << info;
+    }
+    if (info.category == ObjectCategory::FOLIAGE) {
+      EXPECT_EQ(info.mass, 0) << info;
+    }
+  }
+  EXPECT_EQ(objectInfo(ObjectType::Cone).category, ObjectCategory::STATIC);
+  EXPECT_EQ(objectInfo(ObjectType::Birch20y).category, ObjectCategory::FOLIAGE);
+  EXPECT_EQ(objectInfo(ObjectType::Deer).category, ObjectCategory::PEDESTRIAN);
+}
+
+TEST(TestObjectCatalog, Unknown) {
+  // Values not taken from the Prescan object library are NaN rather than made up
+  const auto& sedan = objectInfo(ObjectType::Audi_A8_Sedan);
+  EXPECT_TRUE(std::isnan(sedan.length));
+  EXPECT_TRUE(std::isnan(sedan.mass));
+  // Placement-dependent sizes and anchored masses are known to be 0
+  EXPECT_EQ(objectInfo(ObjectType::Guardrail).length, 0);
+  EXPECT_EQ(objectInfo(ObjectType::Birch20y).mass, 0);
+}
+
+TEST(TestObjectCatalog, InvalidType) {
+  EXPECT_THROW(objectInfo(static_cast<ObjectType>(-1)), std::out_of_range);
+  EXPECT_THROW(objectInfo(static_cast<ObjectType>(object_catalog.size())), std::out_of_range);
+}
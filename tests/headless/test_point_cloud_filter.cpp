@@ -0,0 +1,168 @@
+/**
+ * @file test_point_cloud_filter.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the processing of point clouds
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "symaware/prescan/point_cloud_filter.h"
+#include "symaware/util/constants.h"
+
+using symaware::pi;
+using symaware::PointCloudFilter;
+using symaware::Pose;
+
+namespace {
+
+/** Points stored as separate arrays of coordinates */
+struct Cloud {
+  void add(const double px, const double py, const double pz) {
+    x.push_back(px);
+    y.push_back(py);
+    z.push_back(pz);
+  }
+  void process(PointCloudFilter& filter, const Pose& pose = Pose{true}) const {
+    filter.process(pose, x.data(), y.data(), z.data(), x.size());
+  }
+  std::vector<double> x, y, z;
+};
+
+/** Square of side 10 m on the ground, sampled every 0.25 m, and a 1 m cube above it, sampled every 0.1 m */
+Cloud groundAndBox() {
+  Cloud cloud;
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 40; ++j) cloud.add(i * 0.25 - 5, j * 0.25 - 5, 0);
+  }
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 10; ++k) cloud.add(i * 0.1 + 0.05, j * 0.1 + 0.05, k * 0.1 + 1.05);
+    }
+  }
+  return cloud;
+}
+}  // namespace
+
+TEST(TestPointCloudFilter, Empty) {
+  PointCloudFilter filter{};
+  EXPECT_EQ(filter.size(), 0u);
+  EXPECT_EQ(filter.inputSize(), 0u);
+  EXPECT_TRUE(std::isnan(filter.groundPlane()[0]));
+  Cloud{}.process(filter);
+  EXPECT_EQ(filter.size(), 0u);
+  EXPECT_EQ(filter.groundSize(), 0u);
+}
+
+TEST(TestPointCloudFilter, WorldFrame) {
+  PointCloudFilter filter{PointCloudFilter::Setup{0, 0}};
+  Cloud cloud;
+  cloud.add(1, 0, 0);
+  cloud.add(0, 2, -1);
+  cloud.process(filter, Pose{10, 5, 1, 0, 0, pi / 2});
+  ASSERT_EQ(filter.size(), 2u);
+  const std::vector<double> expected{10, 6, 1, 8, 5, 0};
+  for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_NEAR(filter.points()[i], expected[i], 1e-12);
+}
+
+TEST(TestPointCloudFilter, VoxelDownsampling) {
+  PointCloudFilter filter{PointCloudFilter::Setup{0.5, 0}};
+  // 10 points per side in a 1 m cube, 125 in each of its 8 voxels
+  Cloud cloud;
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 10; ++k) cloud.add(i * 0.1 + 0.05, j * 0.1 + 0.05, k * 0.1 + 0.05);
+    }
+  }
+  cloud.process(filter);
+  EXPECT_EQ(filter.inputSize(), 1000u);
+  ASSERT_EQ(filter.size(), 8u);
+  for (const double coordinate : filter.points()) {
+    EXPECT_TRUE(std::abs(coordinate - 0.25) < 1e-9 || std::abs(coordinate - 0.75) < 1e-9) << coordinate;
+  }
+}
+
+TEST(TestPointCloudFilter, VoxelDownsamplingAroundOrigin) {
+  PointCloudFilter filter{PointCloudFilter::Setup{1, 0}};
+  // Points on both sides of 0 must not end up in the same voxel
+  Cloud cloud;
+  cloud.add(-0.5, -0.5, -0.5);
+  cloud.add(0.5, 0.5, 0.5);
+  cloud.add(0.7, 0.3, 0.1);
+  cloud.process(filter);
+  ASSERT_EQ(filter.size(), 2u);
+}
+
+TEST(TestPointCloudFilter, DropNonFinitePoints) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  Cloud cloud;
+  cloud.add(1, 1, 1);
+  cloud.add(nan, 1, 1);
+  cloud.add(1, std::numeric_limits<double>::infinity(), 1);
+  for (const double voxel_size : {0.0, 0.5}) {
+    PointCloudFilter filter{PointCloudFilter::Setup{voxel_size, 0}};
+    cloud.process(filter);
+    EXPECT_EQ(filter.inputSize(), 3u);
+    EXPECT_EQ(filter.size(), 1u);
+  }
+}
+
+TEST(TestPointCloudFilter, GroundRemoval) {
+  PointCloudFilter filter{PointCloudFilter::Setup{0, 0.05}};
+  const Cloud cloud = groundAndBox();
+  cloud.process(filter, Pose{0, 0, 2, 0, 0, 0.3});
+  EXPECT_EQ(filter.groundSize(), 1600u);
+  ASSERT_EQ(filter.size(), 1000u);
+  const auto& plane = filter.groundPlane();
+  EXPECT_NEAR(plane[0], 0, 1e-9);
+  EXPECT_NEAR(plane[1], 0, 1e-9);
+  EXPECT_NEAR(plane[2], 1, 1e-9);
+  EXPECT_NEAR(plane[3], -2, 1e-9);
+  for (std::size_t i = 0; i < filter.size(); ++i) EXPECT_GT(filter.points()[3 * i + 2], 3);
+}
+
+TEST(TestPointCloudFilter, GroundSlope) {
+  // A wall is not ground, no matter how many points it has
+  Cloud wall;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) wall.add(3, i * 0.1, j * 0.1);
+  }
+  PointCloudFilter filter{PointCloudFilter::Setup{0, 0.05}};
+  wall.process(filter);
+  EXPECT_EQ(filter.groundSize(), 0u);
+  EXPECT_EQ(filter.size(), 400u);
+  EXPECT_TRUE(std::isnan(filter.groundPlane()[3]));
+
+  // A gentle slope is
+  Cloud ramp;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) ramp.add(i * 0.5, j * 0.5, i * 0.05);
+  }
+  ramp.process(filter);
+  EXPECT_EQ(filter.groundSize(), 400u);
+  EXPECT_EQ(filter.size(), 0u);
+}
+
+TEST(TestPointCloudFilter, Deterministic) {
+  PointCloudFilter filter{PointCloudFilter::Setup{0.3, 0.05, 16, 0.3, 42}};
+  const Cloud cloud = groundAndBox();
+  cloud.process(filter);
+  const std::vector<double> first = filter.points();
+  const std::array<double, 4> plane = filter.groundPlane();
+  cloud.process(filter);
+  EXPECT_EQ(filter.points(), first);
+  EXPECT_EQ(filter.groundPlane(), plane);
+}
+
+TEST(TestPointCloudFilter, InvalidSetup) {
+  EXPECT_THROW(PointCloudFilter{PointCloudFilter::Setup{-1}}, std::invalid_argument);
+  EXPECT_THROW((PointCloudFilter{PointCloudFilter::Setup{0.2, -0.1}}), std::invalid_argument);
+  EXPECT_THROW((PointCloudFilter{PointCloudFilter::Setup{0.2, 0.1, 64, std::nan("")}}), std::invalid_argument);
+}
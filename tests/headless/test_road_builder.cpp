@@ -0,0 +1,138 @@
+/**
+ * @file test_road_builder.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test building roads from a declarative description on the headless backend
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/prescan.h"
+
+using symaware::Environment;
+using symaware::RoadBuilder;
+
+namespace {
+
+constexpr char description[] = R"({
+  "roads": [
+    {
+      "position": [10, 5, 0],
+      "traffic_side": "left",
+      "sections": [
+        {"type": "straight", "length": 100},
+        {"type": "arc", "length": 50, "curvature": 0.01},
+        {"type": "spiral", "length": 20, "start_curvature": 0.01, "end_curvature": 0},
+        {"length": 30, "type": "poly3", "c": 0.001},
+        {"type": "param_poly3", "length": 30, "u": [0, 30, 0, 0], "v": [0, 0, -3, 2], "normalized": true}
+      ],
+      "lanes": [
+        {"side": "left", "width": 3.5},
+        {"side": "right", "width": 3, "type": "sidewalk"},
+        {"side": "right", "width": 3, "start": 10, "end": null}
+      ],
+      "speed_limits": [{"value": 13.9}, {"value": 8.3, "start": 100, "end": 150}],
+      "parking_spaces": [{"length": 5, "width": 2.5, "side": "right", "offset": 10}]
+    },
+    {"sections": [{"type": "straight", "length": 40}]}
+  ]
+})";
+
+void expectRoads(const RoadBuilder& builder) {
+  ASSERT_EQ(builder.roads().size(), 2u);
+  const symaware::Road& road = builder.roads()[0];
+  EXPECT_DOUBLE_EQ(road.length(), 230);
+  EXPECT_DOUBLE_EQ(road.referenceLine().length(), 230);
+  const symaware::ReferenceLine::Point start = road.referenceLine().point(0);
+  EXPECT_DOUBLE_EQ(start.x, 10);
+  EXPECT_DOUBLE_EQ(start.y, 5);
+  // Only the lanes spanning the whole road are mirrored
+  EXPECT_EQ(road.left_lane_widths(), std::vector<double>{3.5});
+  EXPECT_EQ(road.right_lane_widths(), std::vector<double>{3});
+  EXPECT_DOUBLE_EQ(builder.roads()[1].length(), 40);
+}
+
+}  // namespace
+
+TEST(TestRoadBuilder, Json) {
+  Environment environment;
+  RoadBuilder builder{environment};
+  std::istringstream is{description};
+  const RoadBuilder::Report report = builder.buildJson(is);
+  EXPECT_EQ(report.roads, 2u);
+  EXPECT_EQ(report.sections, 6u);
+  EXPECT_EQ(report.lanes, 3u);
+  EXPECT_EQ(report.speed_limits, 2u);
+  EXPECT_EQ(report.parking_spaces, 1u);
+  EXPECT_GE(report.build_time, 0);
+  expectRoads(builder);
+}
+
+TEST(TestRoadBuilder, Binary) {
+  std::istringstream json{description};
+  std::stringstream binary;
+  RoadBuilder::jsonToBinary(json, binary);
+
+  Environment environment;
+  RoadBuilder builder{environment};
+  const RoadBuilder::Report report = builder.buildBinary(binary);
+  EXPECT_EQ(report.roads, 2u);
+  EXPECT_EQ(report.sections, 6u);
+  EXPECT_EQ(report.lanes, 3u);
+  EXPECT_EQ(report.speed_limits, 2u);
+  EXPECT_EQ(report.parking_spaces, 1u);
+  expectRoads(builder);
+}
+
+TEST(TestRoadBuilder, Accumulate) {
+  Environment environment;
+  RoadBuilder builder{environment};
+  std::istringstream first{R"({"roads": [{}]})"}, second{R"({"roads": [{}, {}]})"};
+  EXPECT_EQ(builder.buildJson(first).roads, 1u);
+  EXPECT_EQ(builder.buildJson(second).roads, 2u);
+  EXPECT_EQ(builder.roads().size(), 3u);
+}
+
+TEST(TestRoadBuilder, InvalidJson) {
+  Environment environment;
+  RoadBuilder builder{environment};
+  for (const char* const content : {
+           R"({"roads": [{"sections": [{"type": "arc", "length": 10}]}]})",
+           R"({"roads": [{"sections": [{"type": "clothoid", "length": 10}]}]})",
+           R"({"roads": [{"lanes": [{"side": "centre", "width": 3}]}]})",
+           R"({"roads": [{"lanes": [{"side": "left"}]}]})",
+           R"({"roads": [{"unknown": 1}]})",
+           R"({"roads": [1]})",
+           R"({"roads": [{"position": [1, 2]}]})",
+       }) {
+    std::istringstream is{content};
+    EXPECT_THROW(builder.buildJson(is), std::runtime_error) << content;
+  }
+}
+
+TEST(TestRoadBuilder, InvalidBinary) {
+  Environment environment;
+  RoadBuilder builder{environment};
+  for (const std::string& content : {
+           std::string{"SYMX\x01\x00\x00\x00", 8},
+           std::string{"SYMR\x02\x00\x00\x00", 8},
+           std::string{"SYMR\x01\x00\x00\x00\x10", 9},
+           std::string{"SYMR\x01\x00\x00\x00\x01\x7f", 10},
+           std::string{"SYMR\x01\x00\x00\x00\x01\x03\x05", 11},
+       }) {
+    std::istringstream is{content};
+    EXPECT_THROW(builder.buildBinary(is), std::runtime_error);
+  }
+}
+
+TEST(TestRoadBuilder, MissingFile) {
+  Environment environment;
+  RoadBuilder builder{environment};
+  EXPECT_THROW(builder.buildJsonFile("missing.json"), std::runtime_error);
+  EXPECT_THROW(builder.buildBinaryFile("missing.bin"), std::runtime_error);
+}
@@ -0,0 +1,191 @@
+/**
+ * @file test_sensor_fusion.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the fusion of the detections of multiple sensors
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "symaware/prescan/sensor_fusion.h"
+
+using symaware::SensorFusion;
+
+namespace {
+/** Positions of the objects detected in a step, stored as separate arrays */
+struct Positions {
+  void add(const std::int32_t id, const double px, const double py) {
+    ids.push_back(id);
+    x.push_back(px);
+    y.push_back(py);
+  }
+  void update(SensorFusion& fusion) const { fusion.updatePositions(ids.data(), x.data(), y.data(), ids.size()); }
+  std::vector<std::int32_t> ids;
+  std::vector<double> x, y;
+};
+/** Bearings of the objects detected in a step from the same origin, stored as separate arrays */
+struct Bearings {
+  void add(const std::int32_t id, const double angle) {
+    ids.push_back(id);
+    bearing.push_back(angle);
+  }
+  void update(SensorFusion& fusion, const double ox = 0, const double oy = 0) const {
+    fusion.updateBearings(symaware::Position{ox, oy, 0}, ids.data(), bearing.data(), ids.size());
+  }
+  std::vector<std::int32_t> ids;
+  std::vector<double> bearing;
+};
+}  // namespace
+
+TEST(TestSensorFusion, Empty) {
+  SensorFusion fusion{};
+  EXPECT_EQ(fusion.size(), 0u);
+  EXPECT_EQ(fusion.step(), -1);
+  EXPECT_EQ(fusion.find(1), -1);
+  fusion.predict(0.1);
+  Positions{}.update(fusion);
+  Bearings{}.update(fusion);
+  EXPECT_EQ(fusion.size(), 0u);
+  EXPECT_EQ(fusion.step(), 0);
+}
+
+TEST(TestSensorFusion, InvalidSetup) {
+  EXPECT_THROW(SensorFusion{SensorFusion::Setup{0}}, std::invalid_argument);
+  EXPECT_THROW(SensorFusion(SensorFusion::Setup(0.5, -1)), std::invalid_argument);
+  EXPECT_THROW(SensorFusion(SensorFusion::Setup(0.5, 0.01, 2, 10, NAN)), std::invalid_argument);
+}
+
+TEST(TestSensorFusion, NewTracks) {
+  SensorFusion fusion{};
+  Positions positions;
+  positions.add(7, 1, 2);
+  positions.add(-1, -1, -2);
+  fusion.predict(0.1);
+  positions.update(fusion);
+  ASSERT_EQ(fusion.size(), 2u);
+  const std::ptrdiff_t row = fusion.find(7);
+  ASSERT_GE(row, 0);
+  const SensorFusion::Track& track = fusion.tracks()[row];
+  EXPECT_EQ(track.id, 7);
+  EXPECT_EQ(track.last_seen, 0);
+  EXPECT_EQ(track.sources, SensorFusion::POSITION);
+  EXPECT_DOUBLE_EQ(track.state[0], 1);
+  EXPECT_DOUBLE_EQ(track.state[1], 2);
+  EXPECT_DOUBLE_EQ(track.state[2], 0);
+  EXPECT_DOUBLE_EQ(track.covariance[0], 0.25);
+  EXPECT_DOUBLE_EQ(track.covariance[10], 100);
+  // Tracks without an id can not be found
+  EXPECT_EQ(fusion.tracks()[1 - row].id, -1);
+}
+
+TEST(TestSensorFusion, ConstantVelocity) {
+  SensorFusion fusion{};
+  for (int i = 0; i < 40; ++i) {
+    Positions positions;
+    positions.add(1, 2.0 * i * 0.1, -1.0 * i * 0.1);
+    fusion.predict(0.1);
+    positions.update(fusion);
+  }
+  ASSERT_EQ(fusion.size(), 1u);
+  const SensorFusion::Track& track = fusion.tracks()[0];
+  EXPECT_NEAR(track.state[0], 7.8, 0.05);
+  EXPECT_NEAR(track.state[1], -3.9, 0.05);
+  EXPECT_NEAR(track.state[2], 2, 0.1);
+  EXPECT_NEAR(track.state[3], -1, 0.1);
+  // The filter is more certain of the position than a single measurement
+  EXPECT_LT(track.covariance[0], 0.25);
+  EXPECT_NEAR(track.covariance[1], track.covariance[4], 1e-12);
+}
+
+TEST(TestSensorFusion, GatedAssociation) {
+  SensorFusion fusion{};
+  Positions first, second;
+  first.add(-1, 0, 0);
+  first.add(-1, 10, 0);
+  // Both are closer to the first track, which only takes the closest one
+  second.add(-1, 0.5, 0);
+  second.add(-1, 0.2, 0);
+  second.add(-1, 10.3, 0);
+  fusion.predict(0.1);
+  first.update(fusion);
+  fusion.predict(0.1);
+  second.update(fusion);
+  ASSERT_EQ(fusion.size(), 3u);
+  EXPECT_LT(fusion.tracks()[0].state[0], 0.2);
+  EXPECT_GT(fusion.tracks()[0].state[0], 0);
+  EXPECT_GT(fusion.tracks()[1].state[0], 10);
+  EXPECT_LT(fusion.tracks()[1].state[0], 10.3);
+  EXPECT_EQ(fusion.tracks()[1].last_seen, 1);
+  // The detection left out of the gates starts a new track
+  EXPECT_DOUBLE_EQ(fusion.tracks()[2].state[0], 0.5);
+}
+
+TEST(TestSensorFusion, Bearings) {
+  SensorFusion fusion{};
+  Positions positions;
+  positions.add(1, 10, 0);
+  positions.add(-1, 0, 10);
+  fusion.predict(0.1);
+  positions.update(fusion);
+  fusion.predict(0.1);
+
+  Bearings bearings;
+  bearings.add(1, std::atan2(1, 10));
+  bearings.add(2, 0);
+  bearings.add(-1, std::atan2(10, 1));
+  bearings.update(fusion);
+  ASSERT_EQ(fusion.size(), 2u);
+  const SensorFusion::Track& with_id = fusion.tracks()[0];
+  const SensorFusion::Track& without_id = fusion.tracks()[1];
+  // The bearing moves the track across the line of sight, but not along it
+  EXPECT_GT(with_id.state[1], 0.5);
+  EXPECT_LT(with_id.state[1], 1);
+  EXPECT_NEAR(with_id.state[0], 10, 1e-9);
+  EXPECT_EQ(with_id.sources, SensorFusion::BEARING);
+  EXPECT_GT(without_id.state[0], 0.5);
+  EXPECT_EQ(without_id.sources, SensorFusion::BEARING);
+  // Bearings of objects not tracked do not start a track
+  EXPECT_EQ(fusion.find(2), -1);
+
+  // Seen from the other side, the bearing is wrapped around
+  fusion.predict(0.1);
+  Bearings behind;
+  behind.add(1, 3.1);
+  behind.update(fusion, 20, 1);
+  EXPECT_EQ(fusion.tracks()[0].sources, SensorFusion::BEARING);
+  EXPECT_NEAR(fusion.tracks()[0].state[0], 10, 0.5);
+  EXPECT_LT(std::abs(fusion.tracks()[0].state[1]), 2);
+  EXPECT_EQ(fusion.tracks()[1].sources, 0u);
+}
+
+TEST(TestSensorFusion, ExpireTracks) {
+  SensorFusion fusion{SensorFusion::Setup{0.5, 0.01, 2, 10, 9.21, 6.63, 2}};
+  Positions both, one;
+  both.add(1, 0, 0);
+  both.add(2, 5, 5);
+  one.add(2, 5, 5);
+  fusion.predict(0.1);
+  both.update(fusion);
+  for (int i = 0; i < 2; ++i) {
+    fusion.predict(0.1);
+    one.update(fusion);
+  }
+  EXPECT_EQ(fusion.size(), 2u);
+  fusion.predict(0.1);
+  // The last track takes the row of the removed one
+  ASSERT_EQ(fusion.size(), 1u);
+  EXPECT_EQ(fusion.find(1), -1);
+  EXPECT_EQ(fusion.find(2), 0);
+  EXPECT_EQ(fusion.tracks()[0].id, 2);
+
+  fusion.clear();
+  EXPECT_EQ(fusion.size(), 0u);
+  EXPECT_EQ(fusion.step(), -1);
+  EXPECT_EQ(fusion.find(2), -1);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_sensor_noise.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the corruption of the detections of a sensor
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "symaware/prescan/sensor_noise.h"
+
+using symaware::SensorNoise;
+
+namespace {
+/** @return @p size rows of two values, the index of the row and its opposite */
+std::vector<double> rows(const std::size_t size) {
+  std::vector<double> values(2 * size);
+  for (std::size_t i = 0; i < size; ++i) {
+    values[2 * i] = static_cast<double>(i);
+    values[2 * i + 1] = -static_cast<double>(i);
+  }
+  return values;
+}
+/** @return the @p values corrupted by a new step of the @p noise */
+std::vector<double> step(SensorNoise& noise, std::vector<double> values) {
+  noise.beginStep();
+  values.resize(noise.corrupt(values.data(), values.size() / noise.width()) * noise.width());
+  noise.addFalsePositives(values);
+  noise.delay(values);
+  return values;
+}
+/** Mean and standard deviation of the differences between the @p actual and the @p expected values */
+void errorStatistics(const std::vector<double>& actual, const std::vector<double>& expected, double& mean,
+                     double& std) {
+  mean = 0;
+  double square = 0;
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    const double error = actual[i] - expected[i];
+    mean += error;
+    square += error * error;
+  }
+  mean /= static_cast<double>(actual.size());
+  std = std::sqrt(square / static_cast<double>(actual.size()) - mean * mean);
+}
+}  // namespace
+
+TEST(TestSensorNoise, Disabled) {
+  SensorNoise noise{SensorNoise::Setup{}, 2};
+  EXPECT_EQ(noise.step(), -1);
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(step(noise, rows(10)), rows(10));
+  EXPECT_EQ(noise.step(), 2);
+  noise.reset(4);
+  EXPECT_EQ(noise.episode(), 4u);
+  EXPECT_EQ(noise.step(), -1);
+}
+
+TEST(TestSensorNoise, InvalidSetup) {
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({0.1}), 2), std::invalid_argument);
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({0.1, -0.1}), 2), std::invalid_argument);
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({}, SensorNoise::Distribution::GAUSSIAN, {NAN, 1}), 2),
+               std::invalid_argument);
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({}, SensorNoise::Distribution::GAUSSIAN, {}, 1.5), 2),
+               std::invalid_argument);
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({}, SensorNoise::Distribution::GAUSSIAN, {}, 0, -1), 2),
+               std::invalid_argument);
+  // False detections need the bounds of their values
+  EXPECT_THROW(SensorNoise(SensorNoise::Setup({}, SensorNoise::Distribution::GAUSSIAN, {}, 0, 1, {0, 0}), 2),
+               std::invalid_argument);
+}
+
+TEST(TestSensorNoise, Reproducible) {
+  const SensorNoise::Setup setup{{0.5, 0.1}, SensorNoise::Distribution::GAUSSIAN, {}, 0.2, 1, {0, 0}, {1, 1}};
+  SensorNoise first{setup, 2}, second{setup, 2};
+  first.reset(3);
+  second.reset(3);
+  const std::vector<double> one = step(first, rows(100));
+  EXPECT_EQ(one, step(second, rows(100)));
+  // Each step and each episode draws new numbers
+  EXPECT_NE(one, step(first, rows(100)));
+  first.reset(4);
+  EXPECT_NE(one, step(first, rows(100)));
+  // Starting the episode again gives the same numbers, regardless of the previous steps
+  first.reset(3);
+  EXPECT_EQ(one, step(first, rows(100)));
+
+  // Corrupting the rows in batches gives the same result as all at once, even if a batch starts within a pair
+  const SensorNoise::Setup noise_only{{0.5, 0.1, 1}};
+  SensorNoise whole{noise_only, 3}, split{noise_only, 3};
+  whole.beginStep();
+  split.beginStep();
+  std::vector<double> all(300, 1), batches(300, 1);
+  whole.corrupt(all.data(), 100);
+  split.corrupt(batches.data(), 11);
+  split.corrupt(batches.data() + 33, 89, 11);
+  EXPECT_EQ(all, batches);
+}
+
+TEST(TestSensorNoise, Gaussian) {
+  SensorNoise noise{SensorNoise::Setup{{0.5, 0}}, 2};
+  const std::vector<double> exact = rows(20000);
+  const std::vector<double> noisy = step(noise, exact);
+  std::vector<double> actual, expected;
+  for (std::size_t i = 0; i < exact.size(); i += 2) {
+    actual.push_back(noisy[i]);
+    expected.push_back(exact[i]);
+    // A scale of 0 leaves the column unchanged
+    EXPECT_EQ(noisy[i + 1], exact[i + 1]);
+  }
+  double mean, std;
+  errorStatistics(actual, expected, mean, std);
+  EXPECT_NEAR(mean, 0, 0.02);
+  EXPECT_NEAR(std, 0.5, 0.02);
+}
+
+TEST(TestSensorNoise, Laplace) {
+  SensorNoise noise{SensorNoise::Setup{{0.5, 0.5}, SensorNoise::Distribution::LAPLACE}, 2};
+  const std::vector<double> exact = rows(20000);
+  double mean, std;
+  errorStatistics(step(noise, exact), exact, mean, std);
+  EXPECT_NEAR(mean, 0, 0.02);
+  EXPECT_NEAR(std, 0.5 * std::sqrt(2), 0.03);
+}
+
+TEST(TestSensorNoise, Quantisation) {
+  SensorNoise noise{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {0.25, 0}}, 2};
+  std::vector<double> values{0.1, 0.1, 0.2, 0.2, -0.4, -0.4};
+  EXPECT_EQ(step(noise, values), (std::vector<double>{0, 0.1, 0.25, 0.2, -0.5, -0.4}));
+}
+
+TEST(TestSensorNoise, Dropout) {
+  SensorNoise noise{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {}, 0.3}, 2};
+  const std::vector<double> kept = step(noise, rows(10000));
+  ASSERT_EQ(kept.size() % 2, 0u);
+  EXPECT_NEAR(static_cast<double>(kept.size() / 2), 7000, 200);
+  // The kept rows are whole and in the same order
+  for (std::size_t i = 0; i < kept.size(); i += 2) {
+    EXPECT_EQ(kept[i + 1], -kept[i]);
+    if (i > 0) {
+      EXPECT_GT(kept[i], kept[i - 2]);
+    }
+  }
+  SensorNoise all{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {}, 1}, 2};
+  EXPECT_TRUE(step(all, rows(100)).empty());
+}
+
+TEST(TestSensorNoise, FalsePositives) {
+  SensorNoise noise{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {}, 0, 2.5, {1, -3}, {2, -1}}, 2};
+  std::size_t count = 0;
+  constexpr int steps = 2000;
+  for (int i = 0; i < steps; ++i) {
+    const std::vector<double> values = step(noise, rows(1));
+    ASSERT_EQ(values.size() % 2, 0u);
+    // The true detection comes first
+    EXPECT_EQ(values[0], 0);
+    for (std::size_t j = 2; j < values.size(); j += 2) {
+      EXPECT_GE(values[j], 1);
+      EXPECT_LE(values[j], 2);
+      EXPECT_GE(values[j + 1], -3);
+      EXPECT_LE(values[j + 1], -1);
+    }
+    count += values.size() / 2 - 1;
+  }
+  EXPECT_NEAR(static_cast<double>(count) / steps, 2.5, 0.1);
+}
+
+TEST(TestSensorNoise, Latency) {
+  SensorNoise noise{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {}, 0, 0, {}, {}, 2}, 2};
+  std::vector<double> before_step = rows(1);
+  EXPECT_THROW(noise.delay(before_step), std::runtime_error);
+  EXPECT_TRUE(step(noise, rows(1)).empty());
+  EXPECT_TRUE(step(noise, rows(2)).empty());
+  EXPECT_EQ(step(noise, rows(3)), rows(1));
+  EXPECT_EQ(step(noise, rows(4)), rows(2));
+  // A new episode forgets the previous detections
+  noise.reset(1);
+  EXPECT_TRUE(step(noise, rows(5)).empty());
+}
+
+TEST(TestSensorNoise, LatencyJitter) {
+  SensorNoise noise{SensorNoise::Setup{{}, SensorNoise::Distribution::GAUSSIAN, {}, 0, 0, {}, {}, 1, 2}, 2};
+  std::vector<std::size_t> delays(3, 0);
+  for (std::size_t i = 0; i < 300; ++i) {
+    const std::vector<double> values = step(noise, rows(i + 1));
+    if (i < 3) continue;
+    // The number of rows tells the step they come from
+    const std::size_t delay = i + 1 - values.size() / 2;
+    ASSERT_GE(delay, 1u);
+    ASSERT_LE(delay, 3u);
+    ++delays[delay - 1];
+  }
+  for (const std::size_t count : delays) EXPECT_GT(count, 60u);
+}
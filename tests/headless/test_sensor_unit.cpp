@@ -0,0 +1,163 @@
+/**
+ * @file test_sensor_unit.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the ground truth sensors of the headless backend
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <prescan/api/Air.hpp>
+#include <prescan/api/Brs.hpp>
+#include <prescan/api/Experiment.hpp>
+#include <prescan/api/Lms.hpp>
+#include <prescan/sim/AirSensorUnit.hpp>
+#include <prescan/sim/BrsSensorUnit.hpp>
+#include <prescan/sim/LmsSensorUnit.hpp>
+
+using prescan::api::experiment::Experiment;
+using prescan::api::types::WorldObject;
+
+namespace {
+constexpr double pi = 3.14159265358979323846;
+}  // namespace
+
+class TestSensorUnit : public ::testing::Test {
+ protected:
+  TestSensorUnit() : experiment_{prescan::api::experiment::createExperiment()}, ego_{experiment_.createObject("Car")} {}
+
+  WorldObject addObject(const double x, const double y, const double yaw = 0) {
+    WorldObject object = experiment_.createObject("Car");
+    object.pose().position().setXYZ(x, y, 0);
+    object.pose().orientation().setYaw(yaw);
+    return object;
+  }
+
+  Experiment experiment_;
+  WorldObject ego_;
+};
+
+TEST_F(TestSensorUnit, AirDetectsObjectsInRangeAndFov) {
+  prescan::api::air::AirSensor sensor = prescan::api::air::createAirSensor(ego_);
+  sensor.pose().position().setZ(0.75);  // At the height of the centre of the bounding boxes
+  const WorldObject far = addObject(20, 0, 0.5);
+  const WorldObject near = addObject(10, 5);
+  addObject(-10, 0);                  // Behind the sensor
+  addObject(200, 0);                  // Out of range
+  addObject(10, 10);                  // Out of the field of view
+  addObject(5, 0).setSensorDetectability(prescan::api::types::SensorDetectabilityInvisible);
+
+  prescan::sim::AirSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.airSensorOutput().size(), 2u);
+  const prescan::sim::AirSensorDetection& first = *unit.airSensorOutput()[0];
+  EXPECT_EQ(first.ID, near.data().id);
+  EXPECT_DOUBLE_EQ(first.Range, std::hypot(10, 5));
+  EXPECT_DOUBLE_EQ(first.Azimuth, std::atan2(5, 10));
+  EXPECT_DOUBLE_EQ(first.Elevation, 0);
+  const prescan::sim::AirSensorDetection& second = *unit.airSensorOutput()[1];
+  EXPECT_EQ(second.ID, far.data().id);
+  EXPECT_DOUBLE_EQ(second.Range, 20);
+  EXPECT_DOUBLE_EQ(second.Azimuth, 0);
+  EXPECT_DOUBLE_EQ(second.Heading, 0.5);
+}
+
+TEST_F(TestSensorUnit, AirMaxDetectableObjects) {
+  prescan::api::air::AirSensor sensor = prescan::api::air::createAirSensor(ego_);
+  sensor.setMaxDetectableObjects(3);
+  for (int i = 10; i > 0; i--) addObject(10.0 * i, 0);
+
+  prescan::sim::AirSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.airSensorOutput().size(), 3u);
+  for (int i = 0; i < 3; i++) EXPECT_NEAR(unit.airSensorOutput()[i]->Range, 10.0 * (i + 1), 0.1);
+}
+
+TEST_F(TestSensorUnit, AirClosestPointAndVelocity) {
+  prescan::api::air::AirSensor sensor = prescan::api::air::createAirSensor(ego_);
+  sensor.setDetectionType(prescan::api::types::DetectionTypeClosestPointOfBoundingBox);
+  const WorldObject target = addObject(20, 0);
+  target.data().velocity.setX(-5);
+  ego_.data().velocity.setX(5);
+
+  prescan::sim::AirSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.airSensorOutput().size(), 1u);
+  EXPECT_DOUBLE_EQ(unit.airSensorOutput()[0]->Range, 20 - target.data().bounding_box.x() / 2);
+  EXPECT_DOUBLE_EQ(unit.airSensorOutput()[0]->Velocity, -10);
+}
+
+TEST_F(TestSensorUnit, AirFollowsMountingPose) {
+  prescan::api::air::AirSensor sensor = prescan::api::air::createAirSensor(ego_);
+  sensor.pose().position().setXYZ(2, 0, 0.75);
+  sensor.pose().orientation().setYaw(pi / 2);  // Looking left
+  ego_.pose().orientation().setYaw(pi / 2);    // The ego vehicle faces +y, so the sensor in (0, 2) faces -x
+  addObject(-10, 2);
+  addObject(0, 10);
+
+  prescan::sim::AirSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.airSensorOutput().size(), 1u);
+  EXPECT_NEAR(unit.airSensorOutput()[0]->Range, 10, 1e-9);
+  EXPECT_NEAR(unit.airSensorOutput()[0]->Azimuth, 0, 1e-9);
+}
+
+TEST_F(TestSensorUnit, BrsProjectsBoundingBoxes) {
+  prescan::api::brs::BrsSensor sensor = prescan::api::brs::createBrsSensor(ego_);
+  sensor.setResolutionX(640);
+  sensor.setResolutionY(480);
+  sensor.pose().position().setZ(0.75);
+  const WorldObject ahead = addObject(20, 0);
+  addObject(40, 0);
+  addObject(-20, 0);
+
+  prescan::sim::BrsSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.brsSensorOutput().size(), 2u);
+  const prescan::sim::BrsSensorDetection& detection = *unit.brsSensorOutput()[0];
+  EXPECT_EQ(detection.ObjectID, ahead.data().id);
+  // The box is centred in the image and the closest face is the widest one
+  const double focal = 1 / std::tan(sensor.data().fov_horizontal / 2);
+  const double half_width = 320 * focal * 0.9 / (20 - 2.25);
+  EXPECT_NEAR(detection.Left, 320 - half_width, 1e-9);
+  EXPECT_NEAR(detection.Right, 320 + half_width, 1e-9);
+  EXPECT_NEAR(detection.Bottom + detection.Top, 480, 1e-9);
+  EXPECT_LT(unit.brsSensorOutput()[1]->Right - unit.brsSensorOutput()[1]->Left, detection.Right - detection.Left);
+}
+
+TEST_F(TestSensorUnit, BrsClipsToImage) {
+  prescan::api::brs::BrsSensor sensor = prescan::api::brs::createBrsSensor(ego_);
+  addObject(5, 3);
+
+  prescan::sim::BrsSensorUnit unit{sensor};
+  unit.initialize(nullptr);
+
+  ASSERT_EQ(unit.brsSensorOutput().size(), 1u);
+  EXPECT_DOUBLE_EQ(unit.brsSensorOutput()[0]->Left, 0);
+  EXPECT_GT(unit.brsSensorOutput()[0]->Right, 0);
+}
+
+TEST_F(TestSensorUnit, LmsStraightLines) {
+  prescan::api::lms::LmsSensor sensor = prescan::api::lms::createLmsSensor(ego_);
+  sensor.setMaxLines(2);
+  sensor.setMaxPointsPerLine(100);
+  sensor.setPointSpacing(1);
+  sensor.setRange(10);
+  sensor.pose().position().setZ(1);
+
+  const prescan::sim::LmsSensorUnit unit{sensor, ""};
+
+  ASSERT_EQ(unit.linesOutput().size(), 2u);
+  ASSERT_EQ(unit.linesOutput()[0].size(), 10u);
+  EXPECT_DOUBLE_EQ(unit.linesOutput()[0][0].X, 1);
+  EXPECT_DOUBLE_EQ(unit.linesOutput()[0][0].Y, 1.75);
+  EXPECT_DOUBLE_EQ(unit.linesOutput()[0][0].Z, -1);
+  EXPECT_DOUBLE_EQ(unit.linesOutput()[1][9].X, 10);
+  EXPECT_DOUBLE_EQ(unit.linesOutput()[1][9].Y, -1.75);
+}
@@ -0,0 +1,670 @@
+/**
+ * @file test_simulation.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the symaware simulation running on the headless backend
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/prescan.h"
+
+using symaware::AmesimDynamicalModel;
+using symaware::CustomDynamicalModel;
+using symaware::Entity;
+using symaware::Environment;
+using symaware::Gear;
+using symaware::ObjectType;
+using symaware::Sensor;
+using symaware::SensorType;
+using symaware::Simulation;
+
+namespace {
+Entity::Setup setupAt(const double x, const double y, const double yaw = 0) {
+  return Entity::Setup{symaware::Position{x, y, 0},
+                       symaware::Orientation{0, 0, yaw},
+                       symaware::Position{0, 0, 0},
+                       true,
+                       true,
+                       prescan::api::types::SensorDetectability::SensorDetectabilityDetectable};
+}
+
+/** Column names and number of rows of an Arrow IPC stream */
+struct ArrowTable {
+  std::vector<std::string> names;
+  std::int64_t rows = 0;
+};
+/** Read the schema and the length of the record batches of the Arrow IPC stream in @p filename */
+ArrowTable readArrowStream(const std::string& filename) {
+  std::ifstream file{filename, std::ios::binary};
+  const std::vector<char> data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  const auto read = [&data](const std::size_t pos, auto value) {
+    std::memcpy(&value, data.data() + pos, sizeof(value));
+    return value;
+  };
+  const auto deref = [&read](const std::size_t pos) { return pos + read(pos, std::uint32_t{}); };
+  // Position of the field @p index of the flatbuffer table at @p table, 0 if it has the default value
+  const auto field = [&read](const std::size_t table, const int index) -> std::size_t {
+    const std::size_t vtable = table - read(table, std::int32_t{});
+    if (4u + 2u * index >= read(vtable, std::uint16_t{})) return 0;
+    const std::uint16_t offset = read(vtable + 4 + 2 * index, std::uint16_t{});
+    return offset == 0 ? 0 : table + offset;
+  };
+  const auto integer = [&read, &field](const std::size_t table, const int index) {
+    const std::size_t pos = field(table, index);
+    return pos == 0 ? std::int64_t{0} : read(pos, std::int64_t{});
+  };
+
+  ArrowTable table;
+  std::size_t pos = 0;
+  while (pos + 8 <= data.size()) {
+    const auto metadata_size = static_cast<std::size_t>(read(pos + 4, std::int32_t{}));
+    pos += 8;
+    if (metadata_size == 0) break;
+    // Message: version, header type, header, body length
+    const std::size_t message = deref(pos);
+    const auto header_type = read(field(message, 1), std::uint8_t{});
+    const std::size_t header = deref(field(message, 2));
+    if (header_type == 1) {
+      const std::size_t fields = deref(field(header, 1));
+      for (std::uint32_t i = 0; i < read(fields, std::uint32_t{}); ++i) {
+        const std::size_t name = deref(field(deref(fields + 4 + 4 * i), 0));
+        table.names.emplace_back(data.data() + name + 4, read(name, std::uint32_t{}));
+      }
+    } else {
+      table.rows += integer(header, 0);
+    }
+    pos += metadata_size + static_cast<std::size_t>(integer(message, 3));
+  }
+  return table;
+}
+}  // namespace
+
+TEST(TestSimulation, EpisodesOnHeadlessBackend) {
+  for (int episode = 0; episode < 3; episode++) {
+    Environment environment;
+    AmesimDynamicalModel ego_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+    CustomDynamicalModel target_model{};
+    Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0), ego_model};
+    Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 0), target_model};
+    Sensor air{SensorType::AIR};
+    ego.addSensor(air);
+    environment.addEntity(ego);
+    environment.addEntity(target);
+
+    Simulation simulation{environment};
+    simulation.initialise();
+    ASSERT_EQ(air.state().size(), 6u);
+    const double initial_range = air.state()[0];
+    for (int i = 0; i < 20; i++) simulation.step();
+
+    EXPECT_GT(ego.state().position.x, 0);
+    EXPECT_GT(ego.state().velocity, 0);
+    EXPECT_DOUBLE_EQ(target.state().position.x, 30);
+    ASSERT_EQ(air.state().size(), 6u);
+    EXPECT_LT(air.state()[0], initial_range);
+    EXPECT_LT(air.state()[4], 0);  // The ego vehicle is approaching the target
+    simulation.terminate();
+  }
+}
+
+TEST(TestSimulation, AddEntities) {
+  Environment environment;
+  std::vector<Entity> entities;
+  entities.reserve(6);
+  for (int i = 0; i < 6; ++i)
+    entities.emplace_back(i % 2 == 0 ? ObjectType::Audi_A8_Sedan : ObjectType::Cone, setupAt(5.0 * i, 1));
+  std::vector<Entity*> pointers;
+  for (Entity& entity : entities) pointers.push_back(&entity);
+  environment.addEntity(entities[0]);
+  environment.addEntities(pointers);
+
+  ASSERT_EQ(environment.entities().size(), 6u);
+  for (int i = 0; i < 6; ++i) {
+    const Entity& entity = entities[static_cast<std::size_t>(i)];
+    ASSERT_TRUE(entity.is_initialised());
+    EXPECT_EQ(environment.entities().at(entity.name()), &entity);
+    EXPECT_DOUBLE_EQ(entity.object().pose().position().x(), 5.0 * i);
+    EXPECT_DOUBLE_EQ(entity.object().pose().position().y(), 1);
+  }
+  // Objects of the same type are created in order
+  EXPECT_EQ(entities[1].name(), "Cone_1");
+  EXPECT_EQ(entities[5].name(), "Cone_3");
+
+  // Repeated entities are only added once
+  Entity repeated{ObjectType::Cone};
+  environment.addEntities({&repeated, &repeated});
+  EXPECT_EQ(repeated.name(), "Cone_4");
+  EXPECT_EQ(environment.entities().size(), 7u);
+
+  Entity existing{ObjectType::Existing};
+  Entity other{ObjectType::Cone};
+  EXPECT_THROW(environment.addEntities({&other, &existing}), std::runtime_error);
+  EXPECT_FALSE(other.is_initialised());
+  EXPECT_EQ(environment.entities().size(), 7u);
+}
+
+TEST(TestSimulation, EntityModelId) {
+  CustomDynamicalModel model{};
+  CustomDynamicalModel other{};
+  EXPECT_GT(model.id(), 0u);
+  EXPECT_NE(model.id(), other.id());
+  // A copy is a different model, while an assignment keeps the identity of the model
+  const CustomDynamicalModel copy{model};
+  EXPECT_NE(copy.id(), model.id());
+  const std::uint64_t id = other.id();
+  other = model;
+  EXPECT_EQ(other.id(), id);
+}
+
+TEST(TestSimulation, EntityPooling) {
+  Environment environment;
+  environment.setPooling(true);
+  AmesimDynamicalModel ego_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0), ego_model};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 0)};
+  Sensor air{SensorType::AIR};
+  ego.addSensor(air);
+
+  const void* ego_handle = nullptr;
+  const void* target_handle = nullptr;
+  for (int episode = 0; episode < 3; episode++) {
+    environment.addEntities({&ego, &target});
+    ego.applySetup(setupAt(0, episode));
+    ASSERT_EQ(environment.pooledCount(), 0u);
+    if (episode > 0) {
+      // The parked objects are reused, each by the entity with the same model
+      EXPECT_EQ(ego.object().handle(), ego_handle);
+      EXPECT_EQ(target.object().handle(), target_handle);
+    }
+    ego_handle = ego.object().handle();
+    target_handle = target.object().handle();
+    EXPECT_DOUBLE_EQ(ego.object().pose().position().y(), episode);
+    EXPECT_DOUBLE_EQ(ego.object().pose().position().z(), 0);
+    EXPECT_TRUE(ego.object().collisionDetectable());
+
+    Simulation simulation{environment};
+    simulation.initialise();
+    ASSERT_EQ(air.state().size(), 6u);
+    for (int i = 0; i < 5; i++) simulation.step();
+    EXPECT_GT(ego.state().velocity, 0);
+    simulation.terminate();
+
+    environment.removeEntity(ego).removeEntity(target.name());
+    EXPECT_FALSE(ego.is_initialised());
+    EXPECT_FALSE(target.is_initialised());
+    ASSERT_EQ(environment.pooledCount(), 2u);
+  }
+
+  // An object parked with a different model is not reused
+  CustomDynamicalModel other_model{};
+  Entity other{ObjectType::Audi_A8_Sedan, setupAt(0, 10), other_model};
+  Entity cone{ObjectType::Cone};
+  environment.addEntity(other).addEntity(cone);
+  EXPECT_EQ(other.object().handle(), target_handle);
+  EXPECT_EQ(environment.pooledCount(), 1u);
+
+  environment.setPooling(false);
+  EXPECT_EQ(environment.pooledCount(), 0u);
+  environment.removeEntity(other);
+  EXPECT_EQ(environment.pooledCount(), 0u);
+  EXPECT_EQ(environment.entities().size(), 1u);
+}
+
+TEST(TestSimulation, Broadphase) {
+  Environment environment;
+  AmesimDynamicalModel ego_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0), ego_model};
+  std::vector<Entity> cones;
+  cones.reserve(4);
+  for (int i = 0; i < 4; ++i) cones.emplace_back(ObjectType::Cone, setupAt(10.0 * (i + 1), 0));
+  environment.addEntity(ego);
+  for (Entity& cone : cones) environment.addEntity(cone);
+
+  symaware::Broadphase broadphase{5};
+  Simulation simulation{environment};
+  simulation.addObserver(broadphase);
+  simulation.initialise();
+  ASSERT_EQ(broadphase.entities().size(), 5u);
+
+  const auto entityAt = [&broadphase](const std::size_t index) { return broadphase.entities().at(index); };
+  const std::vector<std::size_t> in_range = broadphase.queryRadius(0, 0, 25);
+  ASSERT_EQ(in_range.size(), 3u);
+  EXPECT_EQ(entityAt(in_range[0]), &ego);
+  EXPECT_EQ(entityAt(in_range[1]), &cones[0]);
+  EXPECT_EQ(entityAt(in_range[2]), &cones[1]);
+  const std::vector<std::size_t> nearest = broadphase.queryNearest(38, 0, 2);
+  ASSERT_EQ(nearest.size(), 2u);
+  EXPECT_EQ(entityAt(nearest[0]), &cones[3]);
+  EXPECT_EQ(entityAt(nearest[1]), &cones[2]);
+  EXPECT_EQ(broadphase.queryPairs(10).size(), 4u);
+
+  // The index follows the entities as the simulation steps
+  for (int i = 0; i < 20; i++) simulation.step();
+  const std::vector<std::size_t> moved = broadphase.queryNearest(ego.state().position.x, 0, 1);
+  ASSERT_EQ(moved.size(), 1u);
+  EXPECT_EQ(entityAt(moved[0]), &ego);
+  EXPECT_DOUBLE_EQ(broadphase.x()[moved[0]], ego.state().position.x);
+  simulation.terminate();
+}
+
+TEST(TestSimulation, KpiEvaluator) {
+  Environment environment;
+  AmesimDynamicalModel ego_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0), ego_model};
+  Entity first_cone{ObjectType::Cone, setupAt(30, 0)};
+  Entity second_cone{ObjectType::Cone, setupAt(60, 0)};
+  Entity far_cone{ObjectType::Cone, setupAt(0, 500)};
+  environment.addEntity(ego);
+  environment.addEntity(first_cone);
+  environment.addEntity(second_cone);
+  environment.addEntity(far_cone);
+
+  symaware::KpiEvaluator evaluator{symaware::KpiEvaluator::Setup{50, 2, 2, 1, 3.5}};
+  evaluator.addEgo(ego);
+  Simulation simulation{environment};
+  simulation.addObserver(evaluator);
+  simulation.initialise();
+  // The ego drives through both cones on its way
+  while (ego.state().position.x < 70) simulation.step();
+  simulation.terminate();
+
+  const symaware::KpiEvaluator::Summary& summary = evaluator.summary();
+  EXPECT_GT(summary.steps, 0);
+  EXPECT_LT(summary.first_collision, summary.duration);
+  EXPECT_EQ(summary.collisions, 2u);
+  EXPECT_LT(summary.min_distance, 2);
+  EXPECT_DOUBLE_EQ(summary.min_ttc, 0);
+  EXPECT_DOUBLE_EQ(summary.min_headway, 0);
+  EXPECT_LT(summary.first_ttc_violation, summary.first_collision);
+  EXPECT_LT(summary.first_headway_violation, summary.first_collision);
+  EXPECT_LE(summary.min_ttc_time, summary.first_collision);
+  // Without a road network lane departures are not tracked
+  EXPECT_EQ(summary.lane_departures, 0u);
+  EXPECT_TRUE(std::isnan(summary.first_lane_departure));
+  ASSERT_EQ(evaluator.summaries().size(), 1u);
+  EXPECT_EQ(evaluator.summaries()[0].collisions, 2u);
+
+  // A new episode starts from an empty summary
+  simulation.initialise();
+  EXPECT_EQ(evaluator.summary().steps, 0);
+  EXPECT_EQ(evaluator.summary().collisions, 0u);
+  EXPECT_TRUE(std::isnan(evaluator.summary().first_collision));
+  // The first state is evaluated at the end of the first step
+  simulation.step();
+  EXPECT_EQ(evaluator.summary().steps, 1);
+  EXPECT_GT(evaluator.summary().duration, 0);
+  simulation.terminate();
+  ASSERT_EQ(evaluator.summaries().size(), 2u);
+  EXPECT_EQ(evaluator.summaries()[0].collisions, 2u);
+  evaluator.clearSummaries();
+  EXPECT_TRUE(evaluator.summaries().empty());
+  EXPECT_THROW(symaware::KpiEvaluator{symaware::KpiEvaluator::Setup{0}}, std::invalid_argument);
+}
+
+TEST(TestSimulation, TriggerSystem) {
+  using symaware::TriggerSystem;
+  Environment environment;
+  AmesimDynamicalModel ego_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0), ego_model};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 0)};
+  Sensor air{SensorType::AIR};
+  ego.addSensor(air);
+  environment.addEntity(ego);
+  environment.addEntity(target);
+
+  struct Event {
+    std::size_t trigger;
+    bool active;
+    double x;
+    double time;
+  };
+  std::vector<Event> events;
+  const auto record = [&events, &ego](const std::size_t trigger, const bool active, const double time) {
+    events.push_back(Event{trigger, active, ego.state().position.x, time});
+  };
+  TriggerSystem triggers;
+  const std::size_t moving = triggers.addStateTrigger(ego, TriggerSystem::Quantity::VELOCITY,
+                                                      TriggerSystem::Comparison::ABOVE, 1, 0.5, record);
+  const std::size_t stop_line =
+      triggers.addPointDistanceTrigger(ego, 15, 0, TriggerSystem::Comparison::BELOW, 5, 1, record);
+  const std::size_t close = triggers.addDistanceTrigger(ego, target, TriggerSystem::Comparison::BELOW, 10, 0, record);
+  const std::size_t detecting = triggers.addDetectionTrigger(air, TriggerSystem::Comparison::ABOVE, 0.5, 0, record);
+  EXPECT_EQ(triggers.size(), 4u);
+  EXPECT_THROW(triggers.addDistanceTrigger(ego, target, TriggerSystem::Comparison::BELOW, 10, -1, record),
+               std::invalid_argument);
+
+  Simulation simulation{environment};
+  simulation.addObserver(triggers);
+  simulation.initialise();
+  simulation.step();
+  // The target is detected right away, while the ego is still slow
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].trigger, detecting);
+  EXPECT_TRUE(events[0].active);
+  // The triggers are evaluated at the end of the step, like the KPIs
+  EXPECT_GT(events[0].time, 0);
+  EXPECT_TRUE(triggers.active(detecting));
+  EXPECT_FALSE(triggers.active(moving));
+  EXPECT_DOUBLE_EQ(triggers.value(detecting), 1);
+
+  while (ego.state().position.x < 17) simulation.step();
+  EXPECT_TRUE(triggers.active(moving));
+  EXPECT_TRUE(triggers.active(stop_line));
+  EXPECT_FALSE(triggers.active(close));
+  // Each trigger is called back once when it becomes active, not at every step it holds
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(events[1].trigger, moving);
+  EXPECT_EQ(events[2].trigger, stop_line);
+  EXPECT_GT(events[2].x, 10);
+
+  while (ego.state().position.x < 28) simulation.step();
+  EXPECT_TRUE(triggers.active(close));
+  // Leaving the stop line behind deactivates the trigger only past the hysteresis
+  EXPECT_FALSE(triggers.active(stop_line));
+  ASSERT_EQ(events.size(), 5u);
+  const auto left = std::find_if(events.begin(), events.end(), [stop_line](const Event& event) {
+    return event.trigger == stop_line && !event.active;
+  });
+  ASSERT_NE(left, events.end());
+  EXPECT_GT(left->x, 21);
+  simulation.terminate();
+
+  EXPECT_THROW(triggers.active(4), std::out_of_range);
+  triggers.clear();
+  EXPECT_EQ(triggers.size(), 0u);
+}
+
+TEST(TestSimulation, RoadReferenceLine) {
+  Environment environment;
+  symaware::Road road{environment};
+  road.setPosition(symaware::Position{10, 5, 0});
+  road.addStraightSection(20).addCurveSection(10, 0.05).addSpiralSection(10, 0.05, 0);
+  EXPECT_DOUBLE_EQ(road.length(), 40);
+  EXPECT_DOUBLE_EQ(road.referenceLine().length(), road.length());
+  const symaware::ReferenceLine::Point point = road.referenceLine().point(15);
+  EXPECT_DOUBLE_EQ(point.x, 25);
+  EXPECT_DOUBLE_EQ(point.y, 5);
+  EXPECT_NEAR(road.referenceLine().point(40).heading, 0.5 + 0.25, 1e-12);
+
+  // Moving the road moves its reference line along with it
+  road.setPosition(symaware::Position{0, 0, 0});
+  EXPECT_DOUBLE_EQ(road.referenceLine().point(15).x, 15);
+  EXPECT_DOUBLE_EQ(road.referenceLine().point(15).y, 0);
+}
+
+TEST(TestSimulation, ImportMissingOpenDriveNetwork) {
+  Environment environment;
+  EXPECT_THROW(environment.importOpenDriveNetwork("missing.xodr"), std::runtime_error);
+  EXPECT_TRUE(environment.roadNetwork().roads().empty());
+}
+
+TEST(TestSimulation, TrackModelSetupFromRoute) {
+  const symaware::Router::Route route{{0, 1}, {{0, 0, 1}, {2, 0, 1}, {4, 1, 1}}, 4.24, 0};
+  const symaware::TrackModel::Setup setup{false, true, route, 10, 0.1};
+  ASSERT_EQ(setup.path.size(), 3u);
+  EXPECT_DOUBLE_EQ(setup.path[2].x, 4);
+  EXPECT_DOUBLE_EQ(setup.path[2].y, 1);
+  EXPECT_DOUBLE_EQ(setup.path[2].z, 1);
+  EXPECT_DOUBLE_EQ(setup.speed, 10);
+  EXPECT_TRUE(setup.active);
+}
+
+TEST(TestSimulation, ModelInputFromBuffer) {
+  AmesimDynamicalModel model{};
+  const double input[4] = {0.5, 0.1, 0.2, static_cast<double>(Gear::Forward)};
+  model.setInput(input, 4);
+  EXPECT_DOUBLE_EQ(model.input().throttle, 0.5);
+  EXPECT_DOUBLE_EQ(model.input().brake, 0.1);
+  EXPECT_DOUBLE_EQ(model.input().steering_wheel_angle, 0.2);
+  EXPECT_EQ(model.input().gear, Gear::Forward);
+
+  // Only the non-NaN values are updated, both from a buffer and from a vector
+  const double update[4] = {std::nan(""), 0.3, std::nan(""), std::nan("")};
+  model.updateInput(update, 4);
+  EXPECT_DOUBLE_EQ(model.input().throttle, 0.5);
+  EXPECT_DOUBLE_EQ(model.input().brake, 0.3);
+  model.updateInput(std::vector<double>{0.7, std::nan(""), std::nan(""), std::nan("")});
+  EXPECT_DOUBLE_EQ(model.input().throttle, 0.7);
+  EXPECT_DOUBLE_EQ(model.input().brake, 0.3);
+
+  EXPECT_THROW(model.setInput(input, 3), std::runtime_error);
+  EXPECT_THROW(model.updateInput(std::vector<double>(5, 0)), std::runtime_error);
+}
+
+TEST(TestSimulation, LmsPointCloudFilter) {
+  Environment environment;
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(20, -3)};
+  // 4 lines of 100 points, 0.1 m apart, seen by a sensor 1.5 m above the ground
+  const double nan = std::nan("");
+  Sensor lms{SensorType::LMS, {nan, nan, 1.5, nan, nan, nan, nan, 4, 100, 0.1, nan}};
+  lms.setPointCloudFilter(symaware::PointCloudFilter::Setup{1, 0});
+  ego.addSensor(lms);
+  environment.addEntity(ego);
+
+  Simulation simulation{environment};
+  simulation.initialise();
+  simulation.step();
+  const symaware::PointCloudFilter* const filter = lms.pointCloudFilter();
+  ASSERT_NE(filter, nullptr);
+  EXPECT_EQ(filter->inputSize(), 400u);
+  EXPECT_EQ(lms.detectionCount(), 400u);
+  // Each line is reduced to one point per metre
+  EXPECT_GE(filter->size(), 40u);
+  EXPECT_LE(filter->size(), 44u);
+  for (std::size_t i = 0; i < filter->size(); ++i) {
+    EXPECT_GT(filter->points()[3 * i], 20);
+    EXPECT_NEAR(filter->points()[3 * i + 2], 0, 1e-9);
+  }
+  simulation.terminate();
+
+  // All the lane lines are on the ground
+  lms.setPointCloudFilter(symaware::PointCloudFilter::Setup{1, 0.1});
+  Simulation ground_simulation{environment};
+  ground_simulation.initialise();
+  ground_simulation.step();
+  EXPECT_EQ(lms.pointCloudFilter()->size(), 0u);
+  EXPECT_NEAR(lms.pointCloudFilter()->groundPlane()[2], 1, 1e-9);
+  ground_simulation.terminate();
+
+  lms.clearPointCloudFilter();
+  EXPECT_EQ(lms.pointCloudFilter(), nullptr);
+  Sensor air{SensorType::AIR};
+  EXPECT_THROW(air.setPointCloudFilter(symaware::PointCloudFilter::Setup{}), std::runtime_error);
+}
+
+TEST(TestSimulation, AirTrackTable) {
+  Environment environment;
+  AmesimDynamicalModel target_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0, 0.4)};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 10), target_model};
+  Sensor air{SensorType::AIR};
+  air.setTrackTable(symaware::TrackTable::Setup{});
+  ego.addSensor(air);
+  environment.addEntity(ego);
+  environment.addEntity(target);
+
+  Simulation simulation{environment};
+  simulation.initialise();
+  const symaware::TrackTable* const table = air.trackTable();
+  ASSERT_NE(table, nullptr);
+  for (int i = 0; i < 10; i++) simulation.step();
+  const double previous_x = target.state().position.x;
+  simulation.step();
+
+  ASSERT_EQ(table->size(), 1u);
+  EXPECT_EQ(table->lastSeen()[0], table->step());
+  // The sensor detects the centre of the bounding box of the target
+  EXPECT_NEAR(table->x()[0], target.state().position.x, 1e-9);
+  EXPECT_NEAR(table->y()[0], target.state().position.y, 1e-9);
+  EXPECT_NEAR(table->heading()[0], target.state().orientation.yaw, 1e-9);
+  EXPECT_NEAR(table->vx()[0], (target.state().position.x - previous_x) / 0.05, 1e-6);
+  EXPECT_GT(table->vx()[0], 0);
+  simulation.terminate();
+
+  air.clearTrackTable();
+  EXPECT_EQ(air.trackTable(), nullptr);
+  Sensor lms{SensorType::LMS};
+  EXPECT_THROW(lms.setTrackTable(symaware::TrackTable::Setup{}), std::runtime_error);
+}
+
+TEST(TestSimulation, EntitySensorFusion) {
+  Environment environment;
+  AmesimDynamicalModel target_model{AmesimDynamicalModel::Input{1, 0, 0, Gear::Forward}};
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0, 0.4)};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 10), target_model};
+  Sensor air{SensorType::AIR};
+  Sensor brs{SensorType::BRS};
+  ego.addSensor(air);
+  ego.addSensor(brs);
+  // The detections are exact and the target accelerates, so the measurements are trusted over the model
+  ego.setSensorFusion(symaware::SensorFusion::Setup{0.05, 0.01, 10});
+  environment.addEntity(ego);
+  environment.addEntity(target);
+
+  Simulation simulation{environment};
+  simulation.initialise();
+  const symaware::SensorFusion* const fusion = ego.sensorFusion();
+  ASSERT_NE(fusion, nullptr);
+  for (int i = 0; i < 20; i++) simulation.step();
+
+  ASSERT_EQ(fusion->size(), 1u);
+  const symaware::SensorFusion::Track& track = fusion->tracks()[0];
+  EXPECT_EQ(fusion->find(track.id), 0);
+  EXPECT_EQ(track.last_seen, fusion->step());
+  EXPECT_EQ(track.sources, symaware::SensorFusion::POSITION | symaware::SensorFusion::BEARING);
+  EXPECT_NEAR(track.state[0], target.state().position.x, 0.1);
+  EXPECT_NEAR(track.state[1], target.state().position.y, 0.1);
+  EXPECT_NEAR(track.state[2], target.state().velocity, 0.5);
+  EXPECT_NEAR(track.state[3], 0, 0.5);
+  simulation.terminate();
+
+  ego.clearSensorFusion();
+  EXPECT_EQ(ego.sensorFusion(), nullptr);
+}
+
+TEST(TestSimulation, SensorNoise) {
+  Environment environment;
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0)};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 0)};
+  Sensor exact{SensorType::AIR};
+  Sensor air{SensorType::AIR};
+  air.setSensorNoise(symaware::SensorNoise::Setup{{0.1, 0, 0, 0, 0, 0},
+                                                  symaware::SensorNoise::Distribution::GAUSSIAN,
+                                                  {},
+                                                  0,
+                                                  0,
+                                                  {},
+                                                  {},
+                                                  2,
+                                                  0,
+                                                  7});
+  // 4 lines of 100 points, half of which are dropped
+  const double nan = std::nan("");
+  Sensor lms{SensorType::LMS, {nan, nan, 1.5, nan, nan, nan, nan, 4, 100, 0.1, nan}};
+  lms.setSensorNoise(symaware::SensorNoise::Setup{{}, symaware::SensorNoise::Distribution::GAUSSIAN, {}, 0.5});
+  ego.addSensor(exact);
+  ego.addSensor(air);
+  ego.addSensor(lms);
+  environment.addEntity(ego);
+  environment.addEntity(target);
+
+  const auto run = [&]() {
+    std::vector<double> ranges;
+    Simulation simulation{environment};
+    simulation.initialise();
+    // The detections are delayed by 2 steps
+    EXPECT_TRUE(air.state().empty());
+    simulation.step();
+    EXPECT_TRUE(air.state().empty());
+    for (int i = 0; i < 10; i++) {
+      simulation.step();
+      EXPECT_EQ(air.state().size(), 6u);
+      if (air.state().size() != 6u) continue;
+      ranges.push_back(air.state()[0]);
+      EXPECT_NE(air.state()[0], exact.state()[0]);
+      EXPECT_NEAR(air.state()[0], exact.state()[0], 1);
+      EXPECT_EQ(air.state()[1], exact.state()[1]);
+    }
+    const std::vector<double>& points = lms.state();
+    EXPECT_EQ(std::count_if(points.begin(), points.end(), [](const double value) { return std::isnan(value); }), 4);
+    EXPECT_GT((points.size() - 4) / 4, 4u * 30);
+    EXPECT_LT((points.size() - 4) / 4, 4u * 70);
+    simulation.terminate();
+    return ranges;
+  };
+  const std::vector<double> first = run();
+  ASSERT_NE(air.sensorNoise(), nullptr);
+  EXPECT_EQ(air.sensorNoise()->episode(), 1u);
+  // Each simulation is a new episode, which can be run again
+  EXPECT_NE(run(), first);
+  air.setNoiseEpisode(0);
+  EXPECT_EQ(run(), first);
+
+  air.clearSensorNoise();
+  EXPECT_EQ(air.sensorNoise(), nullptr);
+  Sensor camera{SensorType::CAMERA};
+  EXPECT_THROW(camera.setSensorNoise(symaware::SensorNoise::Setup{}), std::runtime_error);
+}
+
+TEST(TestSimulation, HistoryExporter) {
+  Environment environment;
+  Entity ego{ObjectType::Audi_A8_Sedan, setupAt(0, 0)};
+  Entity target{ObjectType::Audi_A8_Sedan, setupAt(30, 0)};
+  Sensor air{SensorType::AIR};
+  ego.addSensor(air);
+  environment.addEntity(ego);
+  environment.addEntity(target);
+  symaware::HistoryExporter exporter{::testing::TempDir(), 4};
+
+  Simulation simulation{environment};
+  simulation.addObserver(exporter);
+  simulation.initialise();
+  for (int i = 0; i < 10; i++) simulation.step();
+  EXPECT_EQ(exporter.steps(), 10);
+  simulation.terminate();
+
+  const ArrowTable states = readArrowStream(::testing::TempDir() + "/entity_states.arrows");
+  EXPECT_EQ(states.names, (std::vector<std::string>{"step", "time", "entity", "x", "y", "z", "roll", "pitch", "yaw",
+                                                     "velocity", "yaw_rate"}));
+  EXPECT_EQ(states.rows, 2 * 10);
+  // The target is the only object seen by the AIR sensor
+  const ArrowTable detections = readArrowStream(::testing::TempDir() + "/air_detections.arrows");
+  EXPECT_EQ(detections.names, (std::vector<std::string>{"step", "time", "entity", "sensor", "range", "azimuth",
+                                                         "elevation", "object_id", "velocity", "heading"}));
+  EXPECT_EQ(detections.rows, 10);
+  const ArrowTable boxes = readArrowStream(::testing::TempDir() + "/brs_boxes.arrows");
+  EXPECT_EQ(boxes.names.size(), 9u);
+  EXPECT_EQ(boxes.rows, 0);
+}
+
+TEST(TestSimulation, RoadFrenetTransform) {
+  Environment environment;
+  symaware::Road road{environment};
+  road.addStraightSection(50)
+      .addLane(prescan::api::roads::types::RoadSideType::RoadSideTypeRight, 3.5)
+      .addLane(prescan::api::roads::types::RoadSideType::RoadSideTypeRight, 3.5)
+      .addLane(prescan::api::roads::types::RoadSideType::RoadSideTypeLeft, 3.5)
+      .addLane(prescan::api::roads::types::RoadSideType::RoadSideTypeLeft, 3,
+               prescan::api::roads::types::LaneType::LaneTypeDriving, 10, 20);
+  // Lanes not spanning the whole road are not part of the transform
+  EXPECT_EQ(road.right_lane_widths().size(), 2u);
+  EXPECT_EQ(road.left_lane_widths().size(), 1u);
+  const symaware::FrenetTransform transform = road.frenetTransform();
+  const symaware::FrenetTransform::Coordinates coordinates = transform.toFrenet({12, -5, 0.1, 30, 2, 0});
+  EXPECT_DOUBLE_EQ(coordinates.s[0], 12);
+  EXPECT_DOUBLE_EQ(coordinates.d[0], -5);
+  EXPECT_EQ(coordinates.lane[0], -2);
+  EXPECT_EQ(coordinates.lane[1], 1);
+}
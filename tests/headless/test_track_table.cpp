@@ -0,0 +1,122 @@
+/**
+ * @file test_track_table.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the tracking of the detected objects
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "symaware/prescan/track_table.h"
+
+using symaware::TrackTable;
+
+namespace {
+/** Objects detected in a step, stored as separate arrays */
+struct Detections {
+  void add(const std::int32_t id, const double px, const double py, const double pz, const double yaw) {
+    ids.push_back(id);
+    x.push_back(px);
+    y.push_back(py);
+    z.push_back(pz);
+    heading.push_back(yaw);
+  }
+  void update(TrackTable& table, const double sample_time = 0.1) const {
+    table.update(sample_time, ids.data(), x.data(), y.data(), z.data(), heading.data(), ids.size());
+  }
+  std::vector<std::int32_t> ids;
+  std::vector<double> x, y, z, heading;
+};
+}  // namespace
+
+TEST(TestTrackTable, Empty) {
+  TrackTable table{};
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.step(), -1);
+  EXPECT_EQ(table.find(1), -1);
+  Detections{}.update(table);
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.step(), 0);
+}
+
+TEST(TestTrackTable, NewTracks) {
+  TrackTable table{};
+  Detections detections;
+  detections.add(7, 1, 2, 3, 0.5);
+  detections.add(3, -1, -2, -3, -0.5);
+  detections.update(table);
+  ASSERT_EQ(table.size(), 2u);
+  const std::ptrdiff_t row = table.find(3);
+  ASSERT_GE(row, 0);
+  EXPECT_EQ(table.ids()[row], 3);
+  EXPECT_EQ(table.lastSeen()[row], 0);
+  EXPECT_DOUBLE_EQ(table.x()[row], -1);
+  EXPECT_DOUBLE_EQ(table.y()[row], -2);
+  EXPECT_DOUBLE_EQ(table.z()[row], -3);
+  EXPECT_DOUBLE_EQ(table.heading()[row], -0.5);
+  // Seen only once, so there is no velocity yet
+  EXPECT_TRUE(std::isnan(table.vx()[row]));
+}
+
+TEST(TestTrackTable, FiniteDifferenceVelocity) {
+  TrackTable table{};
+  Detections first, second, third;
+  first.add(1, 0, 0, 0, 0);
+  second.add(1, 1, -0.5, 0, 0);
+  third.add(1, 3, -0.5, 0.2, 0);
+  first.update(table);
+  second.update(table);
+  ASSERT_EQ(table.size(), 1u);
+  EXPECT_DOUBLE_EQ(table.vx()[0], 10);
+  EXPECT_DOUBLE_EQ(table.vy()[0], -5);
+  EXPECT_DOUBLE_EQ(table.vz()[0], 0);
+
+  // Two steps between the detections
+  Detections{}.update(table);
+  third.update(table);
+  EXPECT_EQ(table.lastSeen()[0], 3);
+  EXPECT_DOUBLE_EQ(table.vx()[0], 10);
+  EXPECT_DOUBLE_EQ(table.vy()[0], 0);
+  EXPECT_NEAR(table.vz()[0], 1, 1e-12);
+}
+
+TEST(TestTrackTable, ExpireTracks) {
+  TrackTable table{TrackTable::Setup{2}};
+  Detections both, one;
+  both.add(1, 0, 0, 0, 0);
+  both.add(2, 5, 5, 0, 0);
+  one.add(2, 6, 5, 0, 0);
+  both.update(table);
+  for (int i = 0; i < 2; ++i) one.update(table);
+  EXPECT_EQ(table.size(), 2u);
+  one.update(table);
+  // The last track takes the row of the removed one
+  ASSERT_EQ(table.size(), 1u);
+  EXPECT_EQ(table.find(1), -1);
+  EXPECT_EQ(table.find(2), 0);
+  EXPECT_DOUBLE_EQ(table.x()[0], 6);
+  EXPECT_DOUBLE_EQ(table.vx()[0], 0);
+
+  table.clear();
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.step(), -1);
+  EXPECT_EQ(table.find(2), -1);
+}
+
+TEST(TestTrackTable, DuplicateDetections) {
+  TrackTable table{};
+  Detections first, second;
+  first.add(1, 0, 0, 0, 0);
+  second.add(1, 1, 0, 0, 0);
+  second.add(1, 2, 0, 0, 0);
+  first.update(table);
+  second.update(table);
+  ASSERT_EQ(table.size(), 1u);
+  EXPECT_DOUBLE_EQ(table.x()[0], 2);
+  EXPECT_DOUBLE_EQ(table.vx()[0], 10);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_transform.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the frame transforms between poses
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "symaware/prescan/transform.h"
+#include "symaware/util/constants.h"
+
+using symaware::Orientation;
+using symaware::pi;
+using symaware::Pose;
+using symaware::Position;
+using symaware::Quaternion;
+using symaware::RotationMatrix;
+
+namespace {
+constexpr double tolerance = 1e-12;
+
+void expectPositionNear(const Position& actual, const Position& expected) {
+  EXPECT_NEAR(actual.x, expected.x, tolerance);
+  EXPECT_NEAR(actual.y, expected.y, tolerance);
+  EXPECT_NEAR(actual.z, expected.z, tolerance);
+}
+void expectOrientationNear(const Orientation& actual, const Orientation& expected) {
+  EXPECT_NEAR(actual.roll, expected.roll, tolerance);
+  EXPECT_NEAR(actual.pitch, expected.pitch, tolerance);
+  EXPECT_NEAR(actual.yaw, expected.yaw, tolerance);
+}
+
+/** Pseudo-random points in a 100 m cube, stored as separate arrays of coordinates */
+struct Points {
+  explicit Points(const std::size_t size) : x(size), y(size), z(size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      x[i] = std::fmod(static_cast<double>(i) * 7.31, 100.0) - 50;
+      y[i] = std::fmod(static_cast<double>(i) * 3.17, 100.0) - 50;
+      z[i] = std::fmod(static_cast<double>(i) * 1.93, 10.0);
+    }
+  }
+  std::vector<double> x, y, z;
+};
+}  // namespace
+
+TEST(TestTransform, RotationMatrixOfYaw) {
+  const RotationMatrix r = symaware::rotationMatrix(Orientation{0, 0, pi / 2});
+  const RotationMatrix expected{0, -1, 0, 1, 0, 0, 0, 0, 1};
+  for (std::size_t i = 0; i < r.size(); ++i) EXPECT_NEAR(r[i], expected[i], tolerance);
+}
+
+TEST(TestTransform, RotationMatrixIsOrthonormal) {
+  const RotationMatrix r = symaware::rotationMatrix(Orientation{0.3, -0.7, 2.1});
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      const double dot = r[3 * i] * r[3 * j] + r[3 * i + 1] * r[3 * j + 1] + r[3 * i + 2] * r[3 * j + 2];
+      EXPECT_NEAR(dot, i == j ? 1 : 0, tolerance);
+    }
+  }
+}
+
+TEST(TestTransform, OrientationRoundTrip) {
+  const Orientation orientation{0.3, -0.7, 2.1};
+  expectOrientationNear(symaware::orientation(symaware::rotationMatrix(orientation)), orientation);
+  expectOrientationNear(symaware::orientation(symaware::quaternion(orientation)), orientation);
+}
+
+TEST(TestTransform, OrientationAtGimbalLock) {
+  // Only the difference between roll and yaw is defined, so the roll is moved to the yaw
+  const Orientation orientation = symaware::orientation(symaware::rotationMatrix(Orientation{0.2, pi / 2, 0.5}));
+  EXPECT_DOUBLE_EQ(orientation.roll, 0);
+  EXPECT_NEAR(orientation.pitch, pi / 2, 1e-6);
+  EXPECT_NEAR(orientation.yaw, 0.3, 1e-6);
+}
+
+TEST(TestTransform, Quaternion) {
+  const Quaternion q = symaware::quaternion(Orientation{0, 0, pi / 2});
+  EXPECT_NEAR(q.w, std::sqrt(0.5), tolerance);
+  EXPECT_NEAR(q.x, 0, tolerance);
+  EXPECT_NEAR(q.y, 0, tolerance);
+  EXPECT_NEAR(q.z, std::sqrt(0.5), tolerance);
+  // The real part is kept non-negative
+  EXPECT_GE(symaware::quaternion(Orientation{0, 0, 3 * pi / 2}).w, 0);
+}
+
+TEST(TestTransform, TransformPoint) {
+  const Pose pose{10, 5, 1, 0, 0, pi / 2};
+  expectPositionNear(symaware::transformPoint(pose, Position{1, 0, 0}), Position{10, 6, 1});
+  expectPositionNear(symaware::inverseTransformPoint(pose, Position{10, 6, 1}), Position{1, 0, 0});
+}
+
+TEST(TestTransform, ComposeAndInverse) {
+  const Pose entity{10, -4, 0.5, 0.1, -0.2, 0.8};
+  const Pose sensor{2, 0.3, 1.2, 0, 0.05, -0.4};
+  const Pose world = symaware::compose(entity, sensor);
+  const Position point{12, 3, -1};
+  expectPositionNear(symaware::transformPoint(world, point),
+                     symaware::transformPoint(entity, symaware::transformPoint(sensor, point)));
+
+  const Pose identity = symaware::compose(entity, symaware::inverse(entity));
+  expectPositionNear(identity.position, Position{0, 0, 0});
+  expectOrientationNear(identity.orientation, Orientation{0, 0, 0});
+  expectPositionNear(symaware::transformPoint(symaware::inverse(entity), point),
+                     symaware::inverseTransformPoint(entity, point));
+}
+
+TEST(TestTransform, TransformPointsMatchesSinglePoint) {
+  const Pose pose{10, -4, 0.5, 0.1, -0.2, 0.8};
+  // Enough points for the vector kernel and a remainder
+  const Points points{103};
+  std::vector<double> x(103), y(103), z(103);
+  symaware::transformPoints(pose, points.x.data(), points.y.data(), points.z.data(), 103, x.data(), y.data(),
+                            z.data());
+  for (std::size_t i = 0; i < 103; ++i) {
+    expectPositionNear(Position{x[i], y[i], z[i]},
+                       symaware::transformPoint(pose, Position{points.x[i], points.y[i], points.z[i]}));
+  }
+
+  // Back to where they were, in place
+  symaware::inverseTransformPoints(pose, x.data(), y.data(), z.data(), 103, x.data(), y.data(), z.data());
+  for (std::size_t i = 0; i < 103; ++i) {
+    EXPECT_NEAR(x[i], points.x[i], 1e-9);
+    EXPECT_NEAR(y[i], points.y[i], 1e-9);
+    EXPECT_NEAR(z[i], points.z[i], 1e-9);
+  }
+}
+
+TEST(TestTransform, TransformStridedPoints) {
+  const Pose pose{1, 2, 3, 0, 0, -0.6};
+  // More points than fit in a block, with a curvature after each point like in the state of an LMS sensor
+  const std::size_t size = 600;
+  const Points points{size};
+  std::vector<double> strided(size * 4);
+  for (std::size_t i = 0; i < size; ++i) {
+    strided[4 * i] = points.x[i];
+    strided[4 * i + 1] = points.y[i];
+    strided[4 * i + 2] = points.z[i];
+    strided[4 * i + 3] = 0.01;
+  }
+  std::vector<double> out(size * 3);
+  symaware::transformPoints(pose, strided.data(), size, 4, out.data());
+  for (std::size_t i = 0; i < size; ++i) {
+    expectPositionNear(Position{out[3 * i], out[3 * i + 1], out[3 * i + 2]},
+                       symaware::transformPoint(pose, Position{points.x[i], points.y[i], points.z[i]}));
+  }
+  std::vector<double> back(size * 3);
+  symaware::inverseTransformPoints(pose, out.data(), size, 3, back.data());
+  for (std::size_t i = 0; i < size; ++i) EXPECT_NEAR(back[3 * i], points.x[i], 1e-9);
+
+  EXPECT_THROW(symaware::transformPoints(pose, strided.data(), size, 2, out.data()), std::invalid_argument);
+}
+
+TEST(TestTransform, PolarToCartesian) {
+  const double range[2] = {10, 2};
+  const double azimuth[2] = {pi / 2, 0};
+  const double elevation[2] = {0, pi / 6};
+  double x[2], y[2], z[2];
+  symaware::polarToCartesian(range, azimuth, elevation, 2, x, y, z);
+  expectPositionNear(Position{x[0], y[0], z[0]}, Position{0, 10, 0});
+  expectPositionNear(Position{x[1], y[1], z[1]}, Position{std::sqrt(3.0), 0, 1});
+}
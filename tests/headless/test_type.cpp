@@ -0,0 +1,68 @@
+/**
+ * @file test_type.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the conversion of the type enums to and from their names
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+#include "symaware/prescan/type.h"
+
+using symaware::from_string;
+using symaware::Gear;
+using symaware::ObjectType;
+using symaware::SensorType;
+using symaware::SkyType;
+using symaware::to_string;
+using symaware::to_string_view;
+using symaware::to_underlying;
+using symaware::WeatherType;
+
+namespace {
+/** Check that all the values of @p E from @p first to @p last are converted to their name and back */
+template <class E>
+void expectRoundTrip(const E first, const E last) {
+  for (auto i = to_underlying(first); i <= to_underlying(last); ++i) {
+    const E value = static_cast<E>(i);
+    EXPECT_NE(to_string_view(value), "Unknown");
+    EXPECT_EQ(to_string(value), std::string{to_string_view(value)});
+    EXPECT_EQ(from_string<E>(to_string_view(value)), std::optional<E>{value}) << to_string_view(value);
+  }
+}
+}  // namespace
+
+TEST(TestType, ObjectTypeRoundTrip) {
+  expectRoundTrip(ObjectType::ADAC_target_yellow_merc, ObjectType::TrafficSignPole);
+}
+TEST(TestType, SensorTypeRoundTrip) { expectRoundTrip(SensorType::AIR, SensorType::WORLD_VIEWER); }
+TEST(TestType, WeatherTypeRoundTrip) { expectRoundTrip(WeatherType::SUNNY, WeatherType::SNOWY); }
+TEST(TestType, SkyTypeRoundTrip) { expectRoundTrip(SkyType::DAWN, SkyType::NIGHT); }
+TEST(TestType, GearRoundTrip) { expectRoundTrip(Gear::Reverse, Gear::Undefined); }
+
+TEST(TestType, Names) {
+  EXPECT_EQ(to_string_view(ObjectType::Audi_A8_Sedan), "Audi_A8_Sedan");
+  EXPECT_EQ(to_string_view(SensorType::WORLD_VIEWER), "WORLD_VIEWER");
+  EXPECT_EQ(to_string_view(WeatherType::RAINY), "Rainy");
+  EXPECT_EQ(to_string_view(SkyType::NIGHT), "Night");
+  EXPECT_EQ(to_string_view(Gear::Forward), "Forward");
+}
+
+TEST(TestType, UnknownValue) {
+  EXPECT_EQ(to_string_view(static_cast<ObjectType>(-1)), "Unknown");
+  EXPECT_EQ(to_string_view(static_cast<SensorType>(100)), "Unknown");
+  EXPECT_EQ(to_string(static_cast<Gear>(10)), "Unknown");
+}
+
+TEST(TestType, UnknownName) {
+  EXPECT_EQ(from_string<ObjectType>("Audi_A8"), std::nullopt);
+  EXPECT_EQ(from_string<ObjectType>("audi_a8_sedan"), std::nullopt);
+  EXPECT_EQ(from_string<ObjectType>(""), std::nullopt);
+  EXPECT_EQ(from_string<SensorType>("Unknown"), std::nullopt);
+  EXPECT_EQ(from_string<WeatherType>("SUNNY"), std::nullopt);
+  EXPECT_EQ(from_string<SkyType>("Noon"), std::nullopt);
+  EXPECT_EQ(from_string<Gear>("Drive"), std::nullopt);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file test_world.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the objects, the kinematics and the motion units of the headless backend
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <prescan/api/Experiment.hpp>
+#include <prescan/api/Vehicledynamics.hpp>
+#include <prescan/sim/AmesimVehicleDynamicsUnit.hpp>
+#include <prescan/sim/ISimulation.hpp>
+#include <prescan/sim/ISimulationModel.hpp>
+#include <prescan/sim/ManualSimulation.hpp>
+#include <prescan/sim/SelfSensorUnit.hpp>
+#include <prescan/sim/StateActuatorUnit.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using prescan::api::experiment::Experiment;
+using prescan::api::types::WorldObject;
+using prescan::sim::ISimulation;
+
+namespace {
+
+constexpr double pi = 3.14159265358979323846;
+
+/** Model registering the units given in the constructor and doing nothing else */
+class UnitsModel : public prescan::sim::ISimulationModel {
+ public:
+  explicit UnitsModel(std::function<void(ISimulation*)> register_units)
+      : register_units_{std::move(register_units)} {}
+  void registerSimulationUnits(const Experiment&, ISimulation* simulation) override { register_units_(simulation); }
+  void initialize(ISimulation*) override {}
+  void step(ISimulation*) override {}
+  void terminate(ISimulation*) override {}
+
+ private:
+  std::function<void(ISimulation*)> register_units_;
+};
+
+}  // namespace
+
+class TestWorld : public ::testing::Test {
+ protected:
+  TestWorld() : experiment_{prescan::api::experiment::createExperiment()} {
+    experiment_.scheduler().setFrequencies(10, 10);
+  }
+
+  Experiment experiment_;
+};
+
+TEST_F(TestWorld, CreateObject) {
+  const WorldObject first = experiment_.createObject("Car");
+  const WorldObject second = experiment_.createObject("Car");
+  const WorldObject third = experiment_.createObject("Bike");
+  EXPECT_EQ(first.name(), "Car_1");
+  EXPECT_EQ(second.name(), "Car_2");
+  EXPECT_EQ(first.data().id, 0);
+  EXPECT_EQ(third.data().id, 2);
+  EXPECT_EQ(experiment_.objectTypes(), (std::vector<std::string>{"Bike", "Car"}));
+  EXPECT_EQ(experiment_.getObjectByName<WorldObject>("Car_2").handle(), second.handle());
+}
+
+TEST_F(TestWorld, SetName) {
+  WorldObject object = experiment_.createObject("Car");
+  experiment_.createObject("Car");
+  object.setName("ego");
+  EXPECT_EQ(experiment_.getObjectByName<WorldObject>("ego").handle(), object.handle());
+  EXPECT_THROW(experiment_.getObjectByName<WorldObject>("Car_1"), std::runtime_error);
+  EXPECT_THROW(object.setName("Car_2"), std::runtime_error);
+}
+
+TEST_F(TestWorld, RemovedObjectIsNotFound) {
+  WorldObject object = experiment_.createObject("Car");
+  object.remove();
+  EXPECT_THROW(experiment_.getObjectByName<WorldObject>("Car_1"), std::runtime_error);
+}
+
+TEST_F(TestWorld, StateActuatorMovesObject) {
+  WorldObject object = experiment_.createObject("Car");
+  prescan::sim::StateActuatorUnit* actuator = nullptr;
+  prescan::sim::SelfSensorUnit* self_sensor = nullptr;
+  UnitsModel model{[&](ISimulation* simulation) {
+    // Registered in reverse order: the simulation still moves the object before sensing it
+    self_sensor = prescan::sim::registerUnit<prescan::sim::SelfSensorUnit>(simulation, object);
+    actuator = prescan::sim::registerUnit<prescan::sim::StateActuatorUnit>(simulation, object);
+  }};
+  prescan::sim::ManualSimulation simulation{&model};
+  simulation.initialize(experiment_);
+  EXPECT_DOUBLE_EQ(self_sensor->selfSensorOutput().Velocity, 0);
+
+  actuator->stateActuatorInput().PositionX = 2;
+  actuator->stateActuatorInput().PositionY = 1;
+  actuator->stateActuatorInput().OrientationYaw = 0.1;
+  simulation.step();
+
+  EXPECT_DOUBLE_EQ(object.pose().position().x(), 2);
+  EXPECT_DOUBLE_EQ(object.pose().position().y(), 1);
+  EXPECT_DOUBLE_EQ(object.pose().orientation().yaw(), 0.1);
+  EXPECT_DOUBLE_EQ(object.data().velocity.x(), 20);
+  EXPECT_DOUBLE_EQ(object.data().velocity.y(), 10);
+  EXPECT_DOUBLE_EQ(object.data().yaw_rate, 1);
+  EXPECT_DOUBLE_EQ(self_sensor->selfSensorOutput().PositionX, 2);
+  EXPECT_DOUBLE_EQ(self_sensor->selfSensorOutput().Velocity, 20 * std::cos(0.1) + 10 * std::sin(0.1));
+  EXPECT_DOUBLE_EQ(self_sensor->selfSensorOutput().Yaw_rate, 1);
+
+  simulation.step();
+  EXPECT_DOUBLE_EQ(object.data().velocity.x(), 0);
+  EXPECT_DOUBLE_EQ(object.data().yaw_rate, 0);
+}
+
+TEST_F(TestWorld, YawRateIsWrapped) {
+  WorldObject object = experiment_.createObject("Car");
+  object.pose().orientation().setYaw(3.1);
+  prescan::sim::StateActuatorUnit* actuator = nullptr;
+  UnitsModel model{[&](ISimulation* simulation) {
+    actuator = prescan::sim::registerUnit<prescan::sim::StateActuatorUnit>(simulation, object);
+  }};
+  prescan::sim::ManualSimulation simulation{&model};
+  simulation.initialize(experiment_);
+  actuator->stateActuatorInput().OrientationYaw = -3.1;
+  simulation.step();
+  EXPECT_NEAR(object.data().yaw_rate, (2 * pi - 6.2) * 10, 1e-9);
+}
+
+TEST_F(TestWorld, VehicleDynamics) {
+  WorldObject object = experiment_.createObject("Car");
+  prescan::api::vehicledynamics::createAmesimPreconfiguredDynamics(object).setInitialVelocity(5);
+  prescan::sim::AmesimVehicleDynamicsUnit* dynamics = nullptr;
+  UnitsModel model{[&](ISimulation* simulation) {
+    dynamics = prescan::sim::registerUnit<prescan::sim::AmesimVehicleDynamicsUnit>(
+        simulation, prescan::api::vehicledynamics::getAttachedAmesimPreconfiguredDynamics(object), "");
+  }};
+  prescan::sim::ManualSimulation simulation{&model};
+  simulation.initialize(experiment_);
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().VelocityX, 5);
+
+  // Neutral gear: the vehicle coasts
+  dynamics->vehicleControlInput().Throttle = 1;
+  simulation.step();
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().VelocityX, 5);
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().PositionX, 0.5);
+
+  // Full throttle forward
+  dynamics->vehicleControlInput().Gear = 1;
+  simulation.step();
+  const double accelerated = 5 + prescan::sim::AmesimVehicleDynamicsUnit::max_acceleration * 0.1;
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().VelocityX, accelerated);
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().PositionX, 0.5 + (5 + accelerated) / 2 * 0.1);
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().PositionY, 0);
+
+  // Steering makes the vehicle turn left
+  dynamics->vehicleControlInput().SteeringWheelAngle = 1;
+  simulation.step();
+  EXPECT_GT(dynamics->stateActuatorOutput().OrientationYaw, 0);
+  EXPECT_GT(dynamics->stateActuatorOutput().AngularVelocityYaw, 0);
+  EXPECT_GT(dynamics->stateActuatorOutput().PositionY, 0);
+
+  // Braking stops the vehicle without moving it backwards
+  dynamics->vehicleControlInput().Throttle = 0;
+  dynamics->vehicleControlInput().Brake = 1;
+  for (int i = 0; i < 20; i++) simulation.step();
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().VelocityX, 0);
+  EXPECT_DOUBLE_EQ(dynamics->stateActuatorOutput().VelocityY, 0);
+}
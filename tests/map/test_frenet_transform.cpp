@@ -0,0 +1,166 @@
+/**
+ * @file test_frenet_transform.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the batch Frenet transform
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/frenet_transform.h"
+#include "symaware/map/road_network.h"
+#include "symaware/util/constants.h"
+
+using symaware::FrenetTransform;
+using symaware::pi;
+using symaware::ReferenceLine;
+using symaware::RoadNetwork;
+
+namespace {
+
+std::string dataFile(const std::string& name) { return std::string{SYMAWARE_TEST_DATA_DIR} + "/" + name; }
+
+/** Reference line with every type of geometry, turning both ways */
+ReferenceLine makeLine() {
+  ReferenceLine line{10, -5, 0.3};
+  line.addLine(30)
+      .addSpiral(20, 0, 0.02)
+      .addArc(40, 0.02)
+      .addSpiral(20, 0.02, -0.01)
+      .addPoly3(30, 0, 0, 0.002, -0.00002)
+      .addParamPoly3(30, {0, 30, 0, 0}, {0, 0, -3, 2}, true);
+  return line;
+}
+
+/** Poses at the Frenet coordinates (@p s, @p d), with heading offset by @p heading_error from the line */
+std::vector<double> posesAt(const ReferenceLine& line, const std::vector<double>& s, const double d,
+                            const double heading_error) {
+  std::vector<double> poses;
+  for (const double value : s) {
+    const ReferenceLine::Point point = line.point(value);
+    poses.push_back(point.x - d * std::sin(point.heading));
+    poses.push_back(point.y + d * std::cos(point.heading));
+    poses.push_back(point.heading + heading_error);
+  }
+  return poses;
+}
+
+std::vector<double> stations(const ReferenceLine& line, const double step) {
+  std::vector<double> s;
+  for (double value = line.start() + 0.25; value < line.end() - 0.25; value += step) s.push_back(value);
+  return s;
+}
+
+}  // namespace
+
+TEST(TestFrenetTransform, LineRoundTrip) {
+  const FrenetTransform transform{makeLine(), {3.5}, {3.5, 3}};
+  const std::vector<double> s = stations(transform.reference_line(), 0.7);
+  const FrenetTransform::Coordinates coordinates = transform.toFrenet(posesAt(transform.reference_line(), s, -4, 0.1));
+  ASSERT_EQ(coordinates.size(), s.size());
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    EXPECT_NEAR(coordinates.s[i], s[i], 1e-8) << s[i];
+    EXPECT_NEAR(coordinates.d[i], -4, 1e-8) << s[i];
+    EXPECT_NEAR(coordinates.heading_error[i], 0.1, 1e-8) << s[i];
+    EXPECT_EQ(coordinates.lane[i], -2) << s[i];
+    EXPECT_EQ(coordinates.road[i], 0u) << s[i];
+  }
+
+  std::vector<double> poses(3 * s.size());
+  const std::vector<double> d(s.size(), -4);
+  transform.fromFrenet(nullptr, s.data(), d.data(), s.size(), poses.data());
+  const std::vector<double> expected = posesAt(transform.reference_line(), s, -4, 0);
+  for (std::size_t i = 0; i < poses.size(); ++i) EXPECT_NEAR(poses[i], expected[i], 1e-9) << i;
+}
+
+TEST(TestFrenetTransform, Lanes) {
+  const FrenetTransform transform{makeLine(), {3.5}, {3.5, 3}, 20};
+  std::vector<double> poses;
+  for (const auto& [d, heading_error] : {std::pair{1.0, 0.2}, std::pair{-1.0, 0.0}, std::pair{10.0, 0.0}}) {
+    const std::vector<double> pose = posesAt(transform.reference_line(), {5}, d, heading_error);
+    poses.insert(poses.end(), pose.begin(), pose.end());
+  }
+  const FrenetTransform::Coordinates coordinates = transform.toFrenet(poses);
+  EXPECT_EQ(coordinates.lane[0], 1);
+  // Lanes on the left drive against the reference line
+  EXPECT_NEAR(coordinates.heading_error[0], 0.2 - pi, 1e-9);
+  EXPECT_EQ(coordinates.lane[1], -1);
+  EXPECT_NEAR(coordinates.heading_error[1], 0, 1e-9);
+  EXPECT_EQ(coordinates.lane[2], 0);
+  EXPECT_NEAR(coordinates.d[2], 10, 1e-9);
+}
+
+TEST(TestFrenetTransform, OutsideCorridor) {
+  const FrenetTransform transform{makeLine(), {}, {}, 5};
+  const FrenetTransform::Coordinates coordinates = transform.toFrenet(posesAt(transform.reference_line(), {20}, 8, 0));
+  EXPECT_TRUE(std::isnan(coordinates.s[0]));
+  EXPECT_TRUE(std::isnan(coordinates.d[0]));
+  EXPECT_EQ(coordinates.lane[0], 0);
+  EXPECT_EQ(coordinates.road[0], FrenetTransform::npos);
+}
+
+TEST(TestFrenetTransform, ThreadsAgree) {
+  FrenetTransform transform{makeLine()};
+  const std::vector<double> s = stations(transform.reference_line(), 0.05);
+  ASSERT_GT(s.size(), 2000u);
+  const std::vector<double> poses = posesAt(transform.reference_line(), s, 2.5, -0.3);
+  transform.setThreads(1);
+  const FrenetTransform::Coordinates sequential = transform.toFrenet(poses);
+  transform.setThreads(4);
+  const FrenetTransform::Coordinates parallel = transform.toFrenet(poses);
+  EXPECT_EQ(sequential.s, parallel.s);
+  EXPECT_EQ(sequential.d, parallel.d);
+  EXPECT_EQ(sequential.heading_error, parallel.heading_error);
+  EXPECT_EQ(sequential.lane, parallel.lane);
+
+  std::vector<double> sequential_poses(poses.size()), parallel_poses(poses.size());
+  transform.fromFrenet(nullptr, parallel.s.data(), parallel.d.data(), s.size(), parallel_poses.data());
+  transform.setThreads(1);
+  transform.fromFrenet(nullptr, parallel.s.data(), parallel.d.data(), s.size(), sequential_poses.data());
+  EXPECT_EQ(sequential_poses, parallel_poses);
+}
+
+TEST(TestFrenetTransform, Network) {
+  RoadNetwork network;
+  network.importOpenDriveFile(dataFile("straight.xodr"));
+  const FrenetTransform transform{network};
+  const FrenetTransform::Coordinates coordinates = transform.toFrenet({20.3, -1.2, 0.1, 120, 4, pi, 20, 5, 0});
+  EXPECT_EQ(coordinates.road[0], 0u);
+  EXPECT_EQ(coordinates.lane[0], -1);
+  EXPECT_NEAR(coordinates.s[0], 20.3, 1e-9);
+  EXPECT_NEAR(coordinates.d[0], -1.2, 1e-9);
+  EXPECT_NEAR(coordinates.heading_error[0], 0.1, 1e-9);
+  EXPECT_EQ(coordinates.road[1], 1u);
+  EXPECT_EQ(coordinates.lane[1], 1);
+  EXPECT_NEAR(coordinates.s[1], 20, 1e-9);
+  EXPECT_NEAR(coordinates.heading_error[1], 0, 1e-9);
+  EXPECT_EQ(coordinates.road[2], FrenetTransform::npos);
+
+  std::vector<double> poses(6);
+  const std::vector<std::size_t> roads{coordinates.road[0], coordinates.road[1]};
+  transform.fromFrenet(roads.data(), coordinates.s.data(), coordinates.d.data(), 2, poses.data());
+  EXPECT_NEAR(poses[0], 20.3, 1e-9);
+  EXPECT_NEAR(poses[1], -1.2, 1e-9);
+  EXPECT_NEAR(poses[3], 120, 1e-9);
+  EXPECT_NEAR(poses[4], 4, 1e-9);
+}
+
+TEST(TestFrenetTransform, InvalidArguments) {
+  EXPECT_THROW(FrenetTransform{ReferenceLine{}}, std::invalid_argument);
+  EXPECT_THROW((FrenetTransform{makeLine(), {}, {}, 0}), std::invalid_argument);
+  EXPECT_THROW((FrenetTransform{makeLine(), {}, {}, 10, -1}), std::invalid_argument);
+  EXPECT_THROW(FrenetTransform{makeLine()}.toFrenet({1, 2}), std::invalid_argument);
+
+  RoadNetwork network;
+  network.importOpenDriveFile(dataFile("straight.xodr"));
+  const std::size_t road = 2;
+  const double s = 0, d = 0;
+  double pose[3];
+  EXPECT_THROW(FrenetTransform{network}.fromFrenet(&road, &s, &d, 1, pose), std::out_of_range);
+}
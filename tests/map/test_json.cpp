@@ -0,0 +1,129 @@
+/**
+ * @file test_json.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the JSON reader
+ */
+#include <gtest/gtest.h>
+
+#include <clocale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/map/json.h"
+
+using symaware::JsonReader;
+using Token = symaware::JsonReader::Token;
+
+namespace {
+
+/** Read all the tokens of the @p content */
+std::vector<Token> tokens(const std::string& content) {
+  std::istringstream is{content};
+  JsonReader reader{is};
+  std::vector<Token> result;
+  do {
+    result.push_back(reader.next());
+  } while (result.back() != Token::END);
+  return result;
+}
+
+}  // namespace
+
+TEST(TestJson, Tokens) {
+  const std::vector<Token> expected{Token::BEGIN_OBJECT, Token::KEY,         Token::NUMBER,     Token::KEY,
+                                    Token::BEGIN_ARRAY,  Token::STRING,      Token::BOOLEAN,    Token::BOOLEAN,
+                                    Token::NULL_VALUE,   Token::BEGIN_OBJECT, Token::END_OBJECT, Token::BEGIN_ARRAY,
+                                    Token::END_ARRAY,    Token::END_ARRAY,    Token::END_OBJECT, Token::END};
+  EXPECT_EQ(tokens(R"({"a": 1, "b": ["x", true, false, null, {}, []]})"), expected);
+}
+
+TEST(TestJson, Values) {
+  std::istringstream is{R"( {"number": -12.5e-1, "string": "a\"b\\c\/d\nè😀", "flag": true} )"};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_OBJECT);
+  reader.expect(Token::KEY);
+  EXPECT_EQ(reader.string(), "number");
+  EXPECT_DOUBLE_EQ(reader.readNumber(), -1.25);
+  reader.expect(Token::KEY);
+  EXPECT_EQ(reader.readString(), "a\"b\\c/d\n\xC3\xA8\xF0\x9F\x98\x80");
+  reader.expect(Token::KEY);
+  EXPECT_TRUE(reader.readBoolean());
+  reader.expect(Token::END_OBJECT);
+  reader.expect(Token::END);
+}
+
+TEST(TestJson, IndependentOfLocale) {
+  // Locales with a comma as decimal separator must not change the numbers read
+  const std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+  if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr && std::setlocale(LC_NUMERIC, "de_DE") == nullptr)
+    GTEST_SKIP() << "No locale with a comma as decimal separator";
+  std::istringstream is{"[2.5, -0.125e1]"};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_ARRAY);
+  const double first = reader.readNumber();
+  const double second = reader.readNumber();
+  std::setlocale(LC_NUMERIC, previous.c_str());
+  EXPECT_DOUBLE_EQ(first, 2.5);
+  EXPECT_DOUBLE_EQ(second, -1.25);
+}
+
+TEST(TestJson, SkipValue) {
+  std::istringstream is{R"({"skip": {"a": [1, {"b": 2}], "c": "}"}, "keep": 3})"};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_OBJECT);
+  reader.expect(Token::KEY);
+  reader.skipValue();
+  reader.expect(Token::KEY);
+  EXPECT_EQ(reader.string(), "keep");
+  EXPECT_EQ(reader.readNumber(), 3);
+  reader.expect(Token::END_OBJECT);
+}
+
+TEST(TestJson, LargeDocument) {
+  // Spans many chunks of the reader
+  std::string content = "[";
+  for (int i = 0; i < 100000; ++i) content += std::to_string(i) + (i + 1 < 100000 ? ",\n" : "]");
+  std::istringstream is{content};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_ARRAY);
+  for (int i = 0; i < 100000; ++i) ASSERT_EQ(reader.readNumber(), i);
+  reader.expect(Token::END_ARRAY);
+  reader.expect(Token::END);
+  EXPECT_EQ(reader.line(), 100000u);
+}
+
+TEST(TestJson, Line) {
+  std::istringstream is{"{\n\"a\":\n  tru\n}"};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_OBJECT);
+  reader.expect(Token::KEY);
+  try {
+    reader.next();
+    FAIL();
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string{e.what()}.find("line 4"), std::string::npos) << e.what();
+  }
+}
+
+TEST(TestJson, UnexpectedToken) {
+  std::istringstream is{"[\"1\"]"};
+  JsonReader reader{is};
+  reader.expect(Token::BEGIN_ARRAY);
+  EXPECT_THROW(reader.readNumber(), std::runtime_error);
+}
+
+TEST(TestJson, TrailingComma) { EXPECT_THROW(tokens("[1, 2,]"), std::runtime_error); }
+TEST(TestJson, MissingColon) { EXPECT_THROW(tokens(R"({"a" 1})"), std::runtime_error); }
+TEST(TestJson, MissingComma) { EXPECT_THROW(tokens("[1 2]"), std::runtime_error); }
+TEST(TestJson, MismatchedBracket) { EXPECT_THROW(tokens("[1}"), std::runtime_error); }
+TEST(TestJson, UnquotedKey) { EXPECT_THROW(tokens("{a: 1}"), std::runtime_error); }
+TEST(TestJson, LeadingZero) { EXPECT_THROW(tokens("01"), std::runtime_error); }
+TEST(TestJson, Unterminated) { EXPECT_THROW(tokens(R"(["a)"), std::runtime_error); }
+TEST(TestJson, InvalidEscape) { EXPECT_THROW(tokens(R"(["\x"])"), std::runtime_error); }
+TEST(TestJson, TrailingContent) { EXPECT_THROW(tokens("{} {}"), std::runtime_error); }
+TEST(TestJson, NumberOutOfRange) { EXPECT_THROW(tokens("[1e400]"), std::runtime_error); }
+TEST(TestJson, Empty) { EXPECT_THROW(tokens(""), std::runtime_error); }
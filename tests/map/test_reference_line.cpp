@@ -0,0 +1,258 @@
+/**
+ * @file test_reference_line.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the reference line geometries
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "symaware/map/reference_line.h"
+#include "symaware/util/constants.h"
+
+using symaware::fresnel;
+using symaware::pi;
+using symaware::ReferenceLine;
+
+namespace {
+
+/** Integrate the Fresnel integrands with the composite Simpson rule */
+std::pair<double, double> simpsonFresnel(const double x) {
+  constexpr int n = 20000;
+  const double h = x / n;
+  double c = 1 + std::cos(pi / 2 * x * x), s = std::sin(pi / 2 * x * x);
+  for (int i = 1; i < n; ++i) {
+    const double t = h * i, weight = i % 2 ? 4 : 2;
+    c += weight * std::cos(pi / 2 * t * t);
+    s += weight * std::sin(pi / 2 * t * t);
+  }
+  return {c * h / 3, s * h / 3};
+}
+
+}  // namespace
+
+TEST(TestFresnel, KnownValues) {
+  const auto [c1, s1] = fresnel(1);
+  EXPECT_NEAR(c1, 0.7798934003768228, 1e-14);
+  EXPECT_NEAR(s1, 0.4382591473903548, 1e-14);
+  const auto [c0, s0] = fresnel(0);
+  EXPECT_EQ(c0, 0);
+  EXPECT_EQ(s0, 0);
+}
+
+TEST(TestFresnel, OddFunction) {
+  const auto [c, s] = fresnel(2.5);
+  const auto [c_neg, s_neg] = fresnel(-2.5);
+  EXPECT_DOUBLE_EQ(c_neg, -c);
+  EXPECT_DOUBLE_EQ(s_neg, -s);
+}
+
+TEST(TestFresnel, MatchesQuadrature) {
+  for (const double x : {0.1, 0.7, 1.4, 1.5, 1.6, 2.0, 3.3, 5.0}) {
+    const auto [c, s] = fresnel(x);
+    const auto [c_ref, s_ref] = simpsonFresnel(x);
+    EXPECT_NEAR(c, c_ref, 1e-10) << x;
+    EXPECT_NEAR(s, s_ref, 1e-10) << x;
+  }
+}
+
+TEST(TestFresnel, Limit) {
+  const auto [c, s] = fresnel(1e4);
+  EXPECT_NEAR(c, 0.5, 1e-4);
+  EXPECT_NEAR(s, 0.5, 1e-4);
+}
+
+TEST(TestReferenceLine, Line) {
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::line(0, 1, 2, pi / 2, 10));
+  const ReferenceLine::Point point = line.point(4);
+  EXPECT_NEAR(point.x, 1, 1e-12);
+  EXPECT_NEAR(point.y, 6, 1e-12);
+  EXPECT_DOUBLE_EQ(point.heading, pi / 2);
+  EXPECT_EQ(point.curvature, 0);
+  EXPECT_DOUBLE_EQ(line.length(), 10);
+}
+
+TEST(TestReferenceLine, ClampsOutside) {
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::line(0, 0, 0, 0, 10));
+  EXPECT_DOUBLE_EQ(line.point(-5).x, 0);
+  EXPECT_DOUBLE_EQ(line.point(15).x, 10);
+}
+
+TEST(TestReferenceLine, Arc) {
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::arc(0, 0, 0, 0, 10 * pi, 0.1));
+  const ReferenceLine::Point quarter = line.point(5 * pi);
+  EXPECT_NEAR(quarter.x, 10, 1e-12);
+  EXPECT_NEAR(quarter.y, 10, 1e-12);
+  EXPECT_NEAR(quarter.heading, pi / 2, 1e-12);
+  EXPECT_DOUBLE_EQ(quarter.curvature, 0.1);
+  const ReferenceLine::Point half = line.point(10 * pi);
+  EXPECT_NEAR(half.x, 0, 1e-12);
+  EXPECT_NEAR(half.y, 20, 1e-12);
+}
+
+TEST(TestReferenceLine, SpiralMatchesFresnel) {
+  // A clothoid starting straight with curvature rate π is the Fresnel spiral itself
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::spiral(0, 0, 0, 0, 2, 0, 2 * pi));
+  for (const double s : {0.5, 1.0, 1.7, 2.0}) {
+    const auto [c, s_fresnel] = fresnel(s);
+    const ReferenceLine::Point point = line.point(s);
+    EXPECT_NEAR(point.x, c, 1e-12);
+    EXPECT_NEAR(point.y, s_fresnel, 1e-12);
+    EXPECT_NEAR(point.heading, pi / 2 * s * s, 1e-12);
+    EXPECT_NEAR(point.curvature, pi * s, 1e-12);
+  }
+}
+
+TEST(TestReferenceLine, SpiralWithNearlyConstantCurvature) {
+  // The curvature barely changes, so the spiral is indistinguishable from an arc
+  ReferenceLine spiral, arc;
+  spiral.addGeometry(ReferenceLine::Geometry::spiral(0, 0, 0, 0, 100, 0.01, 0.01 + 1e-12));
+  arc.addGeometry(ReferenceLine::Geometry::arc(0, 0, 0, 0, 100, 0.01));
+  EXPECT_NEAR(spiral.point(100).x, arc.point(100).x, 1e-6);
+  EXPECT_NEAR(spiral.point(100).y, arc.point(100).y, 1e-6);
+}
+
+TEST(TestReferenceLine, SpiralDecreasingCurvature) {
+  // Reversing a clothoid ends where the original one started
+  ReferenceLine forward;
+  forward.addGeometry(ReferenceLine::Geometry::spiral(0, 0, 0, 0, 30, 0.01, 0.08));
+  const ReferenceLine::Point end = forward.point(30);
+  ReferenceLine backward;
+  backward.addGeometry(ReferenceLine::Geometry::spiral(0, end.x, end.y, end.heading + pi, 30, -0.08, -0.01));
+  const ReferenceLine::Point start = backward.point(30);
+  EXPECT_NEAR(start.x, 0, 1e-9);
+  EXPECT_NEAR(start.y, 0, 1e-9);
+  EXPECT_NEAR(std::remainder(start.heading - pi, 2 * pi), 0, 1e-12);
+}
+
+TEST(TestReferenceLine, Poly3ArcLength) {
+  // v(u) = u² / 2 has arc length (u √(1 + u²) + asinh(u)) / 2
+  const double u = 1.5;
+  const double length = (u * std::sqrt(1 + u * u) + std::asinh(u)) / 2;
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::poly3(0, 0, 0, 0, length, 0, 0, 0.5, 0));
+  const ReferenceLine::Point point = line.point(length);
+  EXPECT_NEAR(point.x, u, 1e-10);
+  EXPECT_NEAR(point.y, u * u / 2, 1e-10);
+  EXPECT_NEAR(point.heading, std::atan(u), 1e-10);
+  EXPECT_NEAR(point.curvature, 1 / std::pow(1 + u * u, 1.5), 1e-10);
+}
+
+TEST(TestReferenceLine, ParamPoly3) {
+  ReferenceLine normalized, arc_length;
+  normalized.addGeometry(ReferenceLine::Geometry::paramPoly3(0, 1, 1, pi / 2, 10, {0, 10, 0, 0}, {0, 0, 2, 0}, true));
+  arc_length.addGeometry(
+      ReferenceLine::Geometry::paramPoly3(0, 1, 1, pi / 2, 10, {0, 1, 0, 0}, {0, 0, 0.02, 0}, false));
+  for (const ReferenceLine* const line : {&normalized, &arc_length}) {
+    const ReferenceLine::Point point = line->point(5);
+    // u = 5, v = 0.5 in the local frame, rotated by 90 degrees
+    EXPECT_NEAR(point.x, 1 - 0.5, 1e-12);
+    EXPECT_NEAR(point.y, 1 + 5, 1e-12);
+    EXPECT_NEAR(point.heading, pi / 2 + std::atan(0.2), 1e-12);
+  }
+}
+
+TEST(TestReferenceLine, Project) {
+  ReferenceLine line;
+  line.addGeometry(ReferenceLine::Geometry::line(0, 0, 0, 0, 10));
+  line.addGeometry(ReferenceLine::Geometry::arc(10, 10, 0, 0, 10 * pi, 0.1));
+  const auto [s, t] = line.project(10 + 8 * std::sin(0.5), 10 - 8 * std::cos(0.5), 12);
+  EXPECT_NEAR(s, 15, 1e-9);
+  EXPECT_NEAR(t, 2, 1e-9);
+  const auto [s_line, t_line] = line.project(3, -1, 0);
+  EXPECT_NEAR(s_line, 3, 1e-9);
+  EXPECT_NEAR(t_line, -1, 1e-9);
+}
+
+TEST(TestReferenceLine, InvalidGeometry) {
+  ReferenceLine line;
+  EXPECT_THROW(line.point(0), std::runtime_error);
+  EXPECT_THROW(line.addGeometry(ReferenceLine::Geometry::line(0, 0, 0, 0, 0)), std::invalid_argument);
+  line.addGeometry(ReferenceLine::Geometry::line(0, 0, 0, 0, 10));
+  EXPECT_THROW(line.addGeometry(ReferenceLine::Geometry::line(5, 0, 0, 0, 10)), std::invalid_argument);
+}
+
+TEST(TestReferenceLine, ChainedGeometriesAreContinuous) {
+  ReferenceLine line{5, -3, pi / 4};
+  line.addLine(10)
+      .addSpiral(20, 0, 0.05)
+      .addArc(15, 0.05)
+      .addSpiral(20, 0.05, -0.02)
+      .addPoly3(12, 0, 0, 0.01, -0.0004)
+      .addParamPoly3(25, {0, 20, 0, 0}, {0, 0, 3, -1}, true);
+  ASSERT_EQ(line.geometries().size(), 6u);
+  EXPECT_DOUBLE_EQ(line.length(), 102);
+  EXPECT_DOUBLE_EQ(line.end(), 102);
+  EXPECT_DOUBLE_EQ(line.geometries()[0].x, 5);
+  EXPECT_DOUBLE_EQ(line.geometries()[0].heading, pi / 4);
+  for (std::size_t i = 1; i < line.geometries().size(); ++i) {
+    const ReferenceLine::Geometry& geometry = line.geometries()[i];
+    const ReferenceLine::Point end = line.point(geometry.s - 1e-12);
+    EXPECT_NEAR(end.x, geometry.x, 1e-9) << i;
+    EXPECT_NEAR(end.y, geometry.y, 1e-9) << i;
+    EXPECT_NEAR(end.heading, geometry.heading, 1e-9) << i;
+  }
+}
+
+TEST(TestReferenceLine, SetOrigin) {
+  ReferenceLine line;
+  line.addLine(10).addArc(5 * pi, 0.1);
+  const ReferenceLine::Point end = line.point(line.end());
+  EXPECT_NEAR(end.x, 20, 1e-12);
+  EXPECT_NEAR(end.y, 10, 1e-12);
+  // Rotate the line by 90 degrees around its new origin
+  line.setOrigin(1, 2, pi / 2);
+  const ReferenceLine::Point moved = line.point(line.end());
+  EXPECT_NEAR(moved.x, 1 - 10, 1e-12);
+  EXPECT_NEAR(moved.y, 2 + 20, 1e-12);
+  EXPECT_NEAR(moved.heading, pi, 1e-12);
+  EXPECT_DOUBLE_EQ(line.origin_x(), 1);
+  EXPECT_DOUBLE_EQ(line.origin_y(), 2);
+  EXPECT_DOUBLE_EQ(line.origin_heading(), pi / 2);
+  line.addLine(3);
+  EXPECT_NEAR(line.point(line.end()).x, 1 - 13, 1e-12);
+}
+
+TEST(TestReferenceLine, BatchMatchesPoint) {
+  ReferenceLine line{0, 0, 0.3};
+  line.addLine(10)
+      .addSpiral(20, 0, 0.05)
+      .addArc(15, 0.05)
+      .addPoly3(12, 0.1, 0, 0.01, -0.0004)
+      .addParamPoly3(25, {0, 1, 0, 0}, {0, 0, 0.01, 0}, false);
+  // Unsorted arc lengths, some outside the line, still evaluate like the single point ones
+  std::vector<double> s;
+  for (int i = -20; i < 1000; ++i) s.push_back(std::fmod(37.3 * i, 100.0));
+  const ReferenceLine::Samples samples = line.sample(s);
+  ASSERT_EQ(samples.size(), s.size());
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    const ReferenceLine::Point point = line.point(s[i]);
+    EXPECT_DOUBLE_EQ(samples.s[i], s[i]);
+    EXPECT_NEAR(samples.x[i], point.x, 1e-12) << s[i];
+    EXPECT_NEAR(samples.y[i], point.y, 1e-12) << s[i];
+    EXPECT_NEAR(samples.heading[i], point.heading, 1e-12) << s[i];
+    EXPECT_NEAR(samples.curvature[i], point.curvature, 1e-12) << s[i];
+  }
+}
+
+TEST(TestReferenceLine, SampleUniform) {
+  ReferenceLine line;
+  line.addLine(10).addArc(10.5, 0.1);
+  const ReferenceLine::Samples samples = line.sampleUniform(2);
+  ASSERT_EQ(samples.size(), 12u);
+  EXPECT_DOUBLE_EQ(samples.s.front(), 0);
+  EXPECT_DOUBLE_EQ(samples.s[5], 10);
+  EXPECT_DOUBLE_EQ(samples.s.back(), 20.5);
+  EXPECT_DOUBLE_EQ(samples.curvature[4], 0);
+  EXPECT_DOUBLE_EQ(samples.curvature[6], 0.1);
+  EXPECT_NEAR(samples.x.back(), line.point(20.5).x, 1e-12);
+  EXPECT_THROW(line.sampleUniform(0), std::invalid_argument);
+}
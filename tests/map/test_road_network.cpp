@@ -0,0 +1,225 @@
+/**
+ * @file test_road_network.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the OpenDRIVE road network
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/map/road_network.h"
+#include "symaware/util/constants.h"
+
+using symaware::pi;
+using symaware::ReferenceLine;
+using symaware::RoadNetwork;
+
+namespace {
+
+std::string dataFile(const std::string& name) { return std::string{SYMAWARE_TEST_DATA_DIR} + "/" + name; }
+
+bool contains(const std::vector<std::size_t>& nodes, const std::size_t node) {
+  return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+
+}  // namespace
+
+class TestRoadNetwork : public ::testing::Test {
+ protected:
+  RoadNetwork network_;
+};
+
+TEST_F(TestRoadNetwork, ParseStraight) {
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  ASSERT_EQ(network_.roads().size(), 2u);
+  const RoadNetwork::Road& first = network_.roads()[0];
+  EXPECT_EQ(first.id, "1");
+  EXPECT_EQ(first.name, "First");
+  EXPECT_DOUBLE_EQ(first.length, 100);
+  EXPECT_EQ(first.junction, "-1");
+  EXPECT_EQ(first.predecessor.element_type, RoadNetwork::Link::ElementType::None);
+  EXPECT_EQ(first.successor.element_type, RoadNetwork::Link::ElementType::Road);
+  EXPECT_EQ(first.successor.element_id, "2");
+  EXPECT_EQ(first.successor.contact_point, RoadNetwork::ContactPoint::Start);
+  ASSERT_EQ(first.sections.size(), 2u);
+  EXPECT_DOUBLE_EQ(first.sections[0].s_end, 50);
+  EXPECT_DOUBLE_EQ(first.sections[1].s_end, 100);
+  ASSERT_EQ(first.sections[1].right.size(), 2u);
+  EXPECT_EQ(first.sections[1].right[0].id, -1);
+  EXPECT_EQ(first.sections[1].right[1].id, -2);
+  EXPECT_EQ(first.sections[1].lane(-2)->type, "driving");
+  EXPECT_EQ(first.sections[1].lane(-3), nullptr);
+  EXPECT_DOUBLE_EQ(first.elevation(10), 1.1);
+  EXPECT_EQ(network_.lanes().size(), 2u + 3u + 3u);
+}
+
+TEST_F(TestRoadNetwork, LaneBoundaries) {
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  const auto [inner, outer] = network_.laneBoundaries(0, 1, -2, 75);
+  EXPECT_DOUBLE_EQ(inner, -3.5);
+  EXPECT_DOUBLE_EQ(outer, -3.5 - 0.14 * 25);
+  // The second road is shifted to the left by its lane offset
+  const auto [inner_left, outer_left] = network_.laneBoundaries(1, 0, 1, 10);
+  EXPECT_DOUBLE_EQ(inner_left, 1);
+  EXPECT_DOUBLE_EQ(outer_left, 4.5);
+  EXPECT_THROW(network_.laneBoundaries(1, 0, 3, 10), std::out_of_range);
+}
+
+TEST_F(TestRoadNetwork, LaneGraph) {
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  const std::size_t right_0 = network_.laneNode(0, 0, -1), right_1 = network_.laneNode(0, 1, -1);
+  const std::size_t right_next = network_.laneNode(1, 0, -1);
+  const std::size_t left_0 = network_.laneNode(0, 0, 1), left_1 = network_.laneNode(0, 1, 1);
+  const std::size_t left_next = network_.laneNode(1, 0, 1);
+  ASSERT_NE(right_0, RoadNetwork::npos);
+  EXPECT_EQ(network_.laneNode(0, 0, -2), RoadNetwork::npos);
+  EXPECT_EQ(network_.laneNode(2, 0, -1), RoadNetwork::npos);
+
+  // Right lanes drive along the reference line, left lanes against it
+  EXPECT_EQ(network_.lanes()[right_0].successors, std::vector<std::size_t>{right_1});
+  EXPECT_EQ(network_.lanes()[right_1].successors, std::vector<std::size_t>{right_next});
+  EXPECT_EQ(network_.lanes()[right_next].predecessors, std::vector<std::size_t>{right_1});
+  EXPECT_EQ(network_.lanes()[left_next].successors, std::vector<std::size_t>{left_1});
+  EXPECT_EQ(network_.lanes()[left_1].successors, std::vector<std::size_t>{left_0});
+  EXPECT_TRUE(network_.lanes()[left_0].successors.empty());
+  EXPECT_TRUE(network_.lanes()[right_next].successors.empty());
+
+  // The new lane starts in the second section, from nowhere
+  const std::size_t outer = network_.laneNode(0, 1, -2);
+  EXPECT_TRUE(network_.lanes()[outer].predecessors.empty());
+  EXPECT_EQ(network_.lanes()[outer].successors, std::vector<std::size_t>{network_.laneNode(1, 0, -2)});
+
+  // Lane changes are only possible between lanes driving in the same direction
+  EXPECT_EQ(network_.lanes()[right_1].left, RoadNetwork::npos);
+  EXPECT_EQ(network_.lanes()[right_1].right, outer);
+  EXPECT_EQ(network_.lanes()[outer].left, right_1);
+  EXPECT_EQ(network_.lanes()[left_1].left, RoadNetwork::npos);
+  EXPECT_EQ(network_.lanes()[left_1].right, RoadNetwork::npos);
+}
+
+TEST_F(TestRoadNetwork, LocateStraight) {
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  const std::optional<RoadNetwork::LaneLocation> right = network_.locate(20.3, -1.2);
+  ASSERT_TRUE(right.has_value());
+  EXPECT_EQ(right->road, 0u);
+  EXPECT_EQ(right->section, 0u);
+  EXPECT_EQ(right->lane, -1);
+  EXPECT_NEAR(right->s, 20.3, 1e-9);
+  EXPECT_NEAR(right->t, -1.2, 1e-9);
+
+  const std::optional<RoadNetwork::LaneLocation> widening = network_.locate(90, -4);
+  ASSERT_TRUE(widening.has_value());
+  EXPECT_EQ(widening->section, 1u);
+  EXPECT_EQ(widening->lane, -2);
+
+  const std::optional<RoadNetwork::LaneLocation> shifted = network_.locate(120, 4);
+  ASSERT_TRUE(shifted.has_value());
+  EXPECT_EQ(shifted->road, 1u);
+  EXPECT_EQ(shifted->lane, 1);
+  EXPECT_NEAR(shifted->s, 20, 1e-9);
+
+  EXPECT_FALSE(network_.locate(20, 5).has_value());
+  EXPECT_FALSE(network_.locate(-1, 0).has_value());
+  EXPECT_FALSE(network_.locate(1000, 1000).has_value());
+}
+
+TEST_F(TestRoadNetwork, CurvesAreContinuous) {
+  network_.importOpenDriveFile(dataFile("curves.xodr"));
+  const ReferenceLine& line = network_.roads().front().reference_line;
+  ASSERT_EQ(line.geometries().size(), 6u);
+  // Each geometry of the file starts where the previous one ends
+  for (std::size_t i = 1; i < line.geometries().size(); ++i) {
+    const ReferenceLine::Geometry& geometry = line.geometries()[i];
+    const ReferenceLine::Point end = line.point(geometry.s - 1e-12);
+    EXPECT_NEAR(end.x, geometry.x, 1e-8) << i;
+    EXPECT_NEAR(end.y, geometry.y, 1e-8) << i;
+    EXPECT_NEAR(end.heading, geometry.heading, 1e-8) << i;
+  }
+  const ReferenceLine::Point end = line.point(line.end());
+  EXPECT_NEAR(end.x, 8.708838189097703, 1e-8);
+  EXPECT_NEAR(end.y, 81.43209229453643, 1e-8);
+  EXPECT_NEAR(end.heading, 2.1396473396144517, 1e-8);
+}
+
+TEST_F(TestRoadNetwork, LocateCurves) {
+  network_.importOpenDriveFile(dataFile("curves.xodr"));
+  const ReferenceLine& line = network_.roads().front().reference_line;
+  for (double s = 0.5; s < line.end(); s += 3.7) {
+    const ReferenceLine::Point point = line.point(s);
+    const double t = -1.7;
+    const std::optional<RoadNetwork::LaneLocation> location =
+        network_.locate(point.x - t * std::sin(point.heading), point.y + t * std::cos(point.heading));
+    ASSERT_TRUE(location.has_value()) << s;
+    EXPECT_EQ(location->lane, -1);
+    EXPECT_NEAR(location->s, s, 1e-8);
+    EXPECT_NEAR(location->t, t, 1e-8);
+  }
+}
+
+TEST_F(TestRoadNetwork, Junction) {
+  network_.importOpenDriveFile(dataFile("junction.xodr"));
+  ASSERT_EQ(network_.junctions().size(), 1u);
+  EXPECT_EQ(network_.junctions()[0].connections.size(), 2u);
+  const std::size_t west = network_.laneNode(network_.roadIndex("1"), 0, -1);
+  const std::size_t straight = network_.laneNode(network_.roadIndex("10"), 0, -1);
+  const std::size_t turn = network_.laneNode(network_.roadIndex("11"), 0, -1);
+  const std::size_t east = network_.laneNode(network_.roadIndex("2"), 0, -1);
+  const std::size_t north = network_.laneNode(network_.roadIndex("3"), 0, -1);
+  EXPECT_EQ(network_.roads()[network_.roadIndex("11")].junction, "100");
+
+  const std::vector<std::size_t>& successors = network_.lanes()[west].successors;
+  EXPECT_EQ(successors.size(), 2u);
+  EXPECT_TRUE(contains(successors, straight));
+  EXPECT_TRUE(contains(successors, turn));
+  EXPECT_EQ(network_.lanes()[straight].successors, std::vector<std::size_t>{east});
+  EXPECT_EQ(network_.lanes()[turn].successors, std::vector<std::size_t>{north});
+  EXPECT_EQ(network_.lanes()[north].predecessors, std::vector<std::size_t>{turn});
+  EXPECT_TRUE(network_.lanes()[network_.laneNode(network_.roadIndex("2"), 0, 1)].successors.empty());
+}
+
+TEST_F(TestRoadNetwork, LocateJunction) {
+  network_.importOpenDriveFile(dataFile("junction.xodr"));
+  // At the entrance of the junction, the two connecting roads overlap
+  EXPECT_EQ(network_.locateAll(0.5, -1.75).size(), 2u);
+  // The left turn is an arc centred in (0, 10), and its right lane is on the outside
+  const std::optional<RoadNetwork::LaneLocation> turn =
+      network_.locate(11.75 * std::sin(pi / 4), 10 - 11.75 * std::cos(pi / 4));
+  ASSERT_TRUE(turn.has_value());
+  EXPECT_EQ(turn->road, network_.roadIndex("11"));
+  EXPECT_NEAR(turn->s, 10 * pi / 4, 1e-8);
+  EXPECT_NEAR(turn->t, -1.75, 1e-8);
+}
+
+TEST_F(TestRoadNetwork, MultipleFiles) {
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  EXPECT_THROW(network_.importOpenDriveFile(dataFile("straight.xodr")), std::runtime_error);
+  EXPECT_EQ(network_.roads().size(), 2u);
+  network_.clear();
+  EXPECT_TRUE(network_.roads().empty());
+  EXPECT_FALSE(network_.locate(20, -1).has_value());
+  network_.importOpenDriveFile(dataFile("straight.xodr"));
+  EXPECT_TRUE(network_.locate(20, -1).has_value());
+}
+
+TEST_F(TestRoadNetwork, InvalidDocuments) {
+  EXPECT_THROW(network_.importOpenDriveFile(dataFile("missing.xodr")), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive("<root/>"), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive(R"(<OpenDRIVE><road id="1"/></OpenDRIVE>)"), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive(R"(<OpenDRIVE><road id="1" length="x"/></OpenDRIVE>)"), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive(R"(<OpenDRIVE><road id="1" length="1,5"/></OpenDRIVE>)"), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive(R"(<OpenDRIVE><road id="1" length="+-1"/></OpenDRIVE>)"), std::runtime_error);
+  EXPECT_THROW(network_.importOpenDrive(R"(<OpenDRIVE><road id="1" length="1"/></OpenDRIVE>)"), std::runtime_error);
+  EXPECT_TRUE(network_.roads().empty());
+}
+
+TEST(TestRoadNetworkSetup, InvalidSetup) {
+  EXPECT_THROW(RoadNetwork(0), std::invalid_argument);
+  EXPECT_THROW(RoadNetwork(1, -1), std::invalid_argument);
+}
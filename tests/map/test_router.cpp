@@ -0,0 +1,157 @@
+/**
+ * @file test_router.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the routing over road networks
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/map/road_network.h"
+#include "symaware/map/router.h"
+
+using symaware::RoadNetwork;
+using symaware::Router;
+
+namespace {
+
+std::string dataFile(const std::string& name) { return std::string{SYMAWARE_TEST_DATA_DIR} + "/" + name; }
+
+RoadNetwork makeNetwork(const std::string& name) {
+  RoadNetwork network;
+  network.importOpenDriveFile(dataFile(name));
+  return network;
+}
+
+/** Check that consecutive waypoints are at most @p step apart on the plane */
+void expectDense(const Router::Route& route, const double step) {
+  for (std::size_t i = 1; i < route.waypoints.size(); ++i) {
+    const Router::Waypoint& a = route.waypoints[i - 1];
+    const Router::Waypoint& b = route.waypoints[i];
+    EXPECT_LE(std::hypot(b.x - a.x, b.y - a.y), step + 1e-9) << i;
+  }
+}
+
+}  // namespace
+
+TEST(TestRouter, SameLane) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  Router router{network, 20, 20, 2};
+  const std::optional<Router::Route> route = router.route(10, -1.75, 40, -1.75);
+  ASSERT_TRUE(route.has_value());
+  EXPECT_EQ(route->lanes.size(), 1u);
+  EXPECT_EQ(route->lane_changes, 0u);
+  EXPECT_NEAR(route->length, std::hypot(30, 0.3), 1e-9);
+  EXPECT_NEAR(route->waypoints.front().x, 10, 1e-9);
+  EXPECT_NEAR(route->waypoints.front().y, -1.75, 1e-9);
+  EXPECT_NEAR(route->waypoints.back().x, 40, 1e-9);
+  // Elevation profile of the road
+  EXPECT_NEAR(route->waypoints.back().z, 1.4, 1e-9);
+  expectDense(*route, 2);
+}
+
+TEST(TestRouter, AcrossRoads) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  Router router{network};
+  // From the first road to the second one, whose lanes are shifted by the lane offset
+  const std::optional<Router::Route> route = router.route(10, -1.75, 120, -0.75);
+  ASSERT_TRUE(route.has_value());
+  EXPECT_EQ(route->lanes.size(), 3u);
+  EXPECT_EQ(route->lane_changes, 0u);
+  EXPECT_NEAR(route->waypoints.back().x, 120, 1e-9);
+  EXPECT_NEAR(route->waypoints.back().y, -0.75, 1e-9);
+  EXPECT_GT(route->length, 110);
+  expectDense(*route, 2);
+
+  // Lanes on the left drive the other way
+  const std::optional<Router::Route> back = router.route(120, 2.75 + 1, 10, 1.75);
+  ASSERT_TRUE(back.has_value());
+  EXPECT_NEAR(back->waypoints.back().x, 10, 1e-9);
+  EXPECT_FALSE(router.route(10, 1.75, 120, 2.75 + 1).has_value());
+}
+
+TEST(TestRouter, LaneChange) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  Router router{network, 20, 10, 2};
+  const std::optional<RoadNetwork::LaneLocation> from = network.locate(60, -1.75);
+  const std::optional<RoadNetwork::LaneLocation> to = network.locate(95, -5);
+  ASSERT_TRUE(from.has_value() && to.has_value());
+  ASSERT_EQ(to->lane, -2);
+  const std::optional<Router::Route> route = router.route(*from, *to);
+  ASSERT_TRUE(route.has_value());
+  ASSERT_EQ(route->lanes.size(), 2u);
+  EXPECT_EQ(route->lane_changes, 1u);
+  EXPECT_EQ(route->lanes.front(), from->node);
+  EXPECT_EQ(route->lanes.back(), to->node);
+  // The lane change is spread over the lane change length, measured along the centre of the widening lane
+  ASSERT_GE(route->waypoints.size(), 2u);
+  EXPECT_NEAR(route->waypoints[1].x, 70, 0.05);
+  expectDense(*route, std::hypot(10, 3.5 + 2));
+}
+
+TEST(TestRouter, Junction) {
+  const RoadNetwork network = makeNetwork("junction.xodr");
+  Router router{network};
+  const std::optional<Router::Route> left = router.route(-40, -1.75, 11.75, 30);
+  ASSERT_TRUE(left.has_value());
+  EXPECT_EQ(network.lanes()[left->lanes[1]].road, network.roadIndex("11"));
+  EXPECT_NEAR(left->waypoints.back().x, 11.75, 1e-9);
+  EXPECT_NEAR(left->waypoints.back().y, 30, 1e-9);
+
+  const std::optional<Router::Route> straight = router.route(-40, -1.75, 30, -1.75);
+  ASSERT_TRUE(straight.has_value());
+  EXPECT_EQ(network.lanes()[straight->lanes[1]].road, network.roadIndex("10"));
+  EXPECT_NEAR(straight->length, 70, 1e-9);
+}
+
+TEST(TestRouter, Unreachable) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  Router router{network};
+  // Behind the start, with no way back
+  EXPECT_FALSE(router.route(40, -1.75, 10, -1.75).has_value());
+  // Not on a driving lane
+  EXPECT_FALSE(router.route(10, -1.75, 120, -6).has_value());
+  // Not on the network
+  EXPECT_FALSE(router.route(10, -1.75, 1000, 1000).has_value());
+}
+
+TEST(TestRouter, Cache) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  Router router{network, 20, 20, 2, 2};
+  ASSERT_TRUE(router.route(10, -1.75, 120, -0.75).has_value());
+  EXPECT_EQ(router.cache_misses(), 1u);
+  // Same lanes, different points
+  const std::optional<Router::Route> route = router.route(12, -1.5, 125, -0.75);
+  ASSERT_TRUE(route.has_value());
+  EXPECT_EQ(router.cache_hits(), 1u);
+  EXPECT_NEAR(route->waypoints.front().x, 12, 1e-9);
+  EXPECT_NEAR(route->waypoints.back().x, 125, 1e-9);
+
+  // Unreachable destinations are cached as well
+  EXPECT_FALSE(router.route(40, -1.75, 10, -1.75).has_value());
+  EXPECT_FALSE(router.route(40, -1.75, 10, -1.75).has_value());
+  EXPECT_EQ(router.cache_hits(), 2u);
+  EXPECT_EQ(router.cache_size(), 2u);
+
+  // The least recently used entry is evicted
+  ASSERT_TRUE(router.route(10, -1.75, 40, -1.75).has_value());
+  EXPECT_EQ(router.cache_size(), 2u);
+  ASSERT_TRUE(router.route(10, -1.75, 120, -0.75).has_value());
+  EXPECT_EQ(router.cache_misses(), 4u);
+
+  router.clearCache();
+  EXPECT_EQ(router.cache_size(), 0u);
+}
+
+TEST(TestRouter, InvalidArguments) {
+  const RoadNetwork network = makeNetwork("straight.xodr");
+  EXPECT_THROW(Router(network, -1), std::invalid_argument);
+  EXPECT_THROW(Router(network, 20, -1), std::invalid_argument);
+  EXPECT_THROW(Router(network, 20, 20, 0), std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file test_spatial_hash.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the spatial hash over points in the plane
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "symaware/map/spatial_hash.h"
+
+using symaware::SpatialHash;
+
+namespace {
+
+class TestSpatialHash : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::mt19937 generator{42};
+    // Clustered points around the origin and sparse points far away
+    std::normal_distribution<double> cluster{0, 30};
+    std::uniform_real_distribution<double> sparse{-5000, 5000};
+    for (int i = 0; i < 500; ++i) {
+      x_.push_back(i % 10 == 0 ? sparse(generator) : cluster(generator));
+      y_.push_back(i % 10 == 0 ? sparse(generator) : cluster(generator));
+    }
+    hash_.build(x_, y_);
+  }
+
+  double squaredDistance(const std::size_t i, const double x, const double y) const {
+    return (x_[i] - x) * (x_[i] - x) + (y_[i] - y) * (y_[i] - y);
+  }
+
+  /** Indices of all the points sorted by distance from (@p x, @p y), computed by brute force */
+  std::vector<std::size_t> sortedByDistance(const double x, const double y) const {
+    std::vector<std::pair<double, std::size_t>> points;
+    for (std::size_t i = 0; i < x_.size(); ++i) points.emplace_back(squaredDistance(i, x, y), i);
+    std::sort(points.begin(), points.end());
+    std::vector<std::size_t> indices;
+    for (const auto& [distance, index] : points) indices.push_back(index);
+    return indices;
+  }
+
+  std::vector<double> x_, y_;
+  SpatialHash hash_{8};
+};
+
+}  // namespace
+
+TEST_F(TestSpatialHash, Size) {
+  EXPECT_EQ(hash_.size(), 500u);
+  EXPECT_FALSE(hash_.empty());
+  hash_.clear();
+  EXPECT_TRUE(hash_.empty());
+  EXPECT_TRUE(hash_.queryRadius(0, 0, 100).empty());
+  EXPECT_TRUE(hash_.queryNearest(0, 0, 3).empty());
+  EXPECT_TRUE(hash_.queryPairs(100).empty());
+}
+
+TEST_F(TestSpatialHash, QueryRadius) {
+  for (const double radius : {0.0, 5.0, 20.0, 100.0, 20000.0}) {
+    for (const auto& [x, y] : {std::pair{0.0, 0.0}, std::pair{17.5, -3.2}, std::pair{-4000.0, 2500.0}}) {
+      std::vector<std::size_t> expected = sortedByDistance(x, y);
+      expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                    [&](const std::size_t i) { return squaredDistance(i, x, y) > radius * radius; }),
+                     expected.end());
+      EXPECT_EQ(hash_.queryRadius(x, y, radius), expected) << radius << " " << x << " " << y;
+    }
+  }
+}
+
+TEST_F(TestSpatialHash, QueryNearest) {
+  for (const std::size_t k : {1u, 5u, 50u, 500u, 1000u}) {
+    for (const auto& [x, y] : {std::pair{0.0, 0.0}, std::pair{17.5, -3.2}, std::pair{-4000.0, 2500.0}}) {
+      std::vector<std::size_t> expected = sortedByDistance(x, y);
+      expected.resize(std::min(k, expected.size()));
+      EXPECT_EQ(hash_.queryNearest(x, y, k), expected) << k << " " << x << " " << y;
+    }
+  }
+  EXPECT_TRUE(hash_.queryNearest(0, 0, 0).empty());
+}
+
+TEST_F(TestSpatialHash, QueryPairs) {
+  for (const double distance : {0.5, 3.0, 10.0}) {
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t i = 0; i < x_.size(); ++i)
+      for (std::size_t j = i + 1; j < x_.size(); ++j)
+        if (squaredDistance(j, x_[i], y_[i]) <= distance * distance) expected.emplace_back(i, j);
+    EXPECT_EQ(hash_.queryPairs(distance), expected) << distance;
+  }
+}
+
+TEST_F(TestSpatialHash, Rebuild) {
+  hash_.build(std::vector<double>{1, 2}, std::vector<double>{1, 2});
+  EXPECT_EQ(hash_.size(), 2u);
+  EXPECT_EQ(hash_.queryNearest(0, 0, 5), (std::vector<std::size_t>{0, 1}));
+}
+
+TEST(TestSpatialHashInvalid, CellSize) { EXPECT_THROW(SpatialHash{0}, std::invalid_argument); }
+
+TEST(TestSpatialHashInvalid, NonFinite) {
+  SpatialHash hash;
+  EXPECT_THROW(hash.build(std::vector<double>{0, std::numeric_limits<double>::quiet_NaN()}, std::vector<double>{0, 0}),
+               std::runtime_error);
+  EXPECT_THROW(hash.build(std::vector<double>{0, 1}, std::vector<double>{0}), std::invalid_argument);
+}
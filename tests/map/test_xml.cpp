@@ -0,0 +1,59 @@
+/**
+ * @file test_xml.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the XML reader
+ */
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "symaware/map/xml.h"
+
+using symaware::parseXml;
+using symaware::XmlNode;
+
+TEST(TestXml, Elements) {
+  const XmlNode root = parseXml(R"(<?xml version="1.0"?>
+<!-- comment -->
+<root a="1" b='two'>
+  <child id="first"/>
+  <child id="second"><nested/></child>
+  <other />
+</root>
+)");
+  EXPECT_EQ(root.name, "root");
+  ASSERT_EQ(root.attributes.size(), 2u);
+  EXPECT_EQ(*root.attribute("a"), "1");
+  EXPECT_EQ(*root.attribute("b"), "two");
+  EXPECT_EQ(root.attribute("c"), nullptr);
+  ASSERT_EQ(root.children.size(), 3u);
+  EXPECT_EQ(*root.child("child")->attribute("id"), "first");
+  EXPECT_EQ(root.children[1].children.size(), 1u);
+  EXPECT_EQ(root.children[1].children[0].name, "nested");
+  EXPECT_NE(root.child("other"), nullptr);
+  EXPECT_EQ(root.child("missing"), nullptr);
+}
+
+TEST(TestXml, Text) {
+  const XmlNode root = parseXml("<root>a &lt;b&gt; &amp; &quot;c&quot; &#65;&#x42;<![CDATA[<raw & text>]]></root>");
+  EXPECT_EQ(root.text, "a <b> & \"c\" AB<raw & text>");
+}
+
+TEST(TestXml, AttributeEntities) {
+  const XmlNode root = parseXml(R"(<root value="&apos;x&apos; &#x20AC;"/>)");
+  EXPECT_EQ(*root.attribute("value"), "'x' \xE2\x82\xAC");
+}
+
+TEST(TestXml, Doctype) {
+  const XmlNode root = parseXml("<!DOCTYPE root><root/>");
+  EXPECT_EQ(root.name, "root");
+}
+
+TEST(TestXml, MismatchedTag) { EXPECT_THROW(parseXml("<root><child></root>"), std::runtime_error); }
+TEST(TestXml, Unterminated) { EXPECT_THROW(parseXml("<root><child/>"), std::runtime_error); }
+TEST(TestXml, UnknownEntity) { EXPECT_THROW(parseXml("<root>&unknown;</root>"), std::runtime_error); }
+TEST(TestXml, MissingQuote) { EXPECT_THROW(parseXml("<root a=1/>"), std::runtime_error); }
+TEST(TestXml, TrailingContent) { EXPECT_THROW(parseXml("<root/><root/>"), std::runtime_error); }
+TEST(TestXml, Empty) { EXPECT_THROW(parseXml(""), std::runtime_error); }
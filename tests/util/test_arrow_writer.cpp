@@ -0,0 +1,151 @@
+/**
+ * @file test_arrow_writer.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the Arrow IPC stream writer
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "symaware/util/arrow_writer.h"
+
+using symaware::ArrowColumn;
+using symaware::ArrowStreamWriter;
+using symaware::ArrowType;
+
+class TestArrowWriter : public ::testing::Test {
+ protected:
+  std::string filename_;
+
+  void SetUp() override {
+    // Each test has its own file, since ctest may run the tests in parallel processes
+    filename_ = ::testing::TempDir() + "test_arrow_writer_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".arrows";
+  }
+  void TearDown() override { std::remove(filename_.c_str()); }
+
+  std::vector<char> read() const {
+    std::ifstream file{filename_, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+  /** Walk the stream and return the size of the body of each message, checking the framing along the way */
+  static std::vector<std::int64_t> messages(const std::vector<char>& data, std::size_t& end) {
+    std::vector<std::int64_t> sizes;
+    std::size_t pos = 0;
+    while (pos + 8 <= data.size()) {
+      std::uint32_t continuation;
+      std::int32_t metadata_size;
+      std::memcpy(&continuation, data.data() + pos, sizeof(continuation));
+      std::memcpy(&metadata_size, data.data() + pos + 4, sizeof(metadata_size));
+      EXPECT_EQ(continuation, 0xFFFFFFFF);
+      EXPECT_EQ(metadata_size % 8, 0);
+      pos += 8;
+      if (metadata_size == 0) break;
+      // The body length is the last field of the Message table, but its position depends on the vtable
+      const char* const metadata = data.data() + pos;
+      std::uint32_t root;
+      std::int32_t vtable_offset;
+      std::uint16_t body_length_offset;
+      std::memcpy(&root, metadata, sizeof(root));
+      std::memcpy(&vtable_offset, metadata + root, sizeof(vtable_offset));
+      std::memcpy(&body_length_offset, metadata + root - vtable_offset + 4 + 2 * 3, sizeof(body_length_offset));
+      std::int64_t body_length;
+      std::memcpy(&body_length, metadata + root + body_length_offset, sizeof(body_length));
+      EXPECT_EQ(body_length % 8, 0);
+      sizes.push_back(body_length);
+      pos += metadata_size + body_length;
+    }
+    end = pos;
+    return sizes;
+  }
+};
+
+TEST_F(TestArrowWriter, ColumnPrimitive) {
+  ArrowColumn column{{"x", ArrowType::FLOAT64}};
+  column.append(1.5);
+  column.append(-2.0);
+  ASSERT_EQ(column.size(), 2u);
+  ASSERT_EQ(column.data().size(), 2 * sizeof(double));
+  double values[2];
+  std::memcpy(values, column.data().data(), sizeof(values));
+  EXPECT_EQ(values[0], 1.5);
+  EXPECT_EQ(values[1], -2.0);
+  EXPECT_TRUE(column.offsets().empty());
+}
+
+TEST_F(TestArrowWriter, ColumnUtf8) {
+  ArrowColumn column{{"name", ArrowType::UTF8}};
+  column.append(std::string{"car"});
+  column.append(std::string{""});
+  column.append(std::string{"truck"});
+  ASSERT_EQ(column.size(), 3u);
+  EXPECT_EQ(std::string(column.data().begin(), column.data().end()), "cartruck");
+  EXPECT_EQ(column.offsets(), (std::vector<std::int32_t>{0, 3, 3, 8}));
+}
+
+TEST_F(TestArrowWriter, ColumnClear) {
+  ArrowColumn column{{"name", ArrowType::UTF8}};
+  column.append(std::string{"car"});
+  column.clear();
+  EXPECT_EQ(column.size(), 0u);
+  EXPECT_TRUE(column.data().empty());
+  EXPECT_EQ(column.offsets(), (std::vector<std::int32_t>{0}));
+}
+
+TEST_F(TestArrowWriter, EmptyStream) {
+  { ArrowStreamWriter writer{filename_, {{"step", ArrowType::INT64}}}; }
+  const std::vector<char> data = read();
+  std::size_t end;
+  EXPECT_EQ(messages(data, end), (std::vector<std::int64_t>{0}));
+  EXPECT_EQ(end, data.size());
+}
+
+TEST_F(TestArrowWriter, RecordBatches) {
+  {
+    ArrowStreamWriter writer{filename_, {{"step", ArrowType::INT64}, {"entity", ArrowType::UTF8}}};
+    writer.column(0).append(std::int64_t{0});
+    writer.column(1).append(std::string{"car"});
+    writer.flush();
+    EXPECT_EQ(writer.num_rows(), 0u);
+    writer.flush();  // Nothing to write
+    writer.column(0).append(std::int64_t{1});
+    writer.column(1).append(std::string{"truck"});
+    writer.column(0).append(std::int64_t{2});
+    writer.column(1).append(std::string{"bike"});
+    EXPECT_EQ(writer.num_rows(), 2u);
+    writer.close();
+    EXPECT_EQ(writer.num_batches(), 2u);
+    EXPECT_FALSE(writer.is_open());
+  }
+  const std::vector<char> data = read();
+  std::size_t end;
+  // Schema, then two batches. Each body holds the int64 values, the utf8 offsets and the utf8 characters
+  EXPECT_EQ(messages(data, end), (std::vector<std::int64_t>{0, 8 + 8 + 8, 16 + 16 + 16}));
+  EXPECT_EQ(end, data.size());
+}
+
+TEST_F(TestArrowWriter, MismatchedColumns) {
+  {
+    ArrowStreamWriter writer{filename_, {{"step", ArrowType::INT64}, {"x", ArrowType::FLOAT64}}};
+    writer.column(0).append(std::int64_t{0});
+    EXPECT_THROW(writer.flush(), std::runtime_error);
+  }
+  // The destructor drops the partial row, but still ends the stream
+  const std::vector<char> data = read();
+  std::size_t end;
+  EXPECT_EQ(messages(data, end), (std::vector<std::int64_t>{0}));
+  EXPECT_EQ(end, data.size());
+}
+
+TEST_F(TestArrowWriter, InvalidFile) {
+  EXPECT_THROW((ArrowStreamWriter{"/non/existing/directory/file.arrows", {}}), std::runtime_error);
+}
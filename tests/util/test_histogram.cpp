@@ -0,0 +1,118 @@
+/**
+ * @file test_histogram.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the latency histogram and the phase profiler
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "symaware/util/histogram.h"
+#include "symaware/util/profiler.h"
+
+using symaware::LatencyHistogram;
+using symaware::PhaseProfile;
+using symaware::Profiler;
+using symaware::ProfilePhase;
+using symaware::ProfileStats;
+using symaware::ScopedTimer;
+
+TEST(TestHistogram, Empty) {
+  const LatencyHistogram histogram;
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.min(), 0u);
+  EXPECT_EQ(histogram.max(), 0u);
+  EXPECT_EQ(histogram.mean(), 0.0);
+  EXPECT_EQ(histogram.percentile(50), 0u);
+}
+
+TEST(TestHistogram, SmallValuesAreExact) {
+  LatencyHistogram histogram;
+  for (std::uint64_t i = 1; i <= LatencyHistogram::sub_buckets; i++) histogram.record(i);
+  EXPECT_EQ(histogram.count(), LatencyHistogram::sub_buckets);
+  EXPECT_EQ(histogram.min(), 1u);
+  EXPECT_EQ(histogram.max(), LatencyHistogram::sub_buckets);
+  EXPECT_EQ(histogram.percentile(50), LatencyHistogram::sub_buckets / 2);
+  EXPECT_EQ(histogram.percentile(100), LatencyHistogram::sub_buckets);
+}
+
+TEST(TestHistogram, BucketsAreContiguous) {
+  for (std::size_t i = 0; i + 1 < LatencyHistogram::num_buckets; i++) {
+    const std::uint64_t upper_bound = LatencyHistogram::bucketUpperBound(i);
+    ASSERT_EQ(LatencyHistogram::bucketIndex(upper_bound), i);
+    ASSERT_EQ(LatencyHistogram::bucketIndex(upper_bound + 1), i + 1);
+  }
+}
+
+TEST(TestHistogram, RelativeError) {
+  LatencyHistogram histogram;
+  for (std::uint64_t i = 1; i <= 100000; i++) histogram.record(i * 1000);
+  const double tolerance = 1.0 / LatencyHistogram::sub_buckets;
+  EXPECT_NEAR(static_cast<double>(histogram.percentile(50)), 50000000.0, 50000000.0 * tolerance);
+  EXPECT_NEAR(static_cast<double>(histogram.percentile(99)), 99000000.0, 99000000.0 * tolerance);
+  EXPECT_EQ(histogram.percentile(100), 100000000u);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 50000500.0);
+}
+
+TEST(TestHistogram, Merge) {
+  LatencyHistogram first, second;
+  first.record(10);
+  second.record(1000);
+  second.record(5);
+  first.merge(second);
+  EXPECT_EQ(first.count(), 3u);
+  EXPECT_EQ(first.min(), 5u);
+  EXPECT_EQ(first.max(), 1000u);
+  EXPECT_EQ(first.sum(), 1015u);
+}
+
+TEST(TestHistogram, InvalidPercentile) { EXPECT_THROW(LatencyHistogram{}.percentile(101), std::out_of_range); }
+
+TEST(TestProfiler, DisabledDoesNotRecord) {
+  Profiler::setEnabled(false);
+  PhaseProfile profile;
+  { ScopedTimer timer{profile, ProfilePhase::STEP}; }
+  EXPECT_EQ(profile.histogram(ProfilePhase::STEP), nullptr);
+}
+
+TEST(TestProfiler, EnabledRecords) {
+  Profiler::setEnabled(true);
+  PhaseProfile profile;
+  for (int i = 0; i < 10; i++) ScopedTimer timer{profile, ProfilePhase::STEP};
+  Profiler::setEnabled(false);
+  ASSERT_NE(profile.histogram(ProfilePhase::STEP), nullptr);
+  EXPECT_EQ(profile.histogram(ProfilePhase::STEP)->count(), 10u);
+  EXPECT_EQ(profile.histogram(ProfilePhase::INITIALISE), nullptr);
+}
+
+TEST(TestProfiler, Stats) {
+  PhaseProfile profile;
+  profile.record(ProfilePhase::STEP, 100);
+  profile.record(ProfilePhase::STEP, 300);
+  profile.record(ProfilePhase::UPDATE_STATE, 7);
+  std::vector<ProfileStats> stats;
+  symaware::appendProfileStats(stats, "car", "AIR_0", profile);
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[0].entity, "car");
+  EXPECT_EQ(stats[0].component, "AIR_0");
+  EXPECT_EQ(stats[0].phase, ProfilePhase::STEP);
+  EXPECT_EQ(stats[0].count, 2u);
+  EXPECT_EQ(stats[0].min, 100u);
+  EXPECT_EQ(stats[0].max, 300u);
+  EXPECT_DOUBLE_EQ(stats[0].mean, 200.0);
+  EXPECT_EQ(stats[1].phase, ProfilePhase::UPDATE_STATE);
+  EXPECT_EQ(stats[1].p50, 7u);
+}
+
+TEST(TestProfiler, CopyAndReset) {
+  PhaseProfile profile;
+  profile.record(ProfilePhase::STEP, 100);
+  const PhaseProfile copy{profile};
+  profile.reset();
+  EXPECT_EQ(profile.histogram(ProfilePhase::STEP), nullptr);
+  ASSERT_NE(copy.histogram(ProfilePhase::STEP), nullptr);
+  EXPECT_EQ(copy.histogram(ProfilePhase::STEP)->count(), 1u);
+}
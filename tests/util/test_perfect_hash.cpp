@@ -0,0 +1,64 @@
+/**
+ * @file test_perfect_hash.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the compile time perfect hash
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "symaware/util/perfect_hash.h"
+
+using symaware::PerfectHash;
+
+namespace {
+constexpr PerfectHash<5> colours{{"red", "green", "blue", "yellow", ""}};
+static_assert(colours.find("red") == 0);
+static_assert(colours.find("blue") == 2);
+static_assert(colours.find("") == 4);
+static_assert(colours.find("purple") == colours.npos);
+}  // namespace
+
+TEST(TestPerfectHash, FindKeys) {
+  for (std::size_t i = 0; i < colours.size(); ++i) EXPECT_EQ(colours.find(colours.keys()[i]), i);
+}
+
+TEST(TestPerfectHash, FindMissing) {
+  EXPECT_EQ(colours.find("Red"), colours.npos);
+  EXPECT_EQ(colours.find("re"), colours.npos);
+  EXPECT_EQ(colours.find("reds"), colours.npos);
+}
+
+TEST(TestPerfectHash, Empty) {
+  constexpr PerfectHash<0> empty{{}};
+  EXPECT_EQ(empty.find(""), empty.npos);
+  EXPECT_EQ(empty.find("red"), empty.npos);
+}
+
+TEST(TestPerfectHash, SingleKey) {
+  constexpr PerfectHash<1> single{{"red"}};
+  EXPECT_EQ(single.find("red"), 0u);
+  EXPECT_EQ(single.find("green"), single.npos);
+}
+
+TEST(TestPerfectHash, ManyKeys) {
+  std::vector<std::string> storage;
+  for (int i = 0; i < 500; ++i) storage.push_back("key_" + std::to_string(i));
+  std::array<std::string_view, 500> keys{};
+  for (std::size_t i = 0; i < keys.size(); ++i) keys[i] = storage[i];
+  const PerfectHash<500> hash{keys};
+  for (std::size_t i = 0; i < keys.size(); ++i) EXPECT_EQ(hash.find(keys[i]), i);
+  EXPECT_EQ(hash.find("key_500"), hash.npos);
+}
+
+TEST(TestPerfectHash, DuplicateKeys) {
+  const std::array<std::string_view, 3> keys{"red", "green", "red"};
+  EXPECT_THROW(PerfectHash<3>{keys}, std::logic_error);
+}
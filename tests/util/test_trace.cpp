@@ -0,0 +1,93 @@
+/**
+ * @file test_trace.cpp
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024
+ * @licence Apache-2.0 license
+ * @brief Test the Trace Event recorder
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "symaware/util/trace.h"
+
+using symaware::Tracer;
+
+class TestTrace : public ::testing::Test {
+ protected:
+  std::string filename_;
+
+  void SetUp() override {
+    // Each test has its own file, since ctest may run the tests in parallel processes
+    filename_ = ::testing::TempDir() + "test_trace_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json";
+    Tracer::setEnabled(false);
+    Tracer::clear();
+  }
+  void TearDown() override {
+    Tracer::setEnabled(false);
+    Tracer::clear();
+    std::remove(filename_.c_str());
+  }
+
+  std::string read() const {
+    Tracer::write(filename_);
+    std::ifstream file{filename_};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+  static std::size_t occurrences(const std::string& str, const std::string& pattern) {
+    std::size_t count = 0;
+    for (std::size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) count++;
+    return count;
+  }
+};
+
+TEST_F(TestTrace, Disabled) {
+  { SYMAWARE_TRACE_SCOPE("span"); }
+  EXPECT_EQ(read(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+}
+
+TEST_F(TestTrace, Enabled) {
+  Tracer::setEnabled(true);
+  {
+    SYMAWARE_TRACE_SCOPE("outer");
+    SYMAWARE_TRACE_SCOPE("inner");
+  }
+  const std::string trace = read();
+  EXPECT_EQ(occurrences(trace, "\"name\":\"outer\""), 1u);
+  EXPECT_EQ(occurrences(trace, "\"name\":\"inner\""), 1u);
+  EXPECT_EQ(occurrences(trace, "\"ph\":\"X\""), 2u);
+}
+
+TEST_F(TestTrace, EscapeName) {
+  Tracer::setEnabled(true);
+  { SYMAWARE_TRACE_SCOPE("a \"quoted\" span"); }
+  EXPECT_EQ(occurrences(read(), "\"name\":\"a \\\"quoted\\\" span\""), 1u);
+}
+
+TEST_F(TestTrace, ManyEventsManyThreads) {
+  constexpr std::size_t num_threads = 4;
+  constexpr std::size_t num_events = 10000;  // Spans multiple chunks
+  Tracer::setEnabled(true);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back([]() {
+      for (std::size_t j = 0; j < num_events; j++) SYMAWARE_TRACE_SCOPE("span");
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  EXPECT_EQ(occurrences(read(), "\"name\":\"span\""), num_threads * num_events);
+}
+
+TEST_F(TestTrace, Clear) {
+  Tracer::setEnabled(true);
+  { SYMAWARE_TRACE_SCOPE("span"); }
+  Tracer::setEnabled(false);
+  Tracer::clear();
+  EXPECT_EQ(occurrences(read(), "\"name\""), 0u);
+}